@@ -0,0 +1,74 @@
+#ifndef ADPCM_H
+#define ADPCM_H
+
+#include <Arduino.h>
+
+/**
+ * IMA ADPCM decoder. Clips are stored as a raw stream of 4-bit codes, low
+ * nibble first, starting from a zero predictor and step index. Four bits per
+ * sample keep a second of 16 kHz audio at 8 KB of flash.
+ */
+namespace Adpcm {
+
+struct State {
+    int16_t predictor;
+    int8_t index;
+};
+
+const int8_t indexTable[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+const int16_t stepTable[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767
+};
+
+/**
+ * Decodes one 4-bit code.
+ *
+ * @param state The decoder state, updated.
+ * @param code The code, in the low nibble.
+ * @return The decoded sample.
+ */
+inline int16_t decode(State &state, uint8_t code) {
+    int step = stepTable[state.index];
+    int diff = step >> 3;
+    if (code & 4) diff += step;
+    if (code & 2) diff += step >> 1;
+    if (code & 1) diff += step >> 2;
+
+    int predictor = state.predictor + ((code & 8) ? -diff : diff);
+    state.predictor = constrain(predictor, -32768, 32767);
+    state.index = constrain(state.index + indexTable[code & 0x0F], 0, 88);
+    return state.predictor;
+}
+
+/**
+ * Decodes a run of a clip and scales it by a volume. This is the stream the
+ * PDM modulator turns into pulse density, so the volume sets the duty.
+ *
+ * @param state The decoder state, carried over from the previous run.
+ * @param data The codes of the clip.
+ * @param position The index of the first sample to decode.
+ * @param count The number of samples.
+ * @param volume The volume, 0-255.
+ * @param out Receives the samples.
+ */
+inline void decodeScaled(State &state, const uint8_t *data, uint32_t position, uint32_t count, uint8_t volume, int16_t *out) {
+    for (uint32_t i = 0; i < count; i++, position++) {
+        uint8_t code = data[position >> 1];
+        if (position & 1) code >>= 4;
+        out[i] = (decode(state, code & 0x0F) * volume) >> 8;
+    }
+}
+
+}
+
+#endif
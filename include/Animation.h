@@ -2,26 +2,26 @@
 #define ANIMATION_H
 
 #include <U8g2lib.h>
+#include "AssetPack.h"
 #include HW_CONFIG
 
-#define DEFAULT_FRAME_WIDTH 64
-#define DEFAULT_FRAME_HEIGHT 64
 #define DEFAULT_FRAME_DELAY 42
-#define BITMAP_LENGTH 512
 
 
 class Animation
 {
 public:
     Animation(DisplayType *u8g2);
-    void start(const unsigned char frames[][BITMAP_LENGTH], int frameCount, bool loop = false, bool reverse = false, unsigned long durationMs = 0, int width = DEFAULT_FRAME_WIDTH, int height = DEFAULT_FRAME_HEIGHT);
+    void setAssets(const AssetPack *assets);
+    void start(AssetId id, int frameCount, bool loop = false, bool reverse = false, unsigned long durationMs = 0);
     void update();
     bool isRunning();
     void stop();
 
 private:
     DisplayType *u8g2;
-    const unsigned char (*animationFrames)[BITMAP_LENGTH];
+    const AssetPack *assets;
+    const Asset *animationFrames;
     int totalFrames;
     int currentFrame;
     int frameWidth;
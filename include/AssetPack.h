@@ -0,0 +1,96 @@
+#ifndef ASSET_PACK_H
+#define ASSET_PACK_H
+
+#include <Arduino.h>
+#include <esp_partition.h>
+
+#define ASSET_PARTITION_LABEL "assets"
+#define ASSET_PACK_MAGIC 0x54455341 // "ASET"
+#define ASSET_PACK_VERSION 1
+
+/**
+ * The assets the firmware knows about. tools/pack_assets.py reads this list to
+ * build the pack, taking each asset from assets/<name in lower case>.xbm, so
+ * new entries only go at the end.
+ */
+enum AssetId : uint16_t {
+    ASSET_PLAY_PAUSE,
+    ASSET_HOURGLASS,
+    ASSET_WATCH,
+    ASSET_GEARS,
+    ASSET_EYE,
+    ASSET_RING_ALARM,
+    ASSET_PULSE,
+    ASSET_WIFI,
+    ASSET_INFO,
+    ASSET_COUNT
+};
+
+/**
+ * Start of the pack, at offset 0 of the partition. All fields little endian.
+ */
+struct AssetPackHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count; // entries following the header
+    uint32_t size;  // bytes of the whole pack, header included
+    uint32_t crc;   // CRC32 of everything after the header
+};
+
+/**
+ * One entry of the table after the header. The frames of an asset are stored
+ * one after the other as XBM bitmaps.
+ */
+struct AssetEntry {
+    uint16_t id;
+    uint16_t frameCount;
+    uint16_t width;
+    uint16_t height;
+    uint32_t offset; // from the start of the pack
+    uint32_t length;
+};
+
+static_assert(sizeof(AssetPackHeader) == 16 && sizeof(AssetEntry) == 16, "pack layout is fixed");
+
+/**
+ * An asset as mapped in flash.
+ */
+struct Asset {
+    const uint8_t *data;
+    uint16_t frameCount;
+    uint16_t width;
+    uint16_t height;
+
+    const uint8_t *frame(int index) const {
+        return data + index * ((width + 7) / 8) * height;
+    }
+};
+
+/**
+ * Animations and icons kept on their own flash partition, so the art can be
+ * reflashed without the firmware and doesn't take room in the app image.
+ *
+ * begin() maps the pack into the address space with esp_partition_mmap and
+ * builds an index by AssetId. Frames are then drawn straight from the mapping
+ * through the flash cache, without copying them to RAM. A missing or corrupted
+ * pack leaves every asset missing, and the screens without art still work.
+ */
+class AssetPack {
+public:
+    AssetPack();
+
+    bool begin();
+    const Asset *get(AssetId id) const;
+
+    bool isLoaded() const {
+        return base != nullptr;
+    }
+
+private:
+    const esp_partition_t *partition;
+    esp_partition_mmap_handle_t mapping;
+    const uint8_t *base;
+    Asset index[ASSET_COUNT]; // frameCount 0 if the pack doesn't hold the asset
+};
+
+#endif
@@ -0,0 +1,128 @@
+#ifndef BOARD_TRAITS_H
+#define BOARD_TRAITS_H
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+
+enum BoardVariant {
+    BOARD_C3,
+    BOARD_H2
+};
+
+/**
+ * Compile-time description of a hardware variant: display, LED ring, pins and
+ * battery ADC calibration. Each variant specializes this template, and its
+ * config header selects it as `Board`. Adding a board is one more specialization.
+ *
+ * Large fixtures split their LEDs into segments, each driven by its own RMT
+ * channel so the segments are sent in parallel. The pixels of the segments
+ * follow each other in the order listed.
+ */
+template <BoardVariant V>
+struct BoardTraits;
+
+// Lolin C3 mini
+template <>
+struct BoardTraits<BOARD_C3> {
+    // OLED screen
+    using Display = U8G2_SSD1306_128X64_NONAME_F_HW_I2C;
+    static constexpr int displayWidth = 128;
+    static constexpr int displayHeight = 64;
+    static constexpr bool displayHwScroll = true; // SSD1306 supports horizontal scroll commands
+    static constexpr int sdaPin = 8;
+    static constexpr int sclPin = 9;
+
+    // LED strip, one RMT channel per segment
+    static constexpr int ledChannels = 1;
+    static constexpr int ledPins[ledChannels] = {21};
+    static constexpr int ledCounts[ledChannels] = {16};
+    static constexpr int numLeds = 16;
+
+    // Encoder
+    static constexpr int encoderPin1 = 4;
+    static constexpr int encoderPin2 = 3;
+
+    // Switch
+    static constexpr int switchPin = 2;
+
+    // Buzzer
+    static constexpr int buzzerPin = 1;
+
+    // Battery
+    static constexpr int batteryPin = 0;
+    static constexpr int batteryLowLevel = 1600;
+    static constexpr int batteryHighLevel = 2795;
+};
+
+// ESP32-H2 devkit
+template <>
+struct BoardTraits<BOARD_H2> {
+    // OLED screen
+    using Display = U8G2_SSD1306_128X32_UNIVISION_F_HW_I2C;
+    static constexpr int displayWidth = 128;
+    static constexpr int displayHeight = 32;
+    static constexpr bool displayHwScroll = true; // SSD1306 supports horizontal scroll commands
+    static constexpr int sdaPin = 3;
+    static constexpr int sclPin = 2;
+
+    // LED strip, one RMT channel per segment
+    static constexpr int ledChannels = 1;
+    static constexpr int ledPins[ledChannels] = {5};
+    static constexpr int ledCounts[ledChannels] = {24};
+    static constexpr int numLeds = 24;
+
+    // Encoder
+    static constexpr int encoderPin1 = 13;
+    static constexpr int encoderPin2 = 14;
+
+    // Switch
+    static constexpr int switchPin = 12;
+
+    // Buzzer
+    static constexpr int buzzerPin = 11;
+
+    // Battery
+    static constexpr int batteryPin = 4;
+    static constexpr int batteryLowLevel = 1600;
+    static constexpr int batteryHighLevel = 2100;
+};
+
+/**
+ * Sums the LED counts of the segments of a board, to check them against numLeds.
+ */
+template <typename B>
+constexpr int ledSegmentTotal() {
+    int total = 0;
+    for (int i = 0; i < B::ledChannels; i++)
+        total += B::ledCounts[i];
+    return total;
+}
+
+/**
+ * Screen layout derived from the display geometry of a board. Screens are drawn
+ * in a 32 px high band, centered vertically on taller panels, with the status
+ * icons on the right edge.
+ */
+template <typename B>
+struct ScreenLayout {
+    static constexpr int bandHeight = 32;
+    static constexpr int top = (B::displayHeight - bandHeight) / 2;
+    static constexpr int bufferSize = B::displayWidth * B::displayHeight / 8;
+
+    // Text lines
+    static constexpr int headBaseline = top + 12;
+    static constexpr int valueBaseline = top + 32;
+    static constexpr int textWidth = B::displayWidth - 22;
+
+    // Time screen
+    static constexpr int timeBaseline = top + 32;
+    static constexpr int tenthsX = 91;
+
+    // Status icons
+    static constexpr int soundIconX = B::displayWidth - 21;
+    static constexpr int soundIconBaseline = top + 21;
+    static constexpr int batteryX = B::displayWidth - 18;
+    static constexpr int batteryBaseline = top + 32;
+};
+
+#endif
@@ -4,6 +4,9 @@
 #include <U8g2lib.h>
 #include "SystemState.h"
 #include "Animation.h"
+#include "ScrollingText.h"
+#include "Settings.h"
+#include "SessionLog.h"
 #include HW_CONFIG
 
 class DisplayController {
@@ -24,9 +27,17 @@ public:
     void drawSettingsText(const char* headText, const char* valueText);
     void drawTimerSettingsCW(long int position);
     void drawTimerSettingsCCW(long int position);
+    void drawTimerSettingsAccel(long int position);
+    void drawTimerSettingsClick(long int position);
+    void drawVolumeSettings(long int position);
     void drawBatteryLevel();
     void drawInfo();
+    void drawStats(long int position);
+    void setSsid(const char* ssid);
+    void setStats(const SessionStats& stats);
+    static void onSettingChanged(void *context, const SettingsData &settings, SettingId id);
     void sleepScreen();
+    void flush();
 
     void setBrightness(int brightness){
         this->brightness = brightness;
@@ -42,6 +53,15 @@ public:
 
 private:
         DisplayType u8g2;
+        ScrollingText headLine;
+        ScrollingText valueLine;
+        uint8_t shadowBuffer[Layout::bufferSize];
+        bool shadowValid;
+        char ssid[EEPROM_SSID_SIZE + 1];
+        uint8_t soundLevel;
+        SessionStats stats;
+
+        void stopHardwareScroll();
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,36 @@
+#ifndef HEAP_GUARD_H
+#define HEAP_GUARD_H
+
+#include <Arduino.h>
+
+/**
+ * Debug check that a code path does not allocate. Enabled by RENDER_HEAP_GUARD,
+ * which also wraps malloc, calloc and realloc at link time so allocations made
+ * by the task that armed the guard are counted. Compiles to nothing otherwise.
+ */
+#ifdef RENDER_HEAP_GUARD
+
+#include <assert.h>
+
+namespace HeapGuard {
+void arm();
+uint32_t disarm();
+}
+
+#define HEAP_GUARD_BEGIN() HeapGuard::arm()
+// disarm() runs outside the assert so the guard is released under NDEBUG too
+#define HEAP_GUARD_END()                                                        \
+    do {                                                                        \
+        uint32_t heapGuardAllocations = HeapGuard::disarm();                    \
+        assert(heapGuardAllocations == 0 && "heap allocation in guarded path"); \
+        (void)heapGuardAllocations;                                             \
+    } while (0)
+
+#else
+
+#define HEAP_GUARD_BEGIN()
+#define HEAP_GUARD_END()
+
+#endif
+
+#endif
@@ -1,22 +1,77 @@
 #ifndef INPUT_CONTROLLER_H
 #define INPUT_CONTROLLER_H
 
-#include <ESP32RotaryEncoder.h>
-#include <Bounce2.h>
+#include <Arduino.h>
+#include <esp_timer.h>
+#include "SpscQueue.h"
+#include "Settings.h"
+
+#define INPUT_QUEUE_SIZE 64
+#define INPUT_DEBOUNCE_US 5000
+#define INPUT_STEPS_PER_DETENT 2
+#define INPUT_POSITION_MIN -1000
+#define INPUT_POSITION_MAX 1000
+#define INPUT_ACCEL_SLOW_MS 150 // detents further apart than this move one step
+#define INPUT_ACCEL_MAX_LEVEL 3
+#define INPUT_ACCEL_DEFAULT_LEVEL 2
+#define INPUT_MULTI_CLICK_MS 300 // default wait for a further click
+#define INPUT_MULTI_CLICK_MIN_MS 150
+#define INPUT_MULTI_CLICK_MAX_MS 600
+#define INPUT_MULTI_CLICK_STEP_MS 50 // per detent on the settings page
+#define INPUT_MAX_CLICKS 3
 
 enum InputAction {
     ROTARY_CCW_TICK,
     ROTARY_CW_TICK,
     BUTTON_SHORT_PRESS,
     BUTTON_LONG_PRESS,
+    BUTTON_DOUBLE_PRESS,
+    BUTTON_TRIPLE_PRESS,
+    BUTTON_PRESS_ROTATE_CW,  // turned while the button is held
+    BUTTON_PRESS_ROTATE_CCW,
     NO_ACTION
 };
 
+enum InputEventType : uint8_t {
+    INPUT_DETENT,
+    INPUT_PRESS,
+    INPUT_RELEASE
+};
+
+/**
+ * An input event as recorded by the interrupt handlers.
+ */
+struct InputEvent {
+    InputEventType type;
+    int8_t delta;    // +1 or -1 for a detent
+    uint32_t timeMs; // when the edge happened, not when it was read
+};
+
+/**
+ * Rotary encoder and push button read by GPIO interrupts. The handlers decode
+ * the quadrature signal and debounce the button, then push timestamped events
+ * into a lock-free queue. update() drains the queue once per loop, so no input
+ * is lost however long a frame takes, and the button timing comes from the
+ * edges rather than from when the loop got around to polling.
+ *
+ * All detents queued since the previous pass are folded into one position
+ * change. While `accelerate` is set, fast spins move more than one step per
+ * detent, following a curve on the time between detents.
+ *
+ * Clicks are grouped into double and triple presses when they follow each
+ * other within multiClickWindowMs, a user setting. A state that has no multi-click bindings
+ * leaves maxClicks at 1, and its short presses are reported on release with no
+ * wait. Turning while the button is held is a chord: with `chords` set, the
+ * detents are reported as BUTTON_PRESS_ROTATE_* instead of moving the position,
+ * and the release that ends the chord is not a click.
+ */
 class InputController {
 public:
     InputController(int pinEncoder1, int pinEncoder2, int pinButton);
-    void begin();
+    void begin(uint8_t accelerationLevel = INPUT_ACCEL_DEFAULT_LEVEL);
     void update();
+    void setAcceleration(uint8_t level);
+    static void onSettingChanged(void *context, const SettingsData &settings, SettingId id);
 
     long int getPosition();
     void setPosition(long int pos);
@@ -25,14 +80,54 @@ public:
     bool buttonHeld;
     unsigned long buttonPressStartTime;
 
-    RotaryEncoder encoder;
     int pinEncoder1;
     int pinEncoder2;
     int pinButton;
-    Bounce bounce = Bounce();
 
     InputAction lastAction = NO_ACTION;
 
+    uint8_t accelerationLevel; // 0 disables acceleration
+    bool accelerate;           // set by the states entering large values
+
+    // Gestures, set by the state controller for the current state
+    uint8_t maxClicks;         // 1 reports single clicks immediately
+    bool chords;
+    uint16_t multiClickWindowMs;
+    int chordSteps;            // detents of the BUTTON_PRESS_ROTATE_* action
+
+    // Metrics, written by the interrupt handlers
+    volatile uint32_t overflowCount;
+    volatile uint32_t quadratureErrors;
+    uint32_t detentsCoalesced;
+
+private:
+    static void IRAM_ATTR onEncoderEdge(void *context);
+    static void IRAM_ATTR onButtonEdge(void *context);
+    static void onButtonSettled(void *context);
+    void IRAM_ATTR push(InputEventType type, int8_t delta, uint32_t timeMs);
+    void applyDetent(const InputEvent &event);
+    long detentStep(const InputEvent &event);
+    void dispatchClicks();
+
+    SpscQueue<InputEvent, INPUT_QUEUE_SIZE> events;
+
+    // Interrupt handler state
+    uint8_t quadratureState;
+    int8_t stepCount;
+    bool buttonDown;
+    int64_t lastButtonEdge;
+    esp_timer_handle_t settleTimer; // re-reads the button once it stops bouncing
+    portMUX_TYPE buttonLock;
+
+    // Gesture state
+    uint8_t clickCount;
+    uint32_t lastReleaseMs;
+    bool chorded;
+
+    // Acceleration state
+    uint32_t lastDetentMs;
+    int8_t lastDetentDelta;
+    uint32_t detentInterval;
 };
 
-#endif
\ No newline at end of file
+#endif
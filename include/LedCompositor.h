@@ -0,0 +1,37 @@
+#ifndef LED_COMPOSITOR_H
+#define LED_COMPOSITOR_H
+
+#include <Arduino.h>
+#include "LedRingAnimations.h"
+#include HW_CONFIG
+
+/**
+ * Layered compositor for the LED ring. The state controller renders a base ring,
+ * and up to LEDRING_LAYER_COUNT effects are drawn over it in one pass, each with
+ * its own keyframe timeline and blend mode. Every layer has fixed storage, so
+ * composing costs at most LEDRING_LAYER_COUNT blends per LED and never allocates.
+ */
+class LedCompositor
+{
+public:
+    LedCompositor();
+
+    void start(const LedEffect &effect, const uint32_t *shown, unsigned long now);
+    void stop(LedLayer layer);
+    void stopAll();
+    bool isActive(LedLayer layer);
+    void compose(const uint32_t *base, uint32_t *output, unsigned long now);
+
+private:
+    struct Layer {
+        const LedEffect *effect;
+        unsigned long startTime;
+        uint32_t pixels[Board::numLeds];
+    };
+
+    static uint8_t opacityAt(const LedEffect &effect, unsigned long elapsed, bool &finished);
+
+    Layer layers[LEDRING_LAYER_COUNT];
+};
+
+#endif
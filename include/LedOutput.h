@@ -0,0 +1,52 @@
+#ifndef LED_OUTPUT_H
+#define LED_OUTPUT_H
+
+#include <Arduino.h>
+#include <driver/rmt_tx.h>
+#include HW_CONFIG
+
+// WS2812 timing with a 10 MHz RMT clock (0.1 us per tick)
+#define LED_RMT_RESOLUTION_HZ 10000000
+#define LED_T0H_TICKS 3
+#define LED_T0L_TICKS 9
+#define LED_T1H_TICKS 9
+#define LED_T1L_TICKS 3
+#define LED_RESET_US 300
+
+/**
+ * Non-blocking WS2812 output on the RMT peripheral. A frame is copied into an
+ * internal buffer and queued, and write() returns immediately while the RMT
+ * shifts the bits out. Interrupts stay enabled during the transfer, so the
+ * encoder and I2C are not held up the way a bit-banged show() holds them.
+ */
+class LedOutput
+{
+public:
+    typedef void (*DoneCallback)(void *context);
+
+    LedOutput();
+
+    bool begin(int pin, size_t frameLength);
+    bool write(const uint8_t *grb);
+    bool busy();
+    void setDoneCallback(DoneCallback callback, void *context);
+
+    unsigned long lastWriteMicros;
+    uint32_t framesSent;
+    uint32_t framesRejected;
+
+private:
+    static bool IRAM_ATTR onTransmitDone(rmt_channel_handle_t channel, const rmt_tx_done_event_data_t *event, void *context);
+
+    int pin;
+    size_t frameLength;
+    uint8_t *txBuffer;
+    rmt_channel_handle_t channel;
+    rmt_encoder_handle_t encoder;
+    DoneCallback doneCallback;
+    void *doneContext;
+    volatile bool inFlight;
+    volatile uint32_t doneTime; // low half of esp_timer_get_time(), a 64-bit read could tear
+};
+
+#endif
@@ -2,6 +2,7 @@
 #define LEDRINGANIMATIONS_H
 
 #include <Arduino.h>
+#include "PixelKernels.h"
 
 enum ledRingAnimation {
 
@@ -15,6 +16,87 @@ enum ledRingAnimation {
     LEDRING_MODE_SELECT,
     LEDRING_SETTINGS_LIMIT,
     LEDRING_PULSE_FLASH,
+    LEDRING_ANIMATION_COUNT
 };
 
-#endif
\ No newline at end of file
+// Layers drawn over the base ring rendered for the current state, bottom first
+enum LedLayer {
+    LAYER_TRANSITION,
+    LAYER_ALERT,
+    LAYER_FLASH,
+    LAYER_NOTIFY,
+    LEDRING_LAYER_COUNT
+};
+
+enum LayerSource {
+    SOURCE_SNAPSHOT, // the ring as it was shown when the effect started
+    SOURCE_COLOR     // a single color on every LED
+};
+
+enum BlendMode {
+    BLEND_NORMAL, // crossfade towards the layer by its opacity
+    BLEND_ADD     // add the layer scaled by its opacity, saturating
+};
+
+enum Easing {
+    EASE_LINEAR,
+    EASE_IN_OUT
+};
+
+/**
+ * Point of an opacity timeline. Opacity is interpolated between keyframes with
+ * the easing of the effect.
+ */
+struct Keyframe {
+    uint16_t timeMs;
+    uint8_t opacity;
+};
+
+/**
+ * Description of a ring effect. An effect is data: which layer it runs on, what
+ * the layer shows, how it is blended and how its opacity moves over time.
+ */
+struct LedEffect {
+    LedLayer layer;
+    LayerSource source;
+    uint32_t color;
+    BlendMode blend;
+    Easing easing;
+    bool loop;
+    const Keyframe *keys;
+    uint8_t keyCount;
+};
+
+// Keyframe timelines
+const Keyframe crossfadeKeys[] = {{0, 255}, {200, 0}};
+const Keyframe alarmPulseKeys[] = {{0, 0}, {1500, 255}, {3000, 0}};
+const Keyframe shortFlashKeys[] = {{0, 255}, {30, 255}, {120, 0}};
+
+// A timeline interpolates between neighbouring keyframes, so it needs two
+template <size_t N>
+constexpr uint8_t keyframeCount(const Keyframe (&)[N]) {
+    static_assert(N >= 2 && N <= 255, "a timeline holds 2 to 255 keyframes");
+    return N;
+}
+
+#define KEYFRAMES(keys) keys, keyframeCount(keys)
+
+// Effects, indexed by ledRingAnimation
+const LedEffect ledEffects[] = {
+    /* LEDRING_START_TIMER      */ {LAYER_TRANSITION, SOURCE_SNAPSHOT, 0, BLEND_NORMAL, EASE_IN_OUT, false, KEYFRAMES(crossfadeKeys)},
+    /* LEDRING_STOP_TIMER       */ {LAYER_TRANSITION, SOURCE_SNAPSHOT, 0, BLEND_NORMAL, EASE_IN_OUT, false, KEYFRAMES(crossfadeKeys)},
+    /* LEDRING_PAUSE_TIMER      */ {LAYER_TRANSITION, SOURCE_SNAPSHOT, 0, BLEND_NORMAL, EASE_IN_OUT, false, KEYFRAMES(crossfadeKeys)},
+    /* LEDRING_FINISHED_TIMER   */ {LAYER_ALERT, SOURCE_COLOR, PixelKernels::rgb(255, 255, 255), BLEND_NORMAL, EASE_IN_OUT, true, KEYFRAMES(alarmPulseKeys)},
+    /* LEDRING_STARTUP          */ {LAYER_TRANSITION, SOURCE_SNAPSHOT, 0, BLEND_NORMAL, EASE_IN_OUT, false, KEYFRAMES(crossfadeKeys)},
+    /* LEDRING_RETURN_MAIN_MENU */ {LAYER_TRANSITION, SOURCE_SNAPSHOT, 0, BLEND_NORMAL, EASE_IN_OUT, false, KEYFRAMES(crossfadeKeys)},
+    /* LEDRING_PREPARE_SLEEP    */ {LAYER_TRANSITION, SOURCE_SNAPSHOT, 0, BLEND_NORMAL, EASE_IN_OUT, false, KEYFRAMES(crossfadeKeys)},
+    /* LEDRING_MODE_SELECT      */ {LAYER_TRANSITION, SOURCE_SNAPSHOT, 0, BLEND_NORMAL, EASE_IN_OUT, false, KEYFRAMES(crossfadeKeys)},
+    /* LEDRING_SETTINGS_LIMIT   */ {LAYER_FLASH, SOURCE_COLOR, PixelKernels::rgb(255, 255, 255), BLEND_ADD, EASE_LINEAR, false, KEYFRAMES(shortFlashKeys)},
+    /* LEDRING_PULSE_FLASH      */ {LAYER_NOTIFY, SOURCE_COLOR, PixelKernels::rgb(255, 255, 255), BLEND_ADD, EASE_LINEAR, false, KEYFRAMES(shortFlashKeys)},
+};
+
+#undef KEYFRAMES
+
+static_assert(sizeof(ledEffects) / sizeof(ledEffects[0]) == LEDRING_ANIMATION_COUNT, "every ledRingAnimation needs an effect");
+
+#endif
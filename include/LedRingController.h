@@ -1,14 +1,23 @@
 #ifndef LEDRING_CONTROLLER_H
 #define LEDRING_CONTROLLER_H
 
-#include <Adafruit_NeoPixel.h>
 #include "SystemState.h"
+#include "LedOutput.h"
+#include "LedCompositor.h"
+#include <esp_timer.h>
 #include "LedRingAnimations.h"
+#include "PixelKernels.h"
+#include "Waveform.h"
+#include "Settings.h"
 #include HW_CONFIG
 
+#define LEDRING_FORCED_REFRESH_MS 1000 // resend an unchanged frame in case a glitch corrupted the ring
+#define LEDRING_METRICS_WINDOW_MS 1000
+#define LEDRING_SLEEP_FLUSH_MS 50 // longest wait for the last frame before sleep, in case the outputs are down
+
 class LedRingController {
 public:
-    LedRingController(int numLeds, int ledPin);
+    LedRingController();
 
     void begin(int brightness);
     void update(SystemState state, long int encoder, long int timer, long int initialTimer);
@@ -20,54 +29,71 @@ public:
     void LedRingModeSelect(long int encoder, uint8_t nModes);
     void LedRingSettingsSelect(long int encoder, uint8_t nMax, uint8_t nMin);
     void LedRingSleep();
-
-    void setBrightness(int brightness) {
-        this->brightness = brightness;
-        strip.setBrightness(brightness);
-    }
+    void setBrightness(int brightness);
+    void printMetrics(Print &out);
+    static void onSettingChanged(void *context, const SettingsData &settings, SettingId id);
 
     void LedringSingleColor(uint32_t color) {
-        for (int i = 0; i < numLeds; i++)
-            strip.setPixelColor(i, color);
-        strip.show();
+        singleColorRing(color, frame);
     }
 
-    int numLeds;
-    int ledPin;
+    static constexpr int numLeds = Board::numLeds;
+    static_assert(ledSegmentTotal<Board>() == Board::numLeds, "LED segments must add up to numLeds");
+    LedOutput outputs[Board::ledChannels];
     int brightness;
+    int32_t deltaTCw;
+    int32_t deltaTCcw;
 
-    bool animationRunning;
-    void startAnimation(ledRingAnimation animation, long int timer, long int initialTimer, long int encoder, int totalFrames);
-    void startAnimation(ledRingAnimation animation, int totalFrames);
-    
-    void updateAnimation();
-    void fadeBetweenStates(uint32_t* initialState, uint32_t* endState);
-    void pulseBetweenStates(uint32_t* initialState, uint32_t* endState);
-    void LedRingShortSinglePulse(uint32_t color);
-
-    ledRingAnimation animation;
+    void startAnimation(ledRingAnimation animation);
+    void stopAnimation(ledRingAnimation animation);
 
     int timeScale(long int encoder);
-    void invertRing(const uint32_t* ring, uint32_t* output, int arraySize);
-    void singleColorRingSelecting(long int timer, bool reversed, uint32_t color, uint32_t* output, int arraySize = NUM_LEDS);
-    void singleColorRingCounting(long int timer, long int initialTimer, bool reversed, uint32_t color, uint32_t* output, int arraySize = NUM_LEDS);
-    void singleColorRing(uint32_t color, uint32_t* output, int arraySize = NUM_LEDS);
-    
-    uint32_t blendColor(uint32_t c1, uint32_t c2, uint8_t t);
-    uint8_t beatsin8(float bpm, uint8_t low, uint8_t high);
+    void reverseRing(uint32_t* ring, int arraySize);
+    void singleColorRingSelecting(long int timer, bool reversed, uint32_t color, uint32_t* output, int arraySize = Board::numLeds);
+    void singleColorRingCounting(long int timer, long int initialTimer, bool reversed, uint32_t color, uint32_t* output, int arraySize = Board::numLeds);
+    void singleColorRing(uint32_t color, uint32_t* output, int arraySize = Board::numLeds);
 
-    int totalFrames;
-    int currentFrame;
-    int animationDuration;
-    int animationStartTime;
-    int lastFrameTime;
-    int frameDelay = 5;
+    // Metrics
+    uint16_t showsPerSecond;
+    uint32_t framesSuppressed;
+    unsigned long showMicros;
+    unsigned long ditherMicros;
+    unsigned long ditherMaxMicros;
 
 private:
-    Adafruit_NeoPixel strip;
-    uint32_t initialState[NUM_LEDS];
-    uint32_t endState[NUM_LEDS];
-    uint32_t newLeds[NUM_LEDS];
+    void show();
+    void transmit();
+    bool outputsBusy();
+    bool writeOutputs();
+    void countShow();
+    void clearFrame();
+    void setDithering(bool enabled);
+    void refreshDithered();
+    static void onDitherTimer(void *context);
+
+    LedCompositor compositor;
+    uint32_t frame[Board::numLeds];
+    uint32_t composed[Board::numLeds];
+    uint8_t pixels[Board::numLeds * 3];
+    uint8_t sentPixels[Board::numLeds * 3];
+    bool framePending;
+    unsigned long lastSendTime;
+    unsigned long metricsWindowStart;
+    uint16_t showsInWindow;
+
+    // Brightness tables. The refresh timer reads the active one, so a new
+    // brightness is built in the other and swapped in.
+    uint16_t luts[2][256];
+    uint16_t *volatile lut;
+
+    // Dithered output, refreshed from the esp_timer task
+    esp_timer_handle_t ditherTimer;
+    bool dithering;
+    volatile bool ditherRefreshing;
+    portMUX_TYPE frameLock;
+    uint32_t published[Board::numLeds];
+    uint32_t ditherFrame[Board::numLeds];
+    uint8_t residual[Board::numLeds * 3];
 };
 
 #endif
\ No newline at end of file
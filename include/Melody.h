@@ -1,14 +1,31 @@
 #ifndef MELODY_H
 #define MELODY_H
 
-#include <vector>
 #include <Arduino.h>
 #include "pitches.h"
 
+/**
+ * A note of a melody. A pitch of 0 is a rest.
+ */
+struct Note {
+    uint16_t pitch;
+    uint16_t duration;
+};
+
+/**
+ * A melody is a view on a constant note table, so it can be passed around and
+ * played without copying the notes or touching the heap.
+ */
 struct Melody {
-    std::vector<int> notes;
-    std::vector<int> durations;
+    const Note *notes;
+    uint8_t length;
     bool loop;
 };
 
-#endif
\ No newline at end of file
+template <size_t N>
+constexpr Melody makeMelody(const Note (&notes)[N], bool loop) {
+    static_assert(N > 0 && N <= 255, "a melody holds 1 to 255 notes");
+    return Melody{notes, (uint8_t)N, loop};
+}
+
+#endif
@@ -1,31 +1,115 @@
 #ifndef PIEZO_CONTROLLER_H
 #define PIEZO_CONTROLLER_H
 
+#include <esp_timer.h>
+#include <driver/ledc.h>
 #include "SystemState.h"
 #include "Melody.h"
+#include "SpscQueue.h"
+#include "SamplePlayer.h"
+#include "Settings.h"
 
+#define PIEZO_CLIP_POLL_US 5000 // sequencer wake-up while a clip holds the buzzer
+#define PIEZO_QUEUE_SIZE 8
+#define PIEZO_CLICK_MIN_INTERVAL_MS 40 // clicks closer than this are dropped
+#define PIEZO_LEDC_MODE LEDC_LOW_SPEED_MODE
+#define PIEZO_LEDC_TIMER LEDC_TIMER_0
+#define PIEZO_LEDC_CHANNEL LEDC_CHANNEL_0
+#define PIEZO_LEDC_RESOLUTION LEDC_TIMER_10_BIT
+#define PIEZO_DUTY_ON 512 // 50% of the 10-bit range
+#define PIEZO_TIMING_LIMIT_US 1000 // late note boundaries past this are audible
+
+// Sound classes, lowest priority first. Each class has its own voice.
+enum SoundPriority {
+    SOUND_CLICK,
+    SOUND_PULSE,
+    SOUND_ALARM,
+    SOUND_PRIORITY_COUNT
+};
+
+/**
+ * Piezo buzzer driven by a sequencer running on an esp_timer, independent of
+ * the main loop. The main task only posts commands to a lock-free queue and
+ * wakes the sequencer, which programs the LEDC directly and arms the timer for
+ * the next note boundary, so a slow frame never stretches a note. With every
+ * voice silent the timer is left idle.
+ *
+ * Every sound class plays on its own voice, and all voices keep time together.
+ * Only the highest active voice allowed by sound_level is heard, so an alarm
+ * silences the clicks and pulses under it, and they resume where they would
+ * have been once it stops. An alarm is never replaced by a lower class.
+ *
+ * Clips play through the SamplePlayer and take the buzzer over from the LEDC
+ * until they end, scaled by the volume setting. The voices keep time underneath
+ * and are heard again after.
+ * Stopping the class that started a clip stops the clip too.
+ */
 class PiezoController {
 public:
     PiezoController(int buzzerPin);
 
     void begin(uint8_t sound_level = 0);
-    void update(SystemState state);
 
     int buzzerPin;
 
-    unsigned long int lastNoteTime;
-    bool melodyRunning;
-    void startMelody(Melody melody);
-    void updateMelody();
+    volatile bool melodyRunning;
+    void startMelody(const Melody &melody, SoundPriority priority = SOUND_PULSE);
     void stopMelody();
+    void stopMelody(SoundPriority priority);
     void beep(int frequency, int duration);
-
-    Melody melody;
+    void playClip(const Clip &clip, SoundPriority priority);
+    static void onSettingChanged(void *context, const SettingsData &settings, SettingId id);
+    void printMetrics(Print &out);
 
     // 0 = muted, 1 = alarms only, 2 = all sounds
     uint8_t sound_level = 0;
+    uint8_t clipVolume = 255; // sample scaling of clips, 0-255
+
+    SamplePlayer samples;
+
+    // Metrics, written by the timer task. 32 bits, so the loop reads them whole.
+    uint32_t timingErrorUs; // how late the last note boundary was handled
+    uint32_t maxTimingErrorUs;
+    uint32_t commandsDropped;
+    uint32_t clicksLimited;
+    uint32_t ledcWrites;
+
+private:
+    struct Command {
+        enum Type { PLAY, PLAY_CLIP, STOP, STOP_ALL } type;
+        const Melody *melody;
+        const Clip *clip;
+        SoundPriority priority;
+        Note note;
+    };
+
+    struct Voice {
+        const Melody *melody;
+        uint8_t currentNote;
+        int64_t nextNoteTime;
+    };
+
+    void post(const Command &command);
+    void tick();
+    void handle(const Command &command, int64_t now);
+    void advance(Voice &voice, int64_t now);
+    bool audible(SoundPriority priority);
+    void output(uint16_t pitch);
+    void attachLedc();
+    void schedule(int64_t wakeTime);
+    static void onTick(void *context);
+
+    SpscQueue<Command, PIEZO_QUEUE_SIZE> commands;
+    esp_timer_handle_t timer;
+    unsigned long lastClickTime;
 
-    int currentNote;
+    // Sequencer state, owned by the timer task
+    Voice voices[SOUND_PRIORITY_COUNT];
+    Note clickNote;
+    Melody clickMelody;
+    uint16_t outputPitch;
+    bool ledcDetached;
+    SoundPriority clipPriority; // class of the clip holding the buzzer
 };
 
-#endif
\ No newline at end of file
+#endif
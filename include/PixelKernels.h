@@ -0,0 +1,178 @@
+#ifndef PIXEL_KERNELS_H
+#define PIXEL_KERNELS_H
+
+#include <Arduino.h>
+
+/**
+ * Integer kernels working on packed 0x00RRGGBB pixels. Red and blue are processed
+ * together in one 32-bit word and green in another (SWAR), so a blend costs two
+ * multiplies per operand instead of three channel divisions.
+ */
+namespace PixelKernels {
+
+/**
+ * Packs a color from its channels.
+ */
+constexpr uint32_t rgb(uint8_t r, uint8_t g, uint8_t b) {
+    return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+}
+
+/**
+ * Maps a blend factor in 0-255 to a weight in 0-256, so that 255 selects the
+ * second color exactly and the result can be divided by a shift. Together with
+ * rounding before the shift this stays within one LSB of a division by 255.
+ */
+inline uint32_t blendWeight(uint8_t t) {
+    return t + (t >> 7);
+}
+
+/**
+ * Linear interpolation between two packed colors. Matches the previous
+ * per-channel `c1 + (c2 - c1) * t / 255` within one LSB.
+ *
+ * @param c1 The color returned for t = 0.
+ * @param c2 The color returned for t = 255.
+ * @param t The blend factor.
+ * @return The blended color.
+ */
+inline uint32_t blend(uint32_t c1, uint32_t c2, uint8_t t) {
+    uint32_t w2 = blendWeight(t);
+    uint32_t w1 = 256 - w2;
+
+    uint32_t rb = ((c1 & 0x00FF00FF) * w1 + (c2 & 0x00FF00FF) * w2 + 0x00800080) >> 8;
+    uint32_t g = ((c1 & 0x0000FF00) * w1 + (c2 & 0x0000FF00) * w2 + 0x00008000) >> 8;
+
+    return (rb & 0x00FF00FF) | (g & 0x0000FF00);
+}
+
+/**
+ * Blends two whole rings into an output ring in one pass.
+ *
+ * @param from The colors returned for t = 0.
+ * @param to The colors returned for t = 255.
+ * @param output The array receiving the blended colors. May alias `from` or `to`.
+ * @param count The number of pixels.
+ * @param t The blend factor.
+ */
+inline void blendRing(const uint32_t* from, const uint32_t* to, uint32_t* output, int count, uint8_t t) {
+    uint32_t w2 = blendWeight(t);
+    uint32_t w1 = 256 - w2;
+
+    for (int i = 0; i < count; i++) {
+        uint32_t rb = ((from[i] & 0x00FF00FF) * w1 + (to[i] & 0x00FF00FF) * w2 + 0x00800080) >> 8;
+        uint32_t g = ((from[i] & 0x0000FF00) * w1 + (to[i] & 0x0000FF00) * w2 + 0x00008000) >> 8;
+        output[i] = (rb & 0x00FF00FF) | (g & 0x0000FF00);
+    }
+}
+
+/**
+ * Adds two packed colors, saturating each channel at 255. The carry out of every
+ * channel is turned into a mask that forces the channel to 255.
+ */
+inline uint32_t addSaturate(uint32_t c1, uint32_t c2) {
+    uint32_t rb = (c1 & 0x00FF00FF) + (c2 & 0x00FF00FF);
+    uint32_t g = (c1 & 0x0000FF00) + (c2 & 0x0000FF00);
+
+    uint32_t rbCarry = rb & 0x01000100;
+    uint32_t gCarry = g & 0x00010000;
+    rb |= rbCarry - (rbCarry >> 8);
+    g |= gCarry - (gCarry >> 8);
+
+    return (rb & 0x00FF00FF) | (g & 0x0000FF00);
+}
+
+/**
+ * Fills a lookup table applying gamma correction and then brightness to a
+ * channel value. Entries are 8.8 fixed point, so the fraction lost when a dim
+ * brightness scales a value down is kept for temporal dithering. The integer
+ * part is the scaling Adafruit_NeoPixel applied in setPixelColor, so a gamma
+ * of 1 keeps the ring looking as it did.
+ *
+ * @param lut The 256 entry table to fill.
+ * @param brightness The brightness, 0-255.
+ * @param gamma The gamma exponent.
+ */
+inline void buildLut(uint16_t* lut, uint8_t brightness, float gamma) {
+    uint16_t scale = brightness + 1;
+    for (int v = 0; v < 256; v++) {
+        if (gamma != 1.0f)
+            lut[v] = (uint16_t)(powf(v / 255.0f, gamma) * 255.0f * scale + 0.5f);
+        else
+            lut[v] = v * scale;
+    }
+}
+
+/**
+ * Converts a ring of packed colors into the GRB byte stream sent to the LEDs,
+ * applying brightness and gamma through the lookup table and dropping the
+ * fraction.
+ *
+ * @param frame The packed colors.
+ * @param grb The output buffer, three bytes per pixel.
+ * @param count The number of pixels.
+ * @param lut The table built by buildLut.
+ */
+inline void applyLut(const uint32_t* frame, uint8_t* grb, int count, const uint16_t* lut) {
+    for (int i = 0; i < count; i++) {
+        uint32_t c = frame[i];
+        grb[3 * i] = lut[(c >> 8) & 0xFF] >> 8;
+        grb[3 * i + 1] = lut[(c >> 16) & 0xFF] >> 8;
+        grb[3 * i + 2] = lut[c & 0xFF] >> 8;
+    }
+}
+
+/**
+ * Checks whether the lookup table drops a fraction on any channel of a ring,
+ * which is when temporal dithering shows levels the plain output can't.
+ *
+ * @param frame The packed colors.
+ * @param count The number of pixels.
+ * @param lut The table built by buildLut.
+ */
+inline bool hasFraction(const uint32_t* frame, int count, const uint16_t* lut) {
+    for (int i = 0; i < count; i++) {
+        uint32_t c = frame[i];
+        if ((lut[(c >> 16) & 0xFF] | lut[(c >> 8) & 0xFF] | lut[c & 0xFF]) & 0xFF)
+            return true;
+    }
+    return false;
+}
+
+/**
+ * Like applyLut, but diffuses the fraction of every channel into the next
+ * frame. Each channel accumulates its 8-bit remainder and rounds up once the
+ * sum carries, so over a few frames the LED averages the exact 16-bit level.
+ *
+ * @param frame The packed colors.
+ * @param grb The output buffer, three bytes per pixel.
+ * @param count The number of pixels.
+ * @param lut The table built by buildLut.
+ * @param residual The per-channel remainders carried between frames, three per pixel.
+ * @return true if no channel had a fraction, so the output is stable.
+ */
+inline bool applyLutDithered(const uint32_t* frame, uint8_t* grb, int count, const uint16_t* lut, uint8_t* residual) {
+    uint8_t fractions = 0;
+    for (int i = 0; i < 3 * count; i += 3) {
+        uint32_t c = frame[i / 3];
+        uint16_t g = lut[(c >> 8) & 0xFF];
+        uint16_t r = lut[(c >> 16) & 0xFF];
+        uint16_t b = lut[c & 0xFF];
+        fractions |= (g | r | b) & 0xFF;
+
+        // lut entries are at most 255 * 256, so adding a remainder can't overflow
+        g += residual[i];
+        r += residual[i + 1];
+        b += residual[i + 2];
+        grb[i] = g >> 8;
+        grb[i + 1] = r >> 8;
+        grb[i + 2] = b >> 8;
+        residual[i] = g;
+        residual[i + 1] = r;
+        residual[i + 2] = b;
+    }
+    return fractions == 0;
+}
+
+}
+
+#endif
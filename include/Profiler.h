@@ -0,0 +1,90 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <Arduino.h>
+#include "SystemState.h"
+#include HW_CONFIG
+
+/**
+ * The code paths timed by the loop profiler.
+ */
+enum ProfileProbe : uint8_t {
+    PROBE_LOOP,     // one whole pass of loop()
+    PROBE_INPUT,    // InputController::update
+    PROBE_STATE,    // StateController::update
+    PROBE_LEDRING,  // LedRingController::update
+    PROBE_DISPLAY,  // DisplayController::update
+    PROBE_STORAGE,  // settings, session log and checkpoint updates
+    PROBE_I2C,      // frame transfers to the display
+    PROBE_LED_SHOW, // frame writes to the LED outputs
+    PROBE_COUNT
+};
+
+#define PROFILER_BUCKETS 24   // log2 buckets of cycles
+#define PROFILER_MIN_SHIFT 6  // the first bucket holds everything under 2^7 cycles
+
+/**
+ * Loop timing histograms, one per probe and SystemState. A probe reads the CPU
+ * cycle counter on entry and exit and counts the difference in a log2 bucket,
+ * which costs a few dozen cycles, so the profiler stays on in release builds.
+ * Percentiles come from the buckets and are only known to within a factor of
+ * two; the maximum is exact.
+ *
+ * The state is the one the loop pass started in. The LED show probe is also
+ * hit by the dithering refresh task; the two don't lock each other, which can
+ * lose a count now and then but never corrupts a histogram.
+ *
+ * Compiled out with LOOP_PROFILER set to 0.
+ */
+#if LOOP_PROFILER
+
+#include <esp_cpu.h>
+
+struct ProfileHistogram {
+    uint16_t buckets[PROFILER_BUCKETS]; // halved together when one would overflow
+    uint32_t count;
+    uint32_t maxCycles;
+};
+
+namespace Profiler {
+void setState(SystemState state);
+void record(ProfileProbe probe, uint32_t cycles);
+void reset();
+void dump(Print &out);
+}
+
+/**
+ * Times the rest of the enclosing scope.
+ */
+class ProfileScope {
+public:
+    explicit ProfileScope(ProfileProbe probe) : probe(probe), start(esp_cpu_get_cycle_count()) {}
+
+    ~ProfileScope() {
+        Profiler::record(probe, esp_cpu_get_cycle_count() - start);
+    }
+
+private:
+    ProfileProbe probe;
+    uint32_t start;
+};
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+#define PROFILE_SCOPE(probe) ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(probe)
+
+#else
+
+namespace Profiler {
+inline void setState(SystemState) {}
+inline void reset() {}
+inline void dump(Print &out) {
+    out.println("prof: disabled in this build");
+}
+}
+
+#define PROFILE_SCOPE(probe)
+
+#endif
+
+#endif
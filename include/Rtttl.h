@@ -0,0 +1,214 @@
+#ifndef RTTTL_H
+#define RTTTL_H
+
+#include "Melody.h"
+
+/**
+ * Compile-time RTTTL compiler. A melody written as an RTTTL string, e.g.
+ * "beep:d=8,o=6,b=120:a,p,a", is parsed by the compiler into a constant note
+ * table, so the player sees the same packed data as a hand-written table and
+ * nothing is parsed at run time.
+ *
+ * Supported: the d, o and b defaults in any order, durations 1-32, notes a-g
+ * with #, rests (p), octaves 1-8 up to D#8, and dots before or after the
+ * octave. Invalid input stops the build with an error naming the problem.
+ */
+namespace Rtttl {
+
+// Called only on invalid input. They are not constexpr, so reaching one during
+// constant evaluation is a compile error that names the problem.
+void error_missing_section();
+void error_unknown_default();
+void error_bad_duration();
+void error_bad_note();
+void error_bad_octave();
+void error_bad_tempo();
+void error_trailing_characters();
+
+constexpr uint16_t pitches[] = {
+    NOTE_C1, NOTE_CS1, NOTE_D1, NOTE_DS1, NOTE_E1, NOTE_F1, NOTE_FS1, NOTE_G1, NOTE_GS1, NOTE_A1, NOTE_AS1, NOTE_B1,
+    NOTE_C2, NOTE_CS2, NOTE_D2, NOTE_DS2, NOTE_E2, NOTE_F2, NOTE_FS2, NOTE_G2, NOTE_GS2, NOTE_A2, NOTE_AS2, NOTE_B2,
+    NOTE_C3, NOTE_CS3, NOTE_D3, NOTE_DS3, NOTE_E3, NOTE_F3, NOTE_FS3, NOTE_G3, NOTE_GS3, NOTE_A3, NOTE_AS3, NOTE_B3,
+    NOTE_C4, NOTE_CS4, NOTE_D4, NOTE_DS4, NOTE_E4, NOTE_F4, NOTE_FS4, NOTE_G4, NOTE_GS4, NOTE_A4, NOTE_AS4, NOTE_B4,
+    NOTE_C5, NOTE_CS5, NOTE_D5, NOTE_DS5, NOTE_E5, NOTE_F5, NOTE_FS5, NOTE_G5, NOTE_GS5, NOTE_A5, NOTE_AS5, NOTE_B5,
+    NOTE_C6, NOTE_CS6, NOTE_D6, NOTE_DS6, NOTE_E6, NOTE_F6, NOTE_FS6, NOTE_G6, NOTE_GS6, NOTE_A6, NOTE_AS6, NOTE_B6,
+    NOTE_C7, NOTE_CS7, NOTE_D7, NOTE_DS7, NOTE_E7, NOTE_F7, NOTE_FS7, NOTE_G7, NOTE_GS7, NOTE_A7, NOTE_AS7, NOTE_B7,
+    NOTE_C8, NOTE_CS8, NOTE_D8, NOTE_DS8,
+};
+
+template <size_t N>
+struct NoteTable {
+    Note notes[N];
+};
+
+constexpr bool isDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+constexpr size_t skipSpaces(const char *text, size_t i) {
+    while (text[i] == ' ') i++;
+    return i;
+}
+
+constexpr size_t bodyStart(const char *text) {
+    size_t i = 0;
+    int colons = 0;
+    while (colons < 2) {
+        if (text[i] == '\0') error_missing_section();
+        if (text[i] == ':') colons++;
+        i++;
+    }
+    return i;
+}
+
+/**
+ * Counts the notes of an RTTTL string, to size its table.
+ */
+constexpr size_t noteCount(const char *text) {
+    size_t count = 1;
+    for (size_t i = bodyStart(text); text[i] != '\0'; i++)
+        if (text[i] == ',') count++;
+    return count;
+}
+
+constexpr bool validDuration(int duration) {
+    return duration == 1 || duration == 2 || duration == 4 || duration == 8 || duration == 16 || duration == 32;
+}
+
+constexpr int semitone(char c) {
+    switch (c) {
+    case 'c': case 'C': return 0;
+    case 'd': case 'D': return 2;
+    case 'e': case 'E': return 4;
+    case 'f': case 'F': return 5;
+    case 'g': case 'G': return 7;
+    case 'a': case 'A': return 9;
+    case 'b': case 'B': return 11;
+    case 'h': case 'H': return 11;
+    case 'p': case 'P': return -1;
+    default: error_bad_note(); return 0;
+    }
+}
+
+/**
+ * Parses an RTTTL string into a note table of N notes.
+ *
+ * @tparam N The number of notes, from noteCount.
+ */
+template <size_t N>
+constexpr NoteTable<N> parse(const char *text) {
+    NoteTable<N> table{};
+    int defaultDuration = 4;
+    int defaultOctave = 6;
+    int bpm = 63;
+
+    // Defaults section
+    size_t i = 0;
+    while (text[i] != ':') {
+        if (text[i] == '\0') error_missing_section();
+        i++;
+    }
+    i = skipSpaces(text, i + 1);
+    while (text[i] != ':') {
+        char key = text[i];
+        i = skipSpaces(text, i + 1);
+        if (text[i] != '=') error_unknown_default();
+        i = skipSpaces(text, i + 1);
+
+        int value = 0;
+        if (!isDigit(text[i])) error_unknown_default();
+        while (isDigit(text[i]))
+            value = value * 10 + (text[i++] - '0');
+
+        if (key == 'd') {
+            if (!validDuration(value)) error_bad_duration();
+            defaultDuration = value;
+        } else if (key == 'o') {
+            if (value < 1 || value > 8) error_bad_octave();
+            defaultOctave = value;
+        } else if (key == 'b') {
+            if (value < 6 || value > 900) error_bad_tempo();
+            bpm = value;
+        } else {
+            error_unknown_default();
+        }
+
+        i = skipSpaces(text, i);
+        if (text[i] == ',') i = skipSpaces(text, i + 1);
+        else if (text[i] != ':') error_unknown_default();
+    }
+    i++;
+
+    // A whole note lasts four beats
+    long wholeMs = 4L * 60000L / bpm;
+
+    // Notes section
+    for (size_t n = 0; n < N; n++) {
+        i = skipSpaces(text, i);
+
+        int duration = 0;
+        while (isDigit(text[i]))
+            duration = duration * 10 + (text[i++] - '0');
+        if (duration == 0) duration = defaultDuration;
+        if (!validDuration(duration)) error_bad_duration();
+
+        int note = semitone(text[i++]);
+        if (text[i] == '#') {
+            if (note < 0) error_bad_note();
+            note++;
+            i++;
+        }
+
+        bool dotted = false;
+        if (text[i] == '.') {
+            dotted = true;
+            i++;
+        }
+
+        int octave = defaultOctave;
+        if (isDigit(text[i])) {
+            octave = text[i++] - '0';
+            if (octave < 1 || octave > 8) error_bad_octave();
+        }
+
+        if (text[i] == '.') {
+            dotted = true;
+            i++;
+        }
+
+        long ms = wholeMs / duration;
+        if (dotted) ms += ms / 2;
+
+        uint16_t pitch = 0;
+        if (note >= 0) {
+            size_t index = (octave - 1) * 12 + note;
+            if (index >= sizeof(pitches) / sizeof(pitches[0])) error_bad_octave();
+            pitch = pitches[index];
+        }
+        table.notes[n] = Note{pitch, (uint16_t)ms};
+
+        i = skipSpaces(text, i);
+        if (n + 1 < N) {
+            if (text[i] != ',') error_trailing_characters();
+            i++;
+        }
+    }
+
+    if (text[i] != '\0') error_trailing_characters();
+    return table;
+}
+
+}
+
+/**
+ * Defines a constant melody from an RTTTL string literal, compiled at build time.
+ *
+ * @param name The name of the melody.
+ * @param text The RTTTL string.
+ * @param loop Whether the melody repeats.
+ */
+#define RTTTL_MELODY(name, text, loop) \
+    inline constexpr auto name##Notes = Rtttl::parse<Rtttl::noteCount(text)>(text); \
+    inline constexpr Melody name = makeMelody(name##Notes.notes, loop)
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef SAMPLE_PLAYER_H
+#define SAMPLE_PLAYER_H
+
+#include <Arduino.h>
+#include <driver/i2s_pdm.h>
+#include "Adpcm.h"
+
+#define SAMPLE_RATE_HZ 16000
+#define SAMPLE_CHUNK 256 // samples decoded per DMA refill, 16 ms at 16 kHz
+#define SAMPLE_DMA_BUFFERS 4
+#define SAMPLE_TASK_STACK 2048
+#define SAMPLE_TASK_PRIORITY 5
+#define SAMPLE_CPU_BUDGET_PERMILLE 20 // decode time allowed per unit of playback time, 2%
+
+/**
+ * A clip of IMA ADPCM audio in flash, at SAMPLE_RATE_HZ.
+ */
+struct Clip {
+    const uint8_t *data;
+    uint32_t sampleCount;
+};
+
+/**
+ * Plays clips on the buzzer pin through the I2S peripheral in PDM mode. The DMA
+ * feeds the pin, and a task only wakes to decode the next chunk into a free
+ * buffer, so playback costs a few percent of CPU at most. Volume scales the
+ * samples, which sets the PDM density, instead of switching the buzzer on and
+ * off.
+ *
+ * The pin is shared with the LEDC tone output: it is routed to the I2S when a
+ * clip starts, and its owner takes it back once isPlaying() is false.
+ */
+class SamplePlayer
+{
+public:
+    SamplePlayer();
+
+    bool begin(int pin);
+    void start(const Clip &clip, uint8_t volume);
+    void stop();
+    bool isPlaying();
+
+    // Metrics
+    uint16_t cpuPermille;
+    uint16_t maxCpuPermille;
+    uint32_t budgetOverruns;
+
+private:
+    static void taskEntry(void *context);
+    void run();
+    void play(const Clip &clip);
+
+    int pin;
+    i2s_chan_handle_t channel;
+    TaskHandle_t task;
+    volatile bool playing;
+    volatile bool stopRequested;
+    const Clip *volatile requested;
+    volatile uint8_t volume;
+    int16_t buffer[SAMPLE_CHUNK];
+};
+
+#endif
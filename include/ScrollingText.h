@@ -0,0 +1,58 @@
+#ifndef SCROLLING_TEXT_H
+#define SCROLLING_TEXT_H
+
+#include <U8g2lib.h>
+#include HW_CONFIG
+
+#define SCROLL_TEXT_MAX_LENGTH 33
+#define SCROLL_SPEED_PX_PER_S 24
+#define SCROLL_GAP_PX 24
+#define SCROLL_START_PAUSE 1000
+
+// SSD1306 scroll commands
+#define SSD1306_SCROLL_RIGHT 0x26
+#define SSD1306_SCROLL_LEFT 0x27
+#define SSD1306_SCROLL_DEACTIVATE 0x2E
+#define SSD1306_SCROLL_ACTIVATE 0x2F
+#define SSD1306_SCROLL_5_FRAMES 0x00
+
+/**
+ * Single line text widget that scrolls its content when it does not fit in the
+ * given width. When the panel supports it and the line owns its display pages,
+ * the SSD1306 hardware scroll is used so the controller rotates the pixels by
+ * itself. Otherwise the text is scrolled in software inside a clip window.
+ */
+class ScrollingText
+{
+public:
+    ScrollingText(DisplayType *u8g2);
+
+    void set(const uint8_t *font, int x, int baseline, int width, const char *text);
+    void render();
+    void onFlushed();
+    void stopHardwareScroll();
+    bool isHardwareScrolling();
+
+private:
+    void drawSoftware(int textWidth);
+    bool pagesAreEmpty();
+    void startHardwareScroll();
+    void sendScrollCommand(uint8_t command);
+
+    DisplayType *u8g2;
+    const uint8_t *font;
+    char text[SCROLL_TEXT_MAX_LENGTH];
+    int x;
+    int baseline;
+    int width;
+    int firstPage;
+    int lastPage;
+    bool pending;
+    bool wantsHardware;
+    bool hardwareScrolling;
+    unsigned long scrollStartTime;
+
+    static ScrollingText *hardwareOwner;
+};
+
+#endif
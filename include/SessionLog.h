@@ -0,0 +1,144 @@
+#ifndef SESSION_LOG_H
+#define SESSION_LOG_H
+
+#include <Arduino.h>
+#include <esp_partition.h>
+
+#define SESSION_PARTITION_LABEL "sessions"
+#define SESSION_SECTOR_SIZE 4096
+#define SESSION_MAGIC 0x53455353 // "SESS"
+#define SESSION_PENDING_SIZE 16     // records buffered in RAM between flash writes
+#define SESSION_BATCH_SIZE 4        // pending records that make a write worth it
+#define SESSION_MAX_DEFER_MS 300000 // write a smaller batch after this long
+#define SESSION_COMPACT_RESERVE 32  // slots kept free in a sector for the day aggregates of a compaction
+#define SESSION_KEEP_DAYS 366       // days older than this are dropped when compacted
+#define SESSION_WEEK_DAYS 7
+#define SESSION_SECONDS_PER_DAY 86400
+
+enum SessionMode : uint8_t {
+    SESSION_TIMER,
+    SESSION_PULSE,
+    SESSION_STOPWATCH
+};
+
+enum SessionRecordType : uint8_t {
+    SESSION_RECORD_RUN = 0x01,
+    SESSION_RECORD_DAY = 0x02,
+    SESSION_RECORD_ERASED = 0xFF
+};
+
+/**
+ * One finished run. Times are seconds from time(), which keeps counting
+ * through deep sleep. Nothing sets the clock, so after a power loss it goes on
+ * from the newest run in the log: days are a count of days the device has
+ * been running rather than calendar days, but they never go back.
+ */
+struct SessionRecord {
+    uint32_t start;
+    uint32_t end;
+    uint32_t activeMs; // time actually counted, without pauses
+    uint8_t mode;      // SessionMode
+    uint8_t completed;
+    uint8_t type;      // SESSION_RECORD_RUN
+    uint8_t check;     // CRC8 over the bytes before it
+};
+
+/**
+ * The runs of one day, written when the sector holding them is compacted.
+ */
+struct DayRecord {
+    uint32_t day; // time() / SESSION_SECONDS_PER_DAY
+    uint32_t activeSeconds;
+    uint16_t sessions;
+    uint16_t completedSessions;
+    uint16_t sourceSequence; // the sector the runs came from, ignored from then on
+    uint8_t type;            // SESSION_RECORD_DAY
+    uint8_t check;
+};
+
+static_assert(sizeof(SessionRecord) == 16 && sizeof(DayRecord) == 16, "records fill one slot");
+static_assert(offsetof(SessionRecord, type) == offsetof(DayRecord, type), "type is at the same place in every record");
+
+/**
+ * Totals of one day.
+ */
+struct DayTotal {
+    uint32_t day;
+    uint32_t activeSeconds;
+    uint16_t sessions;
+    uint16_t completedSessions;
+};
+
+struct SessionStats {
+    DayTotal today;
+    uint32_t weekSeconds;
+    uint16_t weekSessions;
+    uint32_t totalSessions;
+};
+
+/**
+ * Append-only log of the finished timer, pulse and stopwatch runs, kept on a
+ * dedicated flash partition used as a ring of sectors.
+ *
+ * append() only queues the record in RAM and updates the totals, so ending a
+ * session never waits for flash. update() writes the queue in one batch while
+ * the device is idle, and flush() writes it before deep sleep.
+ *
+ * When the ring is full, the oldest sector is compacted: its runs are summed
+ * into one DayRecord per day, written into the space kept free at the end of
+ * the newest sector, and the oldest sector is erased for reuse. A day record
+ * names the sector it came from, so if power fails before the erase those runs
+ * are not counted twice.
+ *
+ * The daily and weekly totals are rebuilt by one scan at boot and kept up to
+ * date on every append, so reading them never touches the log.
+ */
+class SessionLog
+{
+public:
+    SessionLog();
+
+    void begin();
+    void append(SessionMode mode, uint32_t start, uint32_t end, uint32_t activeMs, bool completed);
+    void update(bool idle);
+    void flush();
+    SessionStats stats() const;
+
+    // Metrics
+    uint32_t recordsWritten;
+    uint32_t recordsDropped;
+    uint32_t compactions;
+    unsigned long lastFlushMicros;
+    unsigned long maxFlushMicros;
+
+private:
+    template <typename Visit>
+    void scanSector(uint16_t sector, Visit visit);
+    bool writeSlot(const void *record);
+    void compact();
+    void countRun(const SessionRecord &run);
+    void countDay(const DayRecord &day);
+    DayTotal &bucketFor(uint32_t day);
+    uint32_t slotAddress(uint16_t sector, uint16_t slot) const;
+
+    template <typename R>
+    static uint8_t checkOf(const R &record);
+
+    static constexpr uint16_t slotsPerSector = SESSION_SECTOR_SIZE / 16; // slot 0 holds the header
+
+    const esp_partition_t *partition;
+    uint16_t sectorCount;
+    uint16_t headSector;
+    uint16_t headSlot; // next free slot, slot 0 is the header
+    uint32_t sequence;
+    uint16_t compactedThrough; // newest sector folded into day records
+
+    SessionRecord pending[SESSION_PENDING_SIZE];
+    uint8_t pendingCount;
+    unsigned long pendingSince;
+
+    DayTotal week[SESSION_WEEK_DAYS]; // indexed by day % SESSION_WEEK_DAYS
+    uint32_t totalSessions;
+};
+
+#endif
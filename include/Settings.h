@@ -0,0 +1,118 @@
+#ifndef SETTINGS_H
+#define SETTINGS_H
+
+#include <Arduino.h>
+#include "SettingsJournal.h"
+#include HW_CONFIG
+
+#define SETTINGS_VERSION 1
+#define SETTINGS_MAX_LISTENERS 6
+#define SETTINGS_WRITE_BACK_MS 3000 // quiet time before changes are committed
+#define SETTINGS_MAX_DEFER_MS 60000 // commit even when never idle after this long
+
+// Also the journal record ids, so new settings go at the end
+enum SettingId : uint8_t {
+    SETTING_LEDRING_BRIGHTNESS,
+    SETTING_SCREEN_BRIGHTNESS,
+    SETTING_SOUND_LEVEL,
+    SETTING_DELTA_T_CW,
+    SETTING_DELTA_T_CCW,
+    SETTING_ENCODER_ACCEL,
+    SETTING_SSID,
+    SETTING_PASSWORD,
+    SETTING_MULTI_CLICK,
+    SETTING_VOLUME,
+    SETTING_COUNT
+};
+
+/**
+ * The user settings. Everything that needs a setting on a hot path reads these
+ * fields, or a copy kept up to date by a listener, instead of going to flash.
+ * The header and CRC match the block earlier firmware kept at
+ * EEPROM_SETTINGS_ADDR, which is read once to migrate.
+ */
+struct SettingsData {
+    uint16_t version;
+    uint16_t length;             // sizeof(SettingsData), catches a layout change without a version bump
+    int32_t ledRingBrightness;   // 0-100 %
+    int32_t screenBrightness;    // contrast, 0-250
+    int32_t soundLevel;          // 0 = muted, 1 = alarms only, 2 = all sounds
+    int32_t deltaTCw;            // ms added per clockwise detent
+    int32_t deltaTCcw;           // ms added per counter-clockwise detent
+    int32_t encoderAcceleration; // 0 (off) to INPUT_ACCEL_MAX_LEVEL
+    int32_t multiClickWindowMs;  // wait for a further click of a double or triple press
+    int32_t volume;              // loudness of sample clips, 10-100 %
+    char ssid[EEPROM_SSID_SIZE + 1];
+    char password[EEPROM_PASSWORD_SIZE + 1];
+    uint32_t crc;                // over everything before it
+};
+
+/**
+ * Called after a setting changes, and once per setting when the listener is
+ * added so it starts from the stored values.
+ */
+typedef void (*SettingsListener)(void *context, const SettingsData &settings, SettingId id);
+
+/**
+ * Typed settings store, loaded once at boot and kept in RAM. Values are
+ * validated against their range on load and clamped on change.
+ *
+ * Every setting is persisted as a record of the settings journal, and only the
+ * settings that changed are appended. Changes are written back: they only mark
+ * the store dirty, and update() commits once no change has come for
+ * SETTINGS_WRITE_BACK_MS while the device is idle, so turning through a
+ * settings page costs one short flash write and a running timer is never
+ * stalled. flush() commits at once and must be called before deep sleep.
+ *
+ * On the first boot with an empty journal, the values are migrated from the
+ * EEPROM block, or from the legacy EEPROM layout before it.
+ */
+class Settings {
+public:
+    Settings();
+
+    void begin();
+    void update(bool idle);
+    void flush();
+
+    const SettingsData &get() const {
+        return data;
+    }
+
+    void set(SettingId id, int32_t value);
+    void setSsid(const char *ssid);
+    bool addListener(SettingsListener listener, void *context);
+    void printMetrics(Print &out);
+
+    SettingsJournal journal;
+
+    // Metrics
+    uint32_t commits;
+    unsigned long lastCommitMicros;
+    unsigned long maxCommitMicros;
+    bool migrated;
+
+private:
+    bool loadEeprom();
+    void loadLegacy();
+    bool validate();
+    void save();
+    bool writeRecords(uint32_t mask);
+    void notify(SettingId id);
+    uint32_t checksum() const;
+    static void onRecord(void *context, uint8_t id, const uint8_t *payload, uint8_t length);
+
+    struct Listener {
+        SettingsListener callback;
+        void *context;
+    };
+
+    SettingsData data;
+    uint32_t dirtyMask; // one bit per SettingId
+    unsigned long firstChange;
+    unsigned long lastChange;
+    Listener listeners[SETTINGS_MAX_LISTENERS];
+    uint8_t listenerCount;
+};
+
+#endif
@@ -0,0 +1,91 @@
+#ifndef SETTINGS_JOURNAL_H
+#define SETTINGS_JOURNAL_H
+
+#include <Arduino.h>
+#include <esp_partition.h>
+
+#define JOURNAL_PARTITION_LABEL "settings"
+#define JOURNAL_SECTOR_SIZE 4096
+#define JOURNAL_MAGIC 0x4C4E524A // "JRNL"
+#define JOURNAL_COMPLETE 0x00000000
+#define JOURNAL_MAX_PAYLOAD 36
+#define JOURNAL_RATED_CYCLES 100000 // erase cycles a flash sector is rated for
+
+/**
+ * Start of every journal sector. `complete` is left erased while the sector is
+ * being filled with a snapshot, and cleared once the snapshot is in, so a
+ * sector cut short by a power failure is never taken for the newest one.
+ */
+struct JournalSectorHeader {
+    uint32_t magic;
+    uint32_t sequence;
+    uint32_t complete;
+    uint32_t reserved;
+};
+
+/**
+ * Start of every record. The payload follows, padded to a word.
+ */
+struct JournalRecordHeader {
+    uint8_t id;
+    uint8_t length;
+    uint16_t check; // CRC16 over id, length and payload
+};
+
+/**
+ * Called for every valid record of the newest sector, oldest first.
+ */
+typedef void (*JournalReplay)(void *context, uint8_t id, const uint8_t *payload, uint8_t length);
+
+/**
+ * Append-only record log on a dedicated flash partition. Records are written
+ * one after the other into the active sector, so a change costs a few bytes of
+ * programming rather than an erase. When the sector is full the owner starts
+ * the next one and writes a full snapshot into it. Sectors are used in turn,
+ * so every sector is erased once per lap of the partition.
+ *
+ * Recovery takes the complete sector with the highest sequence and replays its
+ * records in order, later records overriding earlier ones. A record torn by a
+ * power failure fails its check and is skipped, and the previous sector stays
+ * intact until the new one is complete.
+ */
+class SettingsJournal
+{
+public:
+    SettingsJournal();
+
+    bool begin(JournalReplay replay, void *context);
+    bool append(uint8_t id, const void *payload, uint8_t length);
+    bool startSector();
+    bool sealSector();
+    void prepare();
+
+    bool available() const {
+        return partition != nullptr;
+    }
+
+    uint32_t estimatedCycles() const;
+
+    // Metrics
+    uint32_t sectorErases;
+    uint32_t bytesWritten;
+    uint32_t recordsSkipped;
+
+private:
+    uint32_t scanSector(uint16_t sector, JournalReplay replay, void *context);
+    bool eraseSector(uint16_t sector);
+    static uint16_t checkOf(const JournalRecordHeader &header, const uint8_t *payload);
+
+    static constexpr uint32_t recordSize(uint8_t length) {
+        return (sizeof(JournalRecordHeader) + length + 3) & ~3u;
+    }
+
+    const esp_partition_t *partition;
+    uint16_t sectorCount;
+    uint16_t activeSector;
+    uint32_t sequence;
+    uint32_t writeOffset;
+    bool nextErased;
+};
+
+#endif
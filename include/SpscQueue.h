@@ -0,0 +1,57 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <Arduino.h>
+#include <atomic>
+
+/**
+ * Fixed-size lock-free queue for one producer task and one consumer task or
+ * timer callback. Each side only writes its own index, so push and pop never
+ * block and never disable interrupts.
+ *
+ * @tparam T The element type.
+ * @tparam N The capacity, a power of two.
+ */
+template <typename T, size_t N>
+class SpscQueue
+{
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "capacity must be a power of two");
+
+public:
+    SpscQueue() : head(0), tail(0) {}
+
+    /**
+     * Adds an element. Called by the producer only.
+     *
+     * @return false if the queue is full and the element was dropped.
+     */
+    bool push(const T &item) {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) >= N)
+            return false;
+        items[h & (N - 1)] = item;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Removes the oldest element. Called by the consumer only.
+     *
+     * @return false if the queue is empty.
+     */
+    bool pop(T &item) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire))
+            return false;
+        item = items[t & (N - 1)];
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    T items[N];
+    std::atomic<size_t> head;
+    std::atomic<size_t> tail;
+};
+
+#endif
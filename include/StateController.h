@@ -6,29 +6,38 @@
 #include "LedRingController.h"
 #include "PiezoController.h"
 #include "InputController.h"
+#include "Settings.h"
+#include "SessionLog.h"
+#include "TimerCheckpoint.h"
 
 class StateController {
 public:
     StateController();
     SystemState getState();
+    bool isIdle();
 
     void begin();
+    void restore(const TimerCheckpointData& checkpoint, InputController& input);
     void update(
         DisplayController& display,
         LedRingController& ledRing,
         PiezoController& piezo,
-        InputController& input
+        InputController& input,
+        Settings& settings,
+        SessionLog& sessions
     );
 
     long int getTimer();
     long int getInitialTimer();
     long int getPosition();
+    uint32_t getSessionStart();
 
     void buttonFeedback(PiezoController& piezo);
     void rotaryFeedback(PiezoController& piezo);
+    void toggleMute(PiezoController& piezo, Settings& settings);
 
-    void enterDeepSleep(DisplayController& display, LedRingController& ledRing);
-    void checkDeepSleep(DisplayController& display, LedRingController& ledRing, SystemState state);
+    void enterDeepSleep(DisplayController& display, LedRingController& ledRing, Settings& settings, SessionLog& sessions);
+    void checkDeepSleep(DisplayController& display, LedRingController& ledRing, Settings& settings, SessionLog& sessions, SystemState state);
 
     long int currentPosition;
     long newPosition;
@@ -39,10 +48,20 @@ public:
     unsigned long int lastInteractionTimer;
     unsigned long int timeNow;
     unsigned long int timeElapsed;
+    long int lapTimer;
+    uint8_t lapCount;
 
 private:
     SystemState currentState;
     bool firstTime = true;
+    uint8_t unmutedSoundLevel;
+    time_t sessionStart;               // wall clock when the running session started
+    unsigned long int sessionStartMillis;
+
+    void startSession();
+    void endSession(SessionLog& sessions, SessionMode mode, unsigned long int activeMs, bool completed);
+
+    void configureInput(InputController& input);
 };
 
 #endif
\ No newline at end of file
@@ -22,6 +22,8 @@ enum SystemState {
             STATE_PREPARE_SLEEP,
         
             STATE_INFO,
+
+            STATE_STATS,
         
         STATE_SETTINGS,
             STATE_SETTINGS_AUDIO,
@@ -29,8 +31,12 @@ enum SystemState {
             STATE_SETTINGS_LEDRING,
             STATE_SETTINGS_TIMER,
                 STATE_SETTINGS_TIMER_CW,
-                STATE_SETTINGS_TIMER_CCW
+                STATE_SETTINGS_TIMER_CCW,
+                STATE_SETTINGS_TIMER_ACCEL,
+                STATE_SETTINGS_TIMER_CLICK,
+            STATE_SETTINGS_VOLUME,
 
+    STATE_COUNT
 };
 
 #endif
\ No newline at end of file
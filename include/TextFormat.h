@@ -0,0 +1,81 @@
+#ifndef TEXT_FORMAT_H
+#define TEXT_FORMAT_H
+
+#include <Arduino.h>
+
+/**
+ * Fixed-capacity text buffer living on the stack. Used by the draw functions to
+ * build strings without String or printf, so rendering never touches the heap.
+ * Text that does not fit is truncated, and the buffer is always terminated.
+ *
+ * @tparam N The capacity of the buffer, including the terminating null.
+ */
+template <size_t N>
+class TextBuffer
+{
+public:
+    TextBuffer() : len(0) {
+        buffer[0] = '\0';
+    }
+
+    TextBuffer &clear() {
+        len = 0;
+        buffer[0] = '\0';
+        return *this;
+    }
+
+    TextBuffer &append(char c) {
+        if (len < N - 1) {
+            buffer[len++] = c;
+            buffer[len] = '\0';
+        }
+        return *this;
+    }
+
+    TextBuffer &append(const char *text) {
+        while (*text != '\0' && len < N - 1)
+            buffer[len++] = *text++;
+        buffer[len] = '\0';
+        return *this;
+    }
+
+    /**
+     * Appends an integer in decimal, padded with leading zeros.
+     *
+     * @param value The value to append.
+     * @param minDigits The minimum number of digits to print.
+     */
+    TextBuffer &appendInt(long value, uint8_t minDigits = 1) {
+        char digits[12];
+        uint8_t count = 0;
+        unsigned long magnitude = value < 0 ? 0UL - (unsigned long)value : (unsigned long)value;
+
+        do {
+            digits[count++] = '0' + magnitude % 10;
+            magnitude /= 10;
+        } while (magnitude > 0 && count < sizeof(digits));
+
+        while (count < minDigits && count < sizeof(digits))
+            digits[count++] = '0';
+
+        if (value < 0)
+            append('-');
+        while (count > 0)
+            append(digits[--count]);
+        return *this;
+    }
+
+    const char *c_str() const {
+        return buffer;
+    }
+
+    size_t length() const {
+        return len;
+    }
+
+private:
+    char buffer[N];
+    size_t len;
+};
+
+#endif
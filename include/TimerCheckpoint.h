@@ -0,0 +1,88 @@
+#ifndef TIMER_CHECKPOINT_H
+#define TIMER_CHECKPOINT_H
+
+#include <Arduino.h>
+#include <esp_partition.h>
+#include "SystemState.h"
+
+#define CHECKPOINT_PARTITION_LABEL "checkpoint"
+#define CHECKPOINT_SECTOR_SIZE 4096
+#define CHECKPOINT_FLASH_PERIOD_MS 60000 // flash copy of a running timer, at most this old after a power loss
+#define CHECKPOINT_QUIET_MS 1000         // while idle, the flash copy follows once changes stop for this long
+#define CHECKPOINT_DRIFT_MS 250          // moves of a deadline smaller than this are frame jitter
+#define CHECKPOINT_MAX_RESTORES 2        // a run that keeps crashing the firmware is dropped after this
+#define CHECKPOINT_NO_RUN 0xFF           // state of a checkpoint taken while nothing runs
+
+/**
+ * The timing state of a run. For a running countdown or stopwatch, timer is the
+ * value it had at taken, so the deadline follows from the two. For a paused
+ * one, timer is simply frozen, which also covers the time spent in pauses.
+ */
+struct TimerCheckpointData {
+    int64_t taken;         // gettimeofday() in microseconds
+    uint32_t sequence;     // increases with every flash copy
+    int32_t position;      // encoder position the duration was set with
+    int32_t initialTimer;  // ms
+    int32_t timer;         // ms left, or elapsed for the stopwatch
+    uint32_t sessionStart; // time() when the run started, for the session log
+    uint8_t state;         // SystemState, or CHECKPOINT_NO_RUN
+    uint8_t restores;      // times this run has been restored
+    uint16_t check;        // CRC16 over the bytes before it
+};
+
+static_assert(sizeof(TimerCheckpointData) == 32, "a checkpoint fills one flash slot");
+
+/**
+ * Keeps the running timer, pulse or stopwatch across resets.
+ *
+ * update() runs every pass but only writes when the timing state changes: a
+ * new state, a new duration or a deadline that moved. The copy goes to RTC
+ * memory, which survives panics, watchdog and brownout resets, so writing it
+ * costs next to nothing. A second copy goes to flash for a full power loss,
+ * at most once per CHECKPOINT_FLASH_PERIOD_MS while a run is going and without
+ * ever erasing on that path: the two-sector log is erased ahead of time while
+ * idle.
+ *
+ * begin() picks the copy from the reset reason. After a crash, the RTC copy
+ * is resumed as if nothing happened and a countdown that ended meanwhile
+ * finishes at once. After a power loss the clock restarted, so the time spent
+ * off is unknown and the flash copy comes back paused.
+ */
+class TimerCheckpoint {
+public:
+    TimerCheckpoint();
+
+    bool begin(TimerCheckpointData &restored);
+    void update(SystemState state, long position, long initialTimer, long timer, uint32_t sessionStart, bool idle);
+
+    // Metrics
+    uint32_t rtcWrites;
+    uint32_t flashWrites;
+    bool restoredFromFlash;
+
+private:
+    bool loadFlash(TimerCheckpointData &latest);
+    bool writeFlash(bool idle);
+    bool eraseSector(uint16_t sector);
+    uint32_t slotAddress(uint16_t sector, uint16_t slot) const;
+
+    static bool isRun(uint8_t state);
+    static int direction(uint8_t state);
+    static int64_t nowMicros();
+    static uint16_t checkOf(const TimerCheckpointData &data);
+
+    static constexpr uint16_t slotsPerSector = CHECKPOINT_SECTOR_SIZE / sizeof(TimerCheckpointData);
+
+    const esp_partition_t *partition;
+    uint16_t activeSector;
+    uint16_t nextSlot;
+    bool spareErased;
+    uint32_t sequence;
+
+    TimerCheckpointData current; // what the RTC copy holds
+    bool flashDirty;
+    unsigned long lastChange;
+    unsigned long lastFlashWrite;
+};
+
+#endif
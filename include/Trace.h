@@ -0,0 +1,83 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <Arduino.h>
+
+/**
+ * Span tracer for a timeline of what the firmware does: input events, state
+ * transitions, frames, I2C transfers, LED shows, flash commits and notes. The
+ * last TRACE_BUFFER_EVENTS events are kept in a ring and "trace dump" prints
+ * them as Chrome trace JSON, which chrome://tracing and ui.perfetto.dev open.
+ *
+ * Recording takes a slot with one atomic increment and fills it in, so it
+ * never blocks and works from ISRs and the esp_timer task as well as the loop.
+ * A dump pauses recording while it reads the ring.
+ *
+ * Enabled by SPAN_TRACE, set in the debug environment. The macros compile to
+ * nothing otherwise.
+ */
+#ifdef SPAN_TRACE
+
+#include <atomic>
+#include <esp_timer.h>
+
+#define TRACE_BUFFER_EVENTS 512 // a power of two
+#define TRACE_INSTANT_EVENT UINT32_MAX // duration of an event without one
+
+struct TraceEvent {
+    uint32_t start;    // esp_timer_get_time(), in us
+    uint32_t duration; // us, or TRACE_INSTANT_EVENT
+    const char *name;  // a string literal, only the pointer is stored
+    uintptr_t task;    // the recording task, 0 in an ISR
+    int32_t arg;
+};
+
+namespace Trace {
+void record(const char *name, uint32_t start, uint32_t duration, int32_t arg);
+void clear();
+void dump(Print &out);
+
+inline uint32_t now() {
+    return (uint32_t)esp_timer_get_time();
+}
+}
+
+/**
+ * Records the rest of the enclosing scope as a span.
+ */
+class TraceSpan {
+public:
+    TraceSpan(const char *name, int32_t arg = 0) : name(name), arg(arg), start(Trace::now()) {}
+
+    ~TraceSpan() {
+        Trace::record(name, start, Trace::now() - start, arg);
+    }
+
+private:
+    const char *name;
+    int32_t arg;
+    uint32_t start;
+};
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+#define TRACE_SPAN(name) TraceSpan TRACE_CONCAT(traceSpan, __LINE__)(name)
+#define TRACE_SPAN_ARG(name, arg) TraceSpan TRACE_CONCAT(traceSpan, __LINE__)(name, arg)
+#define TRACE_INSTANT(name, arg) Trace::record(name, Trace::now(), TRACE_INSTANT_EVENT, arg)
+
+#else
+
+namespace Trace {
+inline void clear() {}
+inline void dump(Print &out) {
+    out.println("trace: disabled in this build, build with -D SPAN_TRACE");
+}
+}
+
+#define TRACE_SPAN(name)
+#define TRACE_SPAN_ARG(name, arg)
+#define TRACE_INSTANT(name, arg) do {} while (0)
+
+#endif
+
+#endif
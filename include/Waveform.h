@@ -0,0 +1,22 @@
+#ifndef WAVEFORM_H
+#define WAVEFORM_H
+
+#include <Arduino.h>
+
+enum WaveShape {
+    WAVE_SAWTOOTH,
+    WAVE_SINE,
+    WAVE_TRIANGLE,
+    WAVE_BREATHE
+};
+
+/**
+ * Integer waveform generator for LED animations. Waves are sampled from 8-bit
+ * lookup tables with a 16-bit phase, so no float or trigonometry runs per frame.
+ */
+namespace Waveform {
+uint8_t sample(WaveShape shape, uint16_t phase);
+uint8_t easeInOut(uint8_t progress);
+}
+
+#endif
@@ -1,290 +1,22 @@
 #pragma once
 
 #include <Arduino.h>
-#include "bitmaps.h"
+#include "AssetPack.h"
 
-typedef const unsigned char (*BitmapPtr)[BITMAP_LENGTH];
-
-const unsigned char PROGMEM play_pause[][BITMAP_LENGTH] = {
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,15,240,255,0,0,0,128,255,15,240,255,1,0,0,128,255,15,240,255,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,255,15,240,255,1,0,0,128,255,15,240,255,1,0,0,0,255,15,240,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,15,240,255,0,0,0,128,255,15,240,255,1,0,0,128,255,15,240,255,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,255,15,240,255,1,0,0,128,255,15,240,255,1,0,0,0,255,15,240,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,15,240,255,0,0,0,128,255,15,240,255,1,0,0,128,255,15,240,255,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,255,15,240,255,1,0,0,128,255,15,240,255,1,0,0,0,255,15,240,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,15,240,255,0,0,0,128,255,15,240,255,1,0,0,128,255,15,240,255,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,255,15,240,255,1,0,0,128,255,15,240,255,1,0,0,0,255,15,240,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,63,0,0,0,0,0,0,128,255,15,0,0,0,0,0,128,255,15,124,0,0,0,0,128,3,12,252,7,0,0,0,128,3,12,252,127,0,0,0,128,3,12,28,254,3,0,0,128,3,12,28,224,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,128,3,0,0,128,3,12,28,192,3,0,0,128,3,12,28,254,3,0,0,128,3,12,252,127,0,0,0,128,3,12,252,7,0,0,0,128,255,15,60,0,0,0,0,128,255,15,0,0,0,0,0,128,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,128,15,0,0,0,0,0,0,128,255,0,0,0,0,0,0,128,253,15,0,0,0,0,0,128,193,31,0,0,0,0,0,128,1,30,3,0,0,0,0,128,1,24,15,0,0,0,0,128,1,24,127,0,0,0,0,128,1,24,255,1,0,0,0,128,1,24,227,7,0,0,0,128,1,24,3,31,0,0,0,128,1,24,3,252,0,0,0,128,1,24,3,240,3,0,0,128,1,24,3,192,15,0,0,128,1,24,3,0,14,0,0,128,1,24,3,0,14,0,0,128,1,24,3,0,14,0,0,128,1,24,3,0,14,0,0,128,1,24,3,0,14,0,0,128,1,24,3,0,14,0,0,128,1,24,3,0,14,0,0,128,1,24,3,0,14,0,0,128,1,24,3,0,14,0,0,128,1,24,3,0,14,0,0,128,1,24,3,0,14,0,0,128,1,24,3,0,14,0,0,128,1,24,3,0,14,0,0,128,1,24,3,0,14,0,0,128,1,24,3,0,14,0,0,128,1,24,3,0,14,0,0,128,1,24,3,0,14,0,0,128,1,24,3,0,14,0,0,128,1,24,3,128,15,0,0,128,1,24,3,240,3,0,0,128,1,24,3,252,0,0,0,128,1,24,3,31,0,0,0,128,1,24,227,7,0,0,0,128,1,24,255,1,0,0,0,128,1,24,127,0,0,0,0,128,1,24,15,0,0,0,0,128,1,28,3,0,0,0,0,128,193,31,0,0,0,0,0,128,253,7,0,0,0,0,0,128,255,0,0,0,0,0,0,128,15,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,192,1,0,0,0,0,0,0,192,7,0,0,0,0,0,0,192,63,0,0,0,0,0,0,192,252,0,0,0,0,0,0,192,240,3,0,0,0,0,0,192,128,31,0,0,0,0,0,192,0,126,0,0,0,0,0,192,0,248,1,0,0,0,0,192,0,240,7,0,0,0,0,192,0,240,15,0,0,0,0,192,0,240,63,0,0,0,0,192,0,240,248,0,0,0,0,192,0,240,224,3,0,0,0,192,0,240,128,15,0,0,0,192,0,240,0,62,0,0,0,192,0,240,0,120,0,0,0,192,0,240,0,240,1,0,0,192,0,240,0,192,7,0,0,192,0,240,0,0,31,0,0,192,0,240,0,0,28,0,0,192,0,240,0,0,24,0,0,192,0,240,0,0,24,0,0,192,0,240,0,0,24,0,0,192,0,240,0,0,24,0,0,192,0,240,0,0,24,0,0,192,0,240,0,0,24,0,0,192,0,240,0,0,28,0,0,192,0,240,0,0,31,0,0,192,0,240,0,192,7,0,0,192,0,240,0,224,1,0,0,192,0,240,0,248,0,0,0,192,0,240,0,62,0,0,0,192,0,240,128,15,0,0,0,192,0,240,224,3,0,0,0,192,0,240,248,0,0,0,0,192,0,240,62,0,0,0,0,192,0,240,15,0,0,0,0,192,0,240,7,0,0,0,0,192,0,248,1,0,0,0,0,192,0,126,0,0,0,0,0,192,128,31,0,0,0,0,0,192,224,3,0,0,0,0,0,192,252,0,0,0,0,0,0,192,63,0,0,0,0,0,0,192,7,0,0,0,0,0,0,192,1,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,0,0,0,0,0,0,0,224,1,0,0,0,0,0,0,224,7,0,0,0,0,0,0,224,31,0,0,0,0,0,0,224,124,0,0,0,0,0,0,224,240,1,0,0,0,0,0,224,192,3,0,0,0,0,0,224,128,15,0,0,0,0,0,224,0,62,0,0,0,0,0,224,0,248,0,0,0,0,0,224,0,240,1,0,0,0,0,224,0,240,7,0,0,0,0,224,0,240,31,0,0,0,0,224,0,112,124,0,0,0,0,224,0,112,240,0,0,0,0,224,0,112,192,3,0,0,0,224,0,112,128,15,0,0,0,224,0,112,0,30,0,0,0,224,0,112,0,120,0,0,0,224,0,112,0,240,1,0,0,224,0,112,0,192,7,0,0,224,0,112,0,0,15,0,0,224,0,112,0,0,62,0,0,224,0,112,0,0,56,0,0,224,0,112,0,0,56,0,0,224,0,112,0,0,60,0,0,224,0,112,0,0,31,0,0,224,0,112,0,192,7,0,0,224,0,112,0,240,1,0,0,224,0,112,0,120,0,0,0,224,0,112,0,62,0,0,0,224,0,112,128,15,0,0,0,224,0,112,192,3,0,0,0,224,0,112,240,0,0,0,0,224,0,112,124,0,0,0,0,224,0,112,31,0,0,0,0,224,0,240,7,0,0,0,0,224,0,240,3,0,0,0,0,224,0,248,0,0,0,0,0,224,0,62,0,0,0,0,0,224,0,15,0,0,0,0,0,224,192,3,0,0,0,0,0,224,240,1,0,0,0,0,0,224,124,0,0,0,0,0,0,224,31,0,0,0,0,0,0,224,7,0,0,0,0,0,0,224,1,0,0,0,0,0,0,96,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,224,0,0,0,0,0,0,0,224,1,0,0,0,0,0,0,224,7,0,0,0,0,0,0,224,31,0,0,0,0,0,0,96,60,0,0,0,0,0,0,96,240,0,0,0,0,0,0,96,224,3,0,0,0,0,0,96,128,15,0,0,0,0,0,96,0,30,0,0,0,0,0,96,0,124,0,0,0,0,0,96,0,240,1,0,0,0,0,96,0,224,3,0,0,0,0,96,0,224,15,0,0,0,0,96,0,96,62,0,0,0,0,96,0,96,120,0,0,0,0,96,0,96,224,1,0,0,0,96,0,96,192,7,0,0,0,96,0,96,0,15,0,0,0,96,0,96,0,60,0,0,0,96,0,96,0,248,0,0,0,96,0,96,0,224,1,0,0,96,0,96,0,128,7,0,0,96,0,96,0,0,31,0,0,96,0,96,0,0,60,0,0,96,0,96,0,0,124,0,0,96,0,96,0,0,30,0,0,96,0,96,0,128,7,0,0,96,0,96,0,224,3,0,0,96,0,96,0,248,0,0,0,96,0,96,0,60,0,0,0,96,0,96,0,31,0,0,0,96,0,96,192,7,0,0,0,96,0,96,224,1,0,0,0,96,0,96,120,0,0,0,0,96,0,96,62,0,0,0,0,96,0,96,15,0,0,0,0,96,0,224,3,0,0,0,0,96,0,240,1,0,0,0,0,96,0,124,0,0,0,0,0,96,0,30,0,0,0,0,0,96,128,15,0,0,0,0,0,96,224,3,0,0,0,0,0,96,240,0,0,0,0,0,0,96,60,0,0,0,0,0,0,224,31,0,0,0,0,0,0,224,7,0,0,0,0,0,0,224,1,0,0,0,0,0,0,224,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,224,0,0,0,0,0,0,0,224,1,0,0,0,0,0,0,224,7,0,0,0,0,0,0,224,31,0,0,0,0,0,0,96,60,0,0,0,0,0,0,96,240,0,0,0,0,0,0,96,224,3,0,0,0,0,0,96,128,15,0,0,0,0,0,96,0,30,0,0,0,0,0,96,0,124,0,0,0,0,0,96,0,240,1,0,0,0,0,96,0,224,3,0,0,0,0,96,0,224,15,0,0,0,0,96,0,96,62,0,0,0,0,96,0,96,120,0,0,0,0,96,0,96,224,1,0,0,0,96,0,96,192,7,0,0,0,96,0,96,0,15,0,0,0,96,0,0,0,60,0,0,0,96,0,0,0,248,0,0,0,96,0,0,0,224,1,0,0,96,0,0,0,128,7,0,0,96,0,0,0,0,31,0,0,96,0,0,0,0,60,0,0,96,0,0,0,0,124,0,0,96,0,0,0,0,30,0,0,96,0,0,0,128,7,0,0,96,0,0,0,224,3,0,0,96,0,0,0,248,0,0,0,96,0,64,0,60,0,0,0,96,0,96,0,31,0,0,0,96,0,96,192,7,0,0,0,96,0,96,224,1,0,0,0,96,0,96,120,0,0,0,0,96,0,96,62,0,0,0,0,96,0,96,15,0,0,0,0,96,0,224,3,0,0,0,0,96,0,240,1,0,0,0,0,96,0,124,0,0,0,0,0,96,0,30,0,0,0,0,0,96,128,15,0,0,0,0,0,96,224,3,0,0,0,0,0,96,240,0,0,0,0,0,0,96,60,0,0,0,0,0,0,224,31,0,0,0,0,0,0,224,7,0,0,0,0,0,0,224,1,0,0,0,0,0,0,224,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,224,0,0,0,0,0,0,0,224,1,0,0,0,0,0,0,224,7,0,0,0,0,0,0,224,31,0,0,0,0,0,0,96,60,0,0,0,0,0,0,96,240,0,0,0,0,0,0,96,224,3,0,0,0,0,0,96,128,15,0,0,0,0,0,96,0,30,0,0,0,0,0,96,0,124,0,0,0,0,0,96,0,240,1,0,0,0,0,96,0,224,3,0,0,0,0,96,0,192,15,0,0,0,0,96,0,0,62,0,0,0,0,96,0,0,120,0,0,0,0,96,0,0,224,1,0,0,0,96,0,0,192,7,0,0,0,96,0,0,0,15,0,0,0,96,0,0,0,60,0,0,0,96,0,0,0,248,0,0,0,96,0,0,0,224,1,0,0,96,0,0,0,128,7,0,0,96,0,0,0,0,31,0,0,96,0,0,0,0,60,0,0,96,0,0,0,0,124,0,0,96,0,0,0,0,30,0,0,96,0,0,0,128,7,0,0,96,0,0,0,224,3,0,0,96,0,0,0,248,0,0,0,96,0,0,0,60,0,0,0,96,0,0,0,31,0,0,0,96,0,0,192,7,0,0,0,96,0,0,224,1,0,0,0,96,0,0,120,0,0,0,0,96,0,0,62,0,0,0,0,96,0,0,15,0,0,0,0,96,0,224,3,0,0,0,0,96,0,240,1,0,0,0,0,96,0,124,0,0,0,0,0,96,0,30,0,0,0,0,0,96,128,15,0,0,0,0,0,96,224,3,0,0,0,0,0,96,240,0,0,0,0,0,0,96,60,0,0,0,0,0,0,224,31,0,0,0,0,0,0,224,7,0,0,0,0,0,0,224,1,0,0,0,0,0,0,224,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,224,0,0,0,0,0,0,0,224,3,0,0,0,0,0,0,224,7,0,0,0,0,0,0,96,31,0,0,0,0,0,0,96,124,0,0,0,0,0,0,96,248,0,0,0,0,0,0,96,224,3,0,0,0,0,0,96,128,15,0,0,0,0,0,96,0,31,0,0,0,0,0,96,0,124,0,0,0,0,0,96,0,240,1,0,0,0,0,96,0,224,7,0,0,0,0,96,0,128,15,0,0,0,0,96,0,0,62,0,0,0,0,96,0,0,248,0,0,0,0,96,0,0,240,1,0,0,0,96,0,0,192,7,0,0,0,96,0,0,0,31,0,0,0,96,0,0,0,62,0,0,0,96,0,0,0,248,0,0,0,96,0,0,0,224,3,0,0,96,0,0,0,192,15,0,0,96,0,0,0,0,31,0,0,96,0,0,0,0,124,0,0,96,0,0,0,0,124,0,0,96,0,0,0,0,31,0,0,96,0,0,0,192,15,0,0,96,0,0,0,224,3,0,0,96,0,0,0,248,0,0,0,96,0,0,0,62,0,0,0,96,0,0,0,31,0,0,0,96,0,0,192,7,0,0,0,96,0,0,240,1,0,0,0,96,0,0,248,0,0,0,0,96,0,0,62,0,0,0,0,96,0,128,15,0,0,0,0,96,0,224,7,0,0,0,0,96,0,240,1,0,0,0,0,96,0,124,0,0,0,0,0,96,0,31,0,0,0,0,0,96,128,15,0,0,0,0,0,96,224,3,0,0,0,0,0,96,248,0,0,0,0,0,0,96,124,0,0,0,0,0,0,96,31,0,0,0,0,0,0,224,7,0,0,0,0,0,0,224,3,0,0,0,0,0,0,224,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,224,0,0,0,0,0,0,0,224,3,0,0,0,0,0,0,224,7,0,0,0,0,0,0,96,31,0,0,0,0,0,0,96,124,0,0,0,0,0,0,96,248,0,0,0,0,0,0,96,224,3,0,0,0,0,0,96,128,15,0,0,0,0,0,96,0,31,0,0,0,0,0,96,0,124,0,0,0,0,0,96,0,240,1,0,0,0,0,96,0,224,7,0,0,0,0,96,0,128,15,0,0,0,0,96,0,0,62,0,0,0,0,96,0,0,248,0,0,0,0,96,0,0,240,1,0,0,0,96,0,0,192,7,0,0,0,96,0,0,0,31,0,0,0,96,0,0,0,62,0,0,0,96,0,0,0,248,0,0,0,96,0,0,0,224,3,0,0,96,0,0,0,192,15,0,0,96,0,0,0,0,31,0,0,96,0,0,0,0,124,0,0,96,0,0,0,0,124,0,0,96,0,0,0,0,31,0,0,96,0,0,0,192,15,0,0,96,0,0,0,224,3,0,0,96,0,0,0,248,0,0,0,96,0,0,0,62,0,0,0,96,0,0,0,31,0,0,0,96,0,0,192,7,0,0,0,96,0,0,240,1,0,0,0,96,0,0,248,0,0,0,0,96,0,0,62,0,0,0,0,96,0,128,15,0,0,0,0,96,0,224,7,0,0,0,0,96,0,240,1,0,0,0,0,96,0,124,0,0,0,0,0,96,0,31,0,0,0,0,0,96,128,15,0,0,0,0,0,96,224,3,0,0,0,0,0,96,248,0,0,0,0,0,0,96,124,0,0,0,0,0,0,96,31,0,0,0,0,0,0,224,7,0,0,0,0,0,0,224,3,0,0,0,0,0,0,224,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,224,0,0,0,0,0,0,0,224,3,0,0,0,0,0,0,224,7,0,0,0,0,0,0,96,31,0,0,0,0,0,0,96,124,0,0,0,0,0,0,96,248,0,0,0,0,0,0,96,224,3,0,0,0,0,0,96,128,15,0,0,0,0,0,96,0,31,0,0,0,0,0,96,0,124,0,0,0,0,0,96,0,240,1,0,0,0,0,96,0,224,7,0,0,0,0,96,0,128,15,0,0,0,0,96,0,0,62,0,0,0,0,96,0,0,248,0,0,0,0,96,0,0,240,1,0,0,0,96,0,0,192,7,0,0,0,96,0,0,0,31,0,0,0,96,0,0,0,62,0,0,0,96,0,0,0,248,0,0,0,96,0,0,0,224,3,0,0,96,0,0,0,192,15,0,0,96,0,0,0,0,31,0,0,96,0,0,0,0,124,0,0,96,0,0,0,0,124,0,0,96,0,0,0,0,31,0,0,96,0,0,0,192,15,0,0,96,0,0,0,224,3,0,0,96,0,0,0,248,0,0,0,96,0,0,0,62,0,0,0,96,0,0,0,31,0,0,0,96,0,0,192,7,0,0,0,96,0,0,240,1,0,0,0,96,0,0,248,0,0,0,0,96,0,0,62,0,0,0,0,96,0,128,15,0,0,0,0,96,0,224,7,0,0,0,0,96,0,240,1,0,0,0,0,96,0,124,0,0,0,0,0,96,0,31,0,0,0,0,0,96,128,15,0,0,0,0,0,96,224,3,0,0,0,0,0,96,248,0,0,0,0,0,0,96,124,0,0,0,0,0,0,96,31,0,0,0,0,0,0,224,7,0,0,0,0,0,0,224,3,0,0,0,0,0,0,224,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,224,0,0,0,0,0,0,0,224,3,0,0,0,0,0,0,224,7,0,0,0,0,0,0,96,31,0,0,0,0,0,0,96,124,0,0,0,0,0,0,96,248,0,0,0,0,0,0,96,224,3,0,0,0,0,0,96,128,15,0,0,0,0,0,96,0,31,0,0,0,0,0,96,0,124,0,0,0,0,0,96,0,240,1,0,0,0,0,96,0,224,7,0,0,0,0,96,0,128,15,0,0,0,0,96,0,0,62,0,0,0,0,96,0,0,248,0,0,0,0,96,0,0,240,1,0,0,0,96,0,0,192,7,0,0,0,96,0,0,0,31,0,0,0,96,0,0,0,62,0,0,0,96,0,0,0,248,0,0,0,96,0,0,0,224,3,0,0,96,0,0,0,192,15,0,0,96,0,0,0,0,31,0,0,96,0,0,0,0,124,0,0,96,0,0,0,0,124,0,0,96,0,0,0,0,31,0,0,96,0,0,0,192,15,0,0,96,0,0,0,224,3,0,0,96,0,0,0,248,0,0,0,96,0,0,0,62,0,0,0,96,0,0,0,31,0,0,0,96,0,0,192,7,0,0,0,96,0,0,240,1,0,0,0,96,0,0,248,0,0,0,0,96,0,0,62,0,0,0,0,96,0,128,15,0,0,0,0,96,0,224,7,0,0,0,0,96,0,240,1,0,0,0,0,96,0,124,0,0,0,0,0,96,0,31,0,0,0,0,0,96,128,15,0,0,0,0,0,96,224,3,0,0,0,0,0,96,248,0,0,0,0,0,0,96,124,0,0,0,0,0,0,96,31,0,0,0,0,0,0,224,7,0,0,0,0,0,0,224,3,0,0,0,0,0,0,224,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,224,0,0,0,0,0,0,0,224,3,0,0,0,0,0,0,224,7,0,0,0,0,0,0,96,31,0,0,0,0,0,0,96,124,0,0,0,0,0,0,96,248,0,0,0,0,0,0,96,224,3,0,0,0,0,0,96,128,15,0,0,0,0,0,96,0,31,0,0,0,0,0,96,0,124,0,0,0,0,0,96,0,240,1,0,0,0,0,96,0,224,7,0,0,0,0,96,0,128,15,0,0,0,0,96,0,0,62,0,0,0,0,96,0,0,248,0,0,0,0,96,0,0,240,1,0,0,0,96,0,0,192,7,0,0,0,96,0,0,0,31,0,0,0,96,0,0,0,62,0,0,0,96,0,0,0,248,0,0,0,96,0,0,0,224,3,0,0,96,0,0,0,192,15,0,0,96,0,0,0,0,31,0,0,96,0,0,0,0,124,0,0,96,0,0,0,0,124,0,0,96,0,0,0,0,31,0,0,96,0,0,0,192,15,0,0,96,0,0,0,224,3,0,0,96,0,0,0,248,0,0,0,96,0,0,0,62,0,0,0,96,0,0,0,31,0,0,0,96,0,0,192,7,0,0,0,96,0,0,240,1,0,0,0,96,0,0,248,0,0,0,0,96,0,0,62,0,0,0,0,96,0,128,15,0,0,0,0,96,0,224,7,0,0,0,0,96,0,240,1,0,0,0,0,96,0,124,0,0,0,0,0,96,0,31,0,0,0,0,0,96,128,15,0,0,0,0,0,96,224,3,0,0,0,0,0,96,248,0,0,0,0,0,0,96,124,0,0,0,0,0,0,96,31,0,0,0,0,0,0,224,7,0,0,0,0,0,0,224,3,0,0,0,0,0,0,224,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,224,0,0,0,0,0,0,0,224,3,0,0,0,0,0,0,224,7,0,0,0,0,0,0,96,31,0,0,0,0,0,0,96,124,0,0,0,0,0,0,96,248,0,0,0,0,0,0,96,224,3,0,0,0,0,0,96,128,15,0,0,0,0,0,96,0,31,0,0,0,0,0,96,0,124,0,0,0,0,0,96,0,240,1,0,0,0,0,96,0,224,7,0,0,0,0,96,0,128,15,0,0,0,0,96,0,0,62,0,0,0,0,96,0,0,248,0,0,0,0,96,0,0,240,1,0,0,0,96,0,0,192,7,0,0,0,96,0,0,0,31,0,0,0,96,0,0,0,62,0,0,0,96,0,0,0,248,0,0,0,96,0,0,0,224,3,0,0,96,0,0,0,192,15,0,0,96,0,0,0,0,31,0,0,96,0,0,0,0,124,0,0,96,0,0,0,0,124,0,0,96,0,0,0,0,31,0,0,96,0,0,0,192,15,0,0,96,0,0,0,224,3,0,0,96,0,0,0,248,0,0,0,96,0,0,0,62,0,0,0,96,0,0,0,31,0,0,0,96,0,0,192,7,0,0,0,96,0,0,240,1,0,0,0,96,0,0,248,0,0,0,0,96,0,0,62,0,0,0,0,96,0,128,15,0,0,0,0,96,0,224,7,0,0,0,0,96,0,240,1,0,0,0,0,96,0,124,0,0,0,0,0,96,0,31,0,0,0,0,0,96,128,15,0,0,0,0,0,96,224,3,0,0,0,0,0,96,248,0,0,0,0,0,0,96,124,0,0,0,0,0,0,96,31,0,0,0,0,0,0,224,7,0,0,0,0,0,0,224,3,0,0,0,0,0,0,224,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,224,0,0,0,0,0,0,0,224,1,0,0,0,0,0,0,224,7,0,0,0,0,0,0,224,31,0,0,0,0,0,0,96,60,0,0,0,0,0,0,96,240,0,0,0,0,0,0,96,224,3,0,0,0,0,0,96,128,15,0,0,0,0,0,96,0,30,0,0,0,0,0,96,0,124,0,0,0,0,0,96,0,240,1,0,0,0,0,96,0,224,3,0,0,0,0,96,0,192,15,0,0,0,0,96,0,0,62,0,0,0,0,96,0,0,120,0,0,0,0,96,0,0,224,1,0,0,0,96,0,0,192,7,0,0,0,96,0,0,0,15,0,0,0,96,0,0,0,60,0,0,0,96,0,0,0,248,0,0,0,96,0,0,0,224,1,0,0,96,0,0,0,128,7,0,0,96,0,0,0,0,31,0,0,96,0,0,0,0,60,0,0,96,0,0,0,0,124,0,0,96,0,0,0,0,30,0,0,96,0,0,0,128,7,0,0,96,0,0,0,224,3,0,0,96,0,0,0,248,0,0,0,96,0,0,0,60,0,0,0,96,0,0,0,31,0,0,0,96,0,0,192,7,0,0,0,96,0,0,224,1,0,0,0,96,0,0,120,0,0,0,0,96,0,0,62,0,0,0,0,96,0,0,15,0,0,0,0,96,0,224,3,0,0,0,0,96,0,240,1,0,0,0,0,96,0,124,0,0,0,0,0,96,0,30,0,0,0,0,0,96,128,15,0,0,0,0,0,96,224,3,0,0,0,0,0,96,240,0,0,0,0,0,0,96,60,0,0,0,0,0,0,224,31,0,0,0,0,0,0,224,7,0,0,0,0,0,0,224,1,0,0,0,0,0,0,224,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,224,0,0,0,0,0,0,0,224,1,0,0,0,0,0,0,224,7,0,0,0,0,0,0,224,31,0,0,0,0,0,0,96,60,0,0,0,0,0,0,96,240,0,0,0,0,0,0,96,224,3,0,0,0,0,0,96,128,15,0,0,0,0,0,96,0,30,0,0,0,0,0,96,0,124,0,0,0,0,0,96,0,240,1,0,0,0,0,96,0,224,3,0,0,0,0,96,0,224,15,0,0,0,0,96,0,96,62,0,0,0,0,96,0,96,120,0,0,0,0,96,0,64,224,1,0,0,0,96,0,0,192,7,0,0,0,96,0,0,0,15,0,0,0,96,0,0,0,60,0,0,0,96,0,0,0,248,0,0,0,96,0,0,0,224,1,0,0,96,0,0,0,128,7,0,0,96,0,0,0,0,31,0,0,96,0,0,0,0,60,0,0,96,0,0,0,0,124,0,0,96,0,0,0,0,30,0,0,96,0,0,0,128,7,0,0,96,0,0,0,224,3,0,0,96,0,0,0,248,0,0,0,96,0,0,0,60,0,0,0,96,0,0,0,31,0,0,0,96,0,0,192,7,0,0,0,96,0,96,224,1,0,0,0,96,0,96,120,0,0,0,0,96,0,96,62,0,0,0,0,96,0,96,15,0,0,0,0,96,0,224,3,0,0,0,0,96,0,240,1,0,0,0,0,96,0,124,0,0,0,0,0,96,0,30,0,0,0,0,0,96,128,15,0,0,0,0,0,96,224,3,0,0,0,0,0,96,240,0,0,0,0,0,0,96,60,0,0,0,0,0,0,224,31,0,0,0,0,0,0,224,7,0,0,0,0,0,0,224,1,0,0,0,0,0,0,224,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,224,0,0,0,0,0,0,0,224,1,0,0,0,0,0,0,224,7,0,0,0,0,0,0,224,31,0,0,0,0,0,0,96,60,0,0,0,0,0,0,96,240,0,0,0,0,0,0,96,224,3,0,0,0,0,0,96,128,15,0,0,0,0,0,96,0,30,0,0,0,0,0,96,0,124,0,0,0,0,0,96,0,240,1,0,0,0,0,96,0,224,3,0,0,0,0,96,0,224,15,0,0,0,0,96,0,96,62,0,0,0,0,96,0,96,120,0,0,0,0,96,0,96,224,1,0,0,0,96,0,96,192,7,0,0,0,96,0,96,0,15,0,0,0,96,0,96,0,60,0,0,0,96,0,96,0,248,0,0,0,96,0,0,0,224,1,0,0,96,0,0,0,128,7,0,0,96,0,0,0,0,31,0,0,96,0,0,0,0,60,0,0,96,0,0,0,0,124,0,0,96,0,0,0,0,30,0,0,96,0,0,0,128,7,0,0,96,0,96,0,224,3,0,0,96,0,96,0,248,0,0,0,96,0,96,0,60,0,0,0,96,0,96,0,31,0,0,0,96,0,96,192,7,0,0,0,96,0,96,224,1,0,0,0,96,0,96,120,0,0,0,0,96,0,96,62,0,0,0,0,96,0,96,15,0,0,0,0,96,0,224,3,0,0,0,0,96,0,240,1,0,0,0,0,96,0,124,0,0,0,0,0,96,0,30,0,0,0,0,0,96,128,15,0,0,0,0,0,96,224,3,0,0,0,0,0,96,240,0,0,0,0,0,0,96,60,0,0,0,0,0,0,224,31,0,0,0,0,0,0,224,7,0,0,0,0,0,0,224,1,0,0,0,0,0,0,224,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,224,0,0,0,0,0,0,0,224,1,0,0,0,0,0,0,224,7,0,0,0,0,0,0,224,31,0,0,0,0,0,0,96,60,0,0,0,0,0,0,96,240,0,0,0,0,0,0,96,224,3,0,0,0,0,0,96,128,15,0,0,0,0,0,96,0,30,0,0,0,0,0,96,0,124,0,0,0,0,0,96,0,240,1,0,0,0,0,96,0,224,3,0,0,0,0,96,0,224,15,0,0,0,0,96,0,96,62,0,0,0,0,96,0,96,120,0,0,0,0,96,0,96,224,1,0,0,0,96,0,96,192,7,0,0,0,96,0,96,0,15,0,0,0,96,0,96,0,60,0,0,0,96,0,96,0,248,0,0,0,96,0,96,0,224,1,0,0,96,0,96,0,128,7,0,0,96,0,96,0,0,31,0,0,96,0,96,0,0,60,0,0,96,0,96,0,0,124,0,0,96,0,96,0,0,30,0,0,96,0,96,0,128,7,0,0,96,0,96,0,224,3,0,0,96,0,96,0,248,0,0,0,96,0,96,0,60,0,0,0,96,0,96,0,31,0,0,0,96,0,96,192,7,0,0,0,96,0,96,224,1,0,0,0,96,0,96,120,0,0,0,0,96,0,96,62,0,0,0,0,96,0,96,15,0,0,0,0,96,0,224,3,0,0,0,0,96,0,240,1,0,0,0,0,96,0,124,0,0,0,0,0,96,0,30,0,0,0,0,0,96,128,15,0,0,0,0,0,96,224,3,0,0,0,0,0,96,240,0,0,0,0,0,0,96,60,0,0,0,0,0,0,224,31,0,0,0,0,0,0,224,7,0,0,0,0,0,0,224,1,0,0,0,0,0,0,224,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,0,0,0,0,0,0,0,224,1,0,0,0,0,0,0,224,7,0,0,0,0,0,0,224,31,0,0,0,0,0,0,224,124,0,0,0,0,0,0,224,240,1,0,0,0,0,0,224,192,7,0,0,0,0,0,224,0,31,0,0,0,0,0,224,0,60,0,0,0,0,0,224,0,240,0,0,0,0,0,224,0,240,1,0,0,0,0,224,0,240,7,0,0,0,0,224,0,240,31,0,0,0,0,224,0,112,124,0,0,0,0,224,0,112,240,0,0,0,0,224,0,112,224,3,0,0,0,224,0,112,128,15,0,0,0,224,0,112,0,30,0,0,0,224,0,112,0,120,0,0,0,224,0,112,0,240,1,0,0,224,0,112,0,192,3,0,0,224,0,112,0,0,15,0,0,224,0,112,0,0,62,0,0,224,0,112,0,0,56,0,0,224,0,112,0,0,56,0,0,224,0,112,0,0,60,0,0,224,0,112,0,0,15,0,0,224,0,112,0,192,7,0,0,224,0,112,0,240,1,0,0,224,0,112,0,120,0,0,0,224,0,112,0,62,0,0,0,224,0,112,128,15,0,0,0,224,0,112,224,3,0,0,0,224,0,112,240,0,0,0,0,224,0,112,124,0,0,0,0,224,0,112,31,0,0,0,0,224,0,240,7,0,0,0,0,224,0,240,1,0,0,0,0,224,0,240,0,0,0,0,0,224,0,124,0,0,0,0,0,224,0,31,0,0,0,0,0,224,192,7,0,0,0,0,0,224,240,1,0,0,0,0,0,224,124,0,0,0,0,0,0,224,31,0,0,0,0,0,0,224,7,0,0,0,0,0,0,224,1,0,0,0,0,0,0,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,192,1,0,0,0,0,0,0,192,15,0,0,0,0,0,0,192,63,0,0,0,0,0,0,192,252,0,0,0,0,0,0,192,240,7,0,0,0,0,0,192,128,31,0,0,0,0,0,192,0,126,0,0,0,0,0,192,0,248,0,0,0,0,0,192,0,240,3,0,0,0,0,192,0,240,15,0,0,0,0,192,0,240,63,0,0,0,0,192,0,240,248,0,0,0,0,192,0,240,224,1,0,0,0,192,0,240,128,7,0,0,0,192,0,240,0,31,0,0,0,192,0,240,0,124,0,0,0,192,0,240,0,240,1,0,0,192,0,240,0,192,7,0,0,192,0,240,0,0,15,0,0,192,0,240,0,0,30,0,0,192,0,240,0,0,24,0,0,192,0,240,0,0,24,0,0,192,0,240,0,0,24,0,0,192,0,240,0,0,24,0,0,192,0,240,0,0,24,0,0,192,0,248,0,0,24,0,0,192,0,248,0,0,28,0,0,192,0,248,0,0,31,0,0,192,0,248,0,192,7,0,0,192,0,248,0,240,1,0,0,192,0,248,0,124,0,0,0,192,0,248,0,31,0,0,0,192,0,248,128,7,0,0,0,192,0,248,224,3,0,0,0,192,0,248,248,0,0,0,0,192,0,248,63,0,0,0,0,192,0,248,15,0,0,0,0,192,0,248,3,0,0,0,0,192,0,248,0,0,0,0,0,192,0,62,0,0,0,0,0,192,128,31,0,0,0,0,0,192,224,7,0,0,0,0,0,192,252,0,0,0,0,0,0,192,63,0,0,0,0,0,0,192,7,0,0,0,0,0,0,192,1,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,192,1,0,0,0,0,0,0,192,15,0,0,0,0,0,0,192,255,0,0,0,0,0,0,192,253,7,0,0,0,0,0,192,193,31,0,0,0,0,0,192,1,30,1,0,0,0,0,192,1,24,7,0,0,0,0,192,1,24,63,0,0,0,0,192,1,24,255,0,0,0,0,192,1,24,243,3,0,0,0,192,1,24,195,15,0,0,0,192,1,24,3,62,0,0,0,192,1,24,3,248,0,0,0,192,1,24,3,224,3,0,0,192,1,24,3,128,15,0,0,192,1,24,3,0,14,0,0,192,1,24,3,0,12,0,0,192,1,24,3,0,12,0,0,192,1,24,3,0,12,0,0,192,1,24,3,0,12,0,0,192,1,152,3,0,12,0,0,192,1,152,3,0,12,0,0,192,1,152,3,0,12,0,0,192,1,152,3,0,12,0,0,192,1,152,3,0,12,0,0,192,1,152,3,0,12,0,0,192,1,152,3,0,12,0,0,192,1,152,3,0,12,0,0,192,1,152,3,0,12,0,0,192,1,152,3,0,12,0,0,192,1,152,3,0,14,0,0,192,1,152,3,128,15,0,0,192,1,152,3,224,7,0,0,192,1,152,3,248,0,0,0,192,1,152,3,62,0,0,0,192,1,152,131,15,0,0,0,192,1,152,243,3,0,0,0,192,1,152,255,0,0,0,0,192,1,152,31,0,0,0,0,192,1,152,7,0,0,0,0,192,1,156,1,0,0,0,0,192,193,31,0,0,0,0,0,192,253,7,0,0,0,0,0,192,127,0,0,0,0,0,0,192,15,0,0,0,0,0,0,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,31,0,0,0,0,0,0,128,255,15,0,0,0,0,0,128,255,31,28,0,0,0,0,128,1,30,252,1,0,0,0,128,1,28,252,15,0,0,0,128,1,28,220,255,0,0,0,128,1,28,12,252,3,0,0,128,1,28,12,192,3,0,0,128,1,28,12,0,3,0,0,128,1,28,12,0,3,0,0,128,1,28,12,0,3,0,0,128,1,28,12,0,3,0,0,128,1,28,12,0,3,0,0,128,1,28,12,0,3,0,0,128,1,28,12,0,3,0,0,128,1,28,12,0,3,0,0,128,1,28,12,0,3,0,0,128,1,28,12,0,3,0,0,128,1,28,12,0,3,0,0,128,1,28,12,0,3,0,0,128,1,28,12,0,3,0,0,128,1,28,12,0,3,0,0,128,1,28,12,0,3,0,0,128,1,28,12,0,3,0,0,128,1,28,12,0,3,0,0,128,1,28,12,0,3,0,0,128,1,28,12,0,3,0,0,128,1,28,12,0,3,0,0,128,1,28,12,0,3,0,0,128,1,28,12,0,3,0,0,128,1,28,12,0,3,0,0,128,1,28,12,0,3,0,0,128,1,28,12,0,3,0,0,128,1,28,12,0,3,0,0,128,1,28,12,0,3,0,0,128,1,28,12,0,3,0,0,128,1,28,12,192,3,0,0,128,1,28,12,248,3,0,0,128,1,28,140,255,0,0,0,128,1,28,252,15,0,0,0,128,1,28,252,0,0,0,0,128,255,31,12,0,0,0,0,128,255,15,0,0,0,0,0,128,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,15,240,255,0,0,0,128,255,15,240,255,1,0,0,128,255,15,240,255,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,255,15,240,255,1,0,0,128,255,15,240,255,1,0,0,0,255,15,240,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,15,240,255,0,0,0,128,255,15,240,255,1,0,0,128,255,15,240,255,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,3,12,48,192,1,0,0,128,255,15,240,255,1,0,0,128,255,15,240,255,1,0,0,0,255,15,240,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    };
+// The animations live in the asset pack, see AssetPack.h. Only the icons drawn
+// on every frame stay in the firmware.
 
 static const unsigned char image_download_bits[] U8X8_PROGMEM = {0xe0,0x03,0x98,0x0c,0x84,0x10,0x02,0x20,0x82,0x20,0x81,0x40,0x81,0x40,0x87,0x70,0x01,0x41,0x01,0x42,0x02,0x20,0x02,0x20,0x84,0x10,0x98,0x0c,0xe0,0x03,0x00,0x00};
 
-static const unsigned char hourglass[][BITMAP_LENGTH] = {
-    {0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,7,0,0,0,0,224,0,0,255,255,255,255,255,255,0,0,254,255,255,255,255,127,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,128,1,0,0,128,1,0,0,128,3,0,0,192,1,0,0,0,3,0,0,224,0,0,0,0,7,0,0,240,0,0,0,0,30,0,0,120,0,0,0,0,60,0,0,60,0,0,0,0,248,0,0,31,0,0,0,0,224,1,128,7,0,0,0,0,192,7,224,3,0,0,0,0,0,15,240,0,0,0,0,0,0,15,240,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,248,0,0,15,0,0,0,0,60,0,0,60,0,0,0,0,30,0,0,120,0,0,0,0,15,0,0,240,0,0,0,0,7,0,0,192,0,0,0,128,3,128,1,192,1,0,0,128,1,224,7,128,1,0,0,128,1,240,15,128,3,0,0,192,1,252,63,128,3,0,0,192,1,254,127,128,3,0,0,192,1,255,255,128,3,0,0,192,129,255,255,129,3,0,0,192,193,255,255,131,3,0,0,192,193,255,255,131,3,0,0,192,225,255,255,135,3,0,0,192,225,255,255,135,3,0,0,192,241,255,255,143,3,0,0,192,241,255,255,143,3,0,0,192,241,255,255,143,3,0,0,254,255,255,255,255,127,0,0,255,255,255,255,255,255,0,0,7,0,0,0,0,224,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,7,0,0,0,0,224,0,0,255,255,255,255,255,255,0,0,254,255,255,255,255,127,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,128,1,0,0,128,1,0,0,128,3,0,0,192,1,0,0,0,3,0,0,224,0,0,0,0,7,0,0,240,0,0,0,0,30,0,0,120,0,0,0,0,60,0,0,60,0,0,0,0,248,0,0,31,0,0,0,0,224,1,128,7,0,0,0,0,192,7,224,3,0,0,0,0,0,15,240,0,0,0,0,0,0,15,240,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,248,0,0,15,0,0,0,0,60,0,0,60,0,0,0,0,30,0,0,120,0,0,0,0,15,0,0,240,0,0,0,0,7,0,0,192,0,0,0,128,3,128,1,192,1,0,0,128,1,224,7,128,1,0,0,128,1,240,15,128,3,0,0,192,1,252,63,128,3,0,0,192,1,254,127,128,3,0,0,192,1,255,255,128,3,0,0,192,129,255,255,129,3,0,0,192,193,255,255,131,3,0,0,192,193,255,255,131,3,0,0,192,225,255,255,135,3,0,0,192,225,255,255,135,3,0,0,192,241,255,255,143,3,0,0,192,241,255,255,143,3,0,0,192,241,255,255,143,3,0,0,254,255,255,255,255,127,0,0,255,255,255,255,255,255,0,0,7,0,0,0,0,224,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,7,0,0,0,0,224,0,0,255,255,255,255,255,255,0,0,254,255,255,255,255,127,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,128,1,0,0,128,1,0,0,128,3,0,0,192,1,0,0,0,3,0,0,224,0,0,0,0,7,0,0,240,0,0,0,0,30,0,0,120,0,0,0,0,60,0,0,60,0,0,0,0,248,0,0,31,0,0,0,0,224,1,128,7,0,0,0,0,192,7,224,3,0,0,0,0,0,15,240,0,0,0,0,0,0,15,240,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,248,0,0,15,0,0,0,0,60,0,0,60,0,0,0,0,30,0,0,120,0,0,0,0,15,0,0,240,0,0,0,0,7,0,0,192,0,0,0,128,3,128,1,192,1,0,0,128,1,224,7,128,1,0,0,128,1,240,15,128,3,0,0,192,1,252,63,128,3,0,0,192,1,254,127,128,3,0,0,192,1,255,255,128,3,0,0,192,129,255,255,129,3,0,0,192,193,255,255,131,3,0,0,192,193,255,255,131,3,0,0,192,225,255,255,135,3,0,0,192,225,255,255,135,3,0,0,192,241,255,255,143,3,0,0,192,241,255,255,143,3,0,0,192,241,255,255,143,3,0,0,254,255,255,255,255,127,0,0,255,255,255,255,255,255,0,0,7,0,0,0,0,224,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,7,0,0,0,0,224,0,0,255,255,255,255,255,255,0,0,254,255,255,255,255,127,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,128,1,0,0,128,1,0,0,128,3,0,0,192,1,0,0,0,3,0,0,224,0,0,0,0,7,0,0,240,0,0,0,0,30,0,0,120,0,0,0,0,60,0,0,60,0,0,0,0,248,0,0,31,0,0,0,0,224,1,128,7,0,0,0,0,192,7,224,3,0,0,0,0,0,15,240,0,0,0,0,0,0,15,240,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,248,0,0,15,0,0,0,0,60,0,0,60,0,0,0,0,30,0,0,120,0,0,0,0,15,0,0,240,0,0,0,0,7,0,0,192,0,0,0,128,3,128,1,192,1,0,0,128,1,224,7,128,1,0,0,128,1,240,15,128,3,0,0,192,1,252,63,128,3,0,0,192,1,254,127,128,3,0,0,192,1,255,255,128,3,0,0,192,129,255,255,129,3,0,0,192,193,255,255,131,3,0,0,192,193,255,255,131,3,0,0,192,225,255,255,135,3,0,0,192,225,255,255,135,3,0,0,192,241,255,255,143,3,0,0,192,241,255,255,143,3,0,0,192,241,255,255,143,3,0,0,254,255,255,255,255,127,0,0,255,255,255,255,255,255,0,0,7,0,0,0,0,224,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,128,127,0,0,0,0,0,0,192,255,63,0,0,0,0,0,192,225,255,31,0,0,0,0,192,0,240,255,7,0,0,0,192,1,0,248,255,3,0,0,128,3,0,0,252,255,1,0,128,255,1,0,0,254,1,0,0,254,255,0,0,192,1,0,0,184,255,127,0,192,0,0,0,24,192,255,63,192,0,0,0,24,0,224,255,255,0,0,0,24,0,0,240,127,0,0,0,24,0,0,0,63,0,0,0,24,0,0,0,3,0,0,0,12,0,0,0,3,0,0,0,12,0,0,0,3,0,0,0,12,0,0,0,3,0,0,0,12,0,0,128,1,0,0,0,28,0,0,128,1,0,0,0,28,0,0,128,1,0,0,0,24,0,0,128,1,0,0,0,56,0,0,192,1,0,0,0,112,0,0,192,0,0,0,0,224,0,0,224,0,0,0,0,192,1,0,112,0,0,0,0,128,3,0,56,0,0,0,0,0,7,0,31,0,0,0,0,0,14,192,7,0,0,0,0,0,30,240,1,0,0,0,0,128,15,120,0,0,0,0,0,224,3,112,0,0,0,0,0,248,0,224,0,0,0,0,0,28,0,192,1,0,0,0,0,14,0,128,3,0,0,0,0,7,0,0,7,0,0,0,0,3,0,0,14,0,0,0,128,3,0,0,28,0,0,0,128,1,192,15,24,0,0,0,128,1,248,31,56,0,0,0,128,1,254,63,56,0,0,0,128,129,255,63,48,0,0,0,192,192,255,127,48,0,0,0,192,224,255,127,48,0,0,0,192,240,255,127,48,0,0,0,192,240,255,127,24,0,0,0,252,248,255,255,24,0,0,0,254,255,255,255,24,0,0,0,255,255,255,255,24,0,0,0,3,252,255,255,24,0,0,0,3,0,254,255,29,0,0,128,3,0,0,255,127,0,0,128,127,0,0,128,255,1,0,128,255,63,0,0,192,1,0,0,192,255,31,0,128,3,0,0,0,224,255,15,0,3,0,0,0,0,248,255,135,3,0,0,0,0,0,252,255,3,0,0,0,0,0,0,254,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,0,0,0,0,0,0,0,224,1,0,0,0,0,0,0,176,3,0,0,0,0,0,0,48,15,0,0,0,0,0,0,24,28,0,0,0,0,0,0,48,56,0,0,0,0,0,0,112,224,0,0,0,0,0,0,224,193,1,0,0,0,0,0,192,131,7,0,0,0,0,0,96,15,14,0,0,0,0,0,96,28,60,0,0,0,0,0,48,120,112,0,0,0,0,0,24,224,224,1,0,0,0,0,24,192,131,3,0,0,0,0,12,0,7,15,0,0,0,0,4,0,30,28,0,0,0,0,6,0,56,120,0,0,0,0,6,0,112,224,0,0,0,0,6,0,192,193,1,0,0,0,6,0,128,3,7,0,0,0,6,0,0,15,14,0,0,0,12,0,0,28,6,0,0,0,12,0,0,120,7,0,0,0,8,0,0,236,3,0,0,0,24,0,0,134,0,0,0,0,24,0,0,7,0,0,0,248,63,0,0,3,0,0,0,254,63,0,128,1,0,0,0,7,0,0,192,1,0,0,0,3,0,0,224,0,0,0,128,1,0,252,127,0,0,0,192,0,0,252,31,0,0,0,224,0,0,24,0,0,0,0,97,0,0,24,0,0,0,192,55,64,0,16,0,0,0,224,62,252,15,48,0,0,0,96,56,255,255,48,0,0,0,112,240,254,255,97,0,0,0,224,192,253,255,99,0,0,0,128,131,251,255,99,0,0,0,0,7,238,255,99,0,0,0,0,30,220,255,97,0,0,0,0,56,120,255,33,0,0,0,0,240,224,254,48,0,0,0,0,192,193,251,56,0,0,0,0,128,7,119,24,0,0,0,0,0,14,94,12,0,0,0,0,0,60,56,14,0,0,0,0,0,112,240,6,0,0,0,0,0,224,193,3,0,0,0,0,0,128,131,7,0,0,0,0,0,0,7,14,0,0,0,0,0,0,28,12,0,0,0,0,0,0,56,24,0,0,0,0,0,0,240,12,0,0,0,0,0,0,192,13,0,0,0,0,0,0,128,7,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,128,7,0,0,0,0,0,0,224,15,0,0,0,0,0,0,96,12,0,0,0,0,0,0,96,12,0,0,0,0,0,0,96,12,0,0,0,0,0,0,96,24,0,0,0,0,0,0,248,24,0,0,0,0,0,192,255,24,0,0,0,0,0,240,195,24,0,192,7,0,0,56,192,24,0,224,15,0,0,12,128,49,0,96,12,32,0,14,128,49,0,96,12,255,1,6,128,49,0,96,252,255,3,3,128,49,0,192,120,0,14,3,128,97,0,192,24,0,156,3,0,99,0,192,24,0,184,1,0,99,0,192,24,3,240,1,0,99,0,128,177,15,224,0,0,99,0,128,49,31,192,0,0,198,0,128,49,63,0,0,0,198,0,128,49,127,0,0,0,198,0,128,97,255,0,0,0,198,0,0,99,254,1,0,0,134,1,0,99,254,3,0,0,140,1,0,99,254,3,0,0,140,1,0,99,254,7,3,0,140,1,0,198,252,7,7,0,140,1,0,198,252,143,15,0,24,3,0,198,252,143,29,0,24,3,0,198,252,199,57,0,24,3,0,134,249,195,96,0,28,3,0,140,249,193,192,255,63,6,0,140,249,96,128,255,48,6,0,140,57,112,0,4,48,6,0,140,1,56,0,0,240,7,0,24,3,28,0,0,224,3,0,24,131,15,0,0,0,0,0,24,255,3,0,0,0,0,0,24,31,0,0,0,0,0,0,24,6,0,0,0,0,0,0,48,6,0,0,0,0,0,0,48,6,0,0,0,0,0,0,48,6,0,0,0,0,0,0,240,7,0,0,0,0,0,0,224,1,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,1,0,0,0,0,0,0,128,7,0,0,0,0,0,0,128,15,0,0,0,0,0,0,192,29,0,0,0,0,0,0,224,24,0,0,0,0,0,0,112,24,0,0,0,0,0,0,56,28,0,0,0,0,0,0,24,12,0,0,0,0,0,0,28,14,0,0,0,0,0,0,14,15,0,0,0,0,0,0,135,31,0,0,0,0,0,128,195,57,0,0,0,0,0,128,225,240,0,0,0,0,0,192,97,192,1,0,0,0,0,224,112,128,3,0,0,0,0,112,56,6,7,0,0,0,0,56,28,14,6,0,0,0,0,24,14,15,12,0,0,0,0,12,134,31,12,0,0,0,0,14,135,31,12,0,0,0,0,135,195,31,12,0,0,0,128,195,225,31,12,0,0,0,128,225,240,31,12,0,0,0,192,96,240,31,12,0,0,0,224,112,248,31,12,0,0,0,112,56,252,31,12,126,0,0,56,28,252,15,204,255,1,0,28,14,254,15,252,195,3,0,12,6,255,15,124,0,7,0,14,135,255,15,12,0,28,28,135,131,255,7,0,0,56,126,195,7,255,7,0,0,240,231,231,15,252,0,0,0,224,195,126,28,0,0,0,0,192,225,56,56,0,48,0,0,224,112,0,240,0,62,0,0,96,48,0,192,195,63,0,0,112,56,0,128,255,51,0,0,56,28,0,0,126,48,0,0,28,14,0,0,0,48,0,0,14,7,0,0,0,48,0,0,6,3,0,0,0,48,0,0,135,1,0,0,0,48,0,128,195,1,0,0,0,48,0,192,225,0,0,0,0,48,0,224,112,0,0,0,0,48,0,96,56,0,0,0,0,48,0,112,24,0,0,0,0,96,0,56,28,0,0,0,0,224,0,28,14,0,0,0,0,192,1,14,7,0,0,0,0,128,3,134,3,0,0,0,0,0,7,135,1,0,0,0,0,0,156,195,1,0,0,0,0,0,248,225,0,0,0,0,0,0,240,112,0,0,0,0,0,0,112,56,0,0,0,0,0,0,48,24,0,0,0,0,0,0,56,28,0,0,0,0,0,0,24,14,0,0,0,0,0,0,24,7,0,0,0,0,0,0,184,3,0,0,0,0,0,0,240,1,0,0,0,0,0,0,224,1,0,0,0,0,0,0,128,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,192,1,0,0,0,0,0,0,255,1,0,0,0,0,0,252,255,1,0,0,0,0,240,255,135,3,0,0,0,192,255,31,128,3,0,0,0,255,127,0,128,3,0,0,252,255,1,0,192,1,0,192,255,7,0,0,255,1,0,192,31,0,0,252,127,0,0,192,1,0,240,255,31,0,0,192,1,192,255,15,24,0,0,128,1,255,63,0,24,0,0,128,255,255,0,0,24,0,0,0,255,3,0,0,24,0,0,0,126,0,0,192,56,0,0,0,96,0,0,252,56,0,0,0,224,0,192,255,48,0,0,0,224,0,252,255,48,0,0,0,192,192,255,127,48,0,0,0,192,248,255,127,48,0,0,0,192,240,255,63,48,0,0,0,192,240,255,63,56,0,0,0,192,225,255,31,24,0,0,0,128,225,255,15,28,0,0,0,128,193,255,7,14,0,0,0,0,3,255,3,7,0,0,0,0,7,252,129,3,0,0,0,0,30,64,192,1,0,0,0,0,124,0,224,0,0,0,0,0,240,1,112,0,0,0,0,0,192,7,248,0,0,0,0,0,0,31,224,3,0,0,0,0,0,14,128,15,0,0,0,0,0,7,0,62,0,0,0,0,128,3,0,120,0,0,0,0,192,1,0,224,0,0,0,0,224,0,0,192,0,0,0,0,112,0,0,128,1,0,0,0,56,0,0,128,1,0,0,0,24,0,0,128,3,0,0,0,28,0,0,0,3,0,0,0,12,0,0,0,3,0,0,0,12,0,0,0,3,0,0,0,12,0,0,0,3,0,0,0,12,0,0,0,7,0,0,0,12,0,0,0,7,0,0,0,28,0,0,0,6,0,0,0,28,0,0,0,118,0,0,0,24,0,0,192,255,0,0,0,24,0,0,255,255,1,0,0,24,0,252,255,128,1,0,0,24,240,255,3,128,3,0,0,248,255,15,0,128,3,0,0,254,63,0,0,248,3,0,128,255,0,0,224,255,3,0,128,3,0,128,255,63,0,0,192,1,0,254,255,0,0,0,192,1,248,255,3,0,0,0,192,225,255,15,0,0,0,0,128,255,63,0,0,0,0,0,128,255,0,0,0,0,0,0,128,3,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,112,0,0,0,0,0,0,0,240,255,1,0,0,0,0,0,240,255,255,3,0,0,0,0,112,224,255,255,15,0,0,0,48,0,192,255,255,31,0,0,48,0,0,0,255,255,1,0,112,0,0,0,0,254,1,0,224,255,1,0,0,128,1,0,192,255,255,3,0,128,1,0,0,238,255,255,15,128,1,0,0,12,128,255,255,255,1,0,0,14,0,0,255,255,0,0,0,6,0,0,0,127,0,0,0,6,0,0,0,7,0,0,0,6,0,0,0,3,0,0,0,6,0,0,0,3,0,0,0,6,0,0,0,3,0,0,0,134,255,255,15,3,0,0,0,134,255,255,15,3,0,0,0,134,255,255,15,3,0,0,0,134,255,255,15,3,0,0,0,142,255,255,135,3,0,0,0,12,255,255,135,1,0,0,0,28,254,255,131,1,0,0,0,56,252,255,193,0,0,0,0,112,248,255,224,0,0,0,0,224,224,63,112,0,0,0,0,192,129,31,60,0,0,0,0,128,7,2,31,0,0,0,0,0,15,192,7,0,0,0,0,0,30,240,1,0,0,0,0,128,15,120,0,0,0,0,0,224,3,240,0,0,0,0,0,248,0,224,1,0,0,0,0,60,0,128,3,0,0,0,0,14,0,0,7,0,0,0,0,7,0,0,14,0,0,0,0,3,0,0,28,0,0,0,128,1,0,0,56,0,0,0,128,1,0,0,48,0,0,0,128,1,0,0,112,0,0,0,192,0,0,0,96,0,0,0,192,0,0,0,96,0,0,0,192,0,0,0,96,0,0,0,192,0,0,0,96,0,0,0,192,0,0,0,96,0,0,0,192,0,0,0,96,0,0,0,192,0,0,0,96,0,0,0,192,0,0,0,96,0,0,0,254,0,0,0,96,0,0,0,255,255,0,0,112,0,0,128,255,255,255,1,112,0,0,128,1,240,255,255,119,0,0,128,1,0,192,255,255,3,0,128,1,0,0,128,255,7,0,128,127,0,0,0,0,14,0,128,255,255,0,0,0,12,0,0,248,255,255,3,0,12,0,0,0,240,255,255,7,14,0,0,0,0,192,255,255,15,0,0,0,0,0,128,255,15,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,252,0,0,0,0,0,0,0,252,255,255,15,0,0,0,0,252,255,255,255,255,127,0,0,12,0,248,255,255,255,1,0,12,0,0,0,192,255,1,0,12,0,0,0,0,192,1,0,28,0,0,0,0,192,1,0,248,255,255,0,0,192,1,0,240,255,255,255,255,231,1,0,0,131,255,255,255,255,0,0,0,3,0,0,252,127,0,0,0,3,0,0,0,3,0,0,0,3,0,0,0,3,0,0,0,3,0,0,0,3,0,0,0,3,0,0,0,3,0,0,0,3,0,0,0,3,0,0,0,3,0,0,0,3,0,0,128,195,255,255,15,3,0,0,128,195,255,255,7,3,0,0,0,195,255,255,7,3,0,0,0,131,255,255,135,3,0,0,0,131,255,255,131,1,0,0,0,7,255,255,129,1,0,0,0,14,254,255,193,1,0,0,0,28,252,255,224,0,0,0,0,60,248,63,240,0,0,0,0,112,224,15,120,0,0,0,0,224,129,3,30,0,0,0,0,192,3,128,15,0,0,0,0,128,7,192,3,0,0,0,0,0,31,240,1,0,0,0,0,128,15,248,0,0,0,0,0,192,3,224,0,0,0,0,0,240,1,192,3,0,0,0,0,120,0,128,7,0,0,0,0,30,0,0,14,0,0,0,0,14,0,0,28,0,0,0,0,7,0,0,56,0,0,0,128,3,0,0,112,0,0,0,128,1,0,0,224,0,0,0,128,1,0,0,224,0,0,0,192,1,0,0,192,0,0,0,192,0,0,0,192,0,0,0,192,0,0,0,192,0,0,0,192,0,0,0,192,1,0,0,192,0,0,0,192,0,0,0,192,0,0,0,192,0,0,0,192,0,0,0,192,0,0,0,192,0,0,0,192,0,0,0,192,0,0,0,192,0,0,0,192,0,0,0,192,0,0,0,254,63,0,0,192,0,0,0,255,255,255,255,193,0,0,128,231,255,255,255,255,15,0,128,3,0,0,255,255,31,0,128,3,0,0,0,0,56,0,128,3,0,0,0,0,48,0,128,255,3,0,0,0,48,0,128,255,255,255,31,0,48,0,0,254,255,255,255,255,63,0,0,0,0,240,255,255,63,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,7,0,0,0,0,224,0,0,255,255,255,255,255,255,0,0,254,255,255,255,255,127,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,225,255,255,135,3,0,0,192,225,255,255,135,3,0,0,192,193,255,255,131,3,0,0,192,193,255,255,131,3,0,0,192,193,255,255,131,3,0,0,128,129,255,255,129,1,0,0,128,3,255,255,192,1,0,0,0,3,255,255,224,0,0,0,0,7,254,127,240,0,0,0,0,30,248,31,120,0,0,0,0,60,224,7,60,0,0,0,0,248,128,1,31,0,0,0,0,224,1,128,7,0,0,0,0,192,7,224,3,0,0,0,0,0,15,240,0,0,0,0,0,0,15,240,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,248,0,0,15,0,0,0,0,60,0,0,60,0,0,0,0,30,0,0,120,0,0,0,0,15,0,0,240,0,0,0,0,7,0,0,192,0,0,0,128,3,0,0,192,1,0,0,128,1,0,0,128,1,0,0,128,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,254,255,255,255,255,127,0,0,255,255,255,255,255,255,0,0,7,0,0,0,0,224,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,7,0,0,0,0,224,0,0,255,255,255,255,255,255,0,0,254,255,255,255,255,127,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,225,255,255,135,3,0,0,192,225,255,255,135,3,0,0,192,193,255,255,131,3,0,0,192,193,255,255,131,3,0,0,192,193,255,255,131,3,0,0,128,129,255,255,129,1,0,0,128,3,255,255,192,1,0,0,0,3,255,255,224,0,0,0,0,7,254,127,240,0,0,0,0,30,248,31,120,0,0,0,0,60,224,7,60,0,0,0,0,248,128,1,31,0,0,0,0,224,1,128,7,0,0,0,0,192,7,224,3,0,0,0,0,0,15,240,0,0,0,0,0,0,15,240,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,248,0,0,15,0,0,0,0,60,0,0,60,0,0,0,0,30,0,0,120,0,0,0,0,15,0,0,240,0,0,0,0,7,0,0,192,0,0,0,128,3,0,0,192,1,0,0,128,1,0,0,128,1,0,0,128,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,254,255,255,255,255,127,0,0,255,255,255,255,255,255,0,0,7,0,0,0,0,224,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,7,0,0,0,0,224,0,0,255,255,255,255,255,255,0,0,254,255,255,255,255,127,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,225,255,255,135,3,0,0,192,225,255,255,135,3,0,0,192,193,255,255,131,3,0,0,192,193,255,255,131,3,0,0,192,193,255,255,131,3,0,0,128,129,255,255,129,1,0,0,128,3,255,255,192,1,0,0,0,3,255,255,224,0,0,0,0,7,254,127,240,0,0,0,0,30,248,31,120,0,0,0,0,60,224,7,60,0,0,0,0,248,128,1,31,0,0,0,0,224,1,128,7,0,0,0,0,192,7,224,3,0,0,0,0,0,15,240,0,0,0,0,0,0,15,240,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,248,0,0,15,0,0,0,0,60,0,0,60,0,0,0,0,30,0,0,120,0,0,0,0,15,0,0,240,0,0,0,0,7,0,0,192,0,0,0,128,3,0,0,192,1,0,0,128,1,0,0,128,1,0,0,128,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,254,255,255,255,255,127,0,0,255,255,255,255,255,255,0,0,7,0,0,0,0,224,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,7,0,0,0,0,224,0,0,255,255,255,255,255,255,0,0,254,255,255,255,255,127,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,225,255,255,135,3,0,0,192,225,255,255,135,3,0,0,192,193,255,255,131,3,0,0,192,193,255,255,131,3,0,0,192,193,255,255,131,3,0,0,128,129,255,255,129,1,0,0,128,3,255,255,192,1,0,0,0,3,255,255,224,0,0,0,0,7,254,127,240,0,0,0,0,30,248,31,120,0,0,0,0,60,224,7,60,0,0,0,0,248,128,1,31,0,0,0,0,224,1,128,7,0,0,0,0,192,7,224,3,0,0,0,0,0,15,240,0,0,0,0,0,0,15,240,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,248,0,0,15,0,0,0,0,60,0,0,60,0,0,0,0,30,0,0,120,0,0,0,0,15,0,0,240,0,0,0,0,7,0,0,192,0,0,0,128,3,0,0,192,1,0,0,128,1,0,0,128,1,0,0,128,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,254,255,255,255,255,127,0,0,255,255,255,255,255,255,0,0,7,0,0,0,0,224,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,7,0,0,0,0,224,0,0,255,255,255,255,255,255,0,0,254,255,255,255,255,127,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,225,255,255,135,3,0,0,192,225,255,255,135,3,0,0,192,193,255,255,131,3,0,0,192,193,255,255,131,3,0,0,192,193,255,255,131,3,0,0,128,129,255,255,129,1,0,0,128,3,255,255,192,1,0,0,0,3,255,255,224,0,0,0,0,7,254,127,240,0,0,0,0,30,248,31,120,0,0,0,0,60,224,7,60,0,0,0,0,248,128,1,31,0,0,0,0,224,1,128,7,0,0,0,0,192,7,224,3,0,0,0,0,0,15,240,0,0,0,0,0,0,15,240,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,248,0,0,15,0,0,0,0,60,0,0,60,0,0,0,0,30,0,0,120,0,0,0,0,15,0,0,240,0,0,0,0,7,0,0,192,0,0,0,128,3,0,0,192,1,0,0,128,1,0,0,128,1,0,0,128,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,254,255,255,255,255,127,0,0,255,255,255,255,255,255,0,0,7,0,0,0,0,224,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,7,0,0,0,0,224,0,0,255,255,255,255,255,255,0,0,254,255,255,255,255,127,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,225,255,255,135,3,0,0,192,225,255,255,135,3,0,0,192,193,255,255,131,3,0,0,192,193,255,255,131,3,0,0,192,193,255,255,131,3,0,0,128,129,255,255,129,1,0,0,128,3,255,255,192,1,0,0,0,3,255,255,224,0,0,0,0,7,254,127,240,0,0,0,0,30,248,31,120,0,0,0,0,60,224,7,60,0,0,0,0,248,128,1,31,0,0,0,0,224,1,128,7,0,0,0,0,192,7,224,3,0,0,0,0,0,15,240,0,0,0,0,0,0,15,240,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,248,0,0,15,0,0,0,0,60,0,0,60,0,0,0,0,30,0,0,120,0,0,0,0,15,0,0,240,0,0,0,0,7,0,0,192,0,0,0,128,3,0,0,192,1,0,0,128,1,0,0,128,1,0,0,128,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,254,255,255,255,255,127,0,0,255,255,255,255,255,255,0,0,7,0,0,0,0,224,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,7,0,0,0,0,224,0,0,255,255,255,255,255,255,0,0,254,255,255,255,255,127,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,225,255,255,135,3,0,0,192,225,255,255,135,3,0,0,192,193,255,255,131,3,0,0,192,193,255,255,131,3,0,0,192,193,255,255,131,3,0,0,128,129,255,255,129,1,0,0,128,3,255,255,192,1,0,0,0,3,255,255,224,0,0,0,0,7,254,127,240,0,0,0,0,30,248,31,120,0,0,0,0,60,224,7,60,0,0,0,0,248,128,1,31,0,0,0,0,224,1,128,7,0,0,0,0,192,7,224,3,0,0,0,0,0,15,240,0,0,0,0,0,0,15,240,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,248,0,0,15,0,0,0,0,60,0,0,60,0,0,0,0,30,0,0,120,0,0,0,0,15,0,0,240,0,0,0,0,7,0,0,192,0,0,0,128,3,0,0,192,1,0,0,128,1,0,0,128,1,0,0,128,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,254,255,255,255,255,127,0,0,255,255,255,255,255,255,0,0,7,0,0,0,0,224,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,7,0,0,0,0,224,0,0,255,255,255,255,255,255,0,0,254,255,255,255,255,127,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,225,255,255,135,3,0,0,192,225,255,255,135,3,0,0,192,193,255,255,131,3,0,0,192,193,255,255,131,3,0,0,192,193,255,255,131,3,0,0,128,129,255,255,129,1,0,0,128,3,255,255,192,1,0,0,0,3,255,255,224,0,0,0,0,7,254,127,240,0,0,0,0,30,248,31,120,0,0,0,0,60,224,7,60,0,0,0,0,248,128,1,31,0,0,0,0,224,129,129,7,0,0,0,0,192,135,225,3,0,0,0,0,0,143,241,0,0,0,0,0,0,15,240,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,248,0,0,15,0,0,0,0,60,0,0,60,0,0,0,0,30,0,0,120,0,0,0,0,15,0,0,240,0,0,0,0,7,0,0,192,0,0,0,128,3,0,0,192,1,0,0,128,1,0,0,128,1,0,0,128,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,254,255,255,255,255,127,0,0,255,255,255,255,255,255,0,0,7,0,0,0,0,224,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,7,0,0,0,0,224,0,0,255,255,255,255,255,255,0,0,254,255,255,255,255,127,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,225,255,255,135,3,0,0,192,193,255,255,131,3,0,0,192,193,255,255,131,3,0,0,192,193,255,255,131,3,0,0,128,129,255,255,129,1,0,0,128,3,255,255,192,1,0,0,0,3,255,255,224,0,0,0,0,7,254,127,240,0,0,0,0,30,248,31,120,0,0,0,0,60,224,7,60,0,0,0,0,248,128,1,31,0,0,0,0,224,129,129,7,0,0,0,0,192,135,225,3,0,0,0,0,0,143,241,0,0,0,0,0,0,143,241,0,0,0,0,0,192,135,225,3,0,0,0,0,224,129,129,7,0,0,0,0,248,128,1,15,0,0,0,0,60,128,1,60,0,0,0,0,30,128,1,120,0,0,0,0,15,128,1,240,0,0,0,0,7,128,1,192,0,0,0,128,3,128,1,192,1,0,0,128,1,0,0,128,1,0,0,128,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,254,255,255,255,255,127,0,0,255,255,255,255,255,255,0,0,7,0,0,0,0,224,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,7,0,0,0,0,224,0,0,255,255,255,255,255,255,0,0,254,255,255,255,255,127,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,193,255,255,131,3,0,0,128,129,255,255,129,1,0,0,128,3,255,255,192,1,0,0,0,3,255,255,224,0,0,0,0,7,254,127,240,0,0,0,0,30,248,31,120,0,0,0,0,60,224,7,60,0,0,0,0,248,128,1,31,0,0,0,0,224,129,129,7,0,0,0,0,192,135,225,3,0,0,0,0,0,143,241,0,0,0,0,0,0,143,241,0,0,0,0,0,192,135,225,3,0,0,0,0,224,129,129,7,0,0,0,0,248,128,1,15,0,0,0,0,60,128,1,60,0,0,0,0,30,128,1,120,0,0,0,0,15,128,1,240,0,0,0,0,7,128,1,192,0,0,0,128,3,128,1,192,1,0,0,128,1,128,1,128,1,0,0,128,1,128,1,128,3,0,0,192,1,128,1,128,3,0,0,192,1,128,1,128,3,0,0,192,1,128,1,128,3,0,0,192,1,128,1,128,3,0,0,192,1,128,1,128,3,0,0,192,1,128,1,128,3,0,0,192,1,128,1,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,192,3,128,3,0,0,254,255,255,255,255,127,0,0,255,255,255,255,255,255,0,0,7,0,0,0,0,224,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,7,0,0,0,0,224,0,0,255,255,255,255,255,255,0,0,254,255,255,255,255,127,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,128,1,0,0,128,1,0,0,128,3,0,0,192,1,0,0,0,3,254,127,224,0,0,0,0,7,254,127,240,0,0,0,0,30,248,31,120,0,0,0,0,60,224,7,60,0,0,0,0,248,128,1,31,0,0,0,0,224,129,129,7,0,0,0,0,192,135,225,3,0,0,0,0,0,143,241,0,0,0,0,0,0,143,241,0,0,0,0,0,192,135,225,3,0,0,0,0,224,129,129,7,0,0,0,0,248,128,1,15,0,0,0,0,60,128,1,60,0,0,0,0,30,128,1,120,0,0,0,0,15,128,1,240,0,0,0,0,7,128,1,192,0,0,0,128,3,128,1,192,1,0,0,128,1,128,1,128,1,0,0,128,1,128,1,128,3,0,0,192,1,128,1,128,3,0,0,192,1,128,1,128,3,0,0,192,1,128,1,128,3,0,0,192,1,128,1,128,3,0,0,192,1,128,1,128,3,0,0,192,1,128,1,128,3,0,0,192,1,128,1,128,3,0,0,192,1,192,3,128,3,0,0,192,1,240,15,128,3,0,0,192,1,248,31,128,3,0,0,192,1,254,127,128,3,0,0,254,255,255,255,255,127,0,0,255,255,255,255,255,255,0,0,7,0,0,0,0,224,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,7,0,0,0,0,224,0,0,255,255,255,255,255,255,0,0,254,255,255,255,255,127,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,128,1,0,0,128,1,0,0,128,3,0,0,192,1,0,0,0,3,0,0,224,0,0,0,0,7,0,0,240,0,0,0,0,30,0,0,120,0,0,0,0,60,224,7,60,0,0,0,0,248,128,1,31,0,0,0,0,224,129,129,7,0,0,0,0,192,135,225,3,0,0,0,0,0,143,241,0,0,0,0,0,0,143,241,0,0,0,0,0,192,135,225,3,0,0,0,0,224,129,129,7,0,0,0,0,248,128,1,15,0,0,0,0,60,128,1,60,0,0,0,0,30,128,1,120,0,0,0,0,15,128,1,240,0,0,0,0,7,128,1,192,0,0,0,128,3,128,1,192,1,0,0,128,1,128,1,128,1,0,0,128,1,128,1,128,3,0,0,192,1,128,1,128,3,0,0,192,1,128,1,128,3,0,0,192,1,128,1,128,3,0,0,192,1,128,3,128,3,0,0,192,1,224,7,128,3,0,0,192,1,240,31,128,3,0,0,192,1,252,63,128,3,0,0,192,1,254,127,128,3,0,0,192,1,255,255,128,3,0,0,192,129,255,255,129,3,0,0,192,193,255,255,131,3,0,0,254,255,255,255,255,127,0,0,255,255,255,255,255,255,0,0,7,0,0,0,0,224,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,7,0,0,0,0,224,0,0,255,255,255,255,255,255,0,0,254,255,255,255,255,127,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,128,1,0,0,128,1,0,0,128,3,0,0,192,1,0,0,0,3,0,0,224,0,0,0,0,7,0,0,240,0,0,0,0,30,0,0,120,0,0,0,0,60,0,0,60,0,0,0,0,248,0,0,31,0,0,0,0,224,1,128,7,0,0,0,0,192,7,224,3,0,0,0,0,0,15,240,0,0,0,0,0,0,15,240,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,248,128,1,15,0,0,0,0,60,128,1,60,0,0,0,0,30,128,1,120,0,0,0,0,15,128,1,240,0,0,0,0,7,128,1,192,0,0,0,128,3,128,1,192,1,0,0,128,1,128,1,128,1,0,0,128,1,128,1,128,3,0,0,192,1,192,3,128,3,0,0,192,1,224,7,128,3,0,0,192,1,248,31,128,3,0,0,192,1,252,63,128,3,0,0,192,1,254,127,128,3,0,0,192,1,255,255,128,3,0,0,192,129,255,255,129,3,0,0,192,193,255,255,131,3,0,0,192,225,255,255,135,3,0,0,192,225,255,255,135,3,0,0,192,225,255,255,143,3,0,0,254,255,255,255,255,127,0,0,255,255,255,255,255,255,0,0,7,0,0,0,0,224,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,7,0,0,0,0,224,0,0,255,255,255,255,255,255,0,0,254,255,255,255,255,127,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,128,1,0,0,128,1,0,0,128,3,0,0,192,1,0,0,0,3,0,0,224,0,0,0,0,7,0,0,240,0,0,0,0,30,0,0,120,0,0,0,0,60,0,0,60,0,0,0,0,248,0,0,31,0,0,0,0,224,1,128,7,0,0,0,0,192,7,224,3,0,0,0,0,0,15,240,0,0,0,0,0,0,15,240,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,248,0,0,15,0,0,0,0,60,0,0,60,0,0,0,0,30,0,0,120,0,0,0,0,15,0,0,240,0,0,0,0,7,0,0,192,0,0,0,128,3,0,0,192,1,0,0,128,1,192,3,128,1,0,0,128,1,240,15,128,3,0,0,192,1,248,31,128,3,0,0,192,1,254,127,128,3,0,0,192,1,255,255,128,3,0,0,192,129,255,255,129,3,0,0,192,129,255,255,131,3,0,0,192,193,255,255,131,3,0,0,192,225,255,255,135,3,0,0,192,225,255,255,135,3,0,0,192,225,255,255,135,3,0,0,192,241,255,255,143,3,0,0,192,241,255,255,143,3,0,0,254,255,255,255,255,127,0,0,255,255,255,255,255,255,0,0,7,0,0,0,0,224,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,7,0,0,0,0,224,0,0,255,255,255,255,255,255,0,0,254,255,255,255,255,127,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,128,1,0,0,128,1,0,0,128,3,0,0,192,1,0,0,0,3,0,0,224,0,0,0,0,7,0,0,240,0,0,0,0,30,0,0,120,0,0,0,0,60,0,0,60,0,0,0,0,248,0,0,31,0,0,0,0,224,1,128,7,0,0,0,0,192,7,224,3,0,0,0,0,0,15,240,0,0,0,0,0,0,15,240,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,248,0,0,15,0,0,0,0,60,0,0,60,0,0,0,0,30,0,0,120,0,0,0,0,15,0,0,240,0,0,0,0,7,0,0,192,0,0,0,128,3,192,3,192,1,0,0,128,1,240,15,128,1,0,0,128,1,248,31,128,3,0,0,192,1,254,127,128,3,0,0,192,1,255,255,128,3,0,0,192,129,255,255,129,3,0,0,192,129,255,255,129,3,0,0,192,193,255,255,131,3,0,0,192,225,255,255,135,3,0,0,192,225,255,255,135,3,0,0,192,225,255,255,135,3,0,0,192,241,255,255,143,3,0,0,192,241,255,255,143,3,0,0,192,241,255,255,143,3,0,0,254,255,255,255,255,127,0,0,255,255,255,255,255,255,0,0,7,0,0,0,0,224,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,7,0,0,0,0,224,0,0,255,255,255,255,255,255,0,0,254,255,255,255,255,127,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,192,1,0,0,128,3,0,0,128,1,0,0,128,1,0,0,128,3,0,0,192,1,0,0,0,3,0,0,224,0,0,0,0,7,0,0,240,0,0,0,0,30,0,0,120,0,0,0,0,60,0,0,60,0,0,0,0,248,0,0,31,0,0,0,0,224,1,128,7,0,0,0,0,192,7,224,3,0,0,0,0,0,15,240,0,0,0,0,0,0,15,240,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,248,0,0,15,0,0,0,0,60,0,0,60,0,0,0,0,30,0,0,120,0,0,0,0,15,0,0,240,0,0,0,0,7,0,0,192,0,0,0,128,3,192,3,192,1,0,0,128,1,240,15,128,1,0,0,128,1,248,31,128,3,0,0,192,1,254,127,128,3,0,0,192,1,255,255,128,3,0,0,192,129,255,255,129,3,0,0,192,129,255,255,129,3,0,0,192,193,255,255,131,3,0,0,192,225,255,255,135,3,0,0,192,225,255,255,135,3,0,0,192,225,255,255,135,3,0,0,192,241,255,255,143,3,0,0,192,241,255,255,143,3,0,0,192,241,255,255,143,3,0,0,254,255,255,255,255,127,0,0,255,255,255,255,255,255,0,0,7,0,0,0,0,224,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,3,0,0,0,0,192,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0},
-    };
-
-static const unsigned char watch[][BITMAP_LENGTH] = {
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,128,1,128,7,0,0,240,0,128,1,0,15,0,0,120,0,128,1,0,30,0,0,60,0,128,1,0,60,0,0,30,0,128,1,0,120,0,0,15,0,128,1,0,240,0,0,7,0,128,1,0,224,0,128,3,0,128,1,0,192,1,128,1,0,128,1,0,128,1,192,1,0,128,1,0,128,3,224,0,0,128,1,0,0,7,224,0,0,128,1,0,0,7,96,0,0,128,1,0,0,6,112,0,0,128,1,0,0,14,112,0,0,128,1,0,0,14,48,0,0,128,1,0,0,12,56,0,0,128,1,0,0,28,56,0,0,128,1,0,0,28,56,0,0,128,1,0,0,28,24,0,0,192,3,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,240,15,0,0,24,24,0,0,240,15,0,0,24,24,0,0,240,7,0,0,24,24,0,0,240,7,0,0,24,24,0,0,248,1,0,0,24,56,0,0,28,0,0,0,28,56,0,0,14,0,0,0,28,56,0,0,7,0,0,0,28,48,0,128,3,0,0,0,12,112,0,192,1,0,0,0,14,112,0,224,0,0,0,0,14,96,0,112,0,0,0,0,6,224,0,32,0,0,0,0,7,224,0,0,0,0,0,0,7,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,3,30,0,0,60,0,0,0,7,60,0,0,30,0,0,128,3,120,0,0,15,0,0,128,3,240,0,0,7,0,0,128,1,224,0,128,3,0,0,192,1,192,1,128,1,0,0,192,0,128,1,192,1,0,0,224,0,128,3,224,0,0,0,96,0,0,7,224,0,0,0,112,0,0,7,96,0,0,0,48,0,0,6,112,0,0,0,56,0,0,14,112,0,0,0,56,0,0,14,48,0,0,0,28,0,0,12,56,0,0,0,28,0,0,28,56,0,0,0,14,0,0,28,56,0,0,0,14,0,0,28,24,0,0,128,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,240,15,0,0,24,24,0,0,240,15,0,0,24,24,0,0,248,7,0,0,24,24,0,0,252,7,0,0,24,24,0,0,159,1,0,0,24,56,0,192,7,0,0,0,28,56,0,224,3,0,0,0,28,56,0,248,0,0,0,0,28,48,0,60,0,0,0,0,12,112,0,24,0,0,0,0,14,112,0,0,0,0,0,0,14,96,0,0,0,0,0,0,6,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,0,0,0,240,0,0,7,0,0,0,0,224,0,128,3,0,0,0,0,192,1,128,1,0,0,0,0,131,1,192,1,0,0,0,128,131,3,224,0,0,0,0,192,3,7,224,0,0,0,0,240,0,7,96,0,0,0,0,120,0,6,112,0,0,0,0,60,0,14,112,0,0,0,0,30,0,14,48,0,0,0,128,7,0,12,56,0,0,0,192,3,0,28,56,0,0,0,224,1,0,28,56,0,0,0,240,0,0,28,24,0,0,128,61,0,0,24,24,0,0,224,31,0,0,24,24,0,0,224,15,0,0,24,24,0,0,240,15,0,0,24,24,0,0,248,15,0,0,24,24,0,0,255,7,0,0,24,24,0,224,255,7,0,0,24,24,0,252,131,1,0,0,24,56,0,126,0,0,0,0,28,56,0,14,0,0,0,0,28,56,0,0,0,0,0,0,28,48,0,0,0,0,0,0,12,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,96,0,0,0,0,0,0,6,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,0,0,0,240,0,0,7,0,0,0,0,224,0,128,3,0,0,0,0,192,1,128,1,0,0,0,0,128,1,192,1,0,0,0,0,128,3,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,0,0,0,60,28,56,0,0,0,0,192,63,28,24,0,0,128,1,252,31,24,24,0,0,224,231,255,1,24,24,0,0,224,255,15,0,24,24,0,0,254,255,0,0,24,24,0,254,255,15,0,0,24,24,0,255,255,7,0,0,24,24,0,30,224,7,0,0,24,24,0,0,128,1,0,0,24,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,48,0,0,0,0,0,0,12,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,96,0,0,0,0,0,0,6,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,0,0,0,240,0,0,7,0,0,0,0,224,0,128,3,0,0,0,0,192,1,128,1,0,0,0,0,128,1,192,1,0,0,0,0,128,3,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,24,0,0,128,1,0,0,24,24,0,30,224,7,0,0,24,24,0,255,255,7,0,0,24,24,0,254,255,15,0,0,24,24,0,0,254,255,0,0,24,24,0,0,224,255,15,0,24,24,0,0,224,231,255,1,24,24,0,0,128,1,252,31,24,56,0,0,0,0,192,63,28,56,0,0,0,0,0,60,28,56,0,0,0,0,0,0,28,48,0,0,0,0,0,0,12,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,96,0,0,0,0,0,0,6,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,0,0,0,240,0,0,7,0,0,0,0,224,0,128,3,0,0,0,0,192,1,128,1,0,0,0,0,128,1,192,1,0,0,0,0,128,3,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,14,0,0,0,0,28,56,0,126,0,0,0,0,28,24,0,252,131,1,0,0,24,24,0,224,255,7,0,0,24,24,0,0,255,7,0,0,24,24,0,0,248,15,0,0,24,24,0,0,240,15,0,0,24,24,0,0,224,15,0,0,24,24,0,0,224,31,0,0,24,24,0,0,128,61,0,0,24,56,0,0,0,240,0,0,28,56,0,0,0,224,1,0,28,56,0,0,0,192,3,0,28,48,0,0,0,128,7,0,12,112,0,0,0,0,30,0,14,112,0,0,0,0,60,0,14,96,0,0,0,0,120,0,6,224,0,0,0,0,240,0,7,224,0,0,0,0,192,3,7,192,1,0,0,0,128,131,3,128,1,0,0,0,0,131,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,0,0,0,240,0,0,7,0,0,0,0,224,0,128,3,0,0,0,0,192,1,128,1,0,0,0,0,128,1,192,1,0,0,0,0,128,3,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,24,0,0,0,0,14,48,0,60,0,0,0,0,12,56,0,248,0,0,0,0,28,56,0,224,3,0,0,0,28,56,0,192,7,0,0,0,28,24,0,0,159,1,0,0,24,24,0,0,252,7,0,0,24,24,0,0,248,7,0,0,24,24,0,0,240,15,0,0,24,24,0,0,240,15,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,128,7,0,0,24,56,0,0,0,14,0,0,28,56,0,0,0,14,0,0,28,56,0,0,0,28,0,0,28,48,0,0,0,28,0,0,12,112,0,0,0,56,0,0,14,112,0,0,0,56,0,0,14,96,0,0,0,48,0,0,6,224,0,0,0,112,0,0,7,224,0,0,0,96,0,0,7,192,1,0,0,224,0,128,3,128,1,0,0,192,0,128,1,128,3,0,0,192,1,192,1,0,7,0,0,128,1,224,0,0,15,0,0,128,3,240,0,0,30,0,0,128,3,120,0,0,60,0,0,0,7,60,0,0,120,0,0,0,3,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,0,0,0,240,0,0,7,0,0,0,0,224,0,128,3,0,0,0,0,192,1,128,1,0,0,0,0,128,1,192,1,0,0,0,0,128,3,224,0,0,0,0,0,0,7,224,0,32,0,0,0,0,7,96,0,112,0,0,0,0,6,112,0,224,0,0,0,0,14,112,0,192,1,0,0,0,14,48,0,128,3,0,0,0,12,56,0,0,7,0,0,0,28,56,0,0,14,0,0,0,28,56,0,0,28,0,0,0,28,24,0,0,248,1,0,0,24,24,0,0,240,7,0,0,24,24,0,0,240,7,0,0,24,24,0,0,240,15,0,0,24,24,0,0,240,15,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,192,3,0,0,24,56,0,0,128,1,0,0,28,56,0,0,128,1,0,0,28,56,0,0,128,1,0,0,28,48,0,0,128,1,0,0,12,112,0,0,128,1,0,0,14,112,0,0,128,1,0,0,14,96,0,0,128,1,0,0,6,224,0,0,128,1,0,0,7,224,0,0,128,1,0,0,7,192,1,0,128,1,0,128,3,128,1,0,128,1,0,128,1,128,3,0,128,1,0,192,1,0,7,0,128,1,0,224,0,0,15,0,128,1,0,240,0,0,30,0,128,1,0,120,0,0,60,0,128,1,0,60,0,0,120,0,128,1,0,30,0,0,240,0,128,1,0,15,0,0,224,1,128,1,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,0,0,0,240,0,0,7,0,0,0,0,224,0,128,3,0,0,0,0,192,1,128,1,0,0,0,0,128,1,192,1,0,1,0,0,128,3,224,0,128,3,0,0,0,7,224,0,128,3,0,0,0,7,96,0,0,7,0,0,0,6,112,0,0,14,0,0,0,14,112,0,0,14,0,0,0,14,48,0,0,28,0,0,0,12,56,0,0,28,0,0,0,28,56,0,0,56,0,0,0,28,56,0,0,112,0,0,0,28,24,0,0,240,1,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,240,15,0,0,24,24,0,0,240,15,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,1,0,0,24,56,0,0,112,0,0,0,28,56,0,0,112,0,0,0,28,56,0,0,56,0,0,0,28,48,0,0,56,0,0,0,12,112,0,0,28,0,0,0,14,112,0,0,28,0,0,0,14,96,0,0,12,0,0,0,6,224,0,0,14,0,0,0,7,224,0,0,6,0,0,0,7,192,1,0,7,0,0,128,3,128,1,0,3,0,0,128,1,128,3,128,3,0,0,192,1,0,7,128,1,0,0,224,0,0,15,192,1,0,0,240,0,0,30,192,1,0,0,120,0,0,60,224,0,0,0,60,0,0,120,192,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,0,0,0,240,0,0,7,0,0,0,0,224,0,128,3,0,0,0,0,192,1,128,1,0,12,0,0,128,1,192,1,0,28,0,0,128,3,224,0,0,28,0,0,0,7,224,0,0,24,0,0,0,7,96,0,0,56,0,0,0,6,112,0,0,56,0,0,0,14,112,0,0,48,0,0,0,14,48,0,0,112,0,0,0,12,56,0,0,112,0,0,0,28,56,0,0,96,0,0,0,28,56,0,0,224,0,0,0,28,24,0,0,224,1,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,240,15,0,0,24,24,0,0,240,15,0,0,24,24,0,0,240,7,0,0,24,24,0,0,248,7,0,0,24,24,0,0,188,1,0,0,24,56,0,0,15,0,0,0,28,56,0,128,7,0,0,0,28,56,0,192,3,0,0,0,28,48,0,224,1,0,0,0,12,112,0,120,0,0,0,0,14,112,0,60,0,0,0,0,14,96,0,30,0,0,0,0,6,224,0,15,0,0,0,0,7,224,192,3,0,0,0,0,7,192,193,1,0,0,0,128,3,128,193,0,0,0,0,128,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,0,0,0,240,0,0,7,0,0,0,0,224,0,128,3,0,64,0,0,192,1,128,1,0,224,0,0,128,1,192,1,0,224,0,0,128,3,224,0,0,224,0,0,0,7,224,0,0,224,0,0,0,7,96,0,0,192,0,0,0,6,112,0,0,192,0,0,0,14,112,0,0,192,0,0,0,14,48,0,0,192,0,0,0,12,56,0,0,192,1,0,0,28,56,0,0,192,1,0,0,28,56,0,0,192,1,0,0,28,24,0,0,192,1,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,240,15,0,0,24,24,0,0,255,15,0,0,24,24,0,240,255,7,0,0,24,24,128,255,231,7,0,0,24,24,248,63,128,1,0,0,24,56,252,3,0,0,0,0,28,56,60,0,0,0,0,0,28,56,0,0,0,0,0,0,28,48,0,0,0,0,0,0,12,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,96,0,0,0,0,0,0,6,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,0,0,0,240,0,0,7,0,0,0,0,224,0,128,3,0,0,2,0,192,1,128,1,0,0,7,0,128,1,192,1,0,0,7,0,128,3,224,0,0,0,7,0,0,7,224,0,0,0,7,0,0,7,96,0,0,0,3,0,0,6,112,0,0,0,3,0,0,14,112,0,0,0,3,0,0,14,48,0,0,0,3,0,0,12,56,0,0,128,3,0,0,28,56,60,0,128,3,0,0,28,56,252,3,128,3,0,0,28,24,248,63,128,3,0,0,24,24,128,255,231,7,0,0,24,24,0,240,255,7,0,0,24,24,0,0,255,15,0,0,24,24,0,0,240,15,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,128,1,0,0,24,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,48,0,0,0,0,0,0,12,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,96,0,0,0,0,0,0,6,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,0,0,0,240,0,0,7,0,0,0,0,224,0,128,3,0,0,0,0,192,1,128,193,0,0,48,0,128,1,192,193,1,0,56,0,128,3,224,192,3,0,56,0,0,7,224,0,15,0,24,0,0,7,96,0,30,0,28,0,0,6,112,0,60,0,28,0,0,14,112,0,120,0,12,0,0,14,48,0,224,1,14,0,0,12,56,0,192,3,14,0,0,28,56,0,128,7,6,0,0,28,56,0,0,15,7,0,0,28,24,0,0,188,7,0,0,24,24,0,0,248,7,0,0,24,24,0,0,240,7,0,0,24,24,0,0,240,15,0,0,24,24,0,0,240,15,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,128,1,0,0,24,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,48,0,0,0,0,0,0,12,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,96,0,0,0,0,0,0,6,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,192,0,0,0,30,0,0,60,224,0,0,0,60,0,0,30,192,1,0,0,120,0,0,15,192,1,0,0,240,0,0,7,128,1,0,0,224,0,128,3,128,3,0,0,192,1,128,1,0,3,0,0,128,1,192,1,0,7,128,0,128,3,224,0,0,6,192,1,0,7,224,0,0,14,192,1,0,7,96,0,0,12,224,0,0,6,112,0,0,28,112,0,0,14,112,0,0,28,112,0,0,14,48,0,0,56,56,0,0,12,56,0,0,56,56,0,0,28,56,0,0,112,28,0,0,28,56,0,0,112,14,0,0,28,24,0,0,224,15,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,240,15,0,0,24,24,0,0,240,15,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,128,1,0,0,24,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,48,0,0,0,0,0,0,12,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,96,0,0,0,0,0,0,6,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,128,1,128,7,0,0,240,0,128,1,0,15,0,0,120,0,128,1,0,30,0,0,60,0,128,1,0,60,0,0,30,0,128,1,0,120,0,0,15,0,128,1,0,240,0,0,7,0,128,1,0,224,0,128,3,0,128,1,0,192,1,128,1,0,128,1,0,128,1,192,1,0,128,1,0,128,3,224,0,0,128,1,0,0,7,224,0,0,128,1,4,0,7,96,0,0,128,1,14,0,6,112,0,0,128,1,7,0,14,112,0,0,128,129,3,0,14,48,0,0,128,193,1,0,12,56,0,0,128,225,0,0,28,56,0,0,128,113,0,0,28,56,0,0,128,57,0,0,28,24,0,0,192,31,0,0,24,24,0,0,224,15,0,0,24,24,0,0,224,15,0,0,24,24,0,0,240,15,0,0,24,24,0,0,240,15,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,128,1,0,0,24,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,48,0,0,0,0,0,0,12,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,96,0,0,0,0,0,0,6,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,3,30,0,0,60,0,0,0,7,60,0,0,30,0,0,128,3,120,0,0,15,0,0,128,3,240,0,0,7,0,0,128,1,224,0,128,3,0,0,192,1,192,1,128,1,0,0,192,0,128,1,192,1,0,0,224,0,128,3,224,0,0,0,96,0,0,7,224,0,0,0,112,0,0,7,96,0,0,0,48,0,0,6,112,0,0,0,56,0,0,14,112,0,0,0,56,24,0,14,48,0,0,0,28,60,0,12,56,0,0,0,28,31,0,28,56,0,0,0,206,7,0,28,56,0,0,0,238,3,0,28,24,0,0,128,255,0,0,24,24,0,0,224,63,0,0,24,24,0,0,224,31,0,0,24,24,0,0,240,15,0,0,24,24,0,0,240,15,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,128,1,0,0,24,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,48,0,0,0,0,0,0,12,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,96,0,0,0,0,0,0,6,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,0,0,0,240,0,0,7,0,0,0,0,224,0,128,3,0,0,0,0,192,1,128,1,0,0,0,0,131,1,192,1,0,0,0,128,131,3,224,0,0,0,0,192,3,7,224,0,0,0,0,240,0,7,96,0,0,0,0,120,0,6,112,0,0,0,0,60,0,14,112,0,0,0,0,30,0,14,48,0,0,0,128,7,0,12,56,0,0,0,192,3,0,28,56,0,0,0,224,113,0,28,56,0,0,0,240,126,0,28,24,0,0,128,253,63,0,24,24,0,0,224,255,7,0,24,24,0,0,224,255,0,0,24,24,0,0,240,31,0,0,24,24,0,0,240,15,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,128,1,0,0,24,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,48,0,0,0,0,0,0,12,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,96,0,0,0,0,0,0,6,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,0,0,0,240,0,0,7,0,0,0,0,224,0,128,3,0,0,0,0,192,1,128,1,0,0,0,0,128,1,192,1,0,0,0,0,128,3,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,0,0,0,60,28,56,0,0,0,0,192,63,28,24,0,0,128,1,252,31,24,24,0,0,224,231,255,1,24,24,0,0,224,255,255,0,24,24,0,0,240,255,127,0,24,24,0,0,240,127,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,128,1,0,0,24,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,48,0,0,0,0,0,0,12,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,96,0,0,0,0,0,0,6,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,0,0,0,240,0,0,7,0,0,0,0,224,0,128,3,0,0,0,0,192,1,128,1,0,0,0,0,128,1,192,1,0,0,0,0,128,3,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,24,0,0,128,1,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,240,127,0,0,24,24,0,0,240,255,127,0,24,24,0,0,224,255,255,0,24,24,0,0,224,231,255,1,24,24,0,0,128,1,252,31,24,56,0,0,0,0,192,63,28,56,0,0,0,0,0,60,28,56,0,0,0,0,0,0,28,48,0,0,0,0,0,0,12,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,96,0,0,0,0,0,0,6,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,0,0,0,240,0,0,7,0,0,0,0,224,0,128,3,0,0,0,0,192,1,128,1,0,0,0,0,128,1,192,1,0,0,0,0,128,3,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,24,0,0,128,1,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,240,15,0,0,24,24,0,0,240,31,0,0,24,24,0,0,224,255,0,0,24,24,0,0,224,255,7,0,24,24,0,0,128,253,63,0,24,56,0,0,0,240,126,0,28,56,0,0,0,224,113,0,28,56,0,0,0,192,3,0,28,48,0,0,0,128,7,0,12,112,0,0,0,0,30,0,14,112,0,0,0,0,60,0,14,96,0,0,0,0,120,0,6,224,0,0,0,0,240,0,7,224,0,0,0,0,192,3,7,192,1,0,0,0,128,131,3,128,1,0,0,0,0,131,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,0,0,0,240,0,0,7,0,0,0,0,224,0,128,3,0,0,0,0,192,1,128,1,0,0,0,0,128,1,192,1,0,0,0,0,128,3,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,24,0,0,128,1,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,240,15,0,0,24,24,0,0,240,15,0,0,24,24,0,0,224,31,0,0,24,24,0,0,224,63,0,0,24,24,0,0,128,255,0,0,24,56,0,0,0,238,3,0,28,56,0,0,0,206,7,0,28,56,0,0,0,28,31,0,28,48,0,0,0,28,60,0,12,112,0,0,0,56,24,0,14,112,0,0,0,56,0,0,14,96,0,0,0,48,0,0,6,224,0,0,0,112,0,0,7,224,0,0,0,96,0,0,7,192,1,0,0,224,0,128,3,128,1,0,0,192,0,128,1,128,3,0,0,192,1,192,1,0,7,0,0,128,1,224,0,0,15,0,0,128,3,240,0,0,30,0,0,128,3,120,0,0,60,0,0,0,7,60,0,0,120,0,0,0,3,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,0,0,0,240,0,0,7,0,0,0,0,224,0,128,3,0,0,0,0,192,1,128,1,0,0,0,0,128,1,192,1,0,0,0,0,128,3,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,24,0,0,128,1,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,240,15,0,0,24,24,0,0,240,15,0,0,24,24,0,0,224,15,0,0,24,24,0,0,224,15,0,0,24,24,0,0,192,31,0,0,24,56,0,0,128,57,0,0,28,56,0,0,128,113,0,0,28,56,0,0,128,225,0,0,28,48,0,0,128,193,1,0,12,112,0,0,128,129,3,0,14,112,0,0,128,1,7,0,14,96,0,0,128,1,14,0,6,224,0,0,128,1,4,0,7,224,0,0,128,1,0,0,7,192,1,0,128,1,0,128,3,128,1,0,128,1,0,128,1,128,3,0,128,1,0,192,1,0,7,0,128,1,0,224,0,0,15,0,128,1,0,240,0,0,30,0,128,1,0,120,0,0,60,0,128,1,0,60,0,0,120,0,128,1,0,30,0,0,240,0,128,1,0,15,0,0,224,1,128,1,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,0,0,0,240,0,0,7,0,0,0,0,224,0,128,3,0,0,0,0,192,1,128,1,0,0,0,0,128,1,192,1,0,0,0,0,128,3,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,24,0,0,128,1,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,240,15,0,0,24,24,0,0,240,15,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,15,0,0,24,56,0,0,112,14,0,0,28,56,0,0,112,28,0,0,28,56,0,0,56,56,0,0,28,48,0,0,56,56,0,0,12,112,0,0,28,112,0,0,14,112,0,0,28,112,0,0,14,96,0,0,12,224,0,0,6,224,0,0,14,192,1,0,7,224,0,0,6,192,1,0,7,192,1,0,7,128,0,128,3,128,1,0,3,0,0,128,1,128,3,128,3,0,0,192,1,0,7,128,1,0,0,224,0,0,15,192,1,0,0,240,0,0,30,192,1,0,0,120,0,0,60,224,0,0,0,60,0,0,120,192,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,0,0,0,240,0,0,7,0,0,0,0,224,0,128,3,0,0,0,0,192,1,128,1,0,0,0,0,128,1,192,1,0,0,0,0,128,3,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,24,0,0,128,1,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,240,15,0,0,24,24,0,0,240,15,0,0,24,24,0,0,240,7,0,0,24,24,0,0,248,7,0,0,24,24,0,0,188,7,0,0,24,56,0,0,15,7,0,0,28,56,0,128,7,6,0,0,28,56,0,192,3,14,0,0,28,48,0,224,1,14,0,0,12,112,0,120,0,12,0,0,14,112,0,60,0,28,0,0,14,96,0,30,0,28,0,0,6,224,0,15,0,24,0,0,7,224,192,3,0,56,0,0,7,192,193,1,0,56,0,128,3,128,193,0,0,48,0,128,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,0,0,0,240,0,0,7,0,0,0,0,224,0,128,3,0,0,0,0,192,1,128,1,0,0,0,0,128,1,192,1,0,0,0,0,128,3,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,24,0,0,128,1,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,240,15,0,0,24,24,0,0,255,15,0,0,24,24,0,240,255,7,0,0,24,24,128,255,231,7,0,0,24,24,248,63,128,3,0,0,24,56,252,3,128,3,0,0,28,56,60,0,128,3,0,0,28,56,0,0,128,3,0,0,28,48,0,0,0,3,0,0,12,112,0,0,0,3,0,0,14,112,0,0,0,3,0,0,14,96,0,0,0,3,0,0,6,224,0,0,0,7,0,0,7,224,0,0,0,7,0,0,7,192,1,0,0,7,0,128,3,128,1,0,0,7,0,128,1,128,3,0,0,2,0,192,1,0,7,0,0,0,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,0,0,0,240,0,0,7,0,0,0,0,224,0,128,3,0,0,0,0,192,1,128,1,0,0,0,0,128,1,192,1,0,0,0,0,128,3,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,60,0,0,0,0,0,28,56,252,3,0,0,0,0,28,24,248,63,128,1,0,0,24,24,128,255,231,7,0,0,24,24,0,240,255,7,0,0,24,24,0,0,255,15,0,0,24,24,0,0,240,15,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,192,1,0,0,24,56,0,0,192,1,0,0,28,56,0,0,192,1,0,0,28,56,0,0,192,1,0,0,28,48,0,0,192,0,0,0,12,112,0,0,192,0,0,0,14,112,0,0,192,0,0,0,14,96,0,0,192,0,0,0,6,224,0,0,224,0,0,0,7,224,0,0,224,0,0,0,7,192,1,0,224,0,0,128,3,128,1,0,224,0,0,128,1,128,3,0,64,0,0,192,1,0,7,0,0,0,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,0,0,0,240,0,0,7,0,0,0,0,224,0,128,3,0,0,0,0,192,1,128,193,0,0,0,0,128,1,192,193,1,0,0,0,128,3,224,192,3,0,0,0,0,7,224,0,15,0,0,0,0,7,96,0,30,0,0,0,0,6,112,0,60,0,0,0,0,14,112,0,120,0,0,0,0,14,48,0,224,1,0,0,0,12,56,0,192,3,0,0,0,28,56,0,128,7,0,0,0,28,56,0,0,15,0,0,0,28,24,0,0,188,1,0,0,24,24,0,0,248,7,0,0,24,24,0,0,240,7,0,0,24,24,0,0,240,15,0,0,24,24,0,0,240,15,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,1,0,0,24,56,0,0,224,0,0,0,28,56,0,0,96,0,0,0,28,56,0,0,112,0,0,0,28,48,0,0,112,0,0,0,12,112,0,0,48,0,0,0,14,112,0,0,56,0,0,0,14,96,0,0,56,0,0,0,6,224,0,0,24,0,0,0,7,224,0,0,28,0,0,0,7,192,1,0,28,0,0,128,3,128,1,0,12,0,0,128,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    };
-
-static const unsigned char gears[][BITMAP_LENGTH] = {
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,1,0,0,0,0,0,0,248,3,0,0,0,0,0,0,24,3,0,0,0,0,0,0,30,15,0,0,0,0,0,128,31,31,0,0,0,0,0,220,3,124,3,0,0,0,0,252,1,240,7,0,0,0,0,126,0,192,15,0,0,0,0,7,0,0,12,0,0,0,0,7,248,3,28,0,0,0,0,14,252,7,14,0,0,0,0,28,30,15,7,0,0,0,0,12,15,14,7,0,0,0,0,12,7,28,6,0,0,0,0,12,7,28,6,0,0,0,0,12,7,28,6,0,0,0,0,12,7,28,7,0,0,0,0,12,14,14,7,0,0,0,0,30,30,15,7,0,0,0,0,15,252,7,14,0,0,0,0,7,248,1,28,0,0,0,0,6,0,0,14,0,0,0,0,126,0,224,15,0,0,128,31,252,1,240,7,0,0,128,31,200,7,124,3,0,0,192,57,0,31,31,0,0,0,224,121,0,28,7,0,0,0,248,240,1,184,3,0,0,192,61,192,51,248,3,0,0,224,15,0,127,248,225,3,0,224,7,0,126,0,240,7,0,112,0,0,224,0,112,7,0,112,128,31,224,0,56,14,0,112,224,63,240,0,62,62,0,224,224,120,112,0,15,124,0,192,112,224,48,248,3,224,15,224,48,224,48,252,1,192,31,224,48,192,112,92,0,128,28,224,48,192,112,14,224,3,56,224,48,224,48,14,248,7,60,192,112,224,48,28,252,15,30,224,224,121,112,56,28,28,14,112,224,63,224,24,14,24,14,112,128,31,224,24,14,56,12,112,0,0,224,24,14,56,12,224,7,0,126,24,14,56,14,224,15,0,127,24,14,28,14,192,60,192,51,56,28,30,14,0,248,240,1,28,248,15,28,0,224,121,0,14,240,7,56,0,192,57,0,14,192,1,56,0,128,31,0,220,0,128,31,0,128,31,0,252,1,224,15,0,0,0,0,248,7,240,15,0,0,0,0,0,31,124,0,0,0,0,0,0,62,30,0,0,0,0,0,0,48,7,0,0,0,0,0,0,240,7,0,0,0,0,0,0,240,7,0,0,0,0,0,0,224,1,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,0,0,0,0,0,0,0,252,0,0,0,0,0,0,0,206,1,0,0,0,0,0,0,206,15,0,0,0,0,0,128,143,159,3,0,0,0,0,192,3,248,3,0,0,0,0,236,1,240,7,0,0,0,0,254,0,0,14,0,0,0,0,127,0,0,14,0,0,0,0,7,248,3,7,0,0,0,0,3,252,7,3,0,0,0,0,7,30,15,7,0,0,0,0,14,6,14,7,0,0,0,0,12,7,28,6,0,0,0,0,12,7,28,6,0,0,0,0,12,7,28,6,0,0,0,0,12,7,28,6,0,0,0,0,28,14,14,14,0,0,0,0,28,158,15,28,0,0,0,0,28,252,7,28,0,0,0,0,30,248,3,28,0,0,0,0,14,0,192,15,0,0,0,0,14,0,224,15,0,0,0,63,252,1,240,0,0,0,0,127,248,7,124,0,0,0,128,115,56,63,30,0,0,0,224,99,0,62,14,0,0,128,251,225,1,112,7,0,0,192,63,192,3,224,7,0,0,224,15,0,7,224,199,7,0,112,0,0,126,0,192,15,0,112,0,0,252,0,224,15,0,224,128,31,192,0,248,12,0,192,225,63,192,33,126,60,0,192,224,120,224,241,15,120,0,224,112,224,240,248,3,224,0,224,48,224,112,156,1,192,31,224,48,192,112,28,0,128,31,224,48,192,112,28,224,3,61,224,48,224,112,56,248,7,56,240,112,224,48,56,252,15,56,120,224,121,56,56,28,28,60,56,192,63,56,24,14,24,14,48,128,31,112,24,14,56,12,240,3,0,112,24,14,56,12,224,7,0,112,24,14,56,12,0,14,0,127,28,14,28,14,0,60,192,63,30,28,30,14,0,120,248,25,14,248,15,6,0,96,124,0,14,240,7,14,0,224,14,0,126,192,1,28,0,224,15,0,252,0,0,28,0,192,7,0,248,1,192,14,0,0,0,0,128,7,240,15,0,0,0,0,0,15,254,7,0,0,0,0,0,156,31,0,0,0,0,0,0,156,3,0,0,0,0,0,0,248,1,0,0,0,0,0,0,248,1,0,0,0,0,0,0,224,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,0,0,0,0,0,0,0,127,0,0,0,0,0,0,0,231,1,0,0,0,0,0,0,231,207,1,0,0,0,0,128,199,255,3,0,0,0,0,192,3,252,7,0,0,0,0,224,1,0,7,0,0,0,0,112,0,0,7,0,0,0,0,63,0,128,3,0,0,0,0,63,248,131,3,0,0,0,0,3,252,7,3,0,0,0,128,3,30,15,7,0,0,0,128,3,14,14,7,0,0,0,0,15,7,28,6,0,0,0,0,14,7,28,6,0,0,0,0,12,7,28,14,0,0,0,0,12,7,28,30,0,0,0,0,28,14,14,56,0,0,0,0,28,30,15,24,0,0,0,0,24,252,7,28,0,0,0,0,56,248,129,31,0,0,0,0,28,0,192,15,0,0,0,0,28,0,224,0,0,0,0,124,156,1,240,0,0,0,0,254,248,7,120,0,0,0,0,238,248,127,28,0,0,0,227,199,112,252,28,0,0,128,255,195,1,224,29,0,0,192,63,192,3,192,31,0,0,224,8,0,7,128,7,7,0,224,0,0,14,0,128,31,0,192,1,0,252,0,192,63,0,192,129,31,248,64,248,57,0,192,225,63,192,225,255,56,0,192,224,120,192,241,15,120,0,224,112,224,192,57,3,224,0,224,48,224,240,57,0,192,1,224,48,192,112,56,0,128,31,224,48,192,112,112,224,3,63,120,48,224,48,48,248,7,62,56,112,224,48,56,252,15,48,56,224,121,56,56,28,28,48,56,192,63,56,24,14,24,60,240,129,31,24,24,14,56,28,240,3,0,56,28,14,56,12,0,7,0,112,30,14,56,14,0,14,0,121,15,14,28,14,0,60,192,63,7,28,30,14,0,56,252,31,6,248,15,6,0,48,126,12,62,240,7,7,0,112,7,0,126,192,1,7,0,240,3,0,228,0,0,14,0,224,3,0,192,1,0,14,0,0,0,0,128,7,112,15,0,0,0,0,0,7,254,7,0,0,0,0,0,206,223,3,0,0,0,0,0,206,7,0,0,0,0,0,0,254,0,0,0,0,0,0,0,252,0,0,0,0,0,0,0,96,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,128,31,0,0,0,0,0,0,128,255,97,0,0,0,0,0,128,241,255,1,0,0,0,0,128,225,255,3,0,0,0,0,192,1,156,3,0,0,0,0,224,1,128,3,0,0,0,0,112,0,128,1,0,0,0,0,48,0,128,1,0,0,0,0,63,248,131,3,0,0,0,0,31,252,7,3,0,0,0,128,7,30,15,7,0,0,0,128,3,14,14,7,0,0,0,128,3,7,28,6,0,0,0,128,15,7,28,30,0,0,0,0,15,7,28,60,0,0,0,0,12,7,28,56,0,0,0,0,12,14,14,56,0,0,0,0,28,30,15,30,0,0,0,0,24,252,7,31,0,0,0,0,56,248,129,15,0,0,0,0,48,0,192,1,0,0,0,0,56,0,224,1,0,0,0,112,56,0,240,0,0,0,0,248,57,7,120,0,0,0,6,255,251,255,56,0,0,0,255,159,227,255,57,0,0,128,255,143,193,224,63,0,0,192,49,128,3,0,63,0,0,192,1,0,7,0,7,4,0,128,3,0,14,0,0,62,0,128,3,0,28,128,0,127,0,128,129,31,248,192,251,115,0,192,225,63,248,225,255,115,0,192,224,120,240,113,14,112,0,192,112,224,128,49,0,224,0,224,48,224,192,113,0,192,1,240,48,192,224,97,0,128,3,120,48,192,240,112,224,3,7,24,48,224,112,48,248,15,63,24,112,224,48,56,252,15,62,248,224,121,48,56,28,28,48,248,225,63,56,24,14,24,112,240,129,31,28,28,14,56,120,128,3,0,28,31,14,56,60,0,7,0,28,7,14,56,14,0,14,0,56,7,14,28,14,0,28,192,56,7,28,30,14,0,28,255,31,62,248,15,6,0,156,255,15,126,240,7,7,0,252,7,6,112,192,1,3,0,248,1,0,224,0,0,3,0,224,0,0,192,1,0,7,0,0,0,0,128,3,16,7,0,0,0,0,0,3,254,7,0,0,0,0,0,227,255,3,0,0,0,0,0,247,199,1,0,0,0,0,0,127,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,128,15,48,0,0,0,0,0,192,255,121,0,0,0,0,0,224,252,255,1,0,0,0,0,192,248,207,1,0,0,0,0,192,0,192,1,0,0,0,0,224,0,192,0,0,0,0,0,112,0,192,1,0,0,0,0,120,0,192,1,0,0,0,0,56,248,131,3,0,0,0,0,28,252,7,3,0,0,0,128,31,30,15,7,0,0,0,128,15,6,14,15,0,0,0,128,3,7,28,62,0,0,0,128,3,7,28,60,0,0,0,128,7,7,28,56,0,0,0,128,15,7,28,56,0,0,0,0,28,14,14,62,0,0,0,0,28,158,15,31,0,0,0,0,24,252,135,3,0,0,0,0,56,248,129,3,0,0,0,0,112,0,192,1,0,0,0,0,112,0,224,1,0,0,0,64,112,0,240,0,0,0,8,224,113,4,96,0,0,0,62,255,119,254,99,0,0,0,255,63,247,255,119,0,0,128,243,31,199,99,127,0,0,0,3,0,135,1,30,0,0,0,3,0,7,0,0,0,0,0,7,0,14,0,0,60,0,128,3,0,28,128,7,254,0,192,129,31,24,192,255,255,0,192,225,63,120,224,254,199,0,192,224,120,240,97,24,192,0,224,112,224,240,225,0,224,0,248,48,224,128,225,0,192,1,56,48,192,128,225,0,128,3,24,48,192,192,113,224,3,7,24,48,224,240,49,248,7,7,248,112,224,112,56,252,15,62,248,224,121,56,56,28,28,62,192,225,63,56,30,14,24,112,128,129,31,28,31,14,56,112,128,3,0,28,7,14,56,112,0,7,0,14,7,14,56,124,0,14,0,14,15,14,28,30,0,14,0,12,63,28,30,14,0,206,255,30,62,252,15,6,0,206,255,15,112,240,7,7,0,254,199,7,112,192,129,3,0,120,0,1,224,0,128,3,0,32,0,0,192,1,128,1,0,0,0,0,192,1,128,3,0,0,0,0,128,97,158,3,0,0,0,0,192,249,255,3,0,0,0,0,192,255,251,1,0,0,0,0,0,31,96,0,0,0,0,0,0,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,128,3,60,0,0,0,0,0,224,247,126,0,0,0,0,0,240,255,247,0,0,0,0,0,112,254,227,0,0,0,0,0,112,0,96,0,0,0,0,0,96,0,224,0,0,0,0,0,112,0,192,0,0,0,0,0,48,0,192,1,0,0,0,0,56,248,131,3,0,0,0,0,24,252,7,3,0,0,0,0,28,30,15,31,0,0,0,0,15,14,14,62,0,0,0,128,15,7,28,56,0,0,0,128,3,7,28,56,0,0,0,128,3,7,28,56,0,0,0,128,3,7,28,62,0,0,0,128,15,14,14,31,0,0,0,0,31,30,15,3,0,0,0,0,24,252,7,3,0,0,0,0,56,248,129,3,0,0,0,0,48,0,192,1,0,0,0,0,112,0,192,0,0,0,0,0,224,0,224,0,0,0,120,128,225,0,192,0,0,0,254,239,231,252,199,1,0,0,239,255,239,255,255,0,0,0,198,127,206,207,124,0,0,0,6,0,142,7,56,0,0,0,14,0,14,0,0,0,0,0,7,0,14,0,14,32,0,128,3,0,28,128,31,248,0,128,129,31,24,192,255,255,1,192,225,63,56,192,249,223,3,240,224,120,48,192,1,140,1,248,112,224,240,192,1,192,1,24,48,224,240,225,1,192,1,24,48,192,128,225,0,128,3,24,48,192,128,113,224,3,7,248,112,224,192,49,248,7,7,240,112,224,240,59,252,15,6,192,224,121,248,63,28,28,30,192,193,63,56,15,14,24,124,128,129,31,24,7,14,56,120,128,3,0,28,7,14,56,112,0,7,0,14,31,14,56,112,0,7,0,7,30,14,28,124,0,7,0,7,56,28,28,62,0,231,63,6,56,248,15,14,0,255,127,7,112,240,7,7,0,62,247,7,112,192,129,3,0,24,224,1,224,0,128,3,0,0,0,0,192,0,192,1,0,0,0,0,224,0,192,0,0,0,0,0,224,56,198,1,0,0,0,0,224,253,207,1,0,0,0,0,192,255,255,1,0,0,0,0,0,7,120,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,63,0,0,0,0,0,224,241,63,0,0,0,0,0,240,255,51,0,0,0,0,0,120,255,49,0,0,0,0,0,56,2,112,0,0,0,0,0,56,0,240,0,0,0,0,0,48,0,192,1,0,0,0,0,48,0,192,1,0,0,0,0,56,248,131,3,0,0,0,0,28,252,7,31,0,0,0,0,28,30,15,31,0,0,0,0,28,14,14,24,0,0,0,0,14,7,28,56,0,0,0,128,15,7,28,60,0,0,0,128,3,7,28,30,0,0,0,128,3,7,28,7,0,0,0,128,3,14,14,7,0,0,0,128,31,30,15,7,0,0,0,0,31,252,135,3,0,0,0,0,56,248,129,3,0,0,0,0,112,0,192,1,0,0,0,0,240,0,192,1,0,0,96,0,224,1,128,3,0,0,248,0,192,1,140,3,0,0,252,15,199,241,255,3,0,0,140,255,207,249,255,0,0,0,12,255,223,255,112,0,0,0,28,192,156,31,0,0,0,0,15,0,28,12,0,0,0,0,7,0,28,0,62,0,0,128,3,0,28,128,63,192,0,192,129,31,24,128,243,255,1,248,225,63,56,128,227,255,3,248,224,120,48,128,3,60,7,24,112,224,48,192,3,0,7,24,48,224,112,224,1,128,3,56,48,192,240,225,0,128,3,248,48,192,192,113,224,3,7,224,48,224,128,63,248,7,7,192,112,224,192,63,252,15,6,192,224,121,240,7,28,28,14,192,193,63,248,7,14,24,14,128,129,31,28,7,14,56,60,128,3,0,28,31,14,56,124,128,3,0,14,30,14,56,112,128,3,0,7,24,14,28,112,192,51,128,3,56,28,30,60,128,255,143,3,56,248,15,62,0,255,159,3,112,240,7,31,0,14,255,3,112,192,1,3,0,0,240,1,96,0,128,3,0,0,96,0,112,0,192,1,0,0,0,0,112,0,224,0,0,0,0,0,112,62,96,0,0,0,0,0,224,255,99,0,0,0,0,0,192,243,119,0,0,0,0,0,0,1,126,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,15,0,0,0,0,0,0,192,31,0,0,0,0,0,0,224,29,0,0,0,0,0,240,254,24,0,0,0,0,0,248,127,24,0,0,0,0,0,188,3,120,0,0,0,0,0,28,0,240,0,0,0,0,0,28,0,192,1,0,0,0,0,56,0,192,15,0,0,0,0,56,248,131,31,0,0,0,0,24,252,7,31,0,0,0,0,28,30,15,24,0,0,0,0,12,15,14,56,0,0,0,0,12,7,28,62,0,0,0,0,14,7,28,14,0,0,0,0,15,7,28,6,0,0,0,128,7,7,28,7,0,0,0,128,3,14,14,7,0,0,0,0,3,30,15,7,0,0,0,0,31,252,135,3,0,0,0,0,63,248,129,3,0,0,0,0,126,0,128,3,0,0,0,0,112,0,0,7,0,0,224,1,224,1,0,7,0,0,248,3,192,3,188,3,0,0,184,15,128,227,255,3,0,0,56,127,14,227,231,1,0,0,56,254,31,127,0,0,0,0,28,192,59,63,0,0,0,0,14,0,56,60,48,0,0,0,7,0,56,0,126,0,0,240,3,0,24,0,254,0,0,248,129,31,24,0,230,143,1,248,224,63,56,0,198,255,3,56,224,120,48,0,7,252,7,56,112,224,48,192,3,32,14,120,48,224,48,192,1,0,14,240,48,192,112,224,0,0,7,224,48,192,240,126,224,3,7,224,48,224,224,63,248,7,7,192,112,224,192,7,252,15,6,192,224,120,192,7,28,28,14,192,225,63,248,15,14,24,14,128,129,31,252,31,14,56,12,192,1,0,124,28,14,56,28,192,1,0,14,24,14,56,60,224,1,0,7,24,14,28,112,192,63,192,3,56,28,30,48,128,255,199,1,56,248,15,56,0,231,207,1,112,240,7,63,0,0,255,1,112,192,129,31,0,0,252,1,56,0,128,3,0,0,56,0,56,0,192,1,0,0,0,0,56,7,240,0,0,0,0,0,240,127,112,0,0,0,0,0,224,255,49,0,0,0,0,0,192,240,59,0,0,0,0,0,0,128,63,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,224,7,0,0,0,0,0,0,224,15,0,0,0,0,0,0,112,14,0,0,0,0,0,0,126,14,0,0,0,0,0,248,63,28,0,0,0,0,0,252,3,120,0,0,0,0,0,220,1,240,0,0,0,0,0,14,0,192,15,0,0,0,0,14,0,192,15,0,0,0,0,28,248,3,28,0,0,0,0,24,252,7,28,0,0,0,0,28,30,15,28,0,0,0,0,28,6,14,30,0,0,0,0,12,7,28,14,0,0,0,0,12,7,28,6,0,0,0,0,12,7,28,6,0,0,0,0,14,7,28,6,0,0,0,0,15,14,14,7,0,0,0,128,3,30,15,7,0,0,0,0,3,252,7,3,0,0,0,0,31,248,3,7,0,0,0,0,126,0,0,14,0,0,0,0,254,0,0,14,0,0,224,7,224,1,112,7,0,0,224,7,192,3,252,3,0,0,96,14,0,135,223,3,0,0,112,124,0,198,7,0,0,0,120,252,31,238,0,0,0,0,62,192,63,254,0,0,0,0,14,0,115,124,240,0,0,240,7,0,112,0,252,1,0,240,3,0,112,0,252,1,0,240,129,31,56,0,140,15,0,56,224,63,56,0,142,63,3,56,224,120,48,128,15,252,7,120,112,224,48,192,3,224,15,224,48,224,112,252,1,0,28,224,48,192,112,252,0,0,28,224,48,192,112,126,224,3,14,224,112,224,112,14,248,7,6,192,112,224,224,7,252,15,6,192,224,121,192,15,28,28,14,192,193,63,192,29,14,24,14,192,129,31,248,24,14,56,12,224,0,0,252,24,14,56,12,224,0,0,126,24,14,56,12,224,15,0,7,24,14,28,28,192,63,192,3,56,28,30,56,128,251,227,1,56,248,15,56,0,224,227,0,56,240,7,56,0,0,119,0,60,192,129,31,0,0,126,0,28,0,128,31,0,0,126,0,156,1,192,1,0,0,0,0,248,7,240,0,0,0,0,0,240,63,120,0,0,0,0,0,32,252,28,0,0,0,0,0,0,240,28,0,0,0,0,0,0,192,31,0,0,0,0,0,0,192,15,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,3,0,0,0,0,0,0,240,3,0,0,0,0,0,0,56,3,0,0,0,0,0,0,30,15,0,0,0,0,0,128,31,30,0,0,0,0,0,252,7,124,2,0,0,0,0,252,1,240,7,0,0,0,0,110,0,224,15,0,0,0,0,6,0,128,12,0,0,0,0,7,248,3,28,0,0,0,0,14,252,7,30,0,0,0,0,28,30,15,14,0,0,0,0,12,14,14,7,0,0,0,0,12,7,28,7,0,0,0,0,12,7,28,6,0,0,0,0,12,7,28,6,0,0,0,0,12,7,28,6,0,0,0,0,12,14,14,7,0,0,0,0,14,30,15,7,0,0,0,0,7,252,7,14,0,0,0,0,7,248,1,14,0,0,0,0,62,0,0,12,0,0,0,0,126,0,224,14,0,0,192,15,252,1,240,7,0,0,192,31,192,7,252,3,0,0,192,24,128,15,31,0,0,0,224,120,0,158,15,0,0,0,248,248,1,156,1,0,0,0,60,192,63,248,1,0,0,224,15,0,127,248,241,3,0,224,7,0,118,0,240,3,0,112,2,0,224,0,248,3,0,56,128,31,224,0,56,15,0,112,224,63,112,0,62,63,0,224,224,121,48,128,15,124,6,224,112,224,48,248,3,224,15,224,48,224,48,252,1,192,31,224,48,192,112,252,0,0,28,224,48,192,112,14,224,3,24,224,112,224,48,14,248,7,28,192,112,224,112,28,252,15,14,224,224,121,240,24,28,28,14,240,192,63,224,24,14,24,14,112,128,31,192,24,14,56,12,112,0,0,236,24,14,56,12,224,7,0,126,24,14,56,14,224,15,0,127,24,14,24,14,192,63,192,3,56,28,30,30,0,248,241,1,60,248,15,60,0,224,113,0,30,240,7,56,0,128,57,0,14,192,1,24,0,128,63,0,156,0,128,31,0,128,31,0,252,1,224,15,0,0,0,0,248,7,240,14,0,0,0,0,16,31,124,0,0,0,0,0,0,62,30,0,0,0,0,0,0,112,14,0,0,0,0,0,0,240,7,0,0,0,0,0,0,224,7,0,0,0,0,0,0,192,3,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,0,0,0,0,0,0,0,252,1,0,0,0,0,0,0,156,1,0,0,0,0,0,0,142,15,0,0,0,0,0,128,15,31,3,0,0,0,0,192,3,252,7,0,0,0,0,252,1,240,7,0,0,0,0,126,0,64,14,0,0,0,0,63,0,0,14,0,0,0,0,7,248,3,14,0,0,0,0,7,252,7,7,0,0,0,0,15,30,15,7,0,0,0,0,12,14,14,7,0,0,0,0,12,7,28,6,0,0,0,0,12,7,28,6,0,0,0,0,12,7,28,6,0,0,0,0,12,7,12,7,0,0,0,0,28,14,14,15,0,0,0,0,28,30,15,30,0,0,0,0,28,252,7,28,0,0,0,0,14,248,1,28,0,0,0,0,14,0,192,15,0,0,0,0,78,0,224,15,0,0,0,63,252,1,240,7,0,0,0,63,252,7,124,0,0,0,128,51,0,31,30,0,0,0,240,113,0,62,7,0,0,128,248,241,1,48,7,0,0,192,63,192,3,240,7,0,0,224,15,0,127,240,195,7,0,96,6,0,126,0,224,15,0,112,0,0,252,0,224,15,0,112,128,31,192,0,120,14,0,224,224,63,192,1,126,60,0,192,224,120,240,240,15,120,0,192,112,224,112,248,3,224,8,224,48,224,48,252,1,192,31,224,48,192,112,12,0,128,31,224,48,192,112,28,224,3,56,224,48,224,48,60,248,15,56,224,112,224,48,56,252,15,60,112,224,121,48,56,28,28,30,56,224,63,48,24,14,24,14,48,128,31,112,24,14,56,12,240,3,0,224,24,14,56,12,224,7,0,118,24,14,56,12,224,15,128,127,28,14,28,14,0,60,224,63,30,28,30,14,0,120,248,17,14,248,15,14,0,224,124,0,14,240,7,30,0,224,28,0,78,192,1,28,0,192,15,0,252,0,0,28,0,192,15,0,252,1,192,15,0,0,0,0,128,7,240,15,0,0,0,0,0,31,126,7,0,0,0,0,0,28,31,0,0,0,0,0,0,24,3,0,0,0,0,0,0,248,3,0,0,0,0,0,0,248,3,0,0,0,0,0,0,224,1,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,230,1,0,0,0,0,0,0,198,143,1,0,0,0,0,128,135,255,3,0,0,0,0,192,3,248,3,0,0,0,0,224,1,48,7,0,0,0,0,126,0,0,6,0,0,0,0,127,0,0,7,0,0,0,0,63,248,131,3,0,0,0,0,3,252,7,3,0,0,0,128,3,30,15,7,0,0,0,128,7,6,14,7,0,0,0,0,14,7,28,6,0,0,0,0,12,7,28,6,0,0,0,0,12,7,28,6,0,0,0,0,12,7,28,30,0,0,0,0,28,14,14,28,0,0,0,0,28,30,15,24,0,0,0,0,24,252,7,28,0,0,0,0,28,248,129,31,0,0,0,0,28,0,192,15,0,0,0,0,14,0,224,5,0,0,0,124,156,1,240,0,0,0,0,254,248,7,124,0,0,0,0,231,248,127,28,0,0,0,227,231,32,124,12,0,0,128,255,227,1,224,14,0,0,192,63,192,3,224,15,0,0,224,12,128,7,192,135,7,0,224,0,0,126,0,128,31,0,224,0,0,252,0,192,31,0,192,129,31,248,0,248,24,0,192,225,63,192,225,254,56,0,192,224,120,192,241,31,120,0,192,112,224,224,185,3,240,0,224,48,224,240,28,0,192,1,224,48,192,112,24,0,128,31,224,48,192,48,56,224,3,31,240,48,224,48,48,248,7,56,120,112,224,48,56,252,15,48,56,224,121,48,24,28,28,56,56,224,63,56,24,14,24,60,240,129,31,56,24,14,56,28,240,3,0,48,24,14,56,12,224,7,0,112,28,14,56,12,0,14,0,115,30,14,28,14,0,60,192,63,7,28,30,14,0,120,252,31,6,252,15,6,0,112,126,12,62,240,7,7,0,112,15,0,126,192,1,6,0,240,7,0,252,0,0,14,0,224,3,0,192,1,0,14,0,0,0,0,128,7,240,15,0,0,0,0,0,15,255,7,0,0,0,0,0,142,159,3,0,0,0,0,0,204,7,0,0,0,0,0,0,252,0,0,0,0,0,0,0,252,0,0,0,0,0,0,0,96,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,0,128,63,0,0,0,0,0,0,128,255,65,0,0,0,0,0,128,243,255,0,0,0,0,0,128,227,255,3,0,0,0,0,192,3,156,3,0,0,0,0,224,1,0,3,0,0,0,0,112,0,128,3,0,0,0,0,56,0,128,1,0,0,0,0,63,248,131,3,0,0,0,0,31,252,7,3,0,0,0,0,3,30,15,7,0,0,0,128,3,14,14,7,0,0,0,128,7,7,28,7,0,0,0,0,15,7,28,14,0,0,0,0,14,7,28,30,0,0,0,0,12,7,28,60,0,0,0,0,28,14,14,24,0,0,0,0,28,30,15,24,0,0,0,0,24,252,7,31,0,0,0,0,56,248,129,31,0,0,0,0,56,0,192,1,0,0,0,0,56,0,224,0,0,0,0,120,28,0,240,0,0,0,0,248,189,7,120,0,0,0,134,255,249,255,56,0,0,0,255,143,241,255,57,0,0,128,255,135,97,192,63,0,0,192,57,128,3,128,31,0,0,192,1,0,7,0,7,6,0,192,1,0,14,0,0,63,0,128,3,0,28,0,128,63,0,128,129,31,248,192,249,115,0,192,225,63,248,225,255,49,0,192,224,121,192,241,15,112,0,192,112,224,192,57,2,224,0,224,48,224,192,49,0,192,1,240,48,192,240,113,0,128,3,120,48,192,112,112,224,3,31,56,112,224,48,48,248,7,63,24,112,224,48,56,252,15,60,56,224,121,48,56,28,28,48,248,193,63,56,24,14,24,112,240,129,31,24,28,14,56,124,128,3,0,28,30,14,56,28,0,7,0,24,15,14,56,14,0,14,0,56,7,14,28,14,0,28,224,61,7,28,30,14,0,24,255,31,62,248,15,6,0,24,255,15,126,240,7,7,0,248,7,6,124,192,1,3,0,248,1,0,224,0,0,7,0,224,1,0,192,1,0,7,0,0,0,0,128,3,48,7,0,0,0,0,0,7,254,7,0,0,0,0,0,231,255,3,0,0,0,0,0,231,199,1,0,0,0,0,0,127,0,0,0,0,0,0,0,62,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,128,15,48,0,0,0,0,0,192,255,121,0,0,0,0,0,192,249,255,1,0,0,0,0,192,241,223,1,0,0,0,0,192,1,128,1,0,0,0,0,224,0,192,1,0,0,0,0,240,0,192,1,0,0,0,0,112,0,192,1,0,0,0,0,56,248,131,3,0,0,0,0,31,252,7,3,0,0,0,0,31,30,15,7,0,0,0,128,3,14,14,7,0,0,0,128,3,7,28,30,0,0,0,128,3,7,28,62,0,0,0,128,15,7,28,56,0,0,0,0,15,7,28,56,0,0,0,0,28,14,14,28,0,0,0,0,28,30,15,31,0,0,0,0,24,252,7,31,0,0,0,0,56,248,129,3,0,0,0,0,48,0,192,1,0,0,0,0,112,0,224,1,0,0,0,96,48,0,240,0,0,0,8,240,49,6,112,0,0,0,30,255,123,255,113,0,0,0,255,63,243,255,115,0,0,128,243,31,195,97,127,0,0,128,35,0,131,0,62,0,0,128,3,0,7,0,4,0,0,0,3,0,14,0,0,60,0,128,3,0,28,128,3,126,0,192,129,31,24,192,255,255,0,192,225,63,248,224,255,231,0,192,224,120,240,113,28,224,0,224,112,224,192,97,0,224,0,240,48,224,128,225,0,192,1,120,48,192,192,225,0,128,3,24,48,192,224,113,224,3,3,24,48,224,240,48,248,7,15,120,112,224,48,56,252,15,62,248,224,121,56,24,28,28,60,240,193,63,56,28,14,24,112,128,129,31,28,31,14,56,112,128,3,0,28,15,14,56,124,0,7,0,12,7,14,56,60,0,14,0,28,7,14,28,14,0,14,64,28,31,28,30,6,0,140,255,30,62,248,15,6,0,206,255,15,48,240,7,7,0,254,135,7,112,192,1,3,0,248,0,1,224,0,128,3,0,96,0,0,192,1,128,3,0,0,0,0,128,3,0,3,0,0,0,0,128,33,158,3,0,0,0,0,128,243,255,3,0,0,0,0,128,255,247,1,0,0,0,0,128,31,96,0,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,3,60,0,0,0,0,0,224,255,126,0,0,0,0,0,224,255,255,0,0,0,0,0,96,252,231,0,0,0,0,0,96,0,224,0,0,0,0,0,224,0,224,0,0,0,0,0,112,0,192,0,0,0,0,0,120,0,192,1,0,0,0,0,56,248,131,3,0,0,0,0,24,252,7,3,0,0,0,0,30,30,15,7,0,0,0,128,15,15,14,31,0,0,0,128,15,7,28,60,0,0,0,128,3,7,28,56,0,0,0,128,3,7,28,56,0,0,0,128,15,7,28,62,0,0,0,128,15,14,14,31,0,0,0,0,28,30,15,7,0,0,0,0,24,252,7,3,0,0,0,0,56,248,129,3,0,0,0,0,48,0,192,1,0,0,0,0,112,0,224,0,0,0,0,0,224,0,224,0,0,0,56,192,97,0,224,0,0,0,126,239,103,252,231,0,0,0,255,255,239,255,255,0,0,0,231,63,238,199,124,0,0,0,7,0,134,3,56,0,0,0,6,0,6,0,0,0,0,0,7,0,14,0,6,48,0,128,3,0,28,128,15,248,0,128,129,31,24,192,255,255,1,192,225,63,56,192,248,207,1,224,224,120,120,192,0,192,1,248,112,224,240,193,1,192,1,120,48,224,224,193,1,192,1,24,48,192,128,225,0,128,3,24,48,192,128,113,224,3,7,120,48,224,224,49,248,7,7,248,112,224,240,57,252,15,14,224,224,121,112,62,28,28,62,192,225,63,56,31,14,24,124,128,129,31,24,7,14,56,112,128,3,0,28,3,14,56,112,0,7,0,14,7,14,56,112,0,6,0,6,31,14,28,126,0,6,0,6,62,28,30,30,0,231,63,14,56,248,15,6,0,255,255,15,112,240,7,7,0,126,230,7,112,192,129,7,0,56,192,1,224,0,128,3,0,0,0,0,192,1,192,1,0,0,0,0,192,1,192,1,0,0,0,0,192,120,134,1,0,0,0,0,192,253,207,1,0,0,0,0,192,255,255,1,0,0,0,0,0,15,120,0,0,0,0,0,0,2,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,0,0,0,0,128,0,62,0,0,0,0,0,224,241,127,0,0,0,0,0,240,255,115,0,0,0,0,0,120,255,113,0,0,0,0,0,56,0,112,0,0,0,0,0,48,0,224,0,0,0,0,0,112,0,224,1,0,0,0,0,48,0,192,1,0,0,0,0,56,248,131,3,0,0,0,0,24,252,7,31,0,0,0,0,28,30,15,31,0,0,0,0,12,6,14,56,0,0,0,0,15,7,28,56,0,0,0,128,15,7,28,56,0,0,0,128,3,7,28,62,0,0,0,128,3,7,28,30,0,0,0,128,7,14,14,7,0,0,0,128,31,158,15,3,0,0,0,0,31,252,7,3,0,0,0,0,56,248,131,3,0,0,0,0,48,0,192,1,0,0,0,0,112,0,192,1,0,0,96,0,224,0,192,1,0,0,248,0,193,1,140,1,0,0,254,143,199,248,223,1,0,0,206,255,207,249,255,0,0,0,140,255,220,223,120,0,0,0,14,64,156,15,32,0,0,0,15,0,12,6,0,0,0,0,7,0,14,0,30,0,0,128,3,0,28,128,31,224,0,128,129,31,24,128,251,255,1,240,225,63,56,128,241,255,3,248,224,120,48,128,3,28,3,56,112,224,48,192,3,128,3,24,48,224,240,224,1,128,3,24,48,192,224,225,0,128,3,120,48,192,128,113,224,3,3,240,48,224,128,61,248,7,7,224,112,224,192,63,252,15,6,192,224,121,240,31,28,28,14,192,193,63,248,7,14,24,30,128,129,31,28,3,14,56,60,128,3,0,28,15,14,56,120,0,3,0,14,31,14,56,112,128,3,0,7,28,14,28,48,128,35,0,3,56,28,30,62,128,243,31,3,56,248,15,62,0,255,191,3,48,240,7,7,0,30,255,3,112,192,1,3,0,0,240,1,224,0,128,3,0,0,96,0,224,0,192,1,0,0,0,0,96,0,224,0,0,0,0,0,112,62,224,0,0,0,0,0,224,255,231,0,0,0,0,0,192,247,255,0,0,0,0,0,128,3,126,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,0,0,0,128,31,0,0,0,0,0,96,248,61,0,0,0,0,0,240,255,57,0,0,0,0,0,248,255,56,0,0,0,0,0,188,7,120,0,0,0,0,0,28,0,240,0,0,0,0,0,56,0,224,0,0,0,0,0,56,0,192,3,0,0,0,0,56,248,131,31,0,0,0,0,24,252,7,31,0,0,0,0,28,30,15,24,0,0,0,0,12,14,14,56,0,0,0,0,12,7,28,60,0,0,0,0,14,7,28,30,0,0,0,128,15,7,28,14,0,0,0,128,3,7,28,6,0,0,0,128,3,14,14,7,0,0,0,128,3,30,15,7,0,0,0,0,31,252,7,3,0,0,0,0,63,248,129,3,0,0,0,0,48,0,128,3,0,0,0,0,112,0,128,3,0,0,224,1,224,1,0,3,0,0,248,1,192,3,188,3,0,0,248,15,134,227,255,3,0,0,24,255,143,243,255,0,0,0,24,255,159,127,64,0,0,0,28,192,57,63,0,0,0,0,14,0,56,28,48,0,0,0,7,0,24,0,126,0,0,128,3,0,28,0,127,0,0,240,129,31,24,0,231,207,1,248,225,63,56,0,199,255,3,56,224,120,48,0,7,252,7,24,112,224,48,192,3,0,15,56,48,224,48,224,1,0,7,120,48,192,112,224,0,0,7,240,48,192,240,127,224,3,7,224,48,224,192,63,248,7,7,192,112,224,128,31,252,15,6,192,224,121,192,7,28,28,14,192,193,63,248,7,14,24,14,128,129,31,248,31,14,56,12,128,3,0,28,30,14,56,60,192,1,0,14,24,14,56,120,192,1,0,7,24,14,28,112,192,57,128,3,56,28,30,48,128,255,135,1,56,248,15,62,0,239,143,1,112,240,7,63,0,6,254,1,112,192,129,31,0,0,248,1,112,0,128,3,0,0,120,0,56,0,224,1,0,0,0,0,56,6,240,0,0,0,0,0,240,127,112,0,0,0,0,0,224,255,49,0,0,0,0,0,192,241,115,0,0,0,0,0,0,0,127,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,192,7,0,0,0,0,0,0,224,15,0,0,0,0,0,0,224,12,0,0,0,0,0,48,126,12,0,0,0,0,0,248,63,28,0,0,0,0,0,252,3,120,0,0,0,0,0,158,0,240,0,0,0,0,0,14,0,192,15,0,0,0,0,28,0,192,15,0,0,0,0,24,248,131,31,0,0,0,0,24,252,7,28,0,0,0,0,28,30,15,24,0,0,0,0,28,14,14,28,0,0,0,0,12,7,28,14,0,0,0,0,12,7,28,6,0,0,0,0,14,7,28,6,0,0,0,0,15,7,28,6,0,0,0,128,7,14,14,7,0,0,0,128,3,30,15,7,0,0,0,0,3,252,7,3,0,0,0,0,63,248,129,3,0,0,0,0,126,0,0,7,0,0,0,0,118,0,0,6,0,0,224,3,224,1,48,7,0,0,240,7,192,3,252,3,0,0,112,14,0,199,255,3,0,0,112,126,12,230,135,0,0,0,56,252,31,238,0,0,0,0,62,192,63,126,0,0,0,0,14,0,115,124,120,0,0,96,7,0,112,0,252,0,0,240,3,0,48,0,252,1,0,240,129,31,56,0,204,15,0,56,224,63,56,0,142,255,3,56,224,120,56,128,15,252,7,120,112,224,48,192,3,240,15,240,48,224,48,224,1,0,12,224,48,192,112,252,0,0,14,224,48,192,112,126,224,3,6,224,48,224,240,14,248,15,7,224,112,224,224,7,252,15,6,192,224,121,192,15,28,28,14,192,225,63,192,31,14,24,14,192,129,31,248,28,14,56,12,224,0,0,252,24,14,56,12,224,0,0,110,24,14,56,28,224,12,128,7,24,14,28,60,192,63,192,3,56,28,30,56,128,255,227,1,56,248,15,48,0,227,231,0,48,240,7,62,0,0,239,0,56,192,129,31,0,0,254,0,24,0,128,31,0,0,124,0,28,1,192,1,0,0,0,0,248,7,240,0,0,0,0,0,240,63,120,0,0,0,0,0,224,254,24,0,0,0,0,0,0,240,28,0,0,0,0,0,0,192,31,0,0,0,0,0,0,128,31,0,0,0,0,0,0,128,3,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,3,0,0,0,0,0,0,240,7,0,0,0,0,0,0,56,7,0,0,0,0,0,0,62,14,0,0,0,0,0,152,31,62,0,0,0,0,0,252,3,124,0,0,0,0,0,252,1,240,7,0,0,0,0,78,0,192,15,0,0,0,0,15,0,128,15,0,0,0,0,14,248,3,28,0,0,0,0,28,252,7,28,0,0,0,0,28,30,15,30,0,0,0,0,28,6,14,15,0,0,0,0,12,7,28,6,0,0,0,0,12,7,28,6,0,0,0,0,12,7,28,6,0,0,0,0,12,7,28,7,0,0,0,0,14,14,14,7,0,0,0,0,15,30,15,7,0,0,0,0,7,252,7,7,0,0,0,0,7,248,1,14,0,0,0,0,62,0,0,14,0,0,0,0,254,0,64,14,0,0,192,15,252,1,240,7,0,0,192,15,192,7,252,3,0,0,192,28,0,143,31,1,0,0,224,124,0,140,7,0,0,0,120,248,25,220,1,0,0,0,60,192,63,252,1,0,0,224,15,0,127,248,240,1,0,224,7,0,118,0,248,3,0,240,3,0,224,0,248,3,0,48,128,31,112,0,24,15,0,56,224,63,112,0,30,63,0,112,224,120,48,128,15,252,7,224,112,224,48,216,3,224,15,224,48,224,112,252,1,192,31,224,48,192,112,252,0,0,28,224,48,192,48,14,224,3,28,224,48,224,48,14,248,7,14,192,112,224,112,14,252,15,14,192,224,121,224,28,28,28,14,224,224,63,192,25,14,24,14,240,128,31,192,24,14,56,12,112,0,0,252,24,14,56,12,96,6,0,126,24,14,56,14,224,15,0,127,24,14,28,14,192,63,224,3,56,28,30,28,128,248,241,1,56,252,15,56,0,224,113,0,28,240,7,56,0,128,51,0,14,192,1,25,0,0,63,0,28,0,128,31,0,0,63,0,252,1,192,15,0,0,0,0,248,7,240,0,0,0,0,0,48,63,124,0,0,0,0,0,0,124,28,0,0,0,0,0,0,112,14,0,0,0,0,0,0,224,15,0,0,0,0,0,0,224,15,0,0,0,0,0,0,192,3,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,1,0,0,0,0,0,0,248,1,0,0,0,0,0,0,156,3,0,0,0,0,0,0,158,15,0,0,0,0,0,128,15,31,0,0,0,0,0,192,7,252,3,0,0,0,0,252,1,240,7,0,0,0,0,126,0,224,14,0,0,0,0,38,0,0,12,0,0,0,0,7,248,3,14,0,0,0,0,7,252,7,15,0,0,0,0,14,30,15,7,0,0,0,0,12,14,14,7,0,0,0,0,12,7,28,7,0,0,0,0,12,7,28,6,0,0,0,0,12,7,28,6,0,0,0,0,12,7,28,6,0,0,0,0,28,14,14,7,0,0,0,0,28,30,15,14,0,0,0,0,14,252,7,28,0,0,0,0,7,248,1,28,0,0,0,0,6,0,192,14,0,0,0,0,126,0,224,15,0,0,128,31,252,1,240,7,0,0,128,63,252,7,124,0,0,0,128,57,128,31,31,0,0,0,224,113,0,62,7,0,0,0,248,240,1,56,3,0,0,192,63,192,3,240,3,0,0,224,15,0,127,240,227,3,0,224,7,0,126,0,224,7,0,112,0,0,228,0,240,7,0,112,128,31,192,0,120,14,0,224,224,63,224,0,62,62,0,224,224,120,240,48,15,124,0,192,112,224,112,248,3,224,15,224,48,224,48,252,1,192,31,224,48,192,112,12,0,128,31,224,48,192,112,14,224,3,56,224,112,224,48,28,248,7,56,224,112,224,48,56,252,15,28,240,224,121,48,56,28,28,14,120,192,63,112,24,14,24,14,48,128,31,224,24,14,56,12,112,2,0,224,24,14,56,12,224,7,0,126,24,14,56,14,224,15,0,127,24,14,28,14,0,60,192,63,28,28,28,14,0,248,248,1,30,248,15,14,0,224,120,0,14,240,7,28,0,192,29,0,14,192,1,24,0,192,31,0,252,0,128,28,0,192,15,0,252,1,192,15,0,0,0,0,152,7,240,15,0,0,0,0,0,31,126,4,0,0,0,0,0,60,31,0,0,0,0,0,0,56,7,0,0,0,0,0,0,240,3,0,0,0,0,0,0,240,3,0,0,0,0,0,0,224,1,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,124,0,0,0,0,0,0,0,254,0,0,0,0,0,0,0,206,1,0,0,0,0,0,0,198,15,0,0,0,0,0,128,135,255,3,0,0,0,0,192,3,248,3,0,0,0,0,224,1,112,7,0,0,0,0,126,0,0,14,0,0,0,0,127,0,0,7,0,0,0,0,23,248,3,7,0,0,0,0,3,252,7,3,0,0,0,128,3,30,15,7,0,0,0,0,15,14,14,7,0,0,0,0,14,7,28,6,0,0,0,0,12,7,28,6,0,0,0,0,12,7,28,6,0,0,0,0,12,7,28,14,0,0,0,0,28,14,14,30,0,0,0,0,28,30,15,28,0,0,0,0,24,252,7,28,0,0,0,0,28,248,129,31,0,0,0,0,14,0,192,15,0,0,0,0,14,0,224,15,0,0,0,126,220,1,240,0,0,0,0,127,248,7,124,0,0,0,0,103,248,63,30,0,0,0,224,227,0,126,14,0,0,128,255,225,1,96,14,0,0,192,63,192,3,224,15,0,0,224,14,0,7,192,135,7,0,96,0,0,126,0,192,15,0,224,0,0,252,0,192,31,0,192,129,31,232,0,248,28,0,192,225,63,192,113,254,60,0,192,224,120,192,241,15,120,0,224,112,224,240,248,3,224,0,224,48,224,112,28,0,192,15,224,48,192,112,28,0,128,31,224,48,192,112,56,224,3,63,224,48,224,112,56,248,7,56,120,112,224,48,56,252,15,56,56,224,121,56,56,28,28,60,56,192,63,56,24,14,24,28,240,129,31,56,24,14,56,12,240,3,0,112,24,14,56,12,224,7,0,112,28,14,56,12,0,14,0,127,30,14,28,14,0,60,192,63,15,28,30,14,0,120,252,31,6,248,15,6,0,112,126,0,14,240,7,6,0,96,14,0,126,192,1,14,0,224,7,0,252,0,0,28,0,224,7,0,192,1,64,14,0,0,0,0,128,7,240,15,0,0,0,0,0,15,254,7,0,0,0,0,0,140,31,3,0,0,0,0,0,156,3,0,0,0,0,0,0,252,1,0,0,0,0,0,0,252,1,0,0,0,0,0,0,224,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,247,1,0,0,0,0,0,0,227,239,1,0,0,0,0,128,195,255,3,0,0,0,0,192,3,188,7,0,0,0,0,224,1,0,7,0,0,0,0,112,0,0,3,0,0,0,0,62,0,128,3,0,0,0,0,63,248,131,3,0,0,0,0,31,252,7,3,0,0,0,128,3,30,15,7,0,0,0,128,3,15,14,7,0,0,0,128,7,7,28,6,0,0,0,0,15,7,28,6,0,0,0,0,12,7,28,30,0,0,0,0,12,7,28,60,0,0,0,0,12,14,14,56,0,0,0,0,28,30,15,24,0,0,0,0,24,252,7,31,0,0,0,0,56,248,129,31,0,0,0,0,56,0,192,15,0,0,0,0,28,0,224,0,0,0,0,124,28,1,240,0,0,0,0,252,249,7,120,0,0,0,2,239,241,127,24,0,0,0,231,207,225,252,24,0,0,128,255,199,1,224,29,0,0,192,61,128,3,192,31,0,0,192,0,0,7,128,7,7,0,192,1,0,14,0,0,63,0,192,1,0,252,0,128,63,0,128,129,31,248,192,248,49,0,192,225,63,240,241,255,49,0,192,224,120,192,249,15,112,0,192,112,224,192,57,2,224,0,224,48,224,224,57,0,192,1,224,48,192,240,112,0,128,3,240,48,192,112,112,224,3,63,120,48,224,48,48,248,7,62,24,112,224,48,56,252,15,48,56,224,120,56,56,28,28,48,248,224,63,56,24,14,24,120,240,129,31,24,24,14,56,60,240,3,0,24,28,14,56,12,0,7,0,56,31,14,56,14,0,14,0,56,7,14,28,14,0,28,192,63,7,28,30,14,0,56,254,31,14,248,15,6,0,56,127,14,126,240,7,7,0,248,7,0,126,192,1,7,0,248,3,0,224,0,0,7,0,224,1,0,192,1,0,14,0,0,0,0,128,3,112,15,0,0,0,0,0,7,254,7,0,0,0,0,0,198,255,3,0,0,0,0,0,230,135,1,0,0,0,0,0,254,0,0,0,0,0,0,0,124,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,0,0,0,128,31,0,0,0,0,0,0,192,255,113,0,0,0,0,0,192,249,255,1,0,0,0,0,128,241,223,3,0,0,0,0,192,1,140,3,0,0,0,0,224,0,128,1,0,0,0,0,112,0,192,1,0,0,0,0,48,0,192,1,0,0,0,0,56,248,131,3,0,0,0,0,31,252,7,3,0,0,0,128,15,30,15,7,0,0,0,128,3,6,14,7,0,0,0,128,3,7,28,14,0,0,0,128,7,7,28,62,0,0,0,0,15,7,28,60,0,0,0,0,14,7,28,56,0,0,0,0,28,14,14,56,0,0,0,0,28,30,15,31,0,0,0,0,24,252,135,31,0,0,0,0,56,248,131,3,0,0,0,0,48,0,192,1,0,0,0,0,112,0,224,1,0,0,0,112,56,0,240,0,0,0,0,240,57,6,112,0,0,0,14,255,251,255,49,0,0,0,255,159,227,255,51,0,0,128,251,143,195,241,127,0,0,128,49,128,3,0,31,0,0,128,3,0,7,0,6,0,0,128,3,0,14,0,0,62,0,128,3,0,28,128,1,127,0,128,129,31,56,192,255,119,0,192,225,63,248,241,255,99,0,192,224,120,240,113,14,96,0,192,112,224,128,113,0,224,0,224,48,224,128,97,0,192,1,248,48,192,192,225,0,128,3,56,48,192,240,113,224,3,7,24,112,224,112,48,248,7,63,24,112,224,48,56,252,15,62,248,224,121,48,56,28,28,48,248,193,63,56,28,14,24,112,128,129,31,28,30,14,56,112,128,3,0,28,15,14,56,124,0,7,0,28,7,14,56,30,0,14,0,28,7,14,28,14,0,28,192,28,31,28,30,14,0,140,255,31,62,248,15,6,0,156,255,15,124,240,7,7,0,252,15,7,112,192,1,3,0,248,0,0,224,0,128,3,0,96,0,0,192,1,128,3,0,0,0,0,128,3,0,7,0,0,0,0,128,3,190,7,0,0,0,0,128,243,255,3,0,0,0,0,128,255,227,1,0,0,0,0,0,63,64,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,128,7,56,0,0,0,0,0,224,255,124,0,0,0,0,0,224,253,255,0,0,0,0,0,224,248,199,1,0,0,0,0,224,0,192,0,0,0,0,0,224,0,192,0,0,0,0,0,112,0,192,0,0,0,0,0,112,0,192,1,0,0,0,0,56,248,131,3,0,0,0,0,28,252,7,3,0,0,0,0,31,30,15,7,0,0,0,128,15,14,14,31,0,0,0,128,3,7,28,62,0,0,0,128,3,7,28,56,0,0,0,128,3,7,28,56,0,0,0,128,15,7,28,60,0,0,0,0,15,14,14,31,0,0,0,0,28,30,15,31,0,0,0,0,24,252,7,3,0,0,0,0,56,248,129,3,0,0,0,0,48,0,192,1,0,0,0,0,112,0,224,1,0,0,0,0,96,0,224,0,0,0,24,224,97,0,96,0,0,0,62,255,119,254,227,0,0,0,255,127,247,255,255,0,0,0,231,63,198,103,126,0,0,0,7,0,135,3,60,0,0,0,7,0,7,0,0,0,0,0,7,0,14,0,2,56,0,128,3,0,28,128,7,252,0,192,129,31,24,192,255,255,1,192,225,63,56,224,252,207,1,192,224,121,240,224,8,192,1,248,112,224,240,193,0,192,1,248,48,224,128,193,0,192,1,24,48,192,128,225,0,128,3,24,48,192,192,113,224,3,7,56,112,224,240,49,248,7,7,248,112,224,240,56,252,15,30,240,224,121,56,60,28,28,62,192,193,63,56,31,14,24,124,128,129,31,28,7,14,56,112,128,3,0,28,3,14,56,112,0,7,0,14,7,14,56,124,0,14,0,14,31,14,24,62,0,6,0,14,62,28,30,14,0,198,127,14,56,248,15,6,0,238,255,15,112,240,7,7,0,254,199,7,112,192,129,3,0,120,128,1,224,0,128,3,0,0,0,0,192,1,192,1,0,0,0,0,192,1,128,1,0,0,0,0,192,113,142,3,0,0,0,0,192,249,255,3,0,0,0,0,192,255,255,1,0,0,0,0,0,15,112,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,0,0,128,1,62,0,0,0,0,0,192,227,127,0,0,0,0,0,240,255,119,0,0,0,0,0,112,254,99,0,0,0,0,0,112,0,112,0,0,0,0,0,112,0,224,0,0,0,0,0,112,0,192,1,0,0,0,0,48,0,192,1,0,0,0,0,56,248,131,3,0,0,0,0,24,252,7,7,0,0,0,0,28,30,15,31,0,0,0,0,30,14,14,62,0,0,0,128,15,7,28,56,0,0,0,128,3,7,28,56,0,0,0,128,3,7,28,60,0,0,0,128,3,7,12,30,0,0,0,128,15,14,14,7,0,0,0,0,31,30,15,7,0,0,0,0,28,252,7,3,0,0,0,0,56,248,129,3,0,0,0,0,112,0,192,1,0,0,0,0,240,0,192,0,0,0,32,0,224,0,192,1,0,0,120,128,193,0,192,1,0,0,254,207,199,248,207,1,0,0,206,255,239,253,255,1,0,0,142,255,220,255,120,0,0,0,14,0,12,15,48,0,0,0,14,0,14,0,0,0,0,0,7,0,14,0,14,0,0,128,3,0,28,128,31,240,0,128,129,31,24,192,255,255,1,192,225,63,56,128,241,255,3,248,224,120,48,128,1,140,3,120,112,224,112,192,1,128,3,24,48,224,240,225,1,128,1,24,48,192,224,225,0,128,3,120,48,192,128,113,224,3,7,248,48,224,128,49,248,15,7,224,112,224,240,63,252,15,6,192,224,121,248,31,28,28,14,192,225,63,56,7,14,24,62,192,129,31,24,7,14,56,124,128,3,0,28,7,14,56,112,0,7,0,14,31,14,56,112,0,7,0,7,30,14,28,120,128,3,0,3,56,28,30,62,128,243,31,7,56,248,15,30,0,255,63,7,112,240,7,7,0,62,247,7,112,192,129,3,0,8,224,1,224,0,128,3,0,0,64,0,224,0,192,1,0,0,0,0,224,0,224,0,0,0,0,0,224,60,194,0,0,0,0,0,224,255,231,0,0,0,0,0,192,255,255,0,0,0,0,0,0,3,124,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,0,0,0,0,0,128,63,0,0,0,0,0,224,240,63,0,0,0,0,0,240,255,49,0,0,0,0,0,248,255,56,0,0,0,0,0,56,3,120,0,0,0,0,0,56,0,240,0,0,0,0,0,56,0,192,1,0,0,0,0,48,0,192,1,0,0,0,0,56,248,131,15,0,0,0,0,28,252,7,31,0,0,0,0,28,30,15,30,0,0,0,0,28,6,14,24,0,0,0,0,14,7,28,56,0,0,0,0,15,7,28,62,0,0,0,128,7,7,28,14,0,0,0,128,3,7,28,7,0,0,0,128,3,14,14,7,0,0,0,0,15,30,15,7,0,0,0,0,31,252,135,3,0,0,0,0,62,248,129,3,0,0,0,0,112,0,192,1,0,0,0,0,240,0,128,3,0,0,224,0,224,1,128,3,0,0,248,1,192,1,156,3,0,0,252,15,135,241,255,3,0,0,156,255,143,241,255,0,0,0,28,255,159,127,96,0,0,0,28,192,184,31,0,0,0,0,15,0,24,28,16,0,0,0,7,0,28,0,62,0,0,128,3,0,28,0,127,128,0,240,129,31,24,0,247,239,1,248,225,63,56,0,227,255,3,120,224,120,48,128,3,60,7,24,112,224,48,192,3,0,7,24,48,224,112,224,1,0,7,120,48,192,240,224,0,128,3,240,48,192,224,113,224,3,7,224,48,224,192,63,248,7,7,192,112,224,192,63,252,15,6,192,224,121,240,7,28,28,14,192,225,63,248,7,14,24,14,128,129,31,252,15,14,56,28,128,3,0,28,30,14,56,124,128,3,0,14,28,14,56,112,192,1,0,7,24,14,28,112,192,57,128,3,56,28,30,56,128,255,143,1,56,252,15,62,0,255,159,1,112,240,7,63,0,6,255,3,112,192,1,3,0,0,248,1,112,0,128,3,0,0,48,0,112,0,224,1,0,0,0,0,112,4,224,0,0,0,0,0,112,63,112,0,0,0,0,0,224,255,115,0,0,0,0,0,192,241,119,0,0,0,0,0,0,0,127,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,192,15,0,0,0,0,0,0,192,31,0,0,0,0,0,0,224,28,0,0,0,0,0,112,254,28,0,0,0,0,0,248,63,28,0,0,0,0,0,252,3,120,0,0,0,0,0,28,0,240,0,0,0,0,0,28,0,192,1,0,0,0,0,28,0,192,15,0,0,0,0,56,248,131,31,0,0,0,0,24,252,7,28,0,0,0,0,28,30,15,24,0,0,0,0,12,14,14,60,0,0,0,0,12,7,28,30,0,0,0,0,12,7,28,14,0,0,0,0,14,7,28,6,0,0,0,128,15,7,28,7,0,0,0,128,3,14,14,7,0,0,0,0,3,30,15,7,0,0,0,0,7,252,135,3,0,0,0,0,63,248,129,3,0,0,0,0,126,0,0,7,0,0,0,0,112,0,0,7,0,0,224,3,224,1,48,7,0,0,240,3,192,3,252,3,0,0,48,15,0,199,255,3,0,0,48,126,14,231,199,1,0,0,56,252,31,255,0,0,0,0,60,192,63,127,0,0,0,0,14,0,113,60,112,0,0,0,7,0,112,0,254,0,0,240,3,0,56,0,254,0,0,240,129,31,24,0,206,15,1,56,224,63,56,0,142,255,3,56,224,121,48,0,7,252,7,56,112,224,48,192,3,96,14,120,48,224,48,192,1,0,14,224,48,192,112,252,0,0,14,224,48,192,112,126,224,3,7,224,112,224,224,63,248,7,7,224,112,224,192,7,252,15,6,192,224,121,192,7,28,28,14,192,193,63,192,15,14,24,14,192,129,31,248,28,14,56,12,192,1,0,252,24,14,56,12,224,0,0,14,24,14,56,60,224,8,0,7,24,14,28,120,192,63,192,3,56,28,30,48,128,255,195,1,56,248,15,56,0,227,199,0,48,240,7,63,0,0,239,0,112,192,129,63,0,0,254,0,56,0,128,11,0,0,124,0,56,0,192,1,0,0,0,0,184,7,240,0,0,0,0,0,240,127,120,0,0,0,0,0,224,252,57,0,0,0,0,0,0,240,57,0,0,0,0,0,0,128,63,0,0,0,0,0,0,128,31,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0},
-    };
-
-static const unsigned char eye[][BITMAP_LENGTH] = {
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,15,0,0,0,0,0,0,255,255,0,0,0,0,0,224,255,255,15,0,0,0,0,252,31,248,63,0,0,0,0,255,0,0,255,0,0,0,128,63,0,0,252,3,0,0,224,31,0,0,248,7,0,0,248,29,224,7,184,31,0,0,124,12,240,15,112,62,0,0,62,14,248,31,112,124,0,128,15,14,252,63,112,240,1,192,7,6,252,63,112,224,3,224,1,6,252,63,96,192,7,240,0,6,252,63,96,0,15,120,0,6,252,63,96,0,30,60,0,6,252,63,96,0,60,30,0,14,248,31,96,0,120,30,0,14,248,31,112,0,120,60,0,12,224,7,48,0,60,120,0,28,0,0,56,0,30,240,0,24,0,0,24,0,15,224,1,56,0,0,28,128,7,192,3,112,0,0,14,192,1,0,15,224,0,0,7,240,0,0,30,192,3,192,3,120,0,0,124,128,15,248,1,62,0,0,240,0,255,127,0,15,0,0,224,3,248,63,192,7,0,0,128,15,0,0,240,1,0,0,0,126,0,0,126,0,0,0,0,248,3,224,31,0,0,0,0,224,255,255,7,0,0,0,0,0,254,255,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,15,0,0,0,0,0,0,255,255,0,0,0,0,0,224,255,255,15,0,0,0,0,252,31,248,63,0,0,0,0,255,0,0,255,0,0,0,128,63,0,0,252,3,0,0,224,31,0,0,248,7,0,0,248,29,224,7,184,31,0,0,124,12,240,15,112,62,0,0,62,14,248,31,112,124,0,128,15,14,252,63,112,240,1,192,7,6,252,63,112,224,3,224,1,6,252,63,96,192,7,240,0,6,252,63,96,0,15,120,0,6,252,63,96,0,30,60,0,6,252,63,96,0,60,30,0,14,248,31,96,0,120,30,0,14,248,31,112,0,120,60,0,12,224,7,48,0,60,120,0,28,0,0,56,0,30,240,0,24,0,0,24,0,15,224,1,56,0,0,28,128,7,192,3,112,0,0,14,192,1,0,15,224,0,0,7,240,0,0,30,192,3,192,3,120,0,0,124,128,15,248,1,62,0,0,240,0,255,127,0,15,0,0,224,3,248,63,192,7,0,0,128,15,0,0,240,1,0,0,0,126,0,0,126,0,0,0,0,248,3,224,31,0,0,0,0,224,255,255,7,0,0,0,0,0,254,255,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,15,0,0,0,0,0,0,255,255,0,0,0,0,0,224,255,255,15,0,0,0,0,252,31,248,63,0,0,0,0,255,0,0,255,0,0,0,128,63,0,0,252,3,0,0,224,31,0,0,248,7,0,0,248,29,224,7,184,31,0,0,124,12,240,15,112,62,0,0,62,14,248,31,112,124,0,128,15,14,252,63,112,240,1,192,7,6,252,63,112,224,3,224,1,6,252,63,96,192,7,240,0,6,252,63,96,0,15,120,0,6,252,63,96,0,30,60,0,6,252,63,96,0,60,30,0,14,248,31,96,0,120,30,0,14,248,31,112,0,120,60,0,12,224,7,48,0,60,120,0,28,0,0,56,0,30,240,0,24,0,0,24,0,15,224,1,56,0,0,28,128,7,192,3,112,0,0,14,192,1,0,15,224,0,0,7,240,0,0,30,192,3,192,3,120,0,0,124,128,15,248,1,62,0,0,240,0,255,127,0,15,0,0,224,3,248,63,192,7,0,0,128,15,0,0,240,1,0,0,0,126,0,0,126,0,0,0,0,248,3,224,31,0,0,0,0,224,255,255,7,0,0,0,0,0,254,255,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,15,0,0,0,0,0,0,255,255,0,0,0,0,0,224,255,255,15,0,0,0,0,252,31,248,63,0,0,0,0,255,0,0,255,0,0,0,128,63,0,0,252,3,0,0,224,31,0,0,248,7,0,0,248,29,224,7,184,31,0,0,124,12,240,15,112,62,0,0,62,14,248,31,112,124,0,128,15,14,252,63,112,240,1,192,7,6,252,63,112,224,3,224,1,6,252,63,96,192,7,240,0,6,252,63,96,0,15,120,0,6,252,63,96,0,30,60,0,6,252,63,96,0,60,30,0,14,248,31,96,0,120,30,0,14,248,31,112,0,120,60,0,12,224,7,48,0,60,120,0,28,0,0,56,0,30,240,0,24,0,0,24,0,15,224,1,56,0,0,28,128,7,192,3,112,0,0,14,192,1,0,15,224,0,0,7,240,0,0,30,192,3,192,3,120,0,0,124,128,15,248,1,62,0,0,240,0,255,127,0,15,0,0,224,3,248,63,192,7,0,0,128,15,0,0,240,1,0,0,0,126,0,0,126,0,0,0,0,248,3,224,31,0,0,0,0,224,255,255,7,0,0,0,0,0,254,255,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,15,0,0,0,0,0,0,255,255,0,0,0,0,0,224,255,255,15,0,0,0,0,252,255,255,63,0,0,0,0,255,255,255,255,0,0,0,128,255,31,252,255,3,0,0,224,127,0,0,255,7,0,0,248,31,224,7,248,31,0,0,252,15,240,15,240,63,0,0,254,14,248,31,112,127,0,128,63,14,252,63,112,252,1,192,15,6,252,63,112,240,3,224,3,6,252,63,96,192,7,240,1,6,252,63,96,128,15,120,0,6,252,63,96,0,30,60,0,6,252,63,96,0,60,30,0,14,248,31,96,0,120,30,0,14,248,31,112,0,120,60,0,12,224,7,48,0,60,120,0,28,0,0,56,0,30,240,0,24,0,0,24,0,15,224,1,56,0,0,28,128,7,192,3,112,0,0,14,192,1,0,15,224,0,0,7,240,0,0,30,192,3,192,3,120,0,0,124,128,15,248,1,62,0,0,240,0,255,127,0,15,0,0,224,3,248,63,192,7,0,0,128,15,0,0,240,1,0,0,0,126,0,0,126,0,0,0,0,248,3,224,31,0,0,0,0,224,255,255,7,0,0,0,0,0,254,255,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,15,0,0,0,0,0,0,255,255,0,0,0,0,0,224,255,255,15,0,0,0,0,252,15,240,63,0,0,0,0,255,0,0,255,0,0,0,128,31,0,0,248,3,0,0,224,7,0,0,224,7,0,0,248,1,0,0,128,31,0,0,124,0,0,0,0,62,0,0,62,192,255,255,7,124,0,128,15,252,255,255,127,240,1,192,199,255,255,255,255,231,3,224,255,15,252,63,240,255,7,240,127,7,252,63,224,255,15,248,7,6,252,63,96,240,31,252,1,6,252,63,96,128,63,62,0,14,248,31,96,0,124,30,0,14,248,31,112,0,120,60,0,12,224,7,48,0,60,120,0,28,0,0,56,0,30,240,0,24,0,0,24,0,15,224,1,56,0,0,28,128,7,192,3,112,0,0,14,192,1,0,15,224,0,0,7,240,0,0,30,192,3,192,3,120,0,0,124,128,15,248,1,62,0,0,240,0,255,127,0,15,0,0,224,3,248,63,192,7,0,0,128,15,0,0,240,1,0,0,0,126,0,0,126,0,0,0,0,248,3,224,31,0,0,0,0,224,255,255,7,0,0,0,0,0,254,255,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,15,0,0,0,0,0,0,255,255,0,0,0,0,0,224,255,255,15,0,0,0,0,252,15,240,63,0,0,0,0,255,0,0,255,0,0,0,128,31,0,0,248,3,0,0,224,7,0,0,224,7,0,0,248,1,0,0,128,31,0,0,124,0,0,0,0,62,0,0,62,0,0,0,0,124,0,128,15,0,0,0,0,240,1,192,7,0,0,0,0,224,3,224,1,0,0,0,0,192,7,240,0,0,0,0,0,0,15,120,0,0,0,0,0,0,30,60,0,0,0,0,0,0,60,254,255,255,255,255,255,255,127,254,255,255,255,255,255,255,127,60,0,30,240,15,120,0,60,120,0,28,0,0,56,0,30,240,0,24,0,0,24,0,15,224,1,56,0,0,28,128,7,192,3,112,0,0,14,192,1,0,15,224,0,0,7,240,0,0,30,192,3,192,3,120,0,0,124,128,15,248,1,62,0,0,240,0,255,127,0,15,0,0,224,3,248,63,192,7,0,0,128,15,0,0,240,1,0,0,0,126,0,0,126,0,0,0,0,248,3,224,31,0,0,0,0,224,255,255,7,0,0,0,0,0,254,255,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,15,0,0,0,0,0,0,255,255,0,0,0,0,0,224,255,255,15,0,0,0,0,252,15,240,63,0,0,0,0,255,0,0,255,0,0,0,128,31,0,0,248,3,0,0,224,7,0,0,224,7,0,0,248,1,0,0,128,31,0,0,124,0,0,0,0,62,0,0,62,0,0,0,0,124,0,128,15,0,0,0,0,240,1,192,7,0,0,0,0,224,3,224,1,0,0,0,0,192,7,240,0,0,0,0,0,0,15,120,0,0,0,0,0,0,30,60,0,0,0,0,0,0,60,30,0,0,0,0,0,0,120,62,0,0,0,0,0,0,124,252,1,0,0,0,0,128,63,248,7,0,0,0,0,224,31,240,127,0,0,0,0,254,15,224,255,7,0,0,192,255,7,192,227,255,1,0,255,199,1,0,15,254,255,255,127,240,0,0,30,224,255,255,7,120,0,0,124,128,255,255,1,62,0,0,240,0,255,127,0,15,0,0,224,3,248,63,192,7,0,0,128,15,0,0,240,1,0,0,0,126,0,0,126,0,0,0,0,248,3,224,31,0,0,0,0,224,255,255,7,0,0,0,0,0,254,255,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,15,0,0,0,0,0,0,255,255,0,0,0,0,0,224,255,255,15,0,0,0,0,252,15,240,63,0,0,0,0,255,0,0,255,0,0,0,128,31,0,0,248,3,0,0,224,7,0,0,224,7,0,0,248,1,0,0,128,31,0,0,124,0,0,0,0,62,0,0,62,0,0,0,0,124,0,128,15,0,0,0,0,240,1,192,7,0,0,0,0,224,3,224,1,0,0,0,0,192,7,240,0,0,0,0,0,0,15,120,0,0,0,0,0,0,30,60,0,0,0,0,0,0,60,30,0,0,0,0,0,0,120,30,0,0,0,0,0,0,120,124,0,0,0,0,0,0,60,248,0,0,0,0,0,0,30,240,1,0,0,0,0,128,15,224,3,0,0,0,0,192,7,192,15,0,0,0,0,240,1,0,63,0,0,0,0,248,0,0,126,0,0,0,0,126,0,0,252,3,0,0,128,63,0,0,240,15,0,0,240,15,0,0,224,127,0,0,254,7,0,0,128,255,15,224,255,1,0,0,0,254,255,255,127,0,0,0,0,248,255,255,31,0,0,0,0,224,255,255,7,0,0,0,0,0,254,255,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,7,0,0,0,0,0,128,255,255,0,0,0,0,0,240,255,255,15,0,0,0,0,252,15,240,63,0,0,0,0,255,0,0,255,0,0,0,128,31,0,0,248,1,0,0,224,7,0,0,224,7,0,0,248,1,0,0,128,31,0,0,124,0,0,0,0,62,0,0,30,0,0,0,0,124,0,0,15,0,0,0,0,240,1,192,7,0,0,0,0,224,3,224,1,0,0,0,0,192,7,240,0,0,0,0,0,0,15,120,0,0,0,0,0,0,30,60,0,0,0,0,0,0,60,30,0,0,0,0,0,0,120,30,0,0,0,0,0,0,120,60,0,0,0,0,0,0,60,120,0,0,0,0,0,0,30,240,0,0,0,0,0,0,15,224,3,0,0,0,0,128,7,192,7,0,0,0,0,224,3,128,15,0,0,0,0,240,0,0,63,0,0,0,0,252,0,0,127,0,0,0,0,254,0,0,248,1,0,0,128,31,0,0,224,7,0,0,224,7,0,0,128,31,0,0,248,1,0,0,0,255,0,0,255,0,0,0,0,254,7,240,63,0,0,0,0,238,255,255,31,0,0,0,0,0,255,255,16,0,0,0,0,0,224,15,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,7,0,0,0,0,0,128,255,255,0,0,0,0,0,240,255,255,15,0,0,0,0,252,15,240,63,0,0,0,0,255,0,0,255,0,0,0,128,31,0,0,248,1,0,0,224,7,0,0,224,7,0,0,248,1,0,0,128,31,0,0,124,0,0,0,0,62,0,0,30,0,0,0,0,124,0,0,15,0,0,0,0,240,1,192,7,0,0,0,0,224,3,224,1,0,0,0,0,192,7,240,0,0,0,0,0,0,15,120,0,0,0,0,0,0,30,60,0,0,0,0,0,0,60,30,0,0,0,0,0,0,120,30,0,0,0,0,0,0,120,60,0,0,0,0,0,0,60,120,0,0,0,0,0,0,30,240,0,0,0,0,0,0,15,224,3,0,0,0,0,128,7,192,7,0,0,0,0,224,3,128,15,0,0,0,0,240,0,0,63,0,0,0,0,252,0,128,127,0,0,0,0,254,1,192,249,1,0,0,128,159,3,192,225,7,0,0,224,7,3,0,128,31,0,0,248,1,0,0,0,255,0,0,255,0,0,0,0,254,7,240,63,0,0,0,0,238,255,255,63,0,0,0,0,6,255,255,56,0,0,0,0,6,224,15,48,0,0,0,0,6,128,1,48,0,0,0,0,0,128,1,0,0,0,0,0,0,128,1,0,0,0,0,0,0,128,1,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,7,0,0,0,0,0,128,255,255,0,0,0,0,0,240,255,255,15,0,0,0,0,252,15,240,63,0,0,0,0,255,0,0,255,0,0,0,128,31,0,0,248,1,0,0,224,7,0,0,224,7,0,0,248,1,0,0,128,31,0,0,124,0,0,0,0,62,0,0,30,0,0,0,0,124,0,0,15,0,0,0,0,240,1,192,7,0,0,0,0,224,3,224,1,0,0,0,0,192,7,240,0,0,0,0,0,0,15,120,0,0,0,0,0,0,30,60,0,0,0,0,0,0,60,30,0,0,0,0,0,0,120,30,0,0,0,0,0,0,120,60,0,0,0,0,0,0,60,120,0,0,0,0,0,0,30,240,0,0,0,0,0,0,15,224,3,0,0,0,0,128,7,192,7,0,0,0,0,224,3,128,15,0,0,0,0,240,0,0,63,0,0,0,0,252,0,128,127,0,0,0,0,254,1,192,249,1,0,0,128,159,3,224,225,7,0,0,224,7,7,224,128,31,0,0,248,1,7,112,0,255,0,0,255,0,14,48,0,254,7,240,63,0,12,0,0,238,255,255,63,0,0,0,0,6,255,255,56,0,0,0,0,6,224,15,48,0,0,0,0,7,128,1,112,0,0,0,0,3,128,1,112,0,0,0,0,3,128,1,112,0,0,0,128,3,128,1,96,0,0,0,0,1,128,1,96,0,0,0,0,0,128,1,0,0,0,0,0,0,128,1,0,0,0,0,0,0,128,1,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,7,0,0,0,0,0,128,255,255,0,0,0,0,0,240,255,255,15,0,0,0,0,252,15,240,63,0,0,0,0,255,0,0,255,0,0,0,128,31,0,0,248,1,0,0,224,7,0,0,224,7,0,0,248,1,0,0,128,31,0,0,124,0,0,0,0,62,0,0,30,0,0,0,0,124,0,0,15,0,0,0,0,240,1,192,7,0,0,0,0,224,3,224,1,0,0,0,0,192,7,240,0,0,0,0,0,0,15,120,0,0,0,0,0,0,30,60,0,0,0,0,0,0,60,30,0,0,0,0,0,0,120,30,0,0,0,0,0,0,120,60,0,0,0,0,0,0,60,120,0,0,0,0,0,0,30,240,0,0,0,0,0,0,15,224,3,0,0,0,0,128,7,192,7,0,0,0,0,224,3,128,15,0,0,0,0,240,0,0,63,0,0,0,0,252,0,128,127,0,0,0,0,254,1,192,249,1,0,0,128,159,3,224,225,7,0,0,224,7,7,224,128,31,0,0,248,1,7,112,0,255,0,0,255,0,14,48,0,254,7,240,63,0,12,0,0,238,255,255,63,0,0,0,0,6,255,255,56,0,0,0,0,6,224,15,48,0,0,0,0,7,128,1,112,0,0,0,0,3,128,1,112,0,0,0,0,3,128,1,112,0,0,0,128,3,128,1,96,0,0,0,0,1,128,1,96,0,0,0,0,0,128,1,0,0,0,0,0,0,128,1,0,0,0,0,0,0,128,1,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,7,0,0,0,0,0,128,255,255,0,0,0,0,0,240,255,255,15,0,0,0,0,252,15,240,63,0,0,0,0,255,0,0,255,0,0,0,128,31,0,0,248,1,0,0,224,7,0,0,224,7,0,0,248,1,0,0,128,31,0,0,124,0,0,0,0,62,0,0,30,0,0,0,0,124,0,0,15,0,0,0,0,240,1,192,7,0,0,0,0,224,3,224,1,0,0,0,0,192,7,240,0,0,0,0,0,0,15,120,0,0,0,0,0,0,30,60,0,0,0,0,0,0,60,30,0,0,0,0,0,0,120,30,0,0,0,0,0,0,120,60,0,0,0,0,0,0,60,120,0,0,0,0,0,0,30,240,0,0,0,0,0,0,15,224,3,0,0,0,0,128,7,192,7,0,0,0,0,224,3,128,15,0,0,0,0,240,0,0,63,0,0,0,0,252,0,128,127,0,0,0,0,254,1,192,249,1,0,0,128,159,3,224,225,7,0,0,224,7,7,224,128,31,0,0,248,1,7,112,0,255,0,0,255,0,14,48,0,254,7,240,63,0,12,0,0,238,255,255,63,0,0,0,0,6,255,255,56,0,0,0,0,6,224,15,48,0,0,0,0,7,128,1,112,0,0,0,0,3,128,1,112,0,0,0,0,3,128,1,112,0,0,0,128,3,128,1,96,0,0,0,0,1,128,1,96,0,0,0,0,0,128,1,0,0,0,0,0,0,128,1,0,0,0,0,0,0,128,1,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,7,0,0,0,0,0,128,255,255,0,0,0,0,0,240,255,255,15,0,0,0,0,252,15,240,63,0,0,0,0,255,0,0,255,0,0,0,128,31,0,0,248,1,0,0,224,7,0,0,224,7,0,0,248,1,0,0,128,31,0,0,124,0,0,0,0,62,0,0,30,0,0,0,0,124,0,0,15,0,0,0,0,240,1,192,7,0,0,0,0,224,3,224,1,0,0,0,0,192,7,240,0,0,0,0,0,0,15,120,0,0,0,0,0,0,30,60,0,0,0,0,0,0,60,30,0,0,0,0,0,0,120,30,0,0,0,0,0,0,120,60,0,0,0,0,0,0,60,120,0,0,0,0,0,0,30,240,0,0,0,0,0,0,15,224,3,0,0,0,0,128,7,192,7,0,0,0,0,224,3,128,15,0,0,0,0,240,0,0,63,0,0,0,0,252,0,128,127,0,0,0,0,254,1,192,249,1,0,0,128,159,3,224,225,7,0,0,224,7,7,224,128,31,0,0,248,1,7,112,0,255,0,0,255,0,14,48,0,254,7,240,63,0,12,0,0,238,255,255,63,0,0,0,0,6,255,255,56,0,0,0,0,6,224,15,48,0,0,0,0,7,128,1,112,0,0,0,0,3,128,1,112,0,0,0,0,3,128,1,112,0,0,0,128,3,128,1,96,0,0,0,0,1,128,1,96,0,0,0,0,0,128,1,0,0,0,0,0,0,128,1,0,0,0,0,0,0,128,1,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,7,0,0,0,0,0,128,255,255,0,0,0,0,0,240,255,255,15,0,0,0,0,252,15,240,63,0,0,0,0,255,0,0,255,0,0,0,128,31,0,0,248,1,0,0,224,7,0,0,224,7,0,0,248,1,0,0,128,31,0,0,124,0,0,0,0,62,0,0,30,0,0,0,0,124,0,0,15,0,0,0,0,240,1,192,7,0,0,0,0,224,3,224,1,0,0,0,0,192,7,240,0,0,0,0,0,0,15,120,0,0,0,0,0,0,30,60,0,0,0,0,0,0,60,30,0,0,0,0,0,0,120,30,0,0,0,0,0,0,120,60,0,0,0,0,0,0,60,120,0,0,0,0,0,0,30,240,0,0,0,0,0,0,15,224,3,0,0,0,0,128,7,192,7,0,0,0,0,224,3,128,15,0,0,0,0,240,0,0,63,0,0,0,0,252,0,128,127,0,0,0,0,254,1,192,249,1,0,0,128,159,3,224,225,7,0,0,224,7,7,224,128,31,0,0,248,1,7,112,0,255,0,0,255,0,14,48,0,254,7,240,63,0,12,0,0,238,255,255,63,0,0,0,0,6,255,255,56,0,0,0,0,6,224,15,48,0,0,0,0,7,128,1,112,0,0,0,0,3,128,1,112,0,0,0,0,3,128,1,112,0,0,0,128,3,128,1,96,0,0,0,0,1,128,1,96,0,0,0,0,0,128,1,0,0,0,0,0,0,128,1,0,0,0,0,0,0,128,1,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,7,0,0,0,0,0,128,255,255,0,0,0,0,0,240,255,255,15,0,0,0,0,252,15,240,63,0,0,0,0,255,0,0,255,0,0,0,128,31,0,0,248,1,0,0,224,7,0,0,224,7,0,0,248,1,0,0,128,31,0,0,124,0,0,0,0,62,0,0,30,0,0,0,0,124,0,0,15,0,0,0,0,240,1,192,7,0,0,0,0,224,3,224,1,0,0,0,0,192,7,240,0,0,0,0,0,0,15,120,0,0,0,0,0,0,30,60,0,0,0,0,0,0,60,30,0,0,0,0,0,0,120,30,0,0,0,0,0,0,120,60,0,0,0,0,0,0,60,120,0,0,0,0,0,0,30,240,0,0,0,0,0,0,15,224,3,0,0,0,0,128,7,192,7,0,0,0,0,224,3,128,15,0,0,0,0,240,0,0,63,0,0,0,0,252,0,128,127,0,0,0,0,254,1,192,249,1,0,0,128,159,3,224,225,7,0,0,224,7,7,224,128,31,0,0,248,1,7,112,0,255,0,0,255,0,14,48,0,254,7,240,63,0,12,0,0,238,255,255,63,0,0,0,0,6,255,255,56,0,0,0,0,6,224,15,48,0,0,0,0,7,128,1,112,0,0,0,0,3,128,1,112,0,0,0,0,3,128,1,112,0,0,0,128,3,128,1,96,0,0,0,0,1,128,1,96,0,0,0,0,0,128,1,0,0,0,0,0,0,128,1,0,0,0,0,0,0,128,1,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,7,0,0,0,0,0,128,255,255,0,0,0,0,0,240,255,255,15,0,0,0,0,252,15,240,63,0,0,0,0,255,0,0,255,0,0,0,128,31,0,0,248,1,0,0,224,7,0,0,224,7,0,0,248,1,0,0,128,31,0,0,124,0,0,0,0,62,0,0,30,0,0,0,0,124,0,0,15,0,0,0,0,240,1,192,7,0,0,0,0,224,3,224,1,0,0,0,0,192,7,240,0,0,0,0,0,0,15,120,0,0,0,0,0,0,30,60,0,0,0,0,0,0,60,30,0,0,0,0,0,0,120,30,0,0,0,0,0,0,120,60,0,0,0,0,0,0,60,120,0,0,0,0,0,0,30,240,0,0,0,0,0,0,15,224,3,0,0,0,0,128,7,192,7,0,0,0,0,224,3,128,15,0,0,0,0,240,0,0,63,0,0,0,0,252,0,128,127,0,0,0,0,254,1,192,249,1,0,0,128,159,3,224,225,7,0,0,224,7,7,224,128,31,0,0,248,1,7,112,0,255,0,0,255,0,14,48,0,254,7,240,63,0,12,0,0,238,255,255,63,0,0,0,0,6,255,255,56,0,0,0,0,6,224,15,48,0,0,0,0,7,128,1,112,0,0,0,0,3,128,1,112,0,0,0,0,3,128,1,112,0,0,0,128,3,128,1,96,0,0,0,0,1,128,1,96,0,0,0,0,0,128,1,0,0,0,0,0,0,128,1,0,0,0,0,0,0,128,1,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,7,0,0,0,0,0,128,255,255,0,0,0,0,0,240,255,255,15,0,0,0,0,252,15,240,63,0,0,0,0,255,0,0,255,0,0,0,128,31,0,0,248,1,0,0,224,7,0,0,224,7,0,0,248,1,0,0,128,31,0,0,124,0,0,0,0,62,0,0,30,0,0,0,0,124,0,0,15,0,0,0,0,240,1,192,7,0,0,0,0,224,3,224,1,0,0,0,0,192,7,240,0,0,0,0,0,0,15,120,0,0,0,0,0,0,30,60,0,0,0,0,0,0,60,30,0,0,0,0,0,0,120,30,0,0,0,0,0,0,120,60,0,0,0,0,0,0,60,120,0,0,0,0,0,0,30,240,0,0,0,0,0,0,15,224,3,0,0,0,0,128,7,192,7,0,0,0,0,224,3,128,15,0,0,0,0,240,0,0,63,0,0,0,0,252,0,128,127,0,0,0,0,254,1,192,249,1,0,0,128,159,3,192,225,7,0,0,224,7,3,0,128,31,0,0,248,1,0,0,0,255,0,0,255,0,0,0,0,254,7,240,63,0,0,0,0,238,255,255,63,0,0,0,0,6,255,255,56,0,0,0,0,6,224,15,48,0,0,0,0,6,128,1,48,0,0,0,0,0,128,1,0,0,0,0,0,0,128,1,0,0,0,0,0,0,128,1,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,7,0,0,0,0,0,128,255,255,0,0,0,0,0,240,255,255,15,0,0,0,0,252,15,240,63,0,0,0,0,255,0,0,255,0,0,0,128,31,0,0,248,1,0,0,224,7,0,0,224,7,0,0,248,1,0,0,128,31,0,0,124,0,0,0,0,62,0,0,30,0,0,0,0,124,0,0,15,0,0,0,0,240,1,192,7,0,0,0,0,224,3,224,1,0,0,0,0,192,7,240,0,0,0,0,0,0,15,120,0,0,0,0,0,0,30,60,0,0,0,0,0,0,60,30,0,0,0,0,0,0,120,30,0,0,0,0,0,0,120,60,0,0,0,0,0,0,60,120,0,0,0,0,0,0,30,240,0,0,0,0,0,0,15,224,3,0,0,0,0,128,7,192,7,0,0,0,0,224,3,128,15,0,0,0,0,240,0,0,63,0,0,0,0,252,0,0,127,0,0,0,0,254,0,0,248,1,0,0,128,31,0,0,224,7,0,0,224,7,0,0,128,31,0,0,248,1,0,0,0,255,0,0,255,0,0,0,0,254,7,240,63,0,0,0,0,238,255,255,31,0,0,0,0,0,255,255,16,0,0,0,0,0,224,15,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,15,0,0,0,0,0,0,255,255,0,0,0,0,0,224,255,255,15,0,0,0,0,252,15,240,63,0,0,0,0,255,0,0,255,0,0,0,128,31,0,0,248,3,0,0,224,7,0,0,224,7,0,0,248,1,0,0,128,31,0,0,124,0,0,0,0,62,0,0,62,0,0,0,0,124,0,128,15,0,0,0,0,240,1,192,7,0,0,0,0,224,3,224,1,0,0,0,0,192,7,240,0,0,0,0,0,0,15,120,0,0,0,0,0,0,30,60,0,0,0,0,0,0,60,30,0,0,0,0,0,0,120,62,0,0,0,0,0,0,120,124,0,0,0,0,0,0,62,248,0,0,0,0,0,0,31,240,3,0,0,0,0,192,15,224,15,0,0,0,0,240,7,192,63,0,0,0,0,252,1,0,255,0,0,0,0,255,0,0,254,7,0,0,224,127,0,0,252,63,0,0,252,63,0,0,240,255,7,192,191,15,0,0,224,243,255,255,199,7,0,0,128,15,255,127,240,1,0,0,0,126,0,0,126,0,0,0,0,248,3,224,31,0,0,0,0,224,255,255,7,0,0,0,0,0,254,255,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,15,0,0,0,0,0,0,255,255,0,0,0,0,0,224,255,255,15,0,0,0,0,252,15,240,63,0,0,0,0,255,0,0,255,0,0,0,128,31,0,0,248,3,0,0,224,7,0,0,224,7,0,0,248,1,0,0,128,31,0,0,124,0,0,0,0,62,0,0,62,0,0,0,0,124,0,128,15,0,0,0,0,240,1,192,7,0,0,0,0,224,3,224,1,0,0,0,0,192,7,240,0,0,0,0,0,0,15,120,0,0,0,0,0,0,30,60,0,0,0,0,0,0,60,30,0,0,0,0,0,0,124,254,1,0,0,0,0,0,127,252,63,0,0,0,0,248,63,248,255,31,0,0,240,255,31,240,248,255,255,255,255,31,15,224,1,255,255,255,127,128,7,192,3,240,224,7,15,192,1,0,15,224,0,0,7,240,0,0,30,192,3,192,3,120,0,0,124,128,15,248,1,62,0,0,240,0,255,127,0,15,0,0,224,3,248,63,192,7,0,0,128,15,0,0,240,1,0,0,0,126,0,0,126,0,0,0,0,248,3,224,31,0,0,0,0,224,255,255,7,0,0,0,0,0,254,255,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,15,0,0,0,0,0,0,255,255,0,0,0,0,0,224,255,255,15,0,0,0,0,252,15,240,63,0,0,0,0,255,0,0,255,0,0,0,128,31,0,0,248,3,0,0,224,7,0,0,224,7,0,0,248,1,0,0,128,31,0,0,124,0,0,0,0,62,0,0,62,0,0,0,0,124,0,128,15,0,0,0,0,240,1,192,7,0,0,0,0,224,3,224,1,0,0,0,0,192,7,240,0,0,224,15,0,0,15,120,224,255,255,255,255,15,30,252,255,255,255,255,255,255,63,254,255,14,248,31,112,255,127,254,0,14,248,31,112,0,127,60,0,12,224,7,48,0,60,120,0,28,0,0,56,0,30,240,0,24,0,0,24,0,15,224,1,56,0,0,28,128,7,192,3,112,0,0,14,192,1,0,15,224,0,0,7,240,0,0,30,192,3,192,3,120,0,0,124,128,15,248,1,62,0,0,240,0,255,127,0,15,0,0,224,3,248,63,192,7,0,0,128,15,0,0,240,1,0,0,0,126,0,0,126,0,0,0,0,248,3,224,31,0,0,0,0,224,255,255,7,0,0,0,0,0,254,255,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,15,0,0,0,0,0,0,255,255,0,0,0,0,0,224,255,255,15,0,0,0,0,252,15,240,63,0,0,0,0,255,0,0,255,0,0,0,128,31,0,0,248,3,0,0,224,7,0,0,224,7,0,0,248,1,240,31,128,31,0,0,124,224,255,255,7,62,0,0,62,254,255,255,127,124,0,128,207,127,252,63,255,243,1,192,255,15,252,63,240,255,3,224,127,6,252,63,96,254,7,240,15,6,252,63,96,248,15,248,3,6,252,63,96,192,31,252,0,6,252,63,96,0,63,62,0,14,248,31,96,0,124,30,0,14,248,31,112,0,120,60,0,12,224,7,48,0,60,120,0,28,0,0,56,0,30,240,0,24,0,0,24,0,15,224,1,56,0,0,28,128,7,192,3,112,0,0,14,192,1,0,15,224,0,0,7,240,0,0,30,192,3,192,3,120,0,0,124,128,15,248,1,62,0,0,240,0,255,127,0,15,0,0,224,3,248,63,192,7,0,0,128,15,0,0,240,1,0,0,0,126,0,0,126,0,0,0,0,248,3,224,31,0,0,0,0,224,255,255,7,0,0,0,0,0,254,255,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,15,0,0,0,0,0,0,255,255,0,0,0,0,0,224,255,255,15,0,0,0,0,252,255,255,63,0,0,0,0,255,255,255,255,0,0,0,128,255,3,224,255,3,0,0,224,63,0,0,254,7,0,0,248,31,224,7,248,31,0,0,252,15,240,15,240,63,0,0,126,14,248,31,112,126,0,128,31,14,252,63,112,248,1,192,15,6,252,63,112,240,3,224,3,6,252,63,96,192,7,240,1,6,252,63,96,128,15,120,0,6,252,63,96,0,30,60,0,6,252,63,96,0,60,30,0,14,248,31,96,0,120,30,0,14,248,31,112,0,120,60,0,12,224,7,48,0,60,120,0,28,0,0,56,0,30,240,0,24,0,0,24,0,15,224,1,56,0,0,28,128,7,192,3,112,0,0,14,192,1,0,15,224,0,0,7,240,0,0,30,192,3,192,3,120,0,0,124,128,15,248,1,62,0,0,240,0,255,127,0,15,0,0,224,3,248,63,192,7,0,0,128,15,0,0,240,1,0,0,0,126,0,0,126,0,0,0,0,248,3,224,31,0,0,0,0,224,255,255,7,0,0,0,0,0,254,255,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,15,0,0,0,0,0,0,255,255,0,0,0,0,0,224,255,255,15,0,0,0,0,252,31,248,63,0,0,0,0,255,0,0,255,0,0,0,128,63,0,0,252,3,0,0,224,31,0,0,248,7,0,0,248,29,224,7,184,31,0,0,124,12,240,15,112,62,0,0,62,14,248,31,112,124,0,128,15,14,252,63,112,240,1,192,7,6,252,63,112,224,3,224,1,6,252,63,96,192,7,240,0,6,252,63,96,0,15,120,0,6,252,63,96,0,30,60,0,6,252,63,96,0,60,30,0,14,248,31,96,0,120,30,0,14,248,31,112,0,120,60,0,12,224,7,48,0,60,120,0,28,0,0,56,0,30,240,0,24,0,0,24,0,15,224,1,56,0,0,28,128,7,192,3,112,0,0,14,192,1,0,15,224,0,0,7,240,0,0,30,192,3,192,3,120,0,0,124,128,15,248,1,62,0,0,240,0,255,127,0,15,0,0,224,3,248,63,192,7,0,0,128,15,0,0,240,1,0,0,0,126,0,0,126,0,0,0,0,248,3,224,31,0,0,0,0,224,255,255,7,0,0,0,0,0,254,255,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,15,0,0,0,0,0,0,255,255,0,0,0,0,0,224,255,255,15,0,0,0,0,252,31,248,63,0,0,0,0,255,0,0,255,0,0,0,128,63,0,0,252,3,0,0,224,31,0,0,248,7,0,0,248,29,224,7,184,31,0,0,124,12,240,15,112,62,0,0,62,14,248,31,112,124,0,128,15,14,252,63,112,240,1,192,7,6,252,63,112,224,3,224,1,6,252,63,96,192,7,240,0,6,252,63,96,0,15,120,0,6,252,63,96,0,30,60,0,6,252,63,96,0,60,30,0,14,248,31,96,0,120,30,0,14,248,31,112,0,120,60,0,12,224,7,48,0,60,120,0,28,0,0,56,0,30,240,0,24,0,0,24,0,15,224,1,56,0,0,28,128,7,192,3,112,0,0,14,192,1,0,15,224,0,0,7,240,0,0,30,192,3,192,3,120,0,0,124,128,15,248,1,62,0,0,240,0,255,127,0,15,0,0,224,3,248,63,192,7,0,0,128,15,0,0,240,1,0,0,0,126,0,0,126,0,0,0,0,248,3,224,31,0,0,0,0,224,255,255,7,0,0,0,0,0,254,255,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    };
-
-static const unsigned char ring_alarm[][BITMAP_LENGTH] = {
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,15,0,0,240,31,0,0,254,31,0,0,248,127,0,128,15,14,0,0,112,240,0,192,3,7,0,0,224,192,3,224,129,3,0,0,192,129,7,224,192,1,252,63,128,3,7,112,224,192,255,255,3,7,14,56,112,240,31,248,15,14,12,56,56,252,1,128,63,28,28,24,28,62,0,0,124,56,24,24,142,15,0,0,240,113,24,24,199,3,0,0,192,227,24,152,227,1,0,0,128,199,25,216,241,0,0,0,0,143,27,248,120,0,0,0,0,30,31,120,56,0,0,0,0,28,30,56,28,0,0,0,0,56,28,16,14,0,0,0,0,112,8,0,14,28,0,0,0,112,0,0,7,60,0,0,0,224,0,0,3,120,0,0,0,192,0,128,3,240,0,0,0,192,1,128,1,224,1,0,0,128,1,192,1,192,3,0,0,128,3,192,1,128,7,0,0,128,3,192,1,0,15,0,0,128,3,192,0,0,30,0,0,0,3,192,0,0,60,0,0,0,3,224,0,0,120,0,0,0,7,224,0,0,240,0,0,0,7,224,0,224,255,1,0,0,7,224,0,240,255,3,0,0,7,224,0,224,255,1,0,0,7,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,6,0,0,0,0,96,0,0,14,0,0,0,0,112,0,0,28,0,0,0,0,56,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,240,1,0,0,128,15,0,0,240,3,0,0,192,15,0,0,184,15,0,0,240,29,0,0,28,62,0,0,124,56,0,0,14,252,0,0,63,112,0,0,7,240,15,240,15,224,0,128,3,192,255,255,3,192,1,192,1,0,254,127,0,128,3,128,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,15,0,0,240,31,0,0,254,31,0,0,248,127,0,128,15,14,0,0,112,240,0,192,3,7,0,0,224,192,3,224,129,3,0,0,192,129,7,224,192,1,252,63,128,3,7,112,224,192,255,255,3,7,14,56,112,240,31,248,15,14,12,56,56,252,1,128,63,28,28,24,28,62,0,0,124,56,24,24,142,15,0,0,240,113,24,24,199,3,0,0,192,227,24,152,227,1,0,0,128,199,25,216,241,0,0,0,0,143,27,248,120,0,0,0,0,30,31,120,56,0,0,0,0,28,30,56,28,16,0,0,0,56,28,16,14,56,0,0,0,112,8,0,14,112,0,0,0,112,0,0,7,240,0,0,0,224,0,0,3,224,1,0,0,192,0,128,3,192,1,0,0,192,1,128,1,128,3,0,0,128,1,192,1,0,7,0,0,128,3,192,1,0,14,0,0,128,3,192,1,0,30,0,0,128,3,192,0,0,28,0,0,0,3,192,0,0,56,0,0,0,3,224,0,0,112,0,0,0,7,224,0,0,224,0,0,0,7,224,0,224,255,1,0,0,7,224,0,240,255,3,0,0,7,224,0,224,255,1,0,0,7,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,6,0,0,0,0,96,0,0,14,0,0,0,0,112,0,0,28,0,0,0,0,56,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,240,1,0,0,128,15,0,0,240,3,0,0,192,15,0,0,184,15,0,0,240,29,0,0,28,62,0,0,124,56,0,0,14,252,0,0,63,112,0,0,7,240,15,240,15,224,0,128,3,192,255,255,3,192,1,192,1,0,254,127,0,128,3,128,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,15,0,0,240,31,0,0,254,31,0,0,248,127,0,128,15,14,0,0,112,240,0,192,3,7,0,0,224,192,3,224,129,3,0,0,192,129,7,224,192,1,252,63,128,3,7,112,224,192,255,255,3,7,14,56,112,240,31,248,15,14,12,56,56,252,1,128,63,28,28,24,28,62,0,0,124,56,24,24,142,15,0,0,240,113,24,24,199,3,0,0,192,227,24,152,227,1,0,0,128,199,25,216,241,0,0,0,0,143,27,248,120,0,0,0,0,30,31,120,56,96,0,0,0,28,30,56,28,224,0,0,0,56,28,16,14,224,0,0,0,112,8,0,14,192,1,0,0,112,0,0,7,192,3,0,0,224,0,0,3,128,3,0,0,192,0,128,3,0,7,0,0,192,1,128,1,0,15,0,0,128,1,192,1,0,14,0,0,128,3,192,1,0,28,0,0,128,3,192,1,0,60,0,0,128,3,192,0,0,56,0,0,0,3,192,0,0,112,0,0,0,3,224,0,0,240,0,0,0,7,224,0,0,224,0,0,0,7,224,0,224,255,1,0,0,7,224,0,240,255,3,0,0,7,224,0,224,255,1,0,0,7,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,6,0,0,0,0,96,0,0,14,0,0,0,0,112,0,0,28,0,0,0,0,56,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,240,1,0,0,128,15,0,0,240,3,0,0,192,15,0,0,184,15,0,0,240,29,0,0,28,62,0,0,124,56,0,0,14,252,0,0,63,112,0,0,7,240,15,240,15,224,0,128,3,192,255,255,3,192,1,192,1,0,254,127,0,128,3,128,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,15,0,0,240,31,0,0,254,31,0,0,248,127,0,128,15,14,0,0,112,240,0,192,3,7,0,0,224,192,3,224,129,3,0,0,192,129,7,224,192,1,252,63,128,3,7,112,224,192,255,255,3,7,14,56,112,240,31,248,15,14,12,56,56,252,1,128,63,28,28,24,28,62,0,0,124,56,24,24,142,15,0,0,240,113,24,24,199,3,0,0,192,227,24,152,227,1,0,0,128,199,25,216,241,0,0,0,0,143,27,248,120,128,0,0,0,30,31,120,56,192,1,0,0,28,30,56,28,128,3,0,0,56,28,16,14,128,3,0,0,112,8,0,14,0,7,0,0,112,0,0,7,0,7,0,0,224,0,0,3,0,14,0,0,192,0,128,3,0,14,0,0,192,1,128,1,0,28,0,0,128,1,192,1,0,28,0,0,128,3,192,1,0,56,0,0,128,3,192,1,0,56,0,0,128,3,192,0,0,112,0,0,0,3,192,0,0,112,0,0,0,3,224,0,0,224,0,0,0,7,224,0,0,224,0,0,0,7,224,0,224,255,1,0,0,7,224,0,240,255,3,0,0,7,224,0,224,255,1,0,0,7,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,6,0,0,0,0,96,0,0,14,0,0,0,0,112,0,0,28,0,0,0,0,56,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,240,1,0,0,128,15,0,0,240,3,0,0,192,15,0,0,184,15,0,0,240,29,0,0,28,62,0,0,124,56,0,0,14,252,0,0,63,112,0,0,7,240,15,240,15,224,0,128,3,192,255,255,3,192,1,192,1,0,254,127,0,128,3,128,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,15,0,0,240,31,0,0,254,31,0,0,248,127,0,128,15,14,0,0,112,240,0,192,3,7,0,0,224,192,3,224,129,3,0,0,192,129,7,224,192,1,252,63,128,3,7,112,224,192,255,255,3,7,14,56,112,240,31,248,15,14,12,56,56,252,1,128,63,28,28,24,28,62,0,0,124,56,24,24,142,15,0,0,240,113,24,24,199,3,0,0,192,227,24,152,227,1,0,0,128,199,25,216,241,0,0,0,0,143,27,248,120,0,7,0,0,30,31,120,56,0,7,0,0,28,30,56,28,0,6,0,0,56,28,16,14,0,14,0,0,112,8,0,14,0,14,0,0,112,0,0,7,0,28,0,0,224,0,0,3,0,28,0,0,192,0,128,3,0,24,0,0,192,1,128,1,0,56,0,0,128,1,192,1,0,56,0,0,128,3,192,1,0,112,0,0,128,3,192,1,0,112,0,0,128,3,192,0,0,96,0,0,0,3,192,0,0,224,0,0,0,3,224,0,0,224,0,0,0,7,224,0,0,192,1,0,0,7,224,0,224,255,1,0,0,7,224,0,240,255,3,0,0,7,224,0,224,255,1,0,0,7,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,6,0,0,0,0,96,0,0,14,0,0,0,0,112,0,0,28,0,0,0,0,56,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,240,1,0,0,128,15,0,0,240,3,0,0,192,15,0,0,184,15,0,0,240,29,0,0,28,62,0,0,124,56,0,0,14,252,0,0,63,112,0,0,7,240,15,240,15,224,0,128,3,192,255,255,3,192,1,192,1,0,254,127,0,128,3,128,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,15,0,0,240,31,0,0,254,31,0,0,248,127,0,128,15,14,0,0,112,240,0,192,3,7,0,0,224,192,3,224,129,3,0,0,192,129,7,224,192,1,252,63,128,3,7,112,224,192,255,255,3,7,14,56,112,240,31,248,15,14,12,56,56,252,1,128,63,28,28,24,28,62,0,0,124,56,24,24,142,15,0,0,240,113,24,24,199,3,0,0,192,227,24,152,227,1,0,0,128,199,25,216,241,0,12,0,0,143,27,248,120,0,12,0,0,30,31,120,56,0,28,0,0,28,30,56,28,0,28,0,0,56,28,16,14,0,24,0,0,112,8,0,14,0,56,0,0,112,0,0,7,0,56,0,0,224,0,0,3,0,56,0,0,192,0,128,3,0,48,0,0,192,1,128,1,0,112,0,0,128,1,192,1,0,112,0,0,128,3,192,1,0,96,0,0,128,3,192,1,0,224,0,0,128,3,192,0,0,224,0,0,0,3,192,0,0,224,0,0,0,3,224,0,0,192,0,0,0,7,224,0,0,192,1,0,0,7,224,0,224,255,1,0,0,7,224,0,240,255,3,0,0,7,224,0,224,255,1,0,0,7,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,6,0,0,0,0,96,0,0,14,0,0,0,0,112,0,0,28,0,0,0,0,56,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,240,1,0,0,128,15,0,0,240,3,0,0,192,15,0,0,184,15,0,0,240,29,0,0,28,62,0,0,124,56,0,0,14,252,0,0,63,112,0,0,7,240,15,240,15,224,0,128,3,192,255,255,3,192,1,192,1,0,254,127,0,128,3,128,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,7,0,0,0,0,0,0,254,31,0,0,0,0,0,0,31,126,0,0,254,3,0,0,28,240,0,128,255,3,0,0,56,192,1,192,195,3,0,0,240,192,3,224,192,1,224,7,224,129,3,112,224,0,255,255,192,3,7,56,112,224,255,255,7,7,7,24,56,248,3,192,31,14,6,28,28,124,0,0,62,60,6,12,30,31,0,0,248,120,14,14,142,7,0,0,224,241,14,14,199,3,0,0,192,195,15,134,227,0,16,0,0,135,7,198,113,0,56,0,0,14,7,230,56,0,56,0,0,28,6,254,28,0,48,0,0,56,0,126,30,0,48,0,0,120,0,60,14,0,112,0,0,112,0,28,7,0,112,0,0,224,0,12,7,0,112,0,0,224,0,128,3,0,96,0,0,192,1,128,3,0,96,0,0,192,1,128,1,0,224,0,0,128,1,192,1,0,224,0,0,128,3,192,1,0,224,0,0,128,3,192,0,0,192,0,0,0,3,192,0,0,192,0,0,0,3,224,0,0,192,1,0,0,7,224,0,0,192,1,0,0,7,224,0,0,192,1,0,0,7,224,0,224,255,1,0,0,7,224,0,224,255,1,0,0,7,224,0,0,128,1,0,0,7,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,7,0,0,0,0,224,0,0,14,0,0,0,0,112,0,0,30,0,0,0,0,120,0,0,28,0,0,0,0,56,0,0,56,0,0,0,0,28,0,0,112,0,0,0,0,14,0,0,240,0,0,0,0,15,0,0,240,1,0,0,128,15,0,0,248,7,0,0,224,31,0,0,60,31,0,0,248,60,0,0,30,126,0,0,126,120,0,0,15,248,3,192,31,240,0,128,7,224,255,255,7,224,1,192,3,0,255,255,0,192,3,128,1,0,248,31,0,128,1,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,3,0,0,0,0,0,0,255,15,0,0,0,0,0,192,7,31,0,0,0,0,0,0,7,120,0,0,0,0,0,0,30,240,0,0,255,1,0,0,60,224,1,192,255,1,0,0,112,192,1,224,225,0,240,15,224,129,3,112,112,0,255,255,192,131,3,56,56,224,255,255,7,7,3,28,56,248,3,192,31,30,3,12,28,126,0,0,126,60,7,14,14,31,0,0,248,112,7,6,135,7,0,0,224,225,3,7,199,3,0,0,192,195,3,135,227,0,96,0,0,7,3,195,113,0,96,0,0,14,2,231,56,0,96,0,0,28,0,231,28,0,96,0,0,56,0,119,30,0,224,0,0,120,0,62,14,0,224,0,0,112,0,30,7,0,224,0,0,224,0,30,7,0,224,0,0,224,0,140,3,0,224,0,0,192,1,132,3,0,192,0,0,192,1,128,1,0,192,0,0,128,1,192,1,0,192,0,0,128,3,192,1,0,192,0,0,128,3,192,0,0,192,1,0,0,3,192,0,0,192,1,0,0,3,224,0,0,192,1,0,0,7,224,0,0,192,1,0,0,7,224,0,0,192,1,0,0,7,224,0,224,255,1,0,0,7,224,0,224,255,1,0,0,7,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,7,0,0,0,0,224,0,0,14,0,0,0,0,112,0,0,30,0,0,0,0,120,0,0,28,0,0,0,0,56,0,0,56,0,0,0,0,28,0,0,112,0,0,0,0,14,0,0,240,0,0,0,0,15,0,0,240,3,0,0,192,15,0,0,248,7,0,0,224,31,0,0,60,31,0,0,248,60,0,0,30,126,0,0,126,120,0,0,15,248,3,192,31,240,0,128,7,224,255,255,7,224,1,192,3,0,255,255,0,192,3,128,1,0,224,7,0,128,1},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,15,0,0,240,31,0,0,254,31,0,0,248,127,0,0,15,14,0,0,112,240,0,192,3,7,0,0,224,192,3,224,129,3,0,0,192,129,7,224,192,1,252,63,128,3,7,112,224,128,255,255,1,7,14,48,112,240,63,252,15,14,12,56,56,252,1,128,63,28,28,24,28,62,0,0,124,56,24,24,14,15,0,0,240,112,24,24,199,3,0,0,192,227,24,152,227,1,64,0,128,199,25,216,241,0,192,0,0,143,27,248,120,0,192,0,0,30,31,120,56,0,192,0,0,28,30,56,28,0,192,0,0,56,28,16,14,0,192,0,0,112,8,0,14,0,192,0,0,112,0,0,7,0,192,1,0,224,0,0,3,0,192,1,0,192,0,128,3,0,192,1,0,192,1,128,1,0,192,1,0,128,1,192,1,0,192,1,0,128,3,192,1,0,192,1,0,128,3,192,1,0,192,1,0,128,3,192,0,0,192,1,0,0,3,192,0,0,192,1,0,0,3,224,0,0,128,1,0,0,7,224,0,0,128,1,0,0,7,224,0,224,255,1,0,0,7,224,0,240,255,1,0,0,7,224,0,224,255,1,0,0,7,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,6,0,0,0,0,96,0,0,14,0,0,0,0,112,0,0,28,0,0,0,0,56,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,240,1,0,0,128,15,0,0,240,3,0,0,192,15,0,0,184,15,0,0,240,29,0,0,28,63,0,0,252,56,0,0,14,252,0,0,63,112,0,0,7,240,15,240,15,224,0,128,3,192,255,255,3,192,1,192,1,0,254,127,0,128,3,128,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0},
-    {0,0,31,0,0,0,0,0,0,224,255,0,0,0,0,0,0,248,255,3,0,0,0,0,0,60,224,1,0,0,0,0,0,14,240,0,0,0,0,0,0,7,60,0,0,128,255,0,128,3,30,0,0,128,255,1,128,1,15,128,1,0,231,7,192,193,3,254,127,0,14,15,192,224,225,255,255,7,14,28,192,240,240,7,224,15,28,56,224,60,252,0,0,63,56,56,224,30,31,0,0,248,112,112,192,143,7,0,0,224,113,96,192,195,3,0,0,192,227,224,192,225,1,128,1,128,199,225,192,112,0,192,1,0,142,195,0,56,0,192,1,0,156,227,0,60,0,192,1,0,60,231,0,28,0,192,1,0,56,238,0,14,0,192,1,0,112,252,0,7,0,128,1,0,224,124,0,7,0,128,1,0,224,120,128,3,0,128,1,0,192,49,128,3,0,128,1,0,192,33,128,1,0,128,1,0,128,1,192,1,0,128,1,0,128,3,192,1,0,128,1,0,128,3,192,0,0,128,1,0,0,3,192,0,0,128,1,0,0,3,224,0,0,128,1,0,0,7,224,0,0,128,1,0,0,7,224,0,0,128,1,0,0,7,224,0,224,255,1,0,0,7,224,0,240,255,1,0,0,7,224,0,224,255,1,0,0,7,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,7,0,0,0,0,224,0,0,14,0,0,0,0,112,0,0,14,0,0,0,0,112,0,0,28,0,0,0,0,56,0,0,56,0,0,0,0,28,0,0,112,0,0,0,0,14,0,0,240,0,0,0,0,15,0,0,240,1,0,0,128,15,0,0,248,7,0,0,224,31,0,0,60,15,0,0,240,60,0,0,30,62,0,0,124,120,0,0,15,248,1,128,31,240,0,128,7,224,127,254,7,224,1,192,3,128,255,255,1,192,3,128,1,0,252,63,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,15,0,0,240,31,0,0,254,31,0,0,248,127,0,0,15,14,0,0,112,240,0,192,3,7,0,0,224,192,3,224,129,3,0,0,192,129,7,224,192,1,252,63,128,3,7,112,224,128,255,255,1,7,14,48,112,240,63,252,15,14,12,56,56,252,1,128,63,28,28,24,28,62,0,0,124,56,24,24,14,15,0,0,240,112,24,24,199,3,0,0,192,227,24,152,227,1,128,1,128,199,25,216,241,0,128,1,0,143,27,248,120,0,128,1,0,30,31,120,56,0,128,1,0,28,30,56,28,0,128,1,0,56,28,16,14,0,128,1,0,112,8,0,14,0,128,1,0,112,0,0,7,0,128,1,0,224,0,0,3,0,128,1,0,192,0,128,3,0,128,1,0,192,1,128,1,0,128,1,0,128,1,192,1,0,128,1,0,128,3,192,1,0,128,1,0,128,3,192,1,0,128,1,0,128,3,192,0,0,128,1,0,0,3,192,0,0,128,1,0,0,3,224,0,0,128,1,0,0,7,224,0,0,128,1,0,0,7,224,0,224,255,1,0,0,7,224,0,240,255,1,0,0,7,224,0,224,255,1,0,0,7,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,6,0,0,0,0,96,0,0,14,0,0,0,0,112,0,0,28,0,0,0,0,56,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,240,1,0,0,128,15,0,0,240,3,0,0,192,15,0,0,184,15,0,0,240,29,0,0,28,63,0,0,252,56,0,0,14,252,0,0,63,112,0,0,7,240,15,240,15,224,0,128,3,192,255,255,3,192,1,192,1,0,254,127,0,128,3,128,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,3,0,0,0,0,0,0,255,15,0,0,0,0,0,192,7,31,0,0,0,0,0,0,7,120,0,0,0,0,0,0,30,240,0,0,255,1,0,0,60,224,1,192,255,1,0,0,112,192,1,224,225,0,240,15,224,129,3,112,112,0,255,255,192,131,3,56,56,224,255,255,7,7,3,28,56,248,3,192,31,30,3,12,28,126,0,0,126,60,7,14,14,31,0,0,248,112,7,6,135,7,0,0,224,225,3,7,199,3,0,0,192,195,3,135,227,0,128,1,0,7,3,195,113,0,128,1,0,14,2,231,56,0,128,1,0,28,0,231,28,0,128,1,0,56,0,119,30,0,128,1,0,120,0,62,14,0,128,1,0,112,0,30,7,0,128,1,0,224,0,30,7,0,128,1,0,224,0,140,3,0,128,1,0,192,1,132,3,0,128,1,0,192,1,128,1,0,128,1,0,128,1,192,1,0,128,1,0,128,3,192,1,0,128,1,0,128,3,192,0,0,128,1,0,0,3,192,0,0,128,1,0,0,3,224,0,0,128,1,0,0,7,224,0,0,128,1,0,0,7,224,0,0,192,1,0,0,7,224,0,224,255,1,0,0,7,224,0,224,255,1,0,0,7,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,7,0,0,0,0,224,0,0,14,0,0,0,0,112,0,0,30,0,0,0,0,120,0,0,28,0,0,0,0,56,0,0,56,0,0,0,0,28,0,0,112,0,0,0,0,14,0,0,240,0,0,0,0,15,0,0,240,3,0,0,192,15,0,0,248,7,0,0,224,31,0,0,60,31,0,0,248,60,0,0,30,126,0,0,126,120,0,0,15,248,3,192,31,240,0,128,7,224,255,255,7,224,1,192,3,0,255,255,0,192,3,128,1,0,224,7,0,128,1},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,15,0,0,240,31,0,0,254,31,0,0,248,127,0,0,15,14,0,0,112,240,0,192,3,7,0,0,224,192,3,224,129,3,0,0,192,129,7,224,192,1,252,63,128,3,7,112,224,128,255,255,1,7,14,48,112,240,63,252,15,14,12,56,56,252,1,128,63,28,28,24,28,62,0,0,124,56,24,24,14,15,0,0,240,112,24,24,199,3,0,0,192,227,24,152,227,1,128,1,128,199,25,216,241,0,128,1,0,143,27,248,120,0,128,1,0,30,31,120,56,0,128,1,0,28,30,56,28,0,128,1,0,56,28,16,14,0,128,1,0,112,8,0,14,0,128,1,0,112,0,0,7,0,128,1,0,224,0,0,3,0,128,1,0,192,0,128,3,0,128,1,0,192,1,128,1,0,128,1,0,128,1,192,1,0,128,1,0,128,3,192,1,0,128,1,0,128,3,192,1,0,128,1,0,128,3,192,0,0,128,1,0,0,3,192,0,0,128,1,0,0,3,224,0,0,128,1,0,0,7,224,0,0,128,1,0,0,7,224,0,224,255,1,0,0,7,224,0,240,255,1,0,0,7,224,0,224,255,1,0,0,7,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,6,0,0,0,0,96,0,0,14,0,0,0,0,112,0,0,28,0,0,0,0,56,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,240,1,0,0,128,15,0,0,240,3,0,0,192,15,0,0,184,15,0,0,240,29,0,0,28,63,0,0,252,56,0,0,14,252,0,0,63,112,0,0,7,240,15,240,15,224,0,128,3,192,255,255,3,192,1,192,1,0,254,127,0,128,3,128,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0},
-    {0,0,31,0,0,0,0,0,0,224,255,0,0,0,0,0,0,248,255,3,0,0,0,0,0,60,224,1,0,0,0,0,0,14,240,0,0,0,0,0,0,7,60,0,0,128,255,0,128,3,30,0,0,128,255,1,128,1,15,128,1,0,231,7,192,193,3,254,127,0,14,15,192,224,225,255,255,7,14,28,192,240,240,7,224,15,28,56,224,60,252,0,0,63,56,56,224,30,31,0,0,248,112,112,192,143,7,0,0,224,113,96,192,195,3,0,0,192,227,224,192,225,1,128,1,128,199,225,192,112,0,128,1,0,142,195,0,56,0,128,1,0,156,227,0,60,0,128,1,0,60,231,0,28,0,128,1,0,56,238,0,14,0,128,1,0,112,252,0,7,0,128,1,0,224,124,0,7,0,128,1,0,224,120,128,3,0,128,1,0,192,49,128,3,0,128,1,0,192,33,128,1,0,128,1,0,128,1,192,1,0,128,1,0,128,3,192,1,0,128,1,0,128,3,192,0,0,128,1,0,0,3,192,0,0,128,1,0,0,3,224,0,0,128,1,0,0,7,224,0,0,128,1,0,0,7,224,0,0,128,1,0,0,7,224,0,224,255,1,0,0,7,224,0,240,255,1,0,0,7,224,0,224,255,1,0,0,7,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,7,0,0,0,0,224,0,0,14,0,0,0,0,112,0,0,14,0,0,0,0,112,0,0,28,0,0,0,0,56,0,0,56,0,0,0,0,28,0,0,112,0,0,0,0,14,0,0,240,0,0,0,0,15,0,0,240,1,0,0,128,15,0,0,248,7,0,0,224,31,0,0,60,15,0,0,240,60,0,0,30,62,0,0,124,120,0,0,15,248,1,128,31,240,0,128,7,224,127,254,7,224,1,192,3,128,255,255,1,192,3,128,1,0,252,63,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,15,0,0,240,31,0,0,254,31,0,0,248,127,0,0,15,14,0,0,112,240,0,192,3,7,0,0,224,192,3,224,129,3,0,0,192,129,7,224,192,1,252,63,128,3,7,112,224,128,255,255,1,7,14,48,112,240,63,252,15,14,12,56,56,252,1,128,63,28,28,24,28,62,0,0,124,56,24,24,14,15,0,0,240,112,24,24,199,3,0,0,192,227,24,152,227,1,128,1,128,199,25,216,241,0,128,1,0,143,27,248,120,0,128,1,0,30,31,120,56,0,128,1,0,28,30,56,28,0,128,1,0,56,28,16,14,0,128,1,0,112,8,0,14,0,128,1,0,112,0,0,7,0,128,1,0,224,0,0,3,0,128,1,0,192,0,128,3,0,128,1,0,192,1,128,1,0,128,1,0,128,1,192,1,0,128,1,0,128,3,192,1,0,128,1,0,128,3,192,1,0,128,1,0,128,3,192,0,0,128,1,0,0,3,192,0,0,128,1,0,0,3,224,0,0,128,1,0,0,7,224,0,0,128,1,0,0,7,224,0,224,255,1,0,0,7,224,0,240,255,1,0,0,7,224,0,224,255,1,0,0,7,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,6,0,0,0,0,96,0,0,14,0,0,0,0,112,0,0,28,0,0,0,0,56,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,240,1,0,0,128,15,0,0,240,3,0,0,192,15,0,0,184,15,0,0,240,29,0,0,28,63,0,0,252,56,0,0,14,252,0,0,63,112,0,0,7,240,15,240,15,224,0,128,3,192,255,255,3,192,1,192,1,0,254,127,0,128,3,128,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,3,0,0,0,0,0,0,255,15,0,0,0,0,0,192,7,31,0,0,0,0,0,0,7,120,0,0,0,0,0,0,30,240,0,0,255,1,0,0,60,224,1,192,255,1,0,0,112,192,1,224,225,0,240,15,224,129,3,112,112,0,255,255,192,131,3,56,56,224,255,255,7,7,3,28,56,248,3,192,31,30,3,12,28,126,0,0,126,60,7,14,14,31,0,0,248,112,7,6,135,7,0,0,224,225,3,7,199,3,0,0,192,195,3,135,227,0,128,1,0,7,3,195,113,0,128,1,0,14,2,231,56,0,128,1,0,28,0,231,28,0,128,1,0,56,0,119,30,0,128,1,0,120,0,62,14,0,128,1,0,112,0,30,7,0,128,1,0,224,0,30,7,0,128,1,0,224,0,140,3,0,128,1,0,192,1,132,3,0,128,1,0,192,1,128,1,0,128,1,0,128,1,192,1,0,128,1,0,128,3,192,1,0,128,1,0,128,3,192,0,0,128,1,0,0,3,192,0,0,128,1,0,0,3,224,0,0,128,1,0,0,7,224,0,0,128,1,0,0,7,224,0,0,192,1,0,0,7,224,0,224,255,1,0,0,7,224,0,224,255,1,0,0,7,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,7,0,0,0,0,224,0,0,14,0,0,0,0,112,0,0,30,0,0,0,0,120,0,0,28,0,0,0,0,56,0,0,56,0,0,0,0,28,0,0,112,0,0,0,0,14,0,0,240,0,0,0,0,15,0,0,240,3,0,0,192,15,0,0,248,7,0,0,224,31,0,0,60,31,0,0,248,60,0,0,30,126,0,0,126,120,0,0,15,248,3,192,31,240,0,128,7,224,255,255,7,224,1,192,3,0,255,255,0,192,3,128,1,0,224,7,0,128,1},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,15,0,0,240,31,0,0,254,31,0,0,248,127,0,0,15,14,0,0,112,240,0,192,3,7,0,0,224,192,3,224,129,3,0,0,192,129,7,224,192,1,252,63,128,3,7,112,224,128,255,255,1,7,14,48,112,240,63,252,15,14,12,56,56,252,1,128,63,28,28,24,28,62,0,0,124,56,24,24,14,15,0,0,240,112,24,24,199,3,0,0,192,227,24,152,227,1,128,1,128,199,25,216,241,0,128,1,0,143,27,248,120,0,128,1,0,30,31,120,56,0,128,1,0,28,30,56,28,0,128,1,0,56,28,16,14,0,128,1,0,112,8,0,14,0,128,1,0,112,0,0,7,0,128,1,0,224,0,0,3,0,128,1,0,192,0,128,3,0,128,1,0,192,1,128,1,0,128,1,0,128,1,192,1,0,128,1,0,128,3,192,1,0,128,1,0,128,3,192,1,0,128,1,0,128,3,192,0,0,128,1,0,0,3,192,0,0,128,1,0,0,3,224,0,0,128,1,0,0,7,224,0,0,128,1,0,0,7,224,0,224,255,1,0,0,7,224,0,240,255,1,0,0,7,224,0,224,255,1,0,0,7,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,6,0,0,0,0,96,0,0,14,0,0,0,0,112,0,0,28,0,0,0,0,56,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,240,1,0,0,128,15,0,0,240,3,0,0,192,15,0,0,184,15,0,0,240,29,0,0,28,63,0,0,252,56,0,0,14,252,0,0,63,112,0,0,7,240,15,240,15,224,0,128,3,192,255,255,3,192,1,192,1,0,254,127,0,128,3,128,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0},
-    {0,0,31,0,0,0,0,0,0,224,255,0,0,0,0,0,0,248,255,3,0,0,0,0,0,60,224,1,0,0,0,0,0,14,240,0,0,0,0,0,0,7,60,0,0,128,255,0,128,3,30,0,0,128,255,1,128,1,15,128,1,0,231,7,192,193,3,254,127,0,14,15,192,224,225,255,255,7,14,28,192,240,240,7,224,15,28,56,224,60,252,0,0,63,56,56,224,30,31,0,0,248,112,112,192,143,7,0,0,224,113,96,192,195,3,0,0,192,227,224,192,225,1,128,1,128,199,225,192,112,0,128,1,0,142,195,0,56,0,128,1,0,156,227,0,60,0,128,1,0,60,231,0,28,0,128,1,0,56,238,0,14,0,128,1,0,112,252,0,7,0,128,1,0,224,124,0,7,0,128,1,0,224,120,128,3,0,128,1,0,192,49,128,3,0,128,1,0,192,33,128,1,0,128,1,0,128,1,192,1,0,128,1,0,128,3,192,1,0,128,1,0,128,3,192,0,0,128,1,0,0,3,192,0,0,128,1,0,0,3,224,0,0,128,1,0,0,7,224,0,0,128,1,0,0,7,224,0,0,128,1,0,0,7,224,0,224,255,1,0,0,7,224,0,240,255,1,0,0,7,224,0,224,255,1,0,0,7,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,7,0,0,0,0,224,0,0,14,0,0,0,0,112,0,0,14,0,0,0,0,112,0,0,28,0,0,0,0,56,0,0,56,0,0,0,0,28,0,0,112,0,0,0,0,14,0,0,240,0,0,0,0,15,0,0,240,1,0,0,128,15,0,0,248,7,0,0,224,31,0,0,60,15,0,0,240,60,0,0,30,62,0,0,124,120,0,0,15,248,1,128,31,240,0,128,7,224,127,254,7,224,1,192,3,128,255,255,1,192,3,128,1,0,252,63,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,15,0,0,240,31,0,0,254,31,0,0,248,127,0,0,15,14,0,0,112,240,0,192,3,7,0,0,224,192,3,224,129,3,0,0,192,129,7,224,192,1,252,63,128,3,7,112,224,128,255,255,1,7,14,48,112,240,63,252,15,14,12,56,56,252,1,128,63,28,28,24,28,62,0,0,124,56,24,24,14,15,0,0,240,112,24,24,199,3,0,0,192,227,24,152,227,1,128,1,128,199,25,216,241,0,128,1,0,143,27,248,120,0,128,1,0,30,31,120,56,0,128,1,0,28,30,56,28,0,128,1,0,56,28,16,14,0,128,1,0,112,8,0,14,0,128,1,0,112,0,0,7,0,128,1,0,224,0,0,3,0,128,1,0,192,0,128,3,0,128,1,0,192,1,128,1,0,128,1,0,128,1,192,1,0,128,1,0,128,3,192,1,0,128,1,0,128,3,192,1,0,128,1,0,128,3,192,0,0,128,1,0,0,3,192,0,0,128,1,0,0,3,224,0,0,128,1,0,0,7,224,0,0,128,1,0,0,7,224,0,224,255,1,0,0,7,224,0,240,255,1,0,0,7,224,0,224,255,1,0,0,7,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,6,0,0,0,0,96,0,0,14,0,0,0,0,112,0,0,28,0,0,0,0,56,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,240,1,0,0,128,15,0,0,240,3,0,0,192,15,0,0,184,15,0,0,240,29,0,0,28,63,0,0,252,56,0,0,14,252,0,0,63,112,0,0,7,240,15,240,15,224,0,128,3,192,255,255,3,192,1,192,1,0,254,127,0,128,3,128,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,3,0,0,0,0,0,0,255,15,0,0,0,0,0,192,7,31,0,0,0,0,0,0,7,120,0,0,0,0,0,0,30,240,0,0,255,1,0,0,60,224,1,192,255,1,0,0,112,192,1,224,225,0,240,15,224,129,3,112,112,0,255,255,192,131,3,56,56,224,255,255,7,7,3,28,56,248,3,192,31,30,3,12,28,126,0,0,126,60,7,14,14,31,0,0,248,112,7,6,135,7,0,0,224,225,3,7,199,3,0,0,192,195,3,135,227,0,0,6,0,7,3,195,113,0,0,6,0,14,2,231,56,0,0,6,0,28,0,231,28,0,0,6,0,56,0,119,30,0,0,7,0,120,0,62,14,0,0,7,0,112,0,30,7,0,0,7,0,224,0,30,7,0,0,7,0,224,0,140,3,0,0,7,0,192,1,132,3,0,0,3,0,192,1,128,1,0,0,3,0,128,1,192,1,0,0,3,0,128,3,192,1,0,128,3,0,128,3,192,0,0,128,3,0,0,3,192,0,0,128,3,0,0,3,224,0,0,128,3,0,0,7,224,0,0,128,3,0,0,7,224,0,0,128,1,0,0,7,224,0,224,255,3,0,0,7,224,0,224,255,1,0,0,7,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,7,0,0,0,0,224,0,0,14,0,0,0,0,112,0,0,30,0,0,0,0,120,0,0,28,0,0,0,0,56,0,0,56,0,0,0,0,28,0,0,112,0,0,0,0,14,0,0,240,0,0,0,0,15,0,0,240,3,0,0,192,15,0,0,248,7,0,0,224,31,0,0,60,31,0,0,248,60,0,0,30,126,0,0,126,120,0,0,15,248,3,192,31,240,0,128,7,224,255,255,7,224,1,192,3,0,255,255,0,192,3,128,1,0,224,7,0,128,1},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,15,0,0,240,31,0,0,254,31,0,0,248,127,0,0,15,14,0,0,112,240,0,192,3,7,0,0,224,192,3,224,129,3,0,0,192,129,7,224,192,1,252,63,128,3,7,112,224,128,255,255,1,7,14,48,112,240,63,252,15,14,12,56,56,252,1,128,63,28,28,24,28,62,0,0,124,56,24,24,14,15,0,0,240,112,24,24,199,3,0,0,192,227,24,152,227,1,0,0,128,199,25,216,241,0,0,0,0,143,27,248,120,0,0,192,0,30,31,120,56,0,0,192,1,28,30,56,28,0,0,224,0,56,28,16,14,0,0,224,0,112,8,0,14,0,0,112,0,112,0,0,7,0,0,112,0,224,0,0,3,0,0,48,0,192,0,128,3,0,0,56,0,192,1,128,1,0,0,24,0,128,1,192,1,0,0,28,0,128,3,192,1,0,0,28,0,128,3,192,1,0,0,14,0,128,3,192,0,0,0,14,0,0,3,192,0,0,0,7,0,0,3,224,0,0,0,7,0,0,7,224,0,0,0,3,0,0,7,224,0,224,255,3,0,0,7,224,0,240,255,3,0,0,7,224,0,224,255,1,0,0,7,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,6,0,0,0,0,96,0,0,14,0,0,0,0,112,0,0,28,0,0,0,0,56,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,240,1,0,0,128,15,0,0,240,3,0,0,192,15,0,0,184,15,0,0,240,29,0,0,28,63,0,0,252,56,0,0,14,252,0,0,63,112,0,0,7,240,15,240,15,224,0,128,3,192,255,255,3,192,1,192,1,0,254,127,0,128,3,128,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0},
-    {0,0,31,0,0,0,0,0,0,224,255,0,0,0,0,0,0,248,255,3,0,0,0,0,0,60,224,1,0,0,0,0,0,14,240,0,0,0,0,0,0,7,60,0,0,128,255,0,128,3,30,0,0,128,255,1,128,1,15,128,1,0,231,7,192,193,3,254,127,0,14,15,192,224,225,255,255,7,14,28,192,240,240,7,224,15,28,56,224,60,252,0,0,63,56,56,224,30,31,0,0,248,112,112,192,143,7,0,0,224,113,96,192,195,3,0,0,192,227,224,192,225,1,0,0,128,199,225,192,112,0,0,0,0,142,195,0,56,0,0,0,0,156,227,0,60,0,0,0,0,60,231,0,28,0,0,0,0,56,238,0,14,0,0,0,0,112,252,0,7,0,0,0,32,224,124,0,7,0,0,0,112,224,120,128,3,0,0,0,60,192,49,128,3,0,0,0,30,192,33,128,1,0,0,0,15,128,1,192,1,0,0,128,7,128,3,192,1,0,0,192,3,128,3,192,0,0,0,224,1,0,3,192,0,0,0,112,0,0,3,224,0,0,0,60,0,0,7,224,0,0,0,30,0,0,7,224,0,0,0,15,0,0,7,224,0,224,255,7,0,0,7,224,0,240,255,3,0,0,7,224,0,224,255,1,0,0,7,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,7,0,0,0,0,224,0,0,14,0,0,0,0,112,0,0,14,0,0,0,0,112,0,0,28,0,0,0,0,56,0,0,56,0,0,0,0,28,0,0,112,0,0,0,0,14,0,0,240,0,0,0,0,15,0,0,240,1,0,0,128,15,0,0,248,7,0,0,224,31,0,0,60,15,0,0,240,60,0,0,30,62,0,0,124,120,0,0,15,248,1,128,31,240,0,128,7,224,127,254,7,224,1,192,3,128,255,255,1,192,3,128,1,0,252,63,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,224,31,0,0,0,0,0,0,248,127,0,0,0,0,0,0,124,248,0,0,0,0,0,0,15,120,0,0,192,127,0,128,7,28,0,0,192,255,1,192,3,15,0,0,192,227,3,192,129,7,192,3,128,131,7,224,192,3,254,127,0,7,14,224,224,225,255,255,7,14,28,96,240,240,7,224,15,28,24,96,60,124,0,0,62,56,56,112,30,31,0,0,248,120,48,112,143,7,0,0,224,113,112,224,199,3,0,0,192,227,112,224,227,1,0,0,128,199,97,224,112,0,0,0,0,142,99,96,56,0,0,0,0,28,103,32,60,0,0,0,0,60,127,0,28,0,0,0,0,56,126,0,14,0,0,0,0,112,60,0,7,0,0,0,0,224,56,0,7,0,0,0,0,224,48,128,3,0,0,0,0,192,1,128,3,0,0,0,0,192,1,128,1,0,0,0,0,128,1,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,224,0,0,0,0,224,7,7,224,0,0,0,0,255,7,7,224,0,0,0,252,255,0,7,224,0,224,255,255,7,0,7,224,0,224,255,31,0,0,7,224,0,0,128,1,0,0,7,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,7,0,0,0,0,224,0,0,14,0,0,0,0,112,0,0,14,0,0,0,0,112,0,0,28,0,0,0,0,56,0,0,56,0,0,0,0,28,0,0,112,0,0,0,0,14,0,0,240,0,0,0,0,15,0,0,240,1,0,0,128,15,0,0,248,7,0,0,224,31,0,0,60,31,0,0,248,60,0,0,30,62,0,0,124,120,0,0,15,248,1,128,31,240,0,128,7,224,255,255,7,224,1,192,3,128,255,255,1,192,3,128,1,0,252,63,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,15,0,0,240,31,0,0,254,31,0,0,248,127,0,128,15,14,0,0,112,240,0,192,3,7,0,0,224,192,3,224,129,3,0,0,192,129,7,224,192,1,252,63,128,3,7,112,224,192,255,255,3,7,14,56,112,240,31,248,15,14,12,56,56,252,1,128,63,28,28,24,28,62,0,0,124,56,24,24,142,15,0,0,240,113,24,24,199,3,0,0,192,227,24,152,227,1,0,0,128,199,25,216,241,0,0,0,0,143,27,248,120,0,0,0,0,30,31,120,56,0,0,0,0,28,30,56,28,0,0,0,0,56,28,16,14,0,0,0,0,112,8,0,14,0,0,0,0,112,0,0,7,0,0,0,0,224,0,0,3,0,0,0,0,192,0,128,3,0,0,0,0,192,1,128,1,0,0,0,0,128,1,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,224,0,224,255,1,0,0,7,224,0,240,255,7,0,0,7,224,0,224,255,31,0,0,7,224,0,0,0,126,0,0,7,224,0,0,0,248,3,0,7,192,0,0,0,192,15,0,3,192,0,0,0,0,63,0,3,192,1,0,0,0,252,128,3,192,1,0,0,0,240,131,3,192,1,0,0,0,192,129,3,128,1,0,0,0,0,128,1,128,3,0,0,0,0,192,1,128,3,0,0,0,0,192,1,0,7,0,0,0,0,224,0,0,6,0,0,0,0,96,0,0,14,0,0,0,0,112,0,0,28,0,0,0,0,56,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,240,1,0,0,128,15,0,0,240,3,0,0,192,15,0,0,184,15,0,0,240,29,0,0,28,62,0,0,124,56,0,0,14,252,0,0,63,112,0,0,7,240,15,240,15,224,0,128,3,192,255,255,3,192,1,192,1,0,254,127,0,128,3,128,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,15,0,0,240,31,0,0,254,31,0,0,248,127,0,128,15,14,0,0,112,240,0,192,3,7,0,0,224,192,3,224,129,3,0,0,192,129,7,224,192,1,252,63,128,3,7,112,224,192,255,255,3,7,14,56,112,240,31,248,15,14,12,56,56,252,1,128,63,28,28,24,28,62,0,0,124,56,24,24,142,15,0,0,240,113,24,24,199,3,0,0,192,227,24,152,227,1,0,0,128,199,25,216,241,0,0,0,0,143,27,248,120,0,0,0,0,30,31,120,56,0,0,0,0,28,30,56,28,0,0,0,0,56,28,16,14,0,0,0,0,112,8,0,14,0,0,0,0,112,0,0,7,0,0,0,0,224,0,0,3,0,0,0,0,192,0,128,3,0,0,0,0,192,1,128,1,0,0,0,0,128,1,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,224,0,224,255,1,0,0,7,224,0,240,255,3,0,0,7,224,0,224,255,3,0,0,7,224,0,0,0,3,0,0,7,224,0,0,0,7,0,0,7,192,0,0,0,6,0,0,3,192,0,0,0,14,0,0,3,192,1,0,0,28,0,128,3,192,1,0,0,28,0,128,3,192,1,0,0,56,0,128,3,128,1,0,0,56,0,128,1,128,3,0,0,112,0,192,1,128,3,0,0,112,0,192,1,0,7,0,0,224,0,224,0,0,6,0,0,224,0,96,0,0,14,0,0,192,1,112,0,0,28,0,0,192,1,56,0,0,60,0,0,128,3,60,0,0,120,0,0,128,1,30,0,0,240,0,0,0,0,15,0,0,240,1,0,0,128,15,0,0,240,3,0,0,192,15,0,0,184,15,0,0,240,29,0,0,28,62,0,0,124,56,0,0,14,252,0,0,63,112,0,0,7,240,15,240,15,224,0,128,3,192,255,255,3,192,1,192,1,0,254,127,0,128,3,128,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,15,0,0,240,31,0,0,254,31,0,0,248,127,0,128,15,14,0,0,112,240,0,192,3,7,0,0,224,192,3,224,129,3,0,0,192,129,7,224,192,1,252,63,128,3,7,112,224,192,255,255,3,7,14,56,112,240,31,248,15,14,12,56,56,252,1,128,63,28,28,24,28,62,0,0,124,56,24,24,142,15,0,0,240,113,24,24,199,3,0,0,192,227,24,152,227,1,0,0,128,199,25,216,241,0,0,0,0,143,27,248,120,0,0,0,0,30,31,120,56,0,0,0,0,28,30,56,28,0,0,0,0,56,28,16,14,0,0,0,0,112,8,0,14,0,0,0,0,112,0,0,7,0,0,0,0,224,0,0,3,0,0,0,0,192,0,128,3,0,0,0,0,192,1,128,1,0,0,0,0,128,1,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,224,0,224,255,1,0,0,7,224,0,240,255,3,0,0,7,224,0,224,255,1,0,0,7,224,0,0,192,1,0,0,7,224,0,0,192,1,0,0,7,192,0,0,192,0,0,0,3,192,0,0,192,0,0,0,3,192,1,0,224,0,0,128,3,192,1,0,224,0,0,128,3,192,1,0,96,0,0,128,3,128,1,0,96,0,0,128,1,128,3,0,112,0,0,192,1,128,3,0,112,0,0,192,1,0,7,0,112,0,0,224,0,0,6,0,48,0,0,96,0,0,14,0,56,0,0,112,0,0,28,0,56,0,0,56,0,0,60,0,56,0,0,60,0,0,120,0,24,0,0,30,0,0,240,0,24,0,0,15,0,0,240,1,0,0,128,15,0,0,240,3,0,0,192,15,0,0,184,15,0,0,240,29,0,0,28,62,0,0,124,56,0,0,14,252,0,0,63,112,0,0,7,240,15,240,15,224,0,128,3,192,255,255,3,192,1,192,1,0,254,127,0,128,3,128,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,15,0,0,240,31,0,0,254,31,0,0,248,127,0,128,15,14,0,0,112,240,0,192,3,7,0,0,224,192,3,224,129,3,0,0,192,129,7,224,192,1,252,63,128,3,7,112,224,192,255,255,3,7,14,56,112,240,31,248,15,14,12,56,56,252,1,128,63,28,28,24,28,62,0,0,124,56,24,24,142,15,0,0,240,113,24,24,199,3,0,0,192,227,24,152,227,1,0,0,128,199,25,216,241,0,0,0,0,143,27,248,120,0,0,0,0,30,31,120,56,0,0,0,0,28,30,56,28,0,0,0,0,56,28,16,14,0,0,0,0,112,8,0,14,0,0,0,0,112,0,0,7,0,0,0,0,224,0,0,3,0,0,0,0,192,0,128,3,0,0,0,0,192,1,128,1,0,0,0,0,128,1,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,192,1,0,0,0,0,128,3,192,0,0,0,0,0,0,3,192,0,0,0,0,0,0,3,224,0,0,0,0,0,0,7,224,0,0,0,0,0,0,7,224,0,224,255,1,0,0,7,224,0,240,255,3,0,0,7,224,0,224,255,1,0,0,7,224,0,0,120,0,0,0,7,224,0,0,60,0,0,0,7,192,0,0,31,0,0,0,3,192,0,128,7,0,0,0,3,192,1,224,3,0,0,128,3,192,1,240,0,0,0,128,3,192,1,124,0,0,0,128,3,128,1,30,0,0,0,128,1,128,3,15,0,0,0,192,1,128,3,7,0,0,0,192,1,0,7,0,0,0,0,224,0,0,6,0,0,0,0,96,0,0,14,0,0,0,0,112,0,0,28,0,0,0,0,56,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,240,1,0,0,128,15,0,0,240,3,0,0,192,15,0,0,184,15,0,0,240,29,0,0,28,62,0,0,124,56,0,0,14,252,0,0,63,112,0,0,7,240,15,240,15,224,0,128,3,192,255,255,3,192,1,192,1,0,254,127,0,128,3,128,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    };
-
-static const unsigned char pulse[][BITMAP_LENGTH] = {
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,102,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,227,0,0,0,0,0,0,3,227,0,6,0,0,0,128,3,227,0,14,0,0,0,128,131,227,0,14,0,0,0,192,135,195,0,15,0,0,0,192,135,193,0,31,0,0,0,224,142,193,1,27,0,0,0,96,142,193,129,59,0,0,224,127,204,193,129,57,248,7,240,63,220,192,129,49,252,15,240,31,220,128,193,113,254,15,0,0,248,128,193,112,6,0,0,0,248,128,195,224,7,0,0,0,112,128,227,224,3,0,0,0,112,128,99,192,3,0,0,0,112,128,99,192,1,0,0,0,96,0,115,192,0,0,0,0,0,0,51,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,102,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,227,0,0,0,0,0,0,3,227,0,6,0,0,0,128,3,227,0,14,0,0,0,128,131,227,0,14,0,0,0,192,135,195,0,15,0,0,0,192,135,193,0,31,0,0,0,224,142,193,1,27,0,0,0,96,142,193,129,59,0,0,224,127,204,193,129,57,248,7,240,63,220,192,129,49,252,15,240,31,220,128,193,113,254,15,0,0,248,128,193,112,6,0,0,0,248,128,195,224,7,0,0,0,112,128,227,224,3,0,0,0,112,128,99,192,3,0,0,0,112,128,99,192,1,0,0,0,96,0,115,192,0,0,0,0,0,0,51,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,102,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,227,0,0,0,0,0,0,3,227,0,6,0,0,0,128,3,227,0,14,0,0,0,128,131,227,0,14,0,0,0,192,135,195,0,15,0,0,0,192,135,193,0,31,0,0,0,224,142,193,1,27,0,0,0,96,142,193,129,59,0,0,224,127,204,193,129,57,248,7,240,63,220,192,129,49,252,15,240,31,220,128,193,113,254,15,0,0,248,128,193,112,6,0,0,0,248,128,195,224,7,0,0,0,112,128,227,224,3,0,0,0,112,128,99,192,3,0,0,0,112,128,99,192,1,0,0,0,96,0,115,192,0,0,0,0,0,0,51,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,102,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,227,0,0,0,0,0,0,3,227,0,6,0,0,0,128,3,227,0,14,0,0,0,128,131,227,0,14,0,0,0,192,135,195,0,15,0,0,0,192,135,193,0,31,0,0,0,224,142,193,1,27,0,0,0,96,142,193,129,59,0,0,224,127,204,193,129,57,248,7,240,63,220,192,129,49,252,15,240,31,220,128,193,113,254,15,0,0,248,128,193,112,6,0,0,0,248,128,195,224,7,0,0,0,112,128,227,224,3,0,0,0,112,128,99,192,3,0,0,0,112,128,99,192,1,0,0,0,96,0,115,192,0,0,0,0,0,0,51,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,102,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,227,0,0,0,0,0,0,3,227,0,6,0,0,0,128,3,227,0,14,0,0,0,128,131,227,0,14,0,0,0,192,135,195,0,15,0,0,0,192,135,193,0,31,0,0,0,224,142,193,1,27,0,0,0,96,142,193,129,59,0,0,128,127,204,193,129,57,248,7,192,63,220,192,129,49,252,15,128,31,220,128,193,113,254,15,0,0,248,128,193,112,6,0,0,0,248,128,195,224,7,0,0,0,112,128,227,224,3,0,0,0,112,128,99,192,3,0,0,0,112,128,99,192,1,0,0,0,96,0,115,192,0,0,0,0,0,0,51,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,102,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,227,0,0,0,0,0,0,3,227,0,6,0,0,0,128,3,227,0,14,0,0,0,128,131,227,0,14,0,0,0,192,135,195,0,15,0,0,0,192,135,193,0,31,0,0,0,224,142,193,1,27,0,0,0,96,142,193,129,59,0,0,0,112,204,193,129,57,248,7,0,48,220,192,129,49,252,15,0,0,220,128,193,113,254,15,0,0,248,128,193,112,6,0,0,0,248,128,195,224,7,0,0,0,112,128,227,224,3,0,0,0,112,128,99,192,3,0,0,0,112,128,99,192,1,0,0,0,96,0,115,192,0,0,0,0,0,0,51,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,102,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,227,0,0,0,0,0,0,0,227,0,6,0,0,0,0,2,227,0,14,0,0,0,0,131,227,0,14,0,0,0,0,135,195,0,15,0,0,0,0,134,193,0,31,0,0,0,0,142,193,1,27,0,0,0,0,142,193,129,59,0,0,0,0,204,193,129,57,248,7,0,0,220,192,129,49,252,15,0,0,220,128,193,113,254,15,0,0,248,128,193,112,6,0,0,0,248,128,195,224,7,0,0,0,112,128,227,224,3,0,0,0,112,128,99,192,3,0,0,0,112,128,99,192,1,0,0,0,96,0,115,192,0,0,0,0,0,0,51,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,62,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,102,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,227,0,6,0,0,0,0,0,227,0,14,0,0,0,0,128,195,0,15,0,0,0,0,128,195,0,31,0,0,0,0,128,193,0,31,0,0,0,0,128,193,128,27,0,0,0,0,192,193,129,59,0,0,0,0,192,193,129,57,248,7,0,0,192,129,193,49,252,15,0,0,192,128,193,113,254,7,0,0,224,128,193,113,6,0,0,0,224,128,193,224,7,0,0,0,224,128,227,224,3,0,0,0,96,128,227,192,3,0,0,0,96,0,99,192,1,0,0,0,96,0,115,192,0,0,0,0,0,0,115,0,0,0,0,0,0,0,51,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,62,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,102,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,99,0,0,0,0,0,0,0,224,0,6,0,0,0,0,0,224,0,14,0,0,0,0,0,192,0,15,0,0,0,0,0,192,0,31,0,0,0,0,0,192,0,31,0,0,0,0,0,192,128,27,0,0,0,0,0,192,129,59,0,0,0,0,0,192,129,57,248,7,0,0,0,128,193,49,252,15,0,0,0,128,193,113,254,7,0,0,0,128,193,113,6,0,0,0,0,128,193,224,7,0,0,0,0,128,227,224,3,0,0,0,0,128,227,192,3,0,0,0,0,0,99,192,1,0,0,0,0,0,115,192,0,0,0,0,0,0,115,0,0,0,0,0,0,0,51,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,112,0,0,0,0,0,0,0,112,0,0,0,0,0,0,0,96,0,0,0,0,0,0,0,96,0,0,0,0,0,0,0,96,0,0,0,0,0,0,0,96,0,0,0,0,0,0,0,224,0,6,0,0,0,0,0,224,0,14,0,0,0,0,0,192,0,15,0,0,0,0,0,192,0,31,0,0,0,0,0,192,0,31,0,0,0,0,0,192,128,27,0,0,0,0,0,192,129,59,0,0,0,0,0,192,129,57,248,7,0,0,0,128,193,49,252,15,0,0,0,128,193,113,254,7,0,0,0,128,193,113,6,0,0,0,0,128,193,224,7,0,0,0,0,128,227,224,3,0,0,0,0,128,227,192,3,0,0,0,0,0,99,192,1,0,0,0,0,0,115,192,0,0,0,0,0,0,115,0,0,0,0,0,0,0,51,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,15,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,27,0,0,0,0,0,0,128,59,0,0,0,0,0,0,128,57,248,7,0,0,0,0,128,49,252,15,0,0,0,0,192,113,254,15,0,0,0,0,192,112,6,0,0,0,0,0,192,224,7,0,0,0,0,0,224,224,3,0,0,0,0,0,97,192,3,0,0,0,0,0,99,192,1,0,0,0,0,0,115,192,0,0,0,0,0,0,51,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,15,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,27,0,0,0,0,0,0,128,59,0,0,0,0,0,0,128,57,248,7,0,0,0,0,128,49,252,15,0,0,0,0,192,113,254,15,0,0,0,0,192,112,6,0,0,0,0,0,192,224,7,0,0,0,0,0,224,224,3,0,0,0,0,0,96,192,3,0,0,0,0,0,96,192,1,0,0,0,0,0,0,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,7,0,0,0,0,0,0,252,15,0,0,0,0,0,32,254,7,0,0,0,0,0,96,6,0,0,0,0,0,0,224,7,0,0,0,0,0,0,224,3,0,0,0,0,0,0,192,3,0,0,0,0,0,0,192,1,0,0,0,0,0,0,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,3,0,0,0,0,0,0,128,3,0,0,0,0,0,0,192,7,0,0,0,0,0,0,192,7,0,0,0,0,0,0,224,7,0,0,0,0,0,0,224,0,0,0,0,0,0,0,112,0,0,0,0,0,0,224,127,0,0,0,0,0,0,240,63,0,0,0,0,0,0,224,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,128,3,0,0,0,0,0,0,128,3,0,0,0,0,0,0,192,135,1,0,0,0,0,0,192,135,1,0,0,0,0,0,224,142,1,0,0,0,0,0,96,142,1,0,0,0,0,224,127,204,1,0,0,0,0,240,63,220,0,0,0,0,0,240,31,220,0,0,0,0,0,0,0,248,0,0,0,0,0,0,0,248,0,0,0,0,0,0,0,112,0,0,0,0,0,0,0,112,0,0,0,0,0,0,0,112,0,0,0,0,0,0,0,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,128,3,3,0,0,0,0,0,128,3,3,0,0,0,0,0,192,135,3,0,0,0,0,0,192,135,3,0,0,0,0,0,224,135,1,0,0,0,0,0,224,142,1,0,0,0,0,0,112,206,1,0,0,0,0,224,127,204,1,0,0,0,0,240,63,220,1,0,0,0,0,224,31,252,0,0,0,0,0,0,0,248,0,0,0,0,0,0,0,248,0,0,0,0,0,0,0,240,0,0,0,0,0,0,0,112,0,0,0,0,0,0,0,112,0,0,0,0,0,0,0,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,62,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,102,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,103,0,0,0,0,0,128,3,227,0,0,0,0,0,128,3,227,0,0,0,0,0,192,135,195,0,0,0,0,0,192,135,195,0,0,0,0,0,224,135,193,0,0,0,0,0,224,142,193,0,0,0,0,0,112,206,193,1,0,0,0,224,127,204,193,1,0,0,0,240,63,220,129,1,0,0,0,224,31,252,128,1,0,0,0,0,0,248,128,1,0,0,0,0,0,248,128,1,0,0,0,0,0,240,128,3,0,0,0,0,0,112,0,1,0,0,0,0,0,112,0,0,0,0,0,0,0,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,62,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,102,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,103,0,0,0,0,0,128,3,227,0,0,0,0,0,128,3,227,0,0,0,0,0,192,135,195,0,0,0,0,0,192,135,195,0,0,0,0,0,224,135,193,0,0,0,0,0,224,142,193,0,0,0,0,0,112,206,193,1,0,0,0,224,127,204,193,1,0,0,0,240,63,220,129,1,0,0,0,224,31,252,128,1,0,0,0,0,0,248,128,1,0,0,0,0,0,248,128,1,0,0,0,0,0,240,128,3,0,0,0,0,0,112,128,3,0,0,0,0,0,112,0,3,0,0,0,0,0,96,0,3,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,23,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,62,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,102,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,103,0,0,0,0,0,128,3,227,0,0,0,0,0,128,3,227,0,0,0,0,0,192,135,195,0,2,0,0,0,192,135,195,0,7,0,0,0,224,135,193,0,3,0,0,0,224,142,193,128,3,0,0,0,112,206,193,129,3,0,0,224,127,204,193,129,1,0,0,240,63,220,129,193,1,0,0,224,31,252,128,193,1,0,0,0,0,248,128,193,1,0,0,0,0,248,128,193,0,0,0,0,0,240,128,227,0,0,0,0,0,112,128,227,0,0,0,0,0,112,0,99,0,0,0,0,0,96,0,115,0,0,0,0,0,0,0,115,0,0,0,0,0,0,0,51,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,102,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,227,0,0,0,0,0,0,3,227,0,6,0,0,0,128,3,227,0,14,0,0,0,128,131,227,0,14,0,0,0,192,135,195,0,15,0,0,0,192,135,193,0,31,0,0,0,224,142,193,1,27,0,0,0,96,142,193,129,59,0,0,224,127,204,193,129,57,0,0,240,63,220,192,129,49,0,0,240,31,220,128,193,113,0,0,0,0,248,128,193,112,0,0,0,0,248,128,195,96,0,0,0,0,112,128,227,0,0,0,0,0,112,128,99,0,0,0,0,0,112,128,99,0,0,0,0,0,96,0,115,0,0,0,0,0,0,0,51,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,102,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,227,0,0,0,0,0,0,3,227,0,6,0,0,0,128,3,227,0,14,0,0,0,128,131,227,0,14,0,0,0,192,135,195,0,15,0,0,0,192,135,193,0,31,0,0,0,224,142,193,1,27,0,0,0,96,142,193,129,59,0,0,224,127,204,193,129,57,0,0,240,63,220,192,129,49,4,0,240,31,220,128,193,113,14,0,0,0,248,128,193,112,6,0,0,0,248,128,195,224,7,0,0,0,112,128,227,224,3,0,0,0,112,128,99,192,3,0,0,0,112,128,99,192,1,0,0,0,96,0,115,192,0,0,0,0,0,0,51,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,102,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,227,0,0,0,0,0,0,3,227,0,6,0,0,0,128,3,227,0,14,0,0,0,128,131,227,0,14,0,0,0,192,135,195,0,15,0,0,0,192,135,193,0,31,0,0,0,224,142,193,1,27,0,0,0,96,142,193,129,59,0,0,224,127,204,193,129,57,248,1,240,63,220,192,129,49,252,3,240,31,220,128,193,113,254,1,0,0,248,128,193,112,6,0,0,0,248,128,195,224,7,0,0,0,112,128,227,224,3,0,0,0,112,128,99,192,3,0,0,0,112,128,99,192,1,0,0,0,96,0,115,192,0,0,0,0,0,0,51,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,102,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,227,0,0,0,0,0,0,3,227,0,6,0,0,0,128,3,227,0,14,0,0,0,128,131,227,0,14,0,0,0,192,135,195,0,15,0,0,0,192,135,193,0,31,0,0,0,224,142,193,1,27,0,0,0,96,142,193,129,59,0,0,224,127,204,193,129,57,248,7,240,63,220,192,129,49,252,15,240,31,220,128,193,113,254,15,0,0,248,128,193,112,6,0,0,0,248,128,195,224,7,0,0,0,112,128,227,224,3,0,0,0,112,128,99,192,3,0,0,0,112,128,99,192,1,0,0,0,96,0,115,192,0,0,0,0,0,0,51,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,102,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,227,0,0,0,0,0,0,3,227,0,6,0,0,0,128,3,227,0,14,0,0,0,128,131,227,0,14,0,0,0,192,135,195,0,15,0,0,0,192,135,193,0,31,0,0,0,224,142,193,1,27,0,0,0,96,142,193,129,59,0,0,224,127,204,193,129,57,248,7,240,63,220,192,129,49,252,15,240,31,220,128,193,113,254,15,0,0,248,128,193,112,6,0,0,0,248,128,195,224,7,0,0,0,112,128,227,224,3,0,0,0,112,128,99,192,3,0,0,0,112,128,99,192,1,0,0,0,96,0,115,192,0,0,0,0,0,0,51,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    };
-
-static const unsigned char wifi[][BITMAP_LENGTH] = {
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,63,0,0,0,0,0,224,255,255,7,0,0,0,0,252,127,255,127,0,0,0,128,63,0,0,254,1,0,0,224,7,0,0,224,7,0,0,248,0,0,0,0,31,0,0,62,0,0,0,0,124,0,128,15,0,0,0,0,240,1,192,3,0,254,255,0,192,3,224,1,224,255,255,7,0,7,112,0,252,15,240,63,0,14,60,0,63,0,0,254,0,60,30,192,7,0,0,224,3,120,15,240,1,0,0,128,15,240,30,120,0,0,0,0,30,120,60,28,0,0,0,0,56,60,120,15,0,254,255,0,240,30,240,7,224,255,255,7,224,15,224,3,248,3,192,31,128,7,192,0,62,0,0,126,0,3,0,0,15,0,0,240,0,0,0,192,3,0,0,192,3,0,0,224,1,0,0,128,7,0,0,240,0,240,15,0,14,0,0,120,0,254,255,0,30,0,0,112,192,255,255,3,14,0,0,224,240,3,192,15,7,0,0,192,121,0,0,158,3,0,0,128,63,0,0,252,1,0,0,0,15,0,0,240,0,0,0,0,6,0,0,96,0,0,0,0,0,248,31,0,0,0,0,0,0,254,127,0,0,0,0,0,0,63,252,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,192,3,192,3,0,0,0,0,128,7,224,1,0,0,0,0,0,15,240,0,0,0,0,0,0,30,120,0,0,0,0,0,0,60,60,0,0,0,0,0,0,120,30,0,0,0,0,0,0,240,15,0,0,0,0,0,0,224,7,0,0,0,0,0,0,192,3,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,63,0,0,0,0,0,224,255,255,7,0,0,0,0,252,127,255,127,0,0,0,128,63,0,0,254,1,0,0,224,7,0,0,224,7,0,0,248,0,0,0,0,31,0,0,62,0,0,0,0,124,0,128,15,0,0,0,0,240,1,192,3,0,254,255,0,192,3,224,1,224,255,255,7,0,7,112,0,252,15,240,63,0,14,60,0,63,0,0,254,0,60,30,192,7,0,0,224,3,120,15,240,1,0,0,128,15,240,30,120,0,0,0,0,30,120,60,28,0,0,0,0,56,60,120,15,0,254,255,0,240,30,240,7,224,255,255,7,224,15,224,3,248,3,192,31,128,7,192,0,62,0,0,126,0,3,0,0,15,0,0,240,0,0,0,192,3,0,0,192,3,0,0,224,1,0,0,128,7,0,0,240,0,240,15,0,14,0,0,120,0,254,255,0,30,0,0,112,192,255,255,3,14,0,0,224,240,3,192,15,7,0,0,192,121,0,0,158,3,0,0,128,63,0,0,252,1,0,0,0,15,0,0,240,0,0,0,0,6,0,0,96,0,0,0,0,0,248,31,0,0,0,0,0,0,254,127,0,0,0,0,0,0,63,252,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,192,3,192,3,0,0,0,0,128,7,224,1,0,0,0,0,0,15,240,0,0,0,0,0,0,30,120,0,0,0,0,0,0,60,60,0,0,0,0,0,0,120,30,0,0,0,0,0,0,240,15,0,0,0,0,0,0,224,7,0,0,0,0,0,0,192,3,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,63,0,0,0,0,0,224,255,255,7,0,0,0,0,252,127,255,127,0,0,0,128,63,0,0,254,1,0,0,224,7,0,0,224,7,0,0,248,0,0,0,0,31,0,0,62,0,0,0,0,124,0,128,15,0,0,0,0,240,1,192,3,0,254,255,0,192,3,224,1,224,255,255,7,0,7,112,0,252,15,240,63,0,14,60,0,63,0,0,254,0,60,30,192,7,0,0,224,3,120,15,240,1,0,0,128,15,240,30,120,0,0,0,0,30,120,60,28,0,0,0,0,56,60,120,15,0,254,255,0,240,30,240,7,224,255,255,7,224,15,224,3,248,3,192,31,128,7,192,0,62,0,0,126,0,3,0,0,15,0,0,240,0,0,0,192,3,0,0,192,3,0,0,224,1,0,0,128,7,0,0,240,0,240,15,0,14,0,0,120,0,254,255,0,30,0,0,112,192,255,255,3,14,0,0,224,240,3,192,15,7,0,0,192,121,0,0,158,3,0,0,128,63,0,0,252,1,0,0,0,15,0,0,240,0,0,0,0,6,0,0,96,0,0,0,0,0,248,31,0,0,0,0,0,0,254,127,0,0,0,0,0,0,63,252,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,192,3,192,3,0,0,0,0,128,7,224,1,0,0,0,0,0,15,240,0,0,0,0,0,0,30,120,0,0,0,0,0,0,60,60,0,0,0,0,0,0,120,30,0,0,0,0,0,0,240,15,0,0,0,0,0,0,224,7,0,0,0,0,0,0,192,3,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,63,0,0,0,0,0,224,255,255,7,0,0,0,0,252,127,255,127,0,0,0,128,63,0,0,254,1,0,0,224,7,0,0,224,7,0,0,248,0,0,0,0,31,0,0,62,0,0,0,0,124,0,128,15,0,0,0,0,240,1,192,3,0,254,255,0,192,3,224,1,224,255,255,7,0,7,112,0,252,15,240,63,0,14,60,0,63,0,0,254,0,60,30,192,7,0,0,224,3,120,15,240,1,0,0,128,15,240,30,120,0,0,0,0,30,120,60,28,0,0,0,0,56,60,120,15,0,254,255,0,240,30,240,7,224,255,255,7,224,15,224,3,248,3,192,31,128,7,192,0,62,0,0,126,0,3,0,0,15,0,0,240,0,0,0,192,3,0,0,192,3,0,0,224,1,0,0,128,7,0,0,240,0,240,15,0,14,0,0,120,0,254,255,0,30,0,0,112,192,255,255,3,14,0,0,224,240,3,192,15,7,0,0,192,121,0,0,158,3,0,0,128,63,0,0,252,1,0,0,0,15,0,0,240,0,0,0,0,6,0,0,96,0,0,0,0,0,248,31,0,0,0,0,0,0,254,127,0,0,0,0,0,0,63,252,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,192,3,192,3,0,0,0,0,128,7,224,1,0,0,0,0,0,15,240,0,0,0,0,0,0,30,120,0,0,0,0,0,0,60,60,0,0,0,0,0,0,120,30,0,0,0,0,0,0,240,15,0,0,0,0,0,0,224,7,0,0,0,0,0,0,192,3,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,63,0,0,0,0,0,224,255,255,7,0,0,0,0,252,127,255,127,0,0,0,128,63,0,0,254,1,0,0,224,7,0,0,224,7,0,0,248,0,0,0,0,31,0,0,62,0,0,0,0,124,0,128,15,0,0,0,0,240,1,192,3,0,254,255,0,192,3,224,1,224,255,255,7,0,7,112,0,252,15,240,63,0,14,60,0,63,0,0,254,0,60,30,192,7,0,0,224,3,120,15,240,1,0,0,128,15,240,30,120,0,0,0,0,30,120,60,28,0,254,255,0,56,60,120,15,224,255,255,7,240,30,240,7,248,3,192,31,224,15,224,3,126,0,0,126,128,7,192,0,15,0,0,240,0,3,0,192,7,0,0,192,3,0,0,224,1,0,0,128,7,0,0,240,0,224,15,0,15,0,0,120,0,254,255,0,30,0,0,112,128,255,255,3,14,0,0,224,224,3,192,7,7,0,0,192,249,0,0,159,3,0,0,128,63,0,0,252,1,0,0,0,31,0,0,240,0,0,0,0,6,128,1,224,0,0,0,0,0,248,31,0,0,0,0,0,0,254,127,0,0,0,0,0,128,31,248,1,0,0,0,0,192,3,192,3,0,0,0,0,192,1,128,3,0,0,0,0,128,3,192,1,0,0,0,0,0,7,224,0,0,0,0,0,0,15,240,0,0,0,0,0,0,30,120,0,0,0,0,0,0,60,60,0,0,0,0,0,0,120,30,0,0,0,0,0,0,240,15,0,0,0,0,0,0,224,7,0,0,0,0,0,0,192,3,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,127,0,0,0,0,0,224,255,255,15,0,0,0,0,254,63,252,127,0,0,0,128,63,0,0,252,3,0,0,224,7,0,0,224,7,0,0,248,0,0,0,0,31,0,0,62,0,0,0,0,124,0,128,15,0,0,0,0,240,1,192,3,0,255,255,0,192,3,224,1,224,255,255,15,0,7,120,0,252,3,224,63,0,14,60,0,63,0,0,252,0,60,30,192,7,0,0,224,3,120,14,240,1,0,0,128,15,240,28,120,0,254,255,0,30,120,60,30,224,255,255,7,120,60,120,15,248,3,224,31,240,30,240,7,126,0,0,126,224,15,224,3,15,0,0,240,128,7,192,192,7,0,0,192,3,3,0,224,1,0,0,128,7,0,0,240,0,192,7,0,15,0,0,120,0,254,127,0,30,0,0,112,128,255,255,1,30,0,0,224,224,3,224,7,15,0,0,224,249,0,0,159,7,0,0,192,63,0,0,252,3,0,0,128,31,0,0,240,1,0,0,0,7,0,0,224,0,0,0,0,2,224,7,64,0,0,0,0,0,252,63,0,0,0,0,0,0,255,255,0,0,0,0,0,128,15,240,1,0,0,0,0,192,3,192,3,0,0,0,0,192,1,128,3,0,0,0,0,128,3,192,1,0,0,0,0,0,7,224,0,0,0,0,0,0,14,112,0,0,0,0,0,0,28,56,0,0,0,0,0,0,56,28,0,0,0,0,0,0,112,14,0,0,0,0,0,0,224,7,0,0,0,0,0,0,192,3,0,0,0,0,0,0,128,1,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,3,0,0,0,0,0,192,255,255,3,0,0,0,0,248,255,255,31,0,0,0,0,255,0,128,255,1,0,0,224,15,0,0,248,7,0,0,240,1,0,0,128,31,0,0,124,0,0,0,0,62,0,0,31,0,0,0,0,248,0,192,7,0,240,31,0,224,3,224,1,128,255,255,3,128,7,240,0,248,255,255,31,0,15,120,0,254,0,0,127,0,28,30,128,15,0,0,248,1,120,15,224,3,0,0,192,7,240,14,248,0,0,0,0,31,240,28,60,0,192,7,0,60,120,56,30,0,255,255,0,112,60,240,7,224,255,255,7,224,30,240,3,248,1,192,31,192,15,224,1,62,0,0,124,128,7,192,128,15,0,0,240,1,2,0,192,3,0,0,192,3,0,0,224,1,0,0,0,7,0,0,120,0,240,15,0,14,0,0,56,0,254,255,0,28,0,0,120,192,255,255,3,30,0,0,240,240,3,192,15,15,0,0,224,249,0,0,159,7,0,0,192,63,0,0,252,3,0,0,128,15,0,0,240,1,0,0,0,7,0,0,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,15,0,0,0,0,0,0,254,127,0,0,0,0,0,0,127,254,0,0,0,0,0,128,7,224,1,0,0,0,0,224,1,128,7,0,0,0,0,192,3,192,3,0,0,0,0,128,7,224,1,0,0,0,0,0,15,240,0,0,0,0,0,0,30,120,0,0,0,0,0,0,60,60,0,0,0,0,0,0,120,30,0,0,0,0,0,0,112,14,0,0,0,0,0,0,224,7,0,0,0,0,0,0,192,3,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,255,0,0,0,0,0,240,255,255,15,0,0,0,0,254,31,252,127,0,0,0,192,63,0,0,252,3,0,0,240,3,0,0,224,15,0,0,124,0,0,0,0,62,0,0,31,0,0,0,0,248,0,128,15,0,0,0,0,240,1,224,3,0,255,255,0,192,3,240,0,224,255,255,15,0,15,120,0,252,15,240,63,0,30,60,0,63,0,0,254,0,56,15,192,7,0,0,224,3,112,7,240,1,0,0,128,15,224,14,124,0,0,0,0,30,112,28,30,0,0,0,0,120,120,56,15,0,0,0,0,240,60,240,7,0,0,0,0,192,31,224,1,0,0,0,0,128,15,192,0,0,0,0,0,0,7,64,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,63,0,0,0,0,0,128,255,255,1,0,0,0,0,224,7,224,7,0,0,0,0,248,0,0,31,0,0,0,0,60,0,0,60,0,0,0,0,15,0,0,240,0,0,0,128,7,240,15,224,1,0,0,128,3,254,127,192,3,0,0,128,135,63,254,225,1,0,0,0,239,3,192,243,0,0,0,0,254,0,0,127,0,0,0,0,124,0,0,60,0,0,0,0,24,128,1,24,0,0,0,0,0,252,63,0,0,0,0,0,0,254,127,0,0,0,0,0,128,31,248,1,0,0,0,0,192,3,192,3,0,0,0,0,192,1,128,3,0,0,0,0,128,3,192,1,0,0,0,0,0,7,224,0,0,0,0,0,0,14,112,0,0,0,0,0,0,30,120,0,0,0,0,0,0,60,60,0,0,0,0,0,0,120,30,0,0,0,0,0,0,240,15,0,0,0,0,0,0,224,7,0,0,0,0,0,0,192,3,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,7,224,31,0,0,0,0,62,0,0,126,0,0,0,128,15,0,0,240,1,0,0,224,3,0,0,192,3,0,0,240,0,252,127,0,15,0,0,56,128,255,255,3,28,0,0,28,240,3,192,15,56,0,0,15,124,0,0,62,112,0,0,7,31,0,0,248,224,0,0,142,7,0,0,224,113,0,0,220,1,0,0,128,59,0,0,248,0,0,0,0,31,0,0,112,0,0,0,0,14,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,31,0,0,0,0,0,0,62,124,0,0,0,0,0,128,247,207,1,0,0,0,0,192,255,255,3,0,0,0,0,192,255,255,3,0,0,0,0,192,7,224,1,0,0,0,0,224,3,192,7,0,0,0,0,192,3,192,3,0,0,0,0,128,7,224,1,0,0,0,0,0,15,240,0,0,0,0,0,0,30,120,0,0,0,0,0,0,28,56,0,0,0,0,0,0,56,28,0,0,0,0,0,0,112,14,0,0,0,0,0,0,224,7,0,0,0,0,0,0,192,3,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,63,0,0,0,0,0,0,7,224,0,0,0,0,0,192,225,135,1,0,0,0,0,96,124,63,6,0,0,0,0,48,7,96,12,0,0,0,0,224,251,159,7,0,0,0,0,192,254,127,3,0,0,0,0,0,31,248,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,192,3,192,3,0,0,0,0,128,7,224,1,0,0,0,0,0,15,240,0,0,0,0,0,0,30,120,0,0,0,0,0,0,60,60,0,0,0,0,0,0,120,30,0,0,0,0,0,0,240,15,0,0,0,0,0,0,224,7,0,0,0,0,0,0,192,3,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,31,0,0,0,0,0,0,254,127,0,0,0,0,0,0,63,252,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,192,3,192,3,0,0,0,0,128,7,224,1,0,0,0,0,0,15,240,0,0,0,0,0,0,30,120,0,0,0,0,0,0,60,60,0,0,0,0,0,0,120,30,0,0,0,0,0,0,240,15,0,0,0,0,0,0,224,7,0,0,0,0,0,0,192,3,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,31,0,0,0,0,0,0,254,127,0,0,0,0,0,0,63,252,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,192,3,192,3,0,0,0,0,128,7,224,1,0,0,0,0,0,15,240,0,0,0,0,0,0,30,120,0,0,0,0,0,0,60,60,0,0,0,0,0,0,120,30,0,0,0,0,0,0,240,15,0,0,0,0,0,0,224,7,0,0,0,0,0,0,192,3,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,31,0,0,0,0,0,0,254,127,0,0,0,0,0,0,63,252,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,192,3,192,3,0,0,0,0,128,7,224,1,0,0,0,0,0,15,240,0,0,0,0,0,0,30,120,0,0,0,0,0,0,60,60,0,0,0,0,0,0,120,30,0,0,0,0,0,0,240,15,0,0,0,0,0,0,224,7,0,0,0,0,0,0,192,3,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,31,0,0,0,0,0,0,254,127,0,0,0,0,0,0,63,252,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,192,3,192,3,0,0,0,0,128,7,224,1,0,0,0,0,0,15,240,0,0,0,0,0,0,30,120,0,0,0,0,0,0,60,60,0,0,0,0,0,0,120,30,0,0,0,0,0,0,240,15,0,0,0,0,0,0,224,7,0,0,0,0,0,0,192,3,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,31,0,0,0,0,0,0,254,127,0,0,0,0,0,0,63,252,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,192,3,192,3,0,0,0,0,128,7,224,1,0,0,0,0,0,15,240,0,0,0,0,0,0,30,120,0,0,0,0,0,0,60,60,0,0,0,0,0,0,120,30,0,0,0,0,0,0,240,15,0,0,0,0,0,0,224,7,0,0,0,0,0,0,192,3,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,31,0,0,0,0,0,0,254,127,0,0,0,0,0,0,63,252,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,192,3,192,3,0,0,0,0,128,7,224,1,0,0,0,0,0,15,240,0,0,0,0,0,0,30,120,0,0,0,0,0,0,60,60,0,0,0,0,0,0,120,30,0,0,0,0,0,0,240,15,0,0,0,0,0,0,224,7,0,0,0,0,0,0,192,3,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,31,0,0,0,0,0,0,254,127,0,0,0,0,0,0,63,252,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,192,3,192,3,0,0,0,0,128,7,224,1,0,0,0,0,0,15,240,0,0,0,0,0,0,30,120,0,0,0,0,0,0,60,60,0,0,0,0,0,0,120,30,0,0,0,0,0,0,240,15,0,0,0,0,0,0,224,7,0,0,0,0,0,0,192,3,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,31,0,0,0,0,0,0,254,127,0,0,0,0,0,0,63,252,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,192,3,192,3,0,0,0,0,128,7,224,1,0,0,0,0,0,15,240,0,0,0,0,0,0,30,120,0,0,0,0,0,0,60,60,0,0,0,0,0,0,120,30,0,0,0,0,0,0,240,15,0,0,0,0,0,0,224,7,0,0,0,0,0,0,192,3,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,224,7,0,0,0,0,0,0,252,63,0,0,0,0,0,0,7,224,0,0,0,0,0,128,249,159,1,0,0,0,0,224,254,127,7,0,0,0,0,192,63,252,3,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,192,3,192,3,0,0,0,0,128,7,224,1,0,0,0,0,0,15,240,0,0,0,0,0,0,30,120,0,0,0,0,0,0,60,60,0,0,0,0,0,0,120,30,0,0,0,0,0,0,240,15,0,0,0,0,0,0,224,7,0,0,0,0,0,0,192,3,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,63,0,0,0,0,0,128,255,255,1,0,0,0,0,224,15,248,7,0,0,0,0,248,0,0,31,0,0,0,0,30,0,0,120,0,0,0,0,7,252,63,224,0,0,0,192,131,255,255,193,3,0,0,224,225,7,224,7,7,0,0,240,248,0,0,31,15,0,0,224,60,0,0,60,7,0,0,192,15,0,0,240,3,0,0,128,7,0,0,224,1,0,0,0,3,0,0,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,15,0,0,0,0,0,0,252,63,0,0,0,0,0,0,255,255,0,0,0,0,0,128,31,248,1,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,192,3,192,3,0,0,0,0,128,7,224,1,0,0,0,0,0,15,240,0,0,0,0,0,0,30,120,0,0,0,0,0,0,60,60,0,0,0,0,0,0,120,30,0,0,0,0,0,0,240,15,0,0,0,0,0,0,224,7,0,0,0,0,0,0,192,3,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,31,0,0,0,0,0,192,255,255,3,0,0,0,0,248,255,255,63,0,0,0,0,127,0,0,255,0,0,0,192,15,0,0,240,3,0,0,240,1,0,0,128,15,0,0,124,0,0,0,0,62,0,0,30,0,252,127,0,120,0,0,15,192,255,255,3,224,0,192,3,248,127,254,31,192,1,224,1,254,0,0,127,128,7,240,128,15,0,0,248,1,15,112,192,7,0,0,224,3,14,224,240,1,0,0,128,15,7,192,121,0,0,0,0,158,3,128,63,0,0,0,0,252,1,0,31,0,0,0,0,240,0,0,6,0,0,0,0,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,128,255,255,1,0,0,0,0,224,3,224,7,0,0,0,0,240,0,0,15,0,0,0,0,56,192,7,28,0,0,0,0,28,252,63,56,0,0,0,0,60,255,255,60,0,0,0,0,248,7,240,31,0,0,0,0,240,243,207,15,0,0,0,0,224,252,63,7,0,0,0,0,0,255,255,0,0,0,0,0,128,7,224,1,0,0,0,0,224,3,192,7,0,0,0,0,192,3,192,3,0,0,0,0,128,7,224,1,0,0,0,0,0,15,240,0,0,0,0,0,0,30,120,0,0,0,0,0,0,28,56,0,0,0,0,0,0,56,28,0,0,0,0,0,0,112,14,0,0,0,0,0,0,224,7,0,0,0,0,0,0,192,3,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,255,0,0,0,0,0,240,255,255,15,0,0,0,0,254,31,252,127,0,0,0,192,63,0,0,252,3,0,0,240,3,0,0,224,15,0,0,124,0,0,0,0,62,0,0,31,0,0,0,0,248,0,128,15,0,0,0,0,240,1,224,3,0,255,255,0,192,3,240,0,224,255,255,15,0,15,120,0,252,15,240,63,0,30,60,0,63,0,0,254,0,56,15,192,7,0,0,224,3,112,7,240,1,0,0,128,15,224,14,124,0,0,0,0,30,112,28,30,0,0,0,0,120,120,56,15,0,0,0,0,240,60,240,7,0,0,0,0,192,31,224,1,0,0,0,0,128,15,192,0,0,0,0,0,0,7,64,0,0,248,63,0,0,2,0,0,128,255,255,1,0,0,0,0,224,255,255,7,0,0,0,0,248,1,128,31,0,0,0,0,62,0,0,124,0,0,0,0,15,0,0,240,0,0,0,128,7,0,0,192,1,0,0,224,1,240,31,128,7,0,0,224,1,255,255,0,7,0,0,192,129,255,255,131,3,0,0,128,227,3,192,199,1,0,0,0,255,0,0,255,1,0,0,0,62,0,0,252,0,0,0,0,28,0,0,120,0,0,0,0,8,0,0,16,0,0,0,0,0,128,1,0,0,0,0,0,0,252,63,0,0,0,0,0,0,254,127,0,0,0,0,0,128,31,248,1,0,0,0,0,192,3,192,3,0,0,0,0,192,1,128,3,0,0,0,0,128,3,192,1,0,0,0,0,0,7,224,0,0,0,0,0,0,14,112,0,0,0,0,0,0,30,120,0,0,0,0,0,0,60,60,0,0,0,0,0,0,120,30,0,0,0,0,0,0,240,15,0,0,0,0,0,0,224,7,0,0,0,0,0,0,192,3,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,3,0,0,0,0,0,192,255,255,3,0,0,0,0,248,255,255,31,0,0,0,0,255,0,128,255,1,0,0,224,15,0,0,248,7,0,0,240,1,0,0,128,31,0,0,124,0,0,0,0,62,0,0,31,0,0,0,0,248,0,192,7,0,240,31,0,224,3,224,1,128,255,255,3,128,7,240,0,248,255,255,31,0,15,120,0,254,0,0,127,0,28,30,128,15,0,0,248,1,120,15,224,3,0,0,192,7,240,14,248,0,0,0,0,31,240,28,60,0,192,7,0,60,120,56,30,0,255,255,0,112,60,240,7,224,255,255,7,224,30,240,3,248,1,192,31,192,15,224,1,62,0,0,124,128,7,192,128,15,0,0,240,1,2,0,192,3,0,0,192,3,0,0,224,1,0,0,0,7,0,0,120,0,240,15,0,14,0,0,56,0,254,255,0,28,0,0,120,192,255,255,3,30,0,0,240,240,3,192,15,15,0,0,224,249,0,0,159,7,0,0,192,63,0,0,252,3,0,0,128,15,0,0,240,1,0,0,0,7,0,0,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,15,0,0,0,0,0,0,254,127,0,0,0,0,0,0,127,254,0,0,0,0,0,128,7,224,1,0,0,0,0,224,1,128,7,0,0,0,0,192,3,192,3,0,0,0,0,128,7,224,1,0,0,0,0,0,15,240,0,0,0,0,0,0,30,120,0,0,0,0,0,0,60,60,0,0,0,0,0,0,120,30,0,0,0,0,0,0,112,14,0,0,0,0,0,0,224,7,0,0,0,0,0,0,192,3,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,127,0,0,0,0,0,224,255,255,15,0,0,0,0,254,63,252,127,0,0,0,128,63,0,0,252,3,0,0,224,7,0,0,224,7,0,0,248,0,0,0,0,31,0,0,62,0,0,0,0,124,0,128,15,0,0,0,0,240,1,192,3,0,255,255,0,192,3,224,1,224,255,255,15,0,7,120,0,252,3,224,63,0,14,60,0,63,0,0,252,0,60,30,192,7,0,0,224,3,120,14,240,1,0,0,128,15,240,28,120,0,254,255,0,30,120,60,30,224,255,255,7,120,60,120,15,248,3,224,31,240,30,240,7,126,0,0,126,224,15,224,3,15,0,0,240,128,7,192,192,7,0,0,192,3,3,0,224,1,0,0,128,7,0,0,240,0,192,7,0,15,0,0,120,0,254,127,0,30,0,0,112,128,255,255,1,30,0,0,224,224,3,224,7,15,0,0,224,249,0,0,159,7,0,0,192,63,0,0,252,3,0,0,128,31,0,0,240,1,0,0,0,7,0,0,224,0,0,0,0,2,224,7,64,0,0,0,0,0,252,63,0,0,0,0,0,0,255,255,0,0,0,0,0,128,15,240,1,0,0,0,0,192,3,192,3,0,0,0,0,192,1,128,3,0,0,0,0,128,3,192,1,0,0,0,0,0,7,224,0,0,0,0,0,0,14,112,0,0,0,0,0,0,28,56,0,0,0,0,0,0,56,28,0,0,0,0,0,0,112,14,0,0,0,0,0,0,224,7,0,0,0,0,0,0,192,3,0,0,0,0,0,0,128,1,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,63,0,0,0,0,0,224,255,255,7,0,0,0,0,252,127,255,127,0,0,0,128,63,0,0,254,1,0,0,224,7,0,0,224,7,0,0,248,0,0,0,0,31,0,0,62,0,0,0,0,124,0,128,15,0,0,0,0,240,1,192,3,0,254,255,0,192,3,224,1,224,255,255,7,0,7,112,0,252,15,240,63,0,14,60,0,63,0,0,254,0,60,30,192,7,0,0,224,3,120,15,240,1,0,0,128,15,240,30,120,0,0,0,0,30,120,60,28,0,254,255,0,56,60,120,15,224,255,255,7,240,30,240,7,248,3,192,31,224,15,224,3,126,0,0,126,128,7,192,0,15,0,0,240,0,3,0,192,7,0,0,192,3,0,0,224,1,0,0,128,7,0,0,240,0,224,15,0,15,0,0,120,0,254,255,0,30,0,0,112,128,255,255,3,14,0,0,224,224,3,192,7,7,0,0,192,249,0,0,159,3,0,0,128,63,0,0,252,1,0,0,0,31,0,0,240,0,0,0,0,6,128,1,224,0,0,0,0,0,248,31,0,0,0,0,0,0,254,127,0,0,0,0,0,128,31,248,1,0,0,0,0,192,3,192,3,0,0,0,0,192,1,128,3,0,0,0,0,128,3,192,1,0,0,0,0,0,7,224,0,0,0,0,0,0,15,240,0,0,0,0,0,0,30,120,0,0,0,0,0,0,60,60,0,0,0,0,0,0,120,30,0,0,0,0,0,0,240,15,0,0,0,0,0,0,224,7,0,0,0,0,0,0,192,3,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,63,0,0,0,0,0,224,255,255,7,0,0,0,0,252,127,255,127,0,0,0,128,63,0,0,254,1,0,0,224,7,0,0,224,7,0,0,248,0,0,0,0,31,0,0,62,0,0,0,0,124,0,128,15,0,0,0,0,240,1,192,3,0,254,255,0,192,3,224,1,224,255,255,7,0,7,112,0,252,15,240,63,0,14,60,0,63,0,0,254,0,60,30,192,7,0,0,224,3,120,15,240,1,0,0,128,15,240,30,120,0,0,0,0,30,120,60,28,0,0,0,0,56,60,120,15,0,254,255,0,240,30,240,7,224,255,255,7,224,15,224,3,248,3,192,31,128,7,192,0,62,0,0,126,0,3,0,0,15,0,0,240,0,0,0,192,3,0,0,192,3,0,0,224,1,0,0,128,7,0,0,240,0,240,15,0,14,0,0,120,0,254,255,0,30,0,0,112,192,255,255,3,14,0,0,224,240,3,192,15,7,0,0,192,121,0,0,158,3,0,0,128,63,0,0,252,1,0,0,0,15,0,0,240,0,0,0,0,6,0,0,96,0,0,0,0,0,248,31,0,0,0,0,0,0,254,127,0,0,0,0,0,0,63,252,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,192,3,192,3,0,0,0,0,128,7,224,1,0,0,0,0,0,15,240,0,0,0,0,0,0,30,120,0,0,0,0,0,0,60,60,0,0,0,0,0,0,120,30,0,0,0,0,0,0,240,15,0,0,0,0,0,0,224,7,0,0,0,0,0,0,192,3,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,63,0,0,0,0,0,224,255,255,7,0,0,0,0,252,127,255,127,0,0,0,128,63,0,0,254,1,0,0,224,7,0,0,224,7,0,0,248,0,0,0,0,31,0,0,62,0,0,0,0,124,0,128,15,0,0,0,0,240,1,192,3,0,254,255,0,192,3,224,1,224,255,255,7,0,7,112,0,252,15,240,63,0,14,60,0,63,0,0,254,0,60,30,192,7,0,0,224,3,120,15,240,1,0,0,128,15,240,30,120,0,0,0,0,30,120,60,28,0,0,0,0,56,60,120,15,0,254,255,0,240,30,240,7,224,255,255,7,224,15,224,3,248,3,192,31,128,7,192,0,62,0,0,126,0,3,0,0,15,0,0,240,0,0,0,192,3,0,0,192,3,0,0,224,1,0,0,128,7,0,0,240,0,240,15,0,14,0,0,120,0,254,255,0,30,0,0,112,192,255,255,3,14,0,0,224,240,3,192,15,7,0,0,192,121,0,0,158,3,0,0,128,63,0,0,252,1,0,0,0,15,0,0,240,0,0,0,0,6,0,0,96,0,0,0,0,0,248,31,0,0,0,0,0,0,254,127,0,0,0,0,0,0,63,252,0,0,0,0,0,192,7,224,3,0,0,0,0,224,1,128,7,0,0,0,0,192,3,192,3,0,0,0,0,128,7,224,1,0,0,0,0,0,15,240,0,0,0,0,0,0,30,120,0,0,0,0,0,0,60,60,0,0,0,0,0,0,120,30,0,0,0,0,0,0,240,15,0,0,0,0,0,0,224,7,0,0,0,0,0,0,192,3,0,0,0,0,0,0,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    };
-
-static const unsigned char info[][BITMAP_LENGTH] = {
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,192,3,0,240,0,0,7,0,224,7,0,224,0,128,3,0,240,15,0,192,1,128,1,0,240,15,0,128,1,192,1,0,240,15,0,128,3,224,0,0,224,7,0,0,7,224,0,0,224,7,0,0,7,96,0,0,128,1,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,56,0,0,248,3,0,0,28,24,0,0,248,3,0,0,24,24,0,0,224,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,56,0,0,192,3,0,0,28,56,0,0,192,3,0,0,28,56,0,0,192,3,0,0,28,48,0,0,192,3,0,0,12,112,0,0,192,3,0,0,14,112,0,0,192,3,0,0,14,96,0,0,192,3,0,0,6,224,0,0,192,3,0,0,7,224,0,0,192,3,0,0,7,192,1,0,192,3,0,128,3,128,1,0,248,31,0,128,1,128,3,0,248,31,0,192,1,0,7,0,248,31,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,192,3,0,240,0,0,7,0,224,7,0,224,0,128,3,0,240,15,0,192,1,128,1,0,240,15,0,128,1,192,1,0,240,15,0,128,3,224,0,0,224,7,0,0,7,224,0,0,224,7,0,0,7,96,0,0,128,1,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,56,0,0,248,3,0,0,28,24,0,0,248,3,0,0,24,24,0,0,224,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,56,0,0,192,3,0,0,28,56,0,0,192,3,0,0,28,56,0,0,192,3,0,0,28,48,0,0,192,3,0,0,12,112,0,0,192,3,0,0,14,112,0,0,192,3,0,0,14,96,0,0,192,3,0,0,6,224,0,0,192,3,0,0,7,224,0,0,192,3,0,0,7,192,1,0,192,3,0,128,3,128,1,0,248,31,0,128,1,128,3,0,248,31,0,192,1,0,7,0,248,31,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,192,3,0,240,0,0,7,0,224,7,0,224,0,128,3,0,240,15,0,192,1,128,1,0,240,15,0,128,1,192,1,0,240,15,0,128,3,224,0,0,224,7,0,0,7,224,0,0,224,7,0,0,7,96,0,0,128,1,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,56,0,0,248,3,0,0,28,24,0,0,248,3,0,0,24,24,0,0,224,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,56,0,0,192,3,0,0,28,56,0,0,192,3,0,0,28,56,0,0,192,3,0,0,28,48,0,0,192,3,0,0,12,112,0,0,192,3,0,0,14,112,0,0,192,3,0,0,14,96,0,0,192,3,0,0,6,224,0,0,192,3,0,0,7,224,0,0,192,3,0,0,7,192,1,0,192,3,0,128,3,128,1,0,248,31,0,128,1,128,3,0,248,31,0,192,1,0,7,0,248,31,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,192,3,0,240,0,0,7,0,224,7,0,224,0,128,3,0,240,15,0,192,1,128,1,0,240,15,0,128,1,192,1,0,240,15,0,128,3,224,0,0,224,7,0,0,7,224,0,0,224,7,0,0,7,96,0,0,128,1,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,56,0,0,248,3,0,0,28,24,0,0,248,3,0,0,24,24,0,0,224,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,56,0,0,192,3,0,0,28,56,0,0,192,3,0,0,28,56,0,0,192,3,0,0,28,48,0,0,192,3,0,0,12,112,0,0,192,3,0,0,14,112,0,0,192,3,0,0,14,96,0,0,192,3,0,0,6,224,0,0,192,3,0,0,7,224,0,0,192,3,0,0,7,192,1,0,192,3,0,128,3,128,1,0,248,31,0,128,1,128,3,0,248,31,0,192,1,0,7,0,248,31,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,192,3,0,240,0,0,7,0,224,7,0,224,0,128,3,0,240,15,0,192,1,128,1,0,240,15,0,128,1,192,1,0,240,15,0,128,3,224,0,0,224,7,0,0,7,224,0,0,224,7,0,0,7,96,0,0,128,1,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,56,0,0,248,7,0,0,28,24,0,0,248,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,56,0,0,224,7,0,0,28,56,0,0,224,7,0,0,28,56,0,0,224,7,0,0,28,48,0,0,224,7,0,0,12,112,0,0,224,7,0,0,14,112,0,0,224,7,0,0,14,96,0,0,224,7,0,0,6,224,0,0,224,7,0,0,7,224,0,0,224,7,0,0,7,192,1,0,224,7,0,128,3,128,1,0,248,31,0,128,1,128,3,0,248,31,0,192,1,0,7,0,248,31,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,128,1,0,120,0,0,15,0,224,7,0,240,0,0,7,0,240,15,0,224,0,128,3,0,240,15,0,192,1,128,1,0,240,15,0,128,1,192,1,0,240,15,0,128,3,224,0,0,224,7,0,0,7,224,0,0,192,3,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,56,0,0,248,7,0,0,28,24,0,0,248,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,56,0,0,224,7,0,0,28,56,0,0,224,7,0,0,28,56,0,0,224,7,0,0,28,48,0,0,224,7,0,0,12,112,0,0,224,7,0,0,14,112,0,0,224,7,0,0,14,96,0,0,224,7,0,0,6,224,0,0,224,7,0,0,7,224,0,0,224,7,0,0,7,192,1,0,224,7,0,128,3,128,1,0,224,7,0,128,1,128,3,0,248,31,0,192,1,0,7,0,248,31,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,224,7,0,120,0,0,15,0,224,7,0,240,0,0,7,0,240,15,0,224,0,128,3,0,240,15,0,192,1,128,1,0,240,15,0,128,1,192,1,0,240,15,0,128,3,224,0,0,224,7,0,0,7,224,0,0,192,3,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,56,0,0,248,7,0,0,28,24,0,0,248,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,56,0,0,224,7,0,0,28,56,0,0,224,7,0,0,28,56,0,0,224,7,0,0,28,48,0,0,224,7,0,0,12,112,0,0,224,7,0,0,14,112,0,0,224,7,0,0,14,96,0,0,224,7,0,0,6,224,0,0,224,7,0,0,7,224,0,0,224,7,0,0,7,192,1,0,224,7,0,128,3,128,1,0,224,7,0,128,1,128,3,0,248,31,0,192,1,0,7,0,248,31,0,224,0,0,15,0,248,31,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,128,1,0,60,0,0,30,0,224,7,0,120,0,0,15,0,240,15,0,240,0,0,7,0,240,15,0,224,0,128,3,0,240,15,0,192,1,128,1,0,240,15,0,128,1,192,1,0,240,15,0,128,3,224,0,0,224,7,0,0,7,224,0,0,128,1,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,248,3,0,0,28,56,0,0,252,7,0,0,28,24,0,0,252,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,56,0,0,224,7,0,0,28,56,0,0,224,7,0,0,28,56,0,0,224,7,0,0,28,48,0,0,224,7,0,0,12,112,0,0,224,7,0,0,14,112,0,0,224,7,0,0,14,96,0,0,224,7,0,0,6,224,0,0,224,7,0,0,7,224,0,0,224,7,0,0,7,192,1,0,224,7,0,128,3,128,1,0,224,7,0,128,1,128,3,0,224,7,0,192,1,0,7,0,252,63,0,224,0,0,15,0,252,63,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,3,0,60,0,0,30,0,192,15,0,120,0,0,15,0,224,31,0,240,0,0,7,0,224,31,0,224,0,128,3,0,224,31,0,192,1,128,1,0,224,31,0,128,1,192,1,0,224,31,0,128,3,224,0,0,192,15,0,0,7,224,0,0,0,3,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,240,7,0,0,28,56,0,0,248,15,0,0,28,24,0,0,248,15,0,0,24,24,0,0,192,15,0,0,24,24,0,0,192,15,0,0,24,24,0,0,192,15,0,0,24,24,0,0,192,7,0,0,24,24,0,0,192,7,0,0,24,24,0,0,192,7,0,0,24,24,0,0,192,7,0,0,24,56,0,0,192,7,0,0,28,56,0,0,192,7,0,0,28,56,0,0,192,7,0,0,28,48,0,0,192,7,0,0,12,112,0,0,192,7,0,0,14,112,0,0,192,7,0,0,14,96,0,0,192,7,0,0,6,224,0,0,192,7,0,0,7,224,0,0,192,7,0,0,7,192,1,0,192,7,0,128,3,128,1,0,192,7,0,128,1,128,3,0,248,15,0,192,1,0,7,0,248,63,0,224,0,0,15,0,248,63,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,12,0,60,0,0,30,0,0,63,0,120,0,0,15,0,0,127,0,240,0,0,7,0,128,127,0,224,0,128,3,0,128,127,0,192,1,128,1,0,128,127,0,128,1,192,1,0,128,127,0,128,3,224,0,0,0,63,0,0,7,224,0,0,0,12,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,224,7,0,0,28,56,0,0,224,31,0,0,28,24,0,0,224,31,0,0,24,24,0,0,0,31,0,0,24,24,0,0,128,31,0,0,24,24,0,0,128,31,0,0,24,24,0,0,128,31,0,0,24,24,0,0,128,31,0,0,24,24,0,0,128,31,0,0,24,24,0,0,128,31,0,0,24,56,0,0,128,31,0,0,28,56,0,0,128,31,0,0,28,56,0,0,128,15,0,0,28,48,0,0,128,15,0,0,12,112,0,0,128,15,0,0,14,112,0,0,128,15,0,0,14,96,0,0,128,15,0,0,6,224,0,0,128,15,0,0,7,224,0,0,128,15,0,0,7,192,1,0,128,15,0,128,3,128,1,0,192,15,0,128,1,128,3,0,240,15,0,192,1,0,7,0,240,127,0,224,0,0,15,0,248,127,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,16,0,60,0,0,30,0,0,126,0,120,0,0,15,0,0,254,0,240,0,0,7,0,0,255,0,224,0,128,3,0,0,255,0,192,1,128,1,0,0,255,0,128,1,192,1,0,0,254,0,128,3,224,0,0,0,126,0,0,7,224,0,0,0,24,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,192,15,0,0,28,56,0,0,192,63,0,0,28,24,0,0,192,63,0,0,24,24,0,0,0,63,0,0,24,24,0,0,0,63,0,0,24,24,0,0,0,63,0,0,24,24,0,0,0,63,0,0,24,24,0,0,0,31,0,0,24,24,0,0,0,31,0,0,24,24,0,0,0,31,0,0,24,56,0,0,0,31,0,0,28,56,0,0,0,31,0,0,28,56,0,0,0,31,0,0,28,48,0,0,128,31,0,0,12,112,0,0,128,31,0,0,14,112,0,0,128,31,0,0,14,96,0,0,128,31,0,0,6,224,0,0,128,31,0,0,7,224,0,0,128,31,0,0,7,192,1,0,128,15,0,128,3,128,1,0,128,15,0,128,1,128,3,0,240,15,0,192,1,0,7,0,240,127,0,224,0,0,15,0,240,127,0,240,0,0,30,0,0,96,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,12,0,60,0,0,30,0,0,63,0,120,0,0,15,0,0,127,0,240,0,0,7,0,128,127,0,224,0,128,3,0,128,127,0,192,1,128,1,0,128,127,0,128,1,192,1,0,0,127,0,128,3,224,0,0,0,63,0,0,7,224,0,0,0,12,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,224,7,0,0,28,56,0,0,224,31,0,0,28,24,0,0,224,31,0,0,24,24,0,0,0,31,0,0,24,24,0,0,0,31,0,0,24,24,0,0,0,31,0,0,24,24,0,0,128,31,0,0,24,24,0,0,128,31,0,0,24,24,0,0,128,31,0,0,24,24,0,0,128,31,0,0,24,56,0,0,128,31,0,0,28,56,0,0,128,31,0,0,28,56,0,0,128,31,0,0,28,48,0,0,128,31,0,0,12,112,0,0,128,15,0,0,14,112,0,0,128,15,0,0,14,96,0,0,128,15,0,0,6,224,0,0,128,15,0,0,7,224,0,0,128,15,0,0,7,192,1,0,128,15,0,128,3,128,1,0,128,15,0,128,1,128,3,0,240,15,0,192,1,0,7,0,240,127,0,224,0,0,15,0,240,127,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,3,0,60,0,0,30,0,192,15,0,120,0,0,15,0,224,15,0,240,0,0,7,0,224,31,0,224,0,128,3,0,224,31,0,192,1,128,1,0,224,31,0,128,1,192,1,0,224,15,0,128,3,224,0,0,192,15,0,0,7,224,0,0,0,3,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,240,7,0,0,28,56,0,0,248,15,0,0,28,24,0,0,248,15,0,0,24,24,0,0,192,15,0,0,24,24,0,0,192,15,0,0,24,24,0,0,192,15,0,0,24,24,0,0,192,15,0,0,24,24,0,0,192,15,0,0,24,24,0,0,192,15,0,0,24,24,0,0,192,15,0,0,24,56,0,0,192,15,0,0,28,56,0,0,192,15,0,0,28,56,0,0,192,15,0,0,28,48,0,0,192,15,0,0,12,112,0,0,192,15,0,0,14,112,0,0,192,15,0,0,14,96,0,0,192,15,0,0,6,224,0,0,192,15,0,0,7,224,0,0,192,15,0,0,7,192,1,0,192,15,0,128,3,128,1,0,192,15,0,128,1,128,3,0,192,15,0,192,1,0,7,0,248,63,0,224,0,0,15,0,248,63,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,96,0,0,60,0,0,30,0,240,1,0,120,0,0,15,0,248,3,0,240,0,0,7,0,252,3,0,224,0,128,3,0,252,7,0,192,1,128,1,0,252,3,0,128,1,192,1,0,248,3,0,128,3,224,0,0,248,1,0,0,7,224,0,0,224,0,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,192,3,0,0,28,56,0,0,254,3,0,0,28,24,0,0,252,3,0,0,24,24,0,0,240,3,0,0,24,24,0,0,240,3,0,0,24,24,0,0,224,3,0,0,24,24,0,0,224,3,0,0,24,24,0,0,224,3,0,0,24,24,0,0,224,3,0,0,24,24,0,0,224,3,0,0,24,56,0,0,224,3,0,0,28,56,0,0,224,3,0,0,28,56,0,0,224,7,0,0,28,48,0,0,224,7,0,0,12,112,0,0,224,7,0,0,14,112,0,0,224,7,0,0,14,96,0,0,224,7,0,0,6,224,0,0,224,7,0,0,7,224,0,0,224,7,0,0,7,192,1,0,224,7,0,128,3,128,1,0,224,7,0,128,1,128,3,0,224,63,0,192,1,0,7,0,248,63,0,224,0,0,15,0,248,63,0,240,0,0,30,0,8,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,48,0,0,60,0,0,30,0,248,0,0,120,0,0,15,0,252,1,0,240,0,0,7,0,254,1,0,224,0,128,3,0,254,3,0,192,1,128,1,0,254,1,0,128,1,192,1,0,252,1,0,128,3,224,0,0,252,0,0,0,7,224,0,0,112,0,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,192,1,0,0,28,56,0,0,254,1,0,0,28,24,0,0,254,1,0,0,24,24,0,0,250,1,0,0,24,24,0,0,240,1,0,0,24,24,0,0,240,1,0,0,24,24,0,0,240,3,0,0,24,24,0,0,240,3,0,0,24,24,0,0,240,3,0,0,24,24,0,0,240,3,0,0,24,56,0,0,240,3,0,0,28,56,0,0,240,3,0,0,28,56,0,0,240,3,0,0,28,48,0,0,224,3,0,0,12,112,0,0,224,3,0,0,14,112,0,0,224,3,0,0,14,96,0,0,224,3,0,0,6,224,0,0,224,7,0,0,7,224,0,0,224,7,0,0,7,192,1,0,224,7,0,128,3,128,1,0,224,7,0,128,1,128,3,0,224,63,0,192,1,0,7,0,248,63,0,224,0,0,15,0,248,63,0,240,0,0,30,0,24,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,96,0,0,60,0,0,30,0,240,1,0,120,0,0,15,0,248,3,0,240,0,0,7,0,252,3,0,224,0,128,3,0,252,7,0,192,1,128,1,0,252,3,0,128,1,192,1,0,248,3,0,128,3,224,0,0,248,1,0,0,7,224,0,0,224,0,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,192,3,0,0,28,56,0,0,254,3,0,0,28,24,0,0,252,3,0,0,24,24,0,0,240,3,0,0,24,24,0,0,240,3,0,0,24,24,0,0,224,3,0,0,24,24,0,0,224,3,0,0,24,24,0,0,224,3,0,0,24,24,0,0,224,3,0,0,24,24,0,0,224,3,0,0,24,56,0,0,224,3,0,0,28,56,0,0,224,3,0,0,28,56,0,0,224,7,0,0,28,48,0,0,224,7,0,0,12,112,0,0,224,7,0,0,14,112,0,0,224,7,0,0,14,96,0,0,224,7,0,0,6,224,0,0,224,7,0,0,7,224,0,0,224,7,0,0,7,192,1,0,224,7,0,128,3,128,1,0,224,7,0,128,1,128,3,0,224,63,0,192,1,0,7,0,248,63,0,224,0,0,15,0,248,63,0,240,0,0,30,0,8,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,3,0,60,0,0,30,0,192,15,0,120,0,0,15,0,224,15,0,240,0,0,7,0,224,31,0,224,0,128,3,0,224,31,0,192,1,128,1,0,224,31,0,128,1,192,1,0,224,15,0,128,3,224,0,0,192,15,0,0,7,224,0,0,0,3,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,240,7,0,0,28,56,0,0,248,15,0,0,28,24,0,0,248,15,0,0,24,24,0,0,192,15,0,0,24,24,0,0,192,15,0,0,24,24,0,0,192,15,0,0,24,24,0,0,192,15,0,0,24,24,0,0,192,15,0,0,24,24,0,0,192,15,0,0,24,24,0,0,192,15,0,0,24,56,0,0,192,15,0,0,28,56,0,0,192,15,0,0,28,56,0,0,192,15,0,0,28,48,0,0,192,15,0,0,12,112,0,0,192,15,0,0,14,112,0,0,192,15,0,0,14,96,0,0,192,15,0,0,6,224,0,0,192,15,0,0,7,224,0,0,192,15,0,0,7,192,1,0,192,15,0,128,3,128,1,0,192,15,0,128,1,128,3,0,192,15,0,192,1,0,7,0,248,63,0,224,0,0,15,0,248,63,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,12,0,60,0,0,30,0,0,63,0,120,0,0,15,0,0,127,0,240,0,0,7,0,128,127,0,224,0,128,3,0,128,127,0,192,1,128,1,0,128,127,0,128,1,192,1,0,0,127,0,128,3,224,0,0,0,63,0,0,7,224,0,0,0,12,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,224,7,0,0,28,56,0,0,224,31,0,0,28,24,0,0,224,31,0,0,24,24,0,0,0,31,0,0,24,24,0,0,0,31,0,0,24,24,0,0,0,31,0,0,24,24,0,0,128,31,0,0,24,24,0,0,128,31,0,0,24,24,0,0,128,31,0,0,24,24,0,0,128,31,0,0,24,56,0,0,128,31,0,0,28,56,0,0,128,31,0,0,28,56,0,0,128,31,0,0,28,48,0,0,128,31,0,0,12,112,0,0,128,15,0,0,14,112,0,0,128,15,0,0,14,96,0,0,128,15,0,0,6,224,0,0,128,15,0,0,7,224,0,0,128,15,0,0,7,192,1,0,128,15,0,128,3,128,1,0,128,15,0,128,1,128,3,0,240,15,0,192,1,0,7,0,240,127,0,224,0,0,15,0,240,127,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,16,0,60,0,0,30,0,0,126,0,120,0,0,15,0,0,254,0,240,0,0,7,0,0,255,0,224,0,128,3,0,0,255,0,192,1,128,1,0,0,255,0,128,1,192,1,0,0,254,0,128,3,224,0,0,0,126,0,0,7,224,0,0,0,24,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,192,15,0,0,28,56,0,0,192,63,0,0,28,24,0,0,192,63,0,0,24,24,0,0,0,63,0,0,24,24,0,0,0,63,0,0,24,24,0,0,0,63,0,0,24,24,0,0,0,63,0,0,24,24,0,0,0,31,0,0,24,24,0,0,0,31,0,0,24,24,0,0,0,31,0,0,24,56,0,0,0,31,0,0,28,56,0,0,0,31,0,0,28,56,0,0,0,31,0,0,28,48,0,0,128,31,0,0,12,112,0,0,128,31,0,0,14,112,0,0,128,31,0,0,14,96,0,0,128,31,0,0,6,224,0,0,128,31,0,0,7,224,0,0,128,31,0,0,7,192,1,0,128,15,0,128,3,128,1,0,128,15,0,128,1,128,3,0,240,15,0,192,1,0,7,0,240,127,0,224,0,0,15,0,240,127,0,240,0,0,30,0,0,96,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,12,0,60,0,0,30,0,0,63,0,120,0,0,15,0,0,127,0,240,0,0,7,0,128,127,0,224,0,128,3,0,128,127,0,192,1,128,1,0,128,127,0,128,1,192,1,0,128,127,0,128,3,224,0,0,0,63,0,0,7,224,0,0,0,12,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,224,7,0,0,28,56,0,0,224,31,0,0,28,24,0,0,224,31,0,0,24,24,0,0,0,31,0,0,24,24,0,0,128,31,0,0,24,24,0,0,128,31,0,0,24,24,0,0,128,31,0,0,24,24,0,0,128,31,0,0,24,24,0,0,128,31,0,0,24,24,0,0,128,31,0,0,24,56,0,0,128,31,0,0,28,56,0,0,128,31,0,0,28,56,0,0,128,15,0,0,28,48,0,0,128,15,0,0,12,112,0,0,128,15,0,0,14,112,0,0,128,15,0,0,14,96,0,0,128,15,0,0,6,224,0,0,128,15,0,0,7,224,0,0,128,15,0,0,7,192,1,0,128,15,0,128,3,128,1,0,192,15,0,128,1,128,3,0,240,15,0,192,1,0,7,0,240,127,0,224,0,0,15,0,248,127,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,3,0,60,0,0,30,0,192,15,0,120,0,0,15,0,224,31,0,240,0,0,7,0,224,31,0,224,0,128,3,0,224,31,0,192,1,128,1,0,224,31,0,128,1,192,1,0,224,31,0,128,3,224,0,0,192,15,0,0,7,224,0,0,0,3,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,240,7,0,0,28,56,0,0,248,15,0,0,28,24,0,0,248,15,0,0,24,24,0,0,192,15,0,0,24,24,0,0,192,15,0,0,24,24,0,0,192,15,0,0,24,24,0,0,192,7,0,0,24,24,0,0,192,7,0,0,24,24,0,0,192,7,0,0,24,24,0,0,192,7,0,0,24,56,0,0,192,7,0,0,28,56,0,0,192,7,0,0,28,56,0,0,192,7,0,0,28,48,0,0,192,7,0,0,12,112,0,0,192,7,0,0,14,112,0,0,192,7,0,0,14,96,0,0,192,7,0,0,6,224,0,0,192,7,0,0,7,224,0,0,192,7,0,0,7,192,1,0,192,7,0,128,3,128,1,0,192,7,0,128,1,128,3,0,248,15,0,192,1,0,7,0,248,63,0,224,0,0,15,0,248,63,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,128,1,0,60,0,0,30,0,224,7,0,120,0,0,15,0,240,15,0,240,0,0,7,0,240,15,0,224,0,128,3,0,240,15,0,192,1,128,1,0,240,15,0,128,1,192,1,0,240,15,0,128,3,224,0,0,224,7,0,0,7,224,0,0,128,1,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,248,3,0,0,28,56,0,0,252,7,0,0,28,24,0,0,252,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,56,0,0,224,7,0,0,28,56,0,0,224,7,0,0,28,56,0,0,224,7,0,0,28,48,0,0,224,7,0,0,12,112,0,0,224,7,0,0,14,112,0,0,224,7,0,0,14,96,0,0,224,7,0,0,6,224,0,0,224,7,0,0,7,224,0,0,224,7,0,0,7,192,1,0,224,7,0,128,3,128,1,0,224,7,0,128,1,128,3,0,224,7,0,192,1,0,7,0,252,63,0,224,0,0,15,0,252,63,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,224,7,0,120,0,0,15,0,224,7,0,240,0,0,7,0,240,15,0,224,0,128,3,0,240,15,0,192,1,128,1,0,240,15,0,128,1,192,1,0,240,15,0,128,3,224,0,0,224,7,0,0,7,224,0,0,192,3,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,56,0,0,248,7,0,0,28,24,0,0,248,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,56,0,0,224,7,0,0,28,56,0,0,224,7,0,0,28,56,0,0,224,7,0,0,28,48,0,0,224,7,0,0,12,112,0,0,224,7,0,0,14,112,0,0,224,7,0,0,14,96,0,0,224,7,0,0,6,224,0,0,224,7,0,0,7,224,0,0,224,7,0,0,7,192,1,0,224,7,0,128,3,128,1,0,224,7,0,128,1,128,3,0,248,31,0,192,1,0,7,0,248,31,0,224,0,0,15,0,248,31,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,128,1,0,120,0,0,15,0,224,7,0,240,0,0,7,0,240,15,0,224,0,128,3,0,240,15,0,192,1,128,1,0,240,15,0,128,1,192,1,0,240,15,0,128,3,224,0,0,224,7,0,0,7,224,0,0,192,3,0,0,7,96,0,0,0,0,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,56,0,0,248,7,0,0,28,24,0,0,248,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,56,0,0,224,7,0,0,28,56,0,0,224,7,0,0,28,56,0,0,224,7,0,0,28,48,0,0,224,7,0,0,12,112,0,0,224,7,0,0,14,112,0,0,224,7,0,0,14,96,0,0,224,7,0,0,6,224,0,0,224,7,0,0,7,224,0,0,224,7,0,0,7,192,1,0,224,7,0,128,3,128,1,0,224,7,0,128,1,128,3,0,248,31,0,192,1,0,7,0,248,31,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,192,3,0,240,0,0,7,0,224,7,0,224,0,128,3,0,240,15,0,192,1,128,1,0,240,15,0,128,1,192,1,0,240,15,0,128,3,224,0,0,224,7,0,0,7,224,0,0,224,7,0,0,7,96,0,0,128,1,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,56,0,0,248,7,0,0,28,24,0,0,248,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,24,0,0,224,7,0,0,24,56,0,0,224,7,0,0,28,56,0,0,224,7,0,0,28,56,0,0,224,7,0,0,28,48,0,0,224,7,0,0,12,112,0,0,224,7,0,0,14,112,0,0,224,7,0,0,14,96,0,0,224,7,0,0,6,224,0,0,224,7,0,0,7,224,0,0,224,7,0,0,7,192,1,0,224,7,0,128,3,128,1,0,248,31,0,128,1,128,3,0,248,31,0,192,1,0,7,0,248,31,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,192,3,0,240,0,0,7,0,224,7,0,224,0,128,3,0,240,15,0,192,1,128,1,0,240,15,0,128,1,192,1,0,240,15,0,128,3,224,0,0,224,7,0,0,7,224,0,0,224,7,0,0,7,96,0,0,128,1,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,56,0,0,248,3,0,0,28,24,0,0,248,3,0,0,24,24,0,0,224,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,56,0,0,192,3,0,0,28,56,0,0,192,3,0,0,28,56,0,0,192,3,0,0,28,48,0,0,192,3,0,0,12,112,0,0,192,3,0,0,14,112,0,0,192,3,0,0,14,96,0,0,192,3,0,0,6,224,0,0,192,3,0,0,7,224,0,0,192,3,0,0,7,192,1,0,192,3,0,128,3,128,1,0,248,31,0,128,1,128,3,0,248,31,0,192,1,0,7,0,248,31,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,127,0,0,0,0,0,192,255,255,3,0,0,0,0,248,15,240,31,0,0,0,0,252,0,0,63,0,0,0,0,31,0,0,248,0,0,0,192,7,0,0,224,3,0,0,224,1,0,0,128,7,0,0,240,0,0,0,0,15,0,0,120,0,0,0,0,30,0,0,60,0,0,0,0,60,0,0,30,0,0,0,0,120,0,0,15,0,192,3,0,240,0,0,7,0,224,7,0,224,0,128,3,0,240,15,0,192,1,128,1,0,240,15,0,128,1,192,1,0,240,15,0,128,3,224,0,0,224,7,0,0,7,224,0,0,224,7,0,0,7,96,0,0,128,1,0,0,6,112,0,0,0,0,0,0,14,112,0,0,0,0,0,0,14,48,0,0,0,0,0,0,12,56,0,0,0,0,0,0,28,56,0,0,0,0,0,0,28,56,0,0,248,3,0,0,28,24,0,0,248,3,0,0,24,24,0,0,224,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,24,0,0,192,3,0,0,24,56,0,0,192,3,0,0,28,56,0,0,192,3,0,0,28,56,0,0,192,3,0,0,28,48,0,0,192,3,0,0,12,112,0,0,192,3,0,0,14,112,0,0,192,3,0,0,14,96,0,0,192,3,0,0,6,224,0,0,192,3,0,0,7,224,0,0,192,3,0,0,7,192,1,0,192,3,0,128,3,128,1,0,248,31,0,128,1,128,3,0,248,31,0,192,1,0,7,0,248,31,0,224,0,0,15,0,0,0,0,240,0,0,30,0,0,0,0,120,0,0,60,0,0,0,0,60,0,0,120,0,0,0,0,30,0,0,240,0,0,0,0,15,0,0,224,1,0,0,128,7,0,0,192,7,0,0,224,3,0,0,0,31,0,0,248,0,0,0,0,252,0,0,63,0,0,0,0,248,15,240,31,0,0,0,0,192,255,255,3,0,0,0,0,0,254,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
-    };
-
-static BitmapPtr bitmaps[] = {
-    hourglass,
-    watch,
-    gears,
-    eye,
-    pulse,
-    wifi,
-    info
+// Animation of each entry of the mode menu
+static const AssetId bitmaps[] = {
+    ASSET_HOURGLASS,
+    ASSET_WATCH,
+    ASSET_GEARS,
+    ASSET_EYE,
+    ASSET_PULSE,
+    ASSET_WIFI,
+    ASSET_INFO
 };
 
 static const unsigned char sound_on_icon[] = {0x70,0x01,0x50,0x02,0x48,0x04,0x47,0x09,0x41,0x0a,0x41,0x0a,0x41,0x0a,0x41,0x0a,0x47,0x09,0x48,0x04,0x50,0x02,0x70,0x01};
@@ -0,0 +1,171 @@
+#ifndef CLIPS_H
+#define CLIPS_H
+
+#include "SamplePlayer.h"
+
+// Two-partial bell chime on E6, 400 ms, decaying. IMA ADPCM at 16 kHz.
+const uint8_t PROGMEM chimeData[] = {
+    0x70, 0x77, 0xd7, 0x08, 0xff, 0xcf, 0x47, 0x81, 0xaa, 0x08, 0xeb, 0x1b, 0x56, 0x81, 0x9a, 0x09, 0xc9, 0x0c, 0x55, 0x82,
+    0xaa, 0x88, 0xc8, 0x8a, 0x64, 0x02, 0xaa, 0x09, 0xb8, 0x9b, 0x65, 0x02, 0xaa, 0x88, 0xb0, 0xab, 0x74, 0x12, 0xaa, 0x09,
+    0xa8, 0xab, 0x73, 0x14, 0xa9, 0x89, 0x98, 0x9c, 0x61, 0x23, 0xb9, 0x8a, 0xa0, 0xac, 0x71, 0x23, 0xb8, 0x8a, 0x98, 0xbc,
+    0x61, 0x24, 0xa8, 0x9a, 0x90, 0xcb, 0x50, 0x25, 0xa8, 0x8a, 0x90, 0xbb, 0x58, 0x26, 0xa0, 0x8a, 0x88, 0xca, 0x49, 0x35,
+    0xa0, 0x9a, 0x88, 0xca, 0x29, 0x37, 0x91, 0x9b, 0x88, 0xca, 0x29, 0x37, 0x91, 0xaa, 0x08, 0xca, 0x1a, 0x37, 0x92, 0x9b,
+    0x09, 0xc9, 0x0a, 0x46, 0x82, 0xaa, 0x09, 0xb9, 0x0b, 0x56, 0x82, 0xaa, 0x88, 0xb8, 0x8b, 0x56, 0x02, 0xaa, 0x89, 0xa8,
+    0x8c, 0x73, 0x03, 0xaa, 0x89, 0xa8, 0x8c, 0x73, 0x12, 0xb9, 0x89, 0xb0, 0xab, 0x73, 0x15, 0xa9, 0x89, 0x98, 0xab, 0x72,
+    0x23, 0xb9, 0x99, 0xa0, 0xac, 0x71, 0x23, 0xb8, 0x8a, 0x98, 0xac, 0x60, 0x24, 0xa8, 0x9a, 0x90, 0xbb, 0x60, 0x25, 0xa0,
+    0x8b, 0x88, 0xcb, 0x58, 0x34, 0xa0, 0x9b, 0x90, 0xcb, 0x48, 0x26, 0xa1, 0x9a, 0x88, 0xca, 0x39, 0x37, 0x90, 0xaa, 0x80,
+    0xca, 0x29, 0x46, 0x91, 0xaa, 0x08, 0xba, 0x2a, 0x47, 0x81, 0xaa, 0x88, 0xb9, 0x1a, 0x47, 0x81, 0xaa, 0x08, 0xb9, 0x0b,
+    0x56, 0x82, 0xaa, 0x88, 0xb8, 0x8b, 0x56, 0x02, 0xaa, 0x89, 0xb8, 0x8b, 0x65, 0x02, 0xb9, 0x09, 0xb8, 0x9b, 0x74, 0x03,
+    0xb9, 0x89, 0x98, 0x9c, 0x63, 0x13, 0xb9, 0x8a, 0xb0, 0x9c, 0x72, 0x14, 0xa9, 0x99, 0x90, 0xab, 0x71, 0x23, 0xb8, 0x9a,
+    0xa0, 0xcb, 0x61, 0x24, 0xb0, 0x9a, 0x88, 0xcb, 0x50, 0x25, 0xa0, 0x8b, 0x98, 0xba, 0x58, 0x26, 0x90, 0x9b, 0x90, 0xba,
+    0x59, 0x26, 0xa1, 0x9a, 0x98, 0xba, 0x49, 0x37, 0x90, 0xaa, 0x88, 0xc9, 0x29, 0x37, 0x91, 0xaa, 0x09, 0xba, 0x2a, 0x47,
+    0x92, 0xaa, 0x88, 0xb9, 0x1b, 0x47, 0x82, 0xaa, 0x89, 0xb8, 0x0b, 0x47, 0x82, 0xb9, 0x89, 0xb8, 0x0b, 0x56, 0x02, 0xaa,
+    0x89, 0xa9, 0x8b, 0x65, 0x12, 0xaa, 0x8a, 0xa8, 0x9b, 0x74, 0x03, 0xa9, 0x8a, 0xa8, 0xab, 0x74, 0x13, 0xb9, 0x8a, 0xa8,
+    0xab, 0x73, 0x15, 0xa8, 0x8a, 0x98, 0xab, 0x62, 0x24, 0xa8, 0x8b, 0x98, 0x9c, 0x60, 0x14, 0xa0, 0x9a, 0x98, 0xba, 0x60,
+    0x25, 0x98, 0x9b, 0x90, 0xba, 0x68, 0x34, 0xa0, 0x9b, 0x98, 0xca, 0x48, 0x36, 0x90, 0xab, 0x88, 0xba, 0x49, 0x37, 0x91,
+    0xab, 0x98, 0xc9, 0x39, 0x46, 0x91, 0xaa, 0x88, 0xb9, 0x2a, 0x47, 0x92, 0xaa, 0x89, 0xa9, 0x1a, 0x47, 0x82, 0xba, 0x09,
+    0xb9, 0x0a, 0x47, 0x82, 0xaa, 0x89, 0xa9, 0x0b, 0x56, 0x02, 0xaa, 0x99, 0xa8, 0x8b, 0x65, 0x12, 0xaa, 0x8a, 0xa8, 0x9b,
+    0x55, 0x13, 0xb9, 0x9a, 0xb8, 0x9b, 0x74, 0x14, 0xa9, 0x8a, 0xa8, 0xaa, 0x73, 0x14, 0xa9, 0x99, 0x98, 0x9b, 0x71, 0x14,
+    0xa8, 0x9a, 0x88, 0xab, 0x71, 0x33, 0xa8, 0xab, 0x98, 0xcb, 0x51, 0x26, 0x98, 0xaa, 0x88, 0xba, 0x50, 0x35, 0xa0, 0x9b,
+    0x89, 0xca, 0x48, 0x36, 0x90, 0xab, 0x88, 0xba, 0x49, 0x37, 0x91, 0xab, 0x89, 0xb9, 0x39, 0x57, 0x91, 0x9a, 0x89, 0xa9,
+    0x2a, 0x37, 0x82, 0xbb, 0x89, 0xb9, 0x1a, 0x67, 0x81, 0xa9, 0x89, 0xa8, 0x1a, 0x45, 0x83, 0xba, 0x8a, 0xa9, 0x0b, 0x47,
+    0x03, 0xba, 0x8a, 0xa9, 0x0c, 0x64, 0x03, 0xaa, 0x8a, 0xa9, 0x8b, 0x65, 0x03, 0xb9, 0x8a, 0x99, 0x9b, 0x74, 0x13, 0xb9,
+    0x9a, 0x98, 0xab, 0x73, 0x15, 0xa8, 0x9a, 0x98, 0x9a, 0x71, 0x23, 0xa8, 0x9b, 0x99, 0xab, 0x71, 0x25, 0x98, 0x9b, 0x98,
+    0xba, 0x61, 0x25, 0xa0, 0x9b, 0x98, 0xaa, 0x68, 0x25, 0x90, 0xab, 0x98, 0xb9, 0x58, 0x26, 0x91, 0xab, 0x98, 0xaa, 0x38,
+    0x57, 0x80, 0xaa, 0x88, 0xaa, 0x28, 0x37, 0x92, 0xab, 0x99, 0xb9, 0x3a, 0x57, 0x81, 0xaa, 0x89, 0xa9, 0x19, 0x47, 0x81,
+    0xb9, 0x89, 0xa9, 0x1a, 0x56, 0x82, 0xaa, 0x99, 0xa8, 0x0a, 0x46, 0x03, 0xba, 0x9a, 0xa9, 0x8a, 0x56, 0x03, 0xb9, 0x9a,
+    0xa9, 0x9a, 0x75, 0x12, 0xb9, 0x99, 0xa8, 0x9a, 0x64, 0x13, 0xa9, 0x9b, 0x99, 0x9b, 0x73, 0x16, 0x99, 0x9a, 0x98, 0x99,
+    0x61, 0x14, 0xa8, 0x9a, 0x98, 0xaa, 0x71, 0x14, 0xa0, 0xaa, 0x98, 0xaa, 0x61, 0x34, 0xa0, 0x9c, 0x98, 0x9a, 0x40, 0x36,
+    0xa0, 0x9b, 0x99, 0xaa, 0x58, 0x36, 0x90, 0xab, 0x89, 0xaa, 0x59, 0x36, 0x80, 0xbb, 0x89, 0xaa, 0x49, 0x37, 0x91, 0xba,
+    0x89, 0xaa, 0x29, 0x57, 0x81, 0xaa, 0x89, 0xa9, 0x19, 0x37, 0x83, 0xbb, 0x9a, 0xa9, 0x1a, 0x57, 0x02, 0xba, 0x99, 0xa9,
+    0x09, 0x56, 0x02, 0xaa, 0x9a, 0xa8, 0x8a, 0x46, 0x13, 0xba, 0x9b, 0xa9, 0x8a, 0x75, 0x03, 0xa9, 0x8b, 0x99, 0x8b, 0x64,
+    0x23, 0xb9, 0xab, 0xa8, 0x9b, 0x74, 0x14, 0xb8, 0x9a, 0x98, 0x9a, 0x72, 0x33, 0xa9, 0x9c, 0x98, 0x9a, 0x61, 0x15, 0xa0,
+    0xaa, 0x98, 0x9a, 0x60, 0x34, 0xa0, 0x9c, 0x89, 0x9a, 0x50, 0x25, 0x90, 0xab, 0x99, 0xa9, 0x58, 0x36, 0x90, 0xab, 0x99,
+    0xa9, 0x48, 0x37, 0x80, 0xbb, 0x89, 0xaa, 0x38, 0x57, 0x91, 0xb9, 0x89, 0xa9, 0x28, 0x37, 0x82, 0xbb, 0x9a, 0xa9, 0x29,
+    0x57, 0x82, 0xaa, 0x9a, 0x99, 0x2a, 0x46, 0x83, 0xba, 0x9a, 0xa9, 0x1a, 0x66, 0x02, 0xaa, 0x9a, 0xa8, 0x0a, 0x65, 0x02,
+    0xa9, 0x9a, 0xa9, 0x89, 0x74, 0x12, 0xa9, 0x9b, 0xa8, 0x89, 0x73, 0x14, 0xb8, 0x9a, 0x99, 0x9a, 0x73, 0x24, 0xa9, 0x9b,
+    0x99, 0x99, 0x72, 0x24, 0xb8, 0xaa, 0x98, 0x9a, 0x71, 0x24, 0xa8, 0xaa, 0x99, 0x9a, 0x61, 0x25, 0xa0, 0xab, 0x98, 0x9a,
+    0x60, 0x34, 0x90, 0xac, 0x89, 0xa9, 0x40, 0x36, 0x90, 0xab, 0x8a, 0xaa, 0x58, 0x36, 0x91, 0xbb, 0x99, 0x9a, 0x49, 0x37,
+    0x81, 0xbb, 0x99, 0xaa, 0x38, 0x57, 0x81, 0xaa, 0x8a, 0xa9, 0x18, 0x47, 0x81, 0xb9, 0x99, 0xa9, 0x29, 0x46, 0x02, 0xba,
+    0xaa, 0xa8, 0x1a, 0x47, 0x03, 0xba, 0x9b, 0xa9, 0x09, 0x56, 0x03, 0xb9, 0xab, 0xa8, 0x0a, 0x65, 0x13, 0xb9, 0xab, 0x99,
+    0x8a, 0x74, 0x23, 0xb9, 0xab, 0x99, 0x9a, 0x74, 0x23, 0xa9, 0x9c, 0x89, 0x8a, 0x62, 0x24, 0xa8, 0xab, 0x99, 0x9a, 0x72,
+    0x24, 0xb0, 0xba, 0x99, 0x99, 0x71, 0x24, 0xa0, 0xab, 0x99, 0x9a, 0x60, 0x35, 0xa0, 0xab, 0x8a, 0xaa, 0x51, 0x26, 0x91,
+    0xbb, 0x99, 0xa9, 0x40, 0x37, 0x91, 0xbb, 0x99, 0x9a, 0x48, 0x46, 0x81, 0xbb, 0x99, 0x99, 0x39, 0x47, 0x81, 0xaa, 0x9a,
+    0xa9, 0x28, 0x47, 0x82, 0xba, 0x9a, 0x99, 0x19, 0x47, 0x82, 0xb9, 0xaa, 0xa8, 0x19, 0x56, 0x02, 0xaa, 0x9b, 0x99, 0x09,
+    0x65, 0x12, 0xaa, 0x9b, 0x99, 0x0a, 0x55, 0x13, 0xb9, 0x9c, 0x99, 0x09, 0x73, 0x14, 0xa9, 0x9b, 0x99, 0x89, 0x73, 0x14,
+    0xa8, 0xab, 0x89, 0x8a, 0x63, 0x24, 0xa8, 0xbb, 0x99, 0x8a, 0x72, 0x15, 0xa0, 0xaa, 0x99, 0x8a, 0x61, 0x34, 0xa8, 0xbb,
+    0x99, 0xa9, 0x71, 0x34, 0xa0, 0xbb, 0x99, 0x9a, 0x60, 0x35, 0x90, 0xbb, 0x9a, 0xa9, 0x50, 0x36, 0x91, 0xbb, 0x9a, 0xa9,
+    0x58, 0x36, 0x81, 0xcb, 0x99, 0x99, 0x38, 0x37, 0x82, 0xcb, 0x99, 0x99, 0x28, 0x46, 0x82, 0xba, 0x9b, 0x99, 0x29, 0x47,
+    0x02, 0xba, 0x9b, 0xa9, 0x18, 0x56, 0x02, 0xb9, 0x9b, 0xa9, 0x19, 0x56, 0x12, 0xba, 0xaa, 0xa9, 0x19, 0x65, 0x12, 0xb9,
+    0x9b, 0xa9, 0x09, 0x74, 0x13, 0xb9, 0xab, 0x99, 0x89, 0x64, 0x14, 0xa8, 0xab, 0x99, 0x8a, 0x73, 0x24, 0xb8, 0xba, 0x99,
+    0x89, 0x72, 0x24, 0xa8, 0xab, 0x99, 0x8a, 0x62, 0x25, 0xa0, 0xbb, 0x99, 0x99, 0x61, 0x25, 0x90, 0xbb, 0x99, 0x8a, 0x50,
+    0x26, 0x91, 0xbb, 0x9a, 0x99, 0x41, 0x36, 0x92, 0xac, 0x9a, 0x99, 0x30, 0x47, 0x91, 0xaa, 0x9a, 0x99, 0x38, 0x37, 0x82,
+    0xbb, 0xab, 0xa9, 0x48, 0x46, 0x02, 0xbb, 0x9b, 0x9a, 0x28, 0x57, 0x82, 0xaa, 0x9b, 0x99, 0x18, 0x46, 0x03, 0xca, 0x9a,
+    0x99, 0x18, 0x64, 0x12, 0xaa, 0xab, 0x99, 0x09, 0x65, 0x12, 0xb9, 0xab, 0x99, 0x09, 0x55, 0x14, 0xa9, 0xab, 0x99, 0x89,
+    0x64, 0x13, 0xb8, 0xbb, 0xa9, 0x89, 0x74, 0x23, 0xb8, 0xbb, 0x9a, 0x89, 0x73, 0x25, 0xa8, 0xab, 0x8a, 0x99, 0x62, 0x25,
+    0x98, 0xbb, 0x99, 0x89, 0x61, 0x34, 0xa0, 0xcb, 0x99, 0x89, 0x50, 0x25, 0x91, 0xbb, 0x9b, 0x99, 0x51, 0x26, 0x81, 0xcb,
+    0x99, 0x89, 0x30, 0x46, 0x91, 0xba, 0x9a, 0x99, 0x48, 0x36, 0x82, 0xcb, 0x9a, 0x99, 0x38, 0x46, 0x82, 0xba, 0xab, 0x99,
+    0x38, 0x47, 0x02, 0xca, 0x9a, 0x89, 0x18, 0x45, 0x03, 0xca, 0xaa, 0x89, 0x19, 0x46, 0x12, 0xba, 0xab, 0x9a, 0x18, 0x65,
+    0x13, 0xba, 0xab, 0x9a, 0x19, 0x65, 0x13, 0xb9, 0x9c, 0x99, 0x09, 0x73, 0x23, 0xb9, 0xbb, 0xa9, 0x88, 0x64, 0x14, 0xb0,
+    0xbb, 0x99, 0x09, 0x72, 0x24, 0xa8, 0xbb, 0x99, 0x89, 0x72, 0x24, 0xa0, 0xbb, 0x9a, 0x89, 0x61, 0x25, 0x90, 0xbb, 0x9a,
+    0x99, 0x61, 0x25, 0x91, 0xac, 0x99, 0x89, 0x40, 0x35, 0x91, 0xcb, 0x9a, 0x89, 0x40, 0x35, 0x92, 0xcb, 0xaa, 0x89, 0x30,
+    0x47, 0x81, 0xba, 0x9b, 0x89, 0x38, 0x47, 0x01, 0xbb, 0xaa, 0x98, 0x28, 0x47, 0x01, 0xba, 0xaa, 0x99, 0x28, 0x56, 0x02,
+    0xba, 0x9b, 0x8a, 0x18, 0x46, 0x03, 0xc9, 0x9b, 0x99, 0x18, 0x64, 0x12, 0xb9, 0xbb, 0x99, 0x08, 0x65, 0x13, 0xb9, 0xac,
+    0x98, 0x08, 0x63, 0x14, 0xb8, 0xbb, 0x99, 0x08, 0x73, 0x14, 0xa8, 0xbb, 0x99, 0x09, 0x73, 0x14, 0xa0, 0xbb, 0x9a, 0x09,
+    0x72, 0x24, 0x98, 0xac, 0x99, 0x88, 0x51, 0x24, 0xa1, 0xcb, 0x8a, 0x89, 0x51, 0x34, 0xa1, 0xcb, 0x9a, 0x89, 0x50, 0x35,
+    0x80, 0xac, 0x9a, 0x89, 0x40, 0x35, 0x92, 0xdb, 0x9a, 0x88, 0x30, 0x45, 0x82, 0xcb, 0x9a, 0x89, 0x38, 0x46, 0x82, 0xca,
+    0x9a, 0x89, 0x20, 0x45, 0x02, 0xca, 0x9b, 0x89, 0x28, 0x55, 0x02, 0xba, 0xab, 0x8a, 0x28, 0x46, 0x13, 0xca, 0xab, 0x99,
+    0x28, 0x55, 0x03, 0xb9, 0xac, 0x99, 0x18, 0x54, 0x23, 0xc9, 0xab, 0x8a, 0x19, 0x54, 0x14, 0xb8, 0xbb, 0x8a, 0x09, 0x64,
+    0x33, 0xc8, 0xbb, 0x99, 0x88, 0x73, 0x14, 0xa0, 0xbb, 0x9a, 0x88, 0x63, 0x34, 0xa8, 0xac, 0x9a, 0x88, 0x52, 0x25, 0x90,
+    0xac, 0x9a, 0x88, 0x51, 0x34, 0xa1, 0xbc, 0x9a, 0x88, 0x51, 0x44, 0x80, 0xcb, 0x99, 0x89, 0x31, 0x36, 0x92, 0xdb, 0x9a,
+    0x88, 0x30, 0x36, 0x82, 0xbc, 0xaa, 0x98, 0x40, 0x35, 0x83, 0xdb, 0xaa, 0x89, 0x20, 0x46, 0x82, 0xba, 0xab, 0x99, 0x20,
+    0x47, 0x02, 0xba, 0x9c, 0x89, 0x28, 0x54, 0x12, 0xba, 0xac, 0x89, 0x18, 0x45, 0x13, 0xc9, 0xbb, 0x89, 0x18, 0x64, 0x13,
+    0xb9, 0xac, 0x8a, 0x18, 0x73, 0x13, 0xb8, 0xac, 0x8a, 0x08, 0x73, 0x13, 0xb0, 0xbc, 0x99, 0x08, 0x63, 0x24, 0xa8, 0xac,
+    0x8a, 0x88, 0x62, 0x33, 0xb0, 0xbc, 0x9a, 0x09, 0x62, 0x34, 0xa0, 0xbc, 0x8a, 0x09, 0x51, 0x25, 0xa1, 0xcb, 0x99, 0x89,
+    0x42, 0x35, 0x90, 0xcb, 0xaa, 0x88, 0x41, 0x35, 0x92, 0xdb, 0x9a, 0x89, 0x31, 0x46, 0x81, 0xbb, 0xab, 0x88, 0x30, 0x47,
+    0x01, 0xbb, 0xab, 0x89, 0x30, 0x47, 0x01, 0xba, 0xab, 0x99, 0x30, 0x46, 0x03, 0xca, 0xab, 0x99, 0x20, 0x55, 0x12, 0xba,
+    0xac, 0x89, 0x28, 0x54, 0x13, 0xba, 0xad, 0x98, 0x10, 0x63, 0x13, 0xb9, 0xbc, 0x99, 0x18, 0x45, 0x23, 0xc8, 0xac, 0x89,
+    0x08, 0x63, 0x23, 0xb8, 0xad, 0x99, 0x08, 0x53, 0x24, 0xb0, 0xac, 0x9a, 0x08, 0x53, 0x25, 0x98, 0xac, 0x9a, 0x08, 0x42,
+    0x35, 0xa0, 0xbc, 0x9a, 0x08, 0x42, 0x26, 0xa1, 0xcb, 0x99, 0x09, 0x41, 0x35, 0x90, 0xcb, 0xaa, 0x88, 0x51, 0x34, 0x81,
+    0xbc, 0xab, 0x88, 0x41, 0x45, 0x81, 0xca, 0x9b, 0x88, 0x30, 0x36, 0x02, 0xdb, 0x9b, 0x89, 0x21, 0x36, 0x83, 0xda, 0x9b,
+    0x89, 0x20, 0x45, 0x03, 0xca, 0xab, 0x99, 0x20, 0x46, 0x02, 0xc9, 0xab, 0x98, 0x20, 0x54, 0x03, 0xb9, 0xad, 0x89, 0x10,
+    0x63, 0x13, 0xb9, 0xad, 0x89, 0x18, 0x44, 0x23, 0xb9, 0xbd, 0x89, 0x18, 0x63, 0x23, 0xb8, 0xad, 0x9a, 0x00, 0x63, 0x33,
+    0xb8, 0xbd, 0x99, 0x08, 0x63, 0x33, 0xb0, 0xbd, 0x99, 0x08, 0x52, 0x34, 0xa0, 0xbc, 0x9b, 0x08, 0x62, 0x24, 0xa1, 0xdb,
+    0x99, 0x88, 0x32, 0x26, 0x91, 0xcb, 0xaa, 0x08, 0x41, 0x35, 0x91, 0xdb, 0x9a, 0x09, 0x31, 0x36, 0x92, 0xcb, 0xab, 0x09,
+    0x40, 0x45, 0x81, 0xca, 0xaa, 0x88, 0x30, 0x36, 0x02, 0xcb, 0x9c, 0x89, 0x21, 0x54, 0x02, 0xca, 0x9b, 0x89, 0x20, 0x45,
+    0x02, 0xc9, 0xab, 0x99, 0x20, 0x45, 0x13, 0xc9, 0xac, 0x89, 0x10, 0x44, 0x13, 0xc9, 0xbb, 0x8a, 0x10, 0x45, 0x14, 0xb8,
+    0xbc, 0x89, 0x18, 0x63, 0x23, 0xb8, 0xbd, 0x99, 0x00, 0x44, 0x33, 0xb8, 0xbd, 0x9a, 0x18, 0x63, 0x24, 0xa8, 0xac, 0x9a,
+    0x08, 0x53, 0x24, 0x90, 0xad, 0x9a, 0x08, 0x42, 0x25, 0xa1, 0xcb, 0x9b, 0x08, 0x42, 0x35, 0x91, 0xbc, 0xab, 0x08, 0x42,
+    0x26, 0x81, 0xdb, 0x9a, 0x08, 0x31, 0x35, 0x92, 0xdb, 0x9b, 0x89, 0x32, 0x36, 0x02, 0xbc, 0xac, 0x88, 0x31, 0x45, 0x82,
+    0xca, 0xab, 0x09, 0x30, 0x45, 0x03, 0xcb, 0xbb, 0x89, 0x21, 0x46, 0x02, 0xc9, 0xab, 0x89, 0x20, 0x45, 0x03, 0xc9, 0xac,
+    0x89, 0x20, 0x44, 0x13, 0xc9, 0xac, 0x89, 0x10, 0x63, 0x13, 0xb9, 0xbc, 0x8a, 0x10, 0x44, 0x24, 0xb8, 0xad, 0x8a, 0x00,
+    0x53, 0x14, 0xb0, 0xcb, 0x9a, 0x00, 0x63, 0x23, 0xb0, 0xcc, 0x99, 0x18, 0x42, 0x25, 0xa0, 0xbc, 0x8a, 0x08, 0x52, 0x24,
+    0xa1, 0xbc, 0x9b, 0x08, 0x53, 0x34, 0xa1, 0xbc, 0xab, 0x08, 0x52, 0x25, 0x92, 0xbc, 0xab, 0x08, 0x42, 0x35, 0x92, 0xdb,
+    0xab, 0x08, 0x31, 0x36, 0x82, 0xdb, 0x9b, 0x09, 0x40, 0x44, 0x01, 0xca, 0xab, 0x89, 0x31, 0x45, 0x83, 0xca, 0x9c, 0x89,
+    0x21, 0x44, 0x12, 0xca, 0xac, 0x88, 0x20, 0x44, 0x12, 0xc9, 0xac, 0x89, 0x20, 0x44, 0x12, 0xc8, 0xac, 0x89, 0x10, 0x44,
+    0x22, 0xb9, 0xbd, 0x89, 0x10, 0x63, 0x23, 0xb9, 0xad, 0x8a, 0x18, 0x44, 0x23, 0xb8, 0xbd, 0x9a, 0x10, 0x63, 0x33, 0xa8,
+    0xbd, 0x8b, 0x18, 0x62, 0x33, 0xa0, 0xbd, 0x9b, 0x00, 0x53, 0x34, 0xa0, 0xbc, 0xab, 0x18, 0x62, 0x24, 0x91, 0xbc, 0x9b,
+    0x19, 0x42, 0x35, 0x91, 0xeb, 0x9a, 0x08, 0x31, 0x35, 0x92, 0xdb, 0xab, 0x08, 0x41, 0x44, 0x81, 0xca, 0xab, 0x09, 0x41,
+    0x34, 0x83, 0xeb, 0xaa, 0x09, 0x21, 0x45, 0x01, 0xba, 0x9d, 0x89, 0x21, 0x44, 0x02, 0xd9, 0xba, 0x88, 0x20, 0x35, 0x13,
+    0xca, 0xad, 0x09, 0x10, 0x44, 0x03, 0xb9, 0xbd, 0x89, 0x20, 0x44, 0x23, 0xc9, 0xac, 0x8a, 0x10, 0x44, 0x23, 0xb9, 0xbd,
+    0x8a, 0x28, 0x63, 0x23, 0xc0, 0xcb, 0x8a, 0x18, 0x53, 0x24, 0xa8, 0xbc, 0x9a, 0x18, 0x63, 0x33, 0xb0, 0xbd, 0x9a, 0x18,
+    0x62, 0x33, 0xa0, 0xcc, 0x9b, 0x00, 0x52, 0x24, 0xa1, 0xdb, 0x9a, 0x08, 0x42, 0x34, 0x80, 0xcc, 0x9a, 0x19, 0x41, 0x34,
+    0x91, 0xdb, 0x9b, 0x09, 0x32, 0x36, 0x82, 0xbc, 0x9c, 0x09, 0x31, 0x35, 0x83, 0xeb, 0xaa, 0x09, 0x21, 0x45, 0x01, 0xca,
+    0xab, 0x09, 0x31, 0x45, 0x02, 0xca, 0xbb, 0x89, 0x31, 0x45, 0x03, 0xd9, 0xab, 0x0a, 0x20, 0x45, 0x12, 0xc9, 0xbb, 0x8a,
+    0x30, 0x54, 0x13, 0xc8, 0xac, 0x8a, 0x20, 0x63, 0x22, 0xc8, 0xbb, 0x9a, 0x20, 0x54, 0x23, 0xb8, 0xae, 0x8a, 0x10, 0x52,
+    0x23, 0xb0, 0xbd, 0x9a, 0x28, 0x53, 0x24, 0xa0, 0xcc, 0x9a, 0x10, 0x42, 0x24, 0xa1, 0xcc, 0x9a, 0x00, 0x42, 0x24, 0x91,
+    0xcc, 0x9a, 0x08, 0x42, 0x34, 0x80, 0xcc, 0x9a, 0x08, 0x41, 0x24, 0x92, 0xdb, 0x9b, 0x09, 0x42, 0x34, 0x82, 0xcc, 0x9b,
+    0x09, 0x41, 0x34, 0x82, 0xdb, 0xab, 0x09, 0x31, 0x36, 0x83, 0xda, 0x9c, 0x09, 0x30, 0x34, 0x13, 0xeb, 0xab, 0x89, 0x31,
+    0x35, 0x13, 0xda, 0xac, 0x89, 0x30, 0x44, 0x03, 0xc9, 0xac, 0x89, 0x20, 0x44, 0x13, 0xc9, 0xac, 0x8a, 0x20, 0x44, 0x13,
+    0xc8, 0xac, 0x8a, 0x10, 0x44, 0x13, 0xb8, 0xbd, 0x8a, 0x28, 0x63, 0x23, 0xb0, 0xbd, 0x8b, 0x28, 0x63, 0x23, 0xb0, 0xcc,
+    0x9a, 0x18, 0x53, 0x33, 0xa0, 0xcd, 0x9a, 0x10, 0x42, 0x24, 0x90, 0xcc, 0x9a, 0x18, 0x42, 0x24, 0x91, 0xbc, 0x9c, 0x18,
+    0x41, 0x24, 0x81, 0xbc, 0x9c, 0x08, 0x32, 0x35, 0x92, 0xeb, 0xaa, 0x08, 0x31, 0x35, 0x82, 0xdb, 0xbb, 0x08, 0x41, 0x44,
+    0x01, 0xca, 0x9c, 0x09, 0x21, 0x44, 0x82, 0xc9, 0xac, 0x88, 0x21, 0x44, 0x02, 0xba, 0xad, 0x89, 0x21, 0x44, 0x03, 0xc9,
+    0xac, 0x0a, 0x20, 0x44, 0x13, 0xc9, 0xac, 0x8a, 0x11, 0x44, 0x13, 0xb9, 0xbd, 0x8a, 0x20, 0x44, 0x23, 0xc8, 0xbc, 0x8a,
+    0x20, 0x63, 0x23, 0xb8, 0xbd, 0x9a, 0x10, 0x44, 0x23, 0xa0, 0xbe, 0x9a, 0x10, 0x53, 0x33, 0xa0, 0xbe, 0x9a, 0x10, 0x52,
+    0x33, 0x90, 0xcd, 0x9a, 0x18, 0x42, 0x24, 0x91, 0xcc, 0x9a, 0x08, 0x42, 0x24, 0x91, 0xdb, 0x9b, 0x08, 0x42, 0x34, 0x81,
+    0xcc, 0xaa, 0x08, 0x41, 0x34, 0x82, 0xcc, 0xaa, 0x09, 0x32, 0x35, 0x83, 0xeb, 0xab, 0x88, 0x32, 0x35, 0x03, 0xeb, 0xab,
+    0x09, 0x31, 0x54, 0x02, 0xca, 0xbb, 0x89, 0x22, 0x36, 0x03, 0xd9, 0xbb, 0x8a, 0x31, 0x45, 0x12, 0xb9, 0xae, 0x89, 0x20,
+    0x53, 0x13, 0xb9, 0xbd, 0x8a, 0x20, 0x44, 0x23, 0xc8, 0xbc, 0x8a, 0x20, 0x63, 0x13, 0xb0, 0xbd, 0x9a, 0x20, 0x53, 0x24,
+    0xa8, 0xcc, 0x8a, 0x10, 0x42, 0x24, 0xa0, 0xcc, 0x9a, 0x10, 0x42, 0x24, 0x90, 0xcc, 0x9a, 0x00, 0x33, 0x35, 0x90, 0xcc,
+    0xaa, 0x18, 0x42, 0x34, 0x91, 0xcc, 0xaa, 0x08, 0x33, 0x26, 0x92, 0xdb, 0x9b, 0x19, 0x32, 0x35, 0x82, 0xeb, 0xab, 0x08,
+    0x32, 0x35, 0x02, 0xeb, 0xab, 0x09, 0x32, 0x35, 0x83, 0xea, 0xab, 0x09, 0x31, 0x35, 0x03, 0xda, 0xac, 0x89, 0x31, 0x44,
+    0x02, 0xc9, 0xac, 0x89, 0x21, 0x44, 0x12, 0xc9, 0xac, 0x89, 0x20, 0x44, 0x12, 0xc8, 0xcb, 0x99, 0x21, 0x53, 0x23, 0xb9,
+    0xbe, 0x89, 0x10, 0x34, 0x24, 0xb8, 0xbd, 0x9a, 0x20, 0x44, 0x23, 0xa8, 0xbe, 0x8a, 0x10, 0x43, 0x24, 0xa0, 0xbd, 0x9a,
+    0x28, 0x53, 0x33, 0xa0, 0xcd, 0x9a, 0x18, 0x43, 0x24, 0xa1, 0xcc, 0xaa, 0x00, 0x43, 0x24, 0x81, 0xcc, 0x9b, 0x08, 0x33,
+    0x26, 0x81, 0xdb, 0x9b, 0x19, 0x32, 0x26, 0x92, 0xda, 0xab, 0x08, 0x32, 0x35, 0x02, 0xeb, 0xab, 0x09, 0x32, 0x35, 0x83,
+    0xea, 0xab, 0x09, 0x41, 0x43, 0x02, 0xca, 0xbc, 0x09, 0x31, 0x35, 0x03, 0xda, 0xac, 0x89, 0x31, 0x34, 0x04, 0xb9, 0xae,
+    0x89, 0x21, 0x53, 0x12, 0xb9, 0xbd, 0x8a, 0x21, 0x44, 0x13, 0xc8, 0xbc, 0x99, 0x21, 0x63, 0x22, 0xb8, 0xbd, 0x8a, 0x20,
+    0x63, 0x22, 0xb0, 0xbd, 0x9a, 0x20, 0x53, 0x14, 0xa0, 0xbc, 0x9b, 0x10, 0x44, 0x33, 0xa0, 0xcd, 0x9b, 0x10, 0x43, 0x24,
+    0xa1, 0xcc, 0xaa, 0x10, 0x42, 0x24, 0x91, 0xeb, 0xaa, 0x00, 0x42, 0x33, 0x92, 0xdc, 0x9b, 0x19, 0x42, 0x24, 0x92, 0xdb,
+    0xab, 0x19, 0x42, 0x34, 0x82, 0xeb, 0xab, 0x08, 0x32, 0x35, 0x02, 0xeb, 0xab, 0x09, 0x32, 0x35, 0x02, 0xda, 0xac, 0x09,
+    0x31, 0x34, 0x13, 0xdb, 0xbc, 0x09, 0x31, 0x44, 0x12, 0xc9, 0xbc, 0x89, 0x21, 0x44, 0x13, 0xc9, 0xbc, 0x0a, 0x30, 0x44,
+    0x22, 0xb9, 0xbe, 0x89, 0x20, 0x53, 0x13, 0xb8, 0xbd, 0x8b, 0x20, 0x35, 0x14, 0xb0, 0xbd, 0x9a, 0x20, 0x34, 0x15, 0xa0,
+    0xbc, 0x9b, 0x10, 0x44, 0x33, 0xa0, 0xbe, 0x9b, 0x10, 0x53, 0x33, 0xa1, 0xcd, 0xaa, 0x10, 0x52, 0x23, 0x91, 0xdc, 0x9a,
+    0x18, 0x32, 0x25, 0x81, 0xcc, 0xaa, 0x08, 0x33, 0x35, 0x92, 0xeb, 0xab, 0x18, 0x41, 0x24, 0x82, 0xdb, 0xab, 0x09, 0x42,
+    0x34, 0x82, 0xea, 0xab, 0x09, 0x32, 0x35, 0x02, 0xda, 0xac, 0x09, 0x31, 0x44, 0x02, 0xca, 0xac, 0x09, 0x21, 0x44, 0x02,
+    0xc9, 0xcb, 0x89, 0x31, 0x53, 0x03, 0xb9, 0xae, 0x8a, 0x21, 0x34, 0x14, 0xb9, 0xbd, 0x8a, 0x21, 0x44, 0x13, 0xb8, 0xbe,
+    0x99, 0x21, 0x43, 0x14, 0xb0, 0xbd, 0x9a, 0x11, 0x44, 0x13, 0xa0, 0xcd, 0x8a, 0x10, 0x33, 0x25, 0xa0, 0xcc, 0x9a, 0x28,
+    0x52, 0x23, 0x90, 0xbd, 0xab, 0x28, 0x53, 0x24, 0xa1, 0xeb, 0x9a, 0x18, 0x32, 0x25, 0x91, 0xdb, 0xab, 0x18, 0x43, 0x34,
+    0x91, 0xeb, 0x9b, 0x19, 0x42, 0x43, 0x81, 0xdb, 0xab, 0x19, 0x42, 0x34, 0x01, 0xdb, 0xac, 0x08, 0x31, 0x44, 0x01, 0xca,
+    0xac, 0x88, 0x22, 0x25, 0x12, 0xda, 0xbb, 0x89, 0x32, 0x45, 0x02, 0xc9, 0xac, 0x89, 0x31, 0x53, 0x12, 0xc9, 0xac, 0x8a,
+    0x31, 0x34, 0x14, 0xb9, 0xae, 0x8a, 0x21, 0x53, 0x13, 0xb9, 0xbd, 0x9a, 0x21, 0x44, 0x23, 0xb8, 0xbe, 0x9a, 0x21, 0x53,
+    0x23, 0xb0, 0xbe, 0x9a, 0x20, 0x53, 0x23, 0xa0, 0xcd, 0x9a, 0x10, 0x43, 0x24, 0xa0, 0xcc, 0x9a, 0x28, 0x42, 0x24, 0x90,
+    0xeb, 0x9a, 0x18, 0x42, 0x33, 0x91, 0xcd, 0xaa, 0x18, 0x33, 0x35, 0x91, 0xeb, 0x9b, 0x19, 0x42, 0x24, 0x81, 0xcb, 0xac,
+    0x19, 0x32, 0x35, 0x82, 0xdb, 0xac, 0x08, 0x32, 0x34, 0x02, 0xeb, 0xbb, 0x09, 0x42, 0x34, 0x02, 0xda, 0xac, 0x09, 0x31,
+    0x34, 0x03, 0xda, 0xac, 0x0a, 0x31, 0x44, 0x12, 0xba, 0xae, 0x0a, 0x30, 0x34, 0x13, 0xc9, 0xbd, 0x8a, 0x31, 0x44, 0x12,
+    0xb8, 0xae, 0x8a, 0x20, 0x34, 0x23, 0xc8, 0xcc, 0x8a, 0x20, 0x53, 0x22, 0xa8, 0xbd, 0x9b, 0x20, 0x35, 0x33, 0xa8, 0xce,
+    0x8a, 0x28, 0x33, 0x25, 0x98, 0xcc, 0x9a, 0x28, 0x52, 0x32, 0x90, 0xbd, 0xab, 0x28, 0x53, 0x24, 0x80, 0xcc, 0xaa, 0x18,
+    0x43, 0x33, 0x92, 0xcd, 0xab, 0x18, 0x52, 0x33, 0x81, 0xcc, 0xbb, 0x19, 0x43, 0x25, 0x01, 0xdb, 0xab, 0x09, 0x33, 0x26,
+    0x82, 0xca, 0xac, 0x09, 0x41, 0x43, 0x01, 0xca, 0xac, 0x89, 0x32, 0x35, 0x02, 0xca, 0xad, 0x89, 0x22, 0x34, 0x13, 0xda,
+    0xac, 0x8a, 0x31, 0x35, 0x12, 0xc9, 0xbc, 0x8a, 0x31, 0x44, 0x13, 0xb9, 0xbe, 0x8a, 0x21, 0x44, 0x12, 0xb8, 0xbd, 0x9a,
+    0x21, 0x44, 0x23, 0xb8, 0xcd, 0x9a, 0x11, 0x34, 0x23, 0xb0, 0xbe, 0x9b, 0x20, 0x44, 0x23, 0xa0, 0xcd, 0x9a, 0x28, 0x43,
+    0x33, 0xa0, 0xcd, 0x9b, 0x28, 0x43, 0x24, 0x91, 0xcc, 0xab, 0x28, 0x52, 0x33, 0x91, 0xdc, 0xaa, 0x08, 0x43, 0x33, 0x92,
+    0xdc, 0xab, 0x08, 0x43, 0x24, 0x82, 0xdb, 0xac, 0x08, 0x32, 0x25, 0x82, 0xda, 0xbb, 0x08, 0x32, 0x35, 0x83, 0xea, 0xbb,
+    0x09, 0x42, 0x43, 0x02, 0xd9, 0xcb, 0x09, 0x31, 0x34, 0x12, 0xca, 0xbd, 0x89, 0x31, 0x35, 0x12, 0xc9, 0xad, 0x0a, 0x30,
+    0x53, 0x12, 0xc8, 0xcb, 0x8a, 0x30, 0x34, 0x14, 0xb8, 0xbd, 0x8b, 0x30, 0x44, 0x13, 0xb0, 0xbe, 0x9a, 0x21, 0x53, 0x23,
+    0xa8, 0xbe, 0x9a, 0x20, 0x53, 0x23, 0xa0, 0xcd, 0x9a, 0x10, 0x43, 0x33, 0xa0, 0xcd, 0x9b, 0x28, 0x53, 0x23, 0xa1, 0xcc,
+};
+const Clip chimeClip = {chimeData, 6400};
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef CONFIG_COMMON_H
+#define CONFIG_COMMON_H
+
+// Settings shared by every board. Include through the board config header,
+// which defines `Board` before including this file.
+
+#include <Arduino.h>
+#include "SystemState.h"
+
+// OLED screen
+#include <U8g2lib.h>
+using DisplayType = Board::Display;
+using Layout = ScreenLayout<Board>;
+
+namespace Fonts {
+static constexpr const uint8_t* LargeNumber = u8g2_font_logisoso32_tn;
+static constexpr const uint8_t* MediumText = u8g2_font_logisoso18_tr;
+static constexpr const uint8_t* SmallText = u8g2_font_profont12_tf;
+static constexpr const uint8_t* Symbols = u8g2_font_streamline_all_t;
+}
+
+// LED strip
+#define LED_GAMMA 1.0f // 1 keeps the linear response of the previous NeoPixel driver
+#define LED_DITHER_REFRESH_HZ 200 // temporal dithering refresh rate, 0 disables dithering
+#define LED_DITHER_MAX_BRIGHTNESS 64 // dither only below this brightness, where the ring has few levels left
+
+// Loop profiler, cycle-count histograms read with the "prof dump" serial command
+#ifndef LOOP_PROFILER
+#define LOOP_PROFILER 1 // 0 compiles the probes out
+#endif
+
+// Switch
+#define BUTTON_LONG_PRESS_THRESHOLD 1250
+
+// System config
+#define SCREEN_TIME 10000
+#define SLEEP_TIMEOUT 60000
+extern RTC_DATA_ATTR SystemState previousState;
+extern RTC_DATA_ATTR long int previousPosition;
+#define HOLD_TIME 1000
+
+// EEPROM
+#define EEPROM_SIZE 512
+#define EEPROM_SETTINGS_ADDR 128 // Settings block, see Settings.h
+
+// Legacy layout, only read to migrate to the settings block. The SSID and
+// password sizes also size the strings of the block.
+
+#define EEPROM_SSID_SIZE 32
+#define EEPROM_SSID_ADDR 0
+
+#define EEPROM_PASSWORD_SIZE 32
+#define EEPROM_PASSWORD_ADDR (EEPROM_SSID_ADDR + EEPROM_SSID_SIZE)
+
+#define EEPROM_LEDRING_BRIGHTNESS_SIZE sizeof(int)
+#define EEPROM_LEDRING_BRIGHTNESS_ADDR (EEPROM_PASSWORD_ADDR + EEPROM_PASSWORD_SIZE)
+
+#define EEPROM_PIEZO_MUTE_SIZE sizeof(uint8_t)
+#define EEPROM_PIEZO_MUTE_ADDR (EEPROM_LEDRING_BRIGHTNESS_ADDR + EEPROM_LEDRING_BRIGHTNESS_SIZE)
+
+#define EEPROM_SCREEN_BRIGHTNESS_SIZE sizeof(int)
+#define EEPROM_SCREEN_BRIGHTNESS_ADDR (EEPROM_PIEZO_MUTE_ADDR + EEPROM_PIEZO_MUTE_SIZE)
+
+#define EEPROM_DELTAT_CW_SIZE sizeof(int)
+#define EEPROM_DELTAT_CW_ADDR (EEPROM_SCREEN_BRIGHTNESS_ADDR + EEPROM_SCREEN_BRIGHTNESS_SIZE)
+
+#define EEPROM_DELTATCCW_SIZE sizeof(int)
+#define EEPROM_DELTAT_CCW_ADDR (EEPROM_DELTAT_CW_ADDR + EEPROM_DELTAT_CW_SIZE)
+
+#define EEPROM_ENCODER_ACCEL_SIZE sizeof(uint8_t)
+#define EEPROM_ENCODER_ACCEL_ADDR (EEPROM_DELTAT_CCW_ADDR + EEPROM_DELTATCCW_SIZE)
+
+#endif
@@ -1,19 +1,14 @@
+#ifndef MELODIES_H
+#define MELODIES_H
+
 #include "Melody.h"
+#include "Rtttl.h"
+
+RTTTL_MELODY(finishMelody, "finish:d=4,o=5,b=300:c,8g4,8g4,a4,g4,p,b4,c", false);
 
-Melody finishMelody = {
-    {NOTE_C5, NOTE_G4, NOTE_G4, NOTE_A4, NOTE_G4, 0, NOTE_B4, NOTE_C5},
-    {200, 100, 100, 200, 200, 200, 200, 200},
-    false
-};
+RTTTL_MELODY(rotaryUpMelody, "rotaryUp:d=16,o=6,b=300:a", false);
 
-Melody rotaryUpMelody = {
-    {NOTE_A6},
-    {50},
-    false
-};
+// The 1 s pause is split into a whole and a quarter rest
+RTTTL_MELODY(loopBeep, "loopBeep:d=16,o=6,b=300:a,4p,a,1p,4p", true);
 
-Melody loopBeep = {
-    {NOTE_A6, 0, NOTE_A6, 0},
-    {50, 200, 50, 1000},
-    true
-};
\ No newline at end of file
+#endif
@@ -1,31 +1,43 @@
 #include <Arduino.h>
 #include "Animation.h"
+#include "Profiler.h"
+#include "Trace.h"
 #include HW_CONFIG
 
-Animation::Animation(DisplayType* display) : u8g2(display), animationRunning(false), playInReverse(false) {}
+Animation::Animation(DisplayType* display) : u8g2(display), assets(nullptr), animationFrames(nullptr), animationRunning(false), playInReverse(false) {}
+
+/**
+ * Sets the asset pack the animations are looked up in.
+ */
+void Animation::setAssets(const AssetPack* assets) {
+    this->assets = assets;
+}
 
 /**
  * Starts the animation with the provided frames, duration, and other parameters.
+ * Nothing is shown if the asset pack doesn't hold the animation.
  *
- * @param frames An array of bitmaps representing the animation frames.
- * @param frameCount The number of frames in the animation.
+ * @param id The animation in the asset pack.
+ * @param frameCount The number of frames to play, at most the frames of the asset.
  * @param loop Whether the animation should loop.
  * @param reverse Whether the animation should play in reverse.
  * @param durationMs The duration of the animation in milliseconds. If 0, the duration is calculated based on the frame delay.
- * @param width The width of each animation frame.
- * @param height The height of each animation frame.
  */
-void Animation::start(const unsigned char frames[][BITMAP_LENGTH], int frameCount, bool loop, bool reverse, unsigned long durationMs, int width, int height) {
-    animationFrames = frames;
-    totalFrames = frameCount;
+void Animation::start(AssetId id, int frameCount, bool loop, bool reverse, unsigned long durationMs) {
+    animationFrames = assets != nullptr ? assets->get(id) : nullptr;
+    if (animationFrames == nullptr) {
+        animationRunning = false;
+        return;
+    }
+    totalFrames = min(frameCount, (int)animationFrames->frameCount);
     loopAnimation = loop;
     playInReverse = reverse; // Set reverse playback flag
     animationRunning = true;
 
     // Initialize current frame correctly based on direction
     currentFrame = playInReverse ? totalFrames - 1 : 0;
-    frameWidth = width;
-    frameHeight = height;
+    frameWidth = animationFrames->width;
+    frameHeight = animationFrames->height;
     frameDelay = DEFAULT_FRAME_DELAY;
 
     if (durationMs == 0) {
@@ -41,7 +53,10 @@ void Animation::start(const unsigned char frames[][BITMAP_LENGTH], int frameCoun
     frameY = (u8g2->getHeight() - frameHeight) / 2;
 
     u8g2->clearBuffer();
-    u8g2->drawXBM(frameX, frameY, frameWidth, frameHeight, animationFrames[currentFrame]);
+    u8g2->drawXBM(frameX, frameY, frameWidth, frameHeight, animationFrames->frame(currentFrame));
+
+    PROFILE_SCOPE(PROBE_I2C);
+    TRACE_SPAN_ARG("frame", currentFrame);
     u8g2->sendBuffer();
 }
 
@@ -91,17 +106,17 @@ void Animation::update() {
 
         // Display the current frame
         u8g2->clearBuffer();
-        u8g2->drawXBM(frameX, frameY, frameWidth, frameHeight, animationFrames[currentFrame]);
+        u8g2->drawXBM(frameX, frameY, frameWidth, frameHeight, animationFrames->frame(currentFrame));
         
-        if (digitalRead(SWITCH_PIN)==LOW){
+        if (digitalRead(Board::switchPin)==LOW){
             u8g2->setDrawColor(2);
-            u8g2->drawBox(0,0,128,32);
+            u8g2->drawBox(0,0,Board::displayWidth,Board::displayHeight);
             u8g2->setDrawColor(1);
         }
 
+        PROFILE_SCOPE(PROBE_I2C);
+        TRACE_SPAN_ARG("frame", currentFrame);
         u8g2->sendBuffer();
-
-        
     }
 }
 
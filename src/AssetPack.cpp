@@ -0,0 +1,72 @@
+#include <Arduino.h>
+#include <esp_rom_crc.h>
+#include "AssetPack.h"
+
+AssetPack::AssetPack()
+    : partition(nullptr),
+      mapping(0),
+      base(nullptr),
+      index{} {}
+
+/**
+ * Finds the asset partition, checks the pack and maps it.
+ *
+ * @return false if there is no valid pack, every asset is then missing.
+ */
+bool AssetPack::begin() {
+    partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, ASSET_PARTITION_LABEL);
+    if (partition == nullptr) {
+        Serial.println("Asset partition not found");
+        return false;
+    }
+
+    AssetPackHeader header;
+    if (esp_partition_read(partition, 0, &header, sizeof(header)) != ESP_OK ||
+        header.magic != ASSET_PACK_MAGIC || header.version != ASSET_PACK_VERSION ||
+        header.size > partition->size ||
+        header.size < sizeof(header) + header.count * sizeof(AssetEntry)) {
+        Serial.println("Asset pack missing, upload with pio run -t upload or tools/pack_assets.py");
+        return false;
+    }
+
+    // Only the pack is mapped, the rest of the partition takes no MMU pages
+    const void *mapped;
+    if (esp_partition_mmap(partition, 0, header.size, ESP_PARTITION_MMAP_DATA, &mapped, &mapping) != ESP_OK) {
+        Serial.println("Asset pack could not be mapped");
+        return false;
+    }
+
+    const uint8_t *pack = (const uint8_t *)mapped;
+    if (esp_rom_crc32_le(0, pack + sizeof(header), header.size - sizeof(header)) != header.crc) {
+        Serial.println("Asset pack corrupted");
+        esp_partition_munmap(mapping);
+        return false;
+    }
+
+    const AssetEntry *entries = (const AssetEntry *)(pack + sizeof(header));
+    for (uint16_t i = 0; i < header.count; i++) {
+        const AssetEntry &entry = entries[i];
+        uint32_t frameSize = (entry.width + 7) / 8 * entry.height;
+
+        // Entries from a newer pack, or that don't hold their frames, are skipped
+        if (entry.id >= ASSET_COUNT || entry.offset > header.size ||
+            entry.length > header.size - entry.offset ||
+            (uint32_t)entry.frameCount * frameSize > entry.length)
+            continue;
+
+        index[entry.id] = {pack + entry.offset, entry.frameCount, entry.width, entry.height};
+    }
+
+    base = pack;
+    return true;
+}
+
+/**
+ * Looks up an asset.
+ *
+ * @return The asset, or nullptr if the pack doesn't hold it.
+ */
+const Asset *AssetPack::get(AssetId id) const {
+    if (id >= ASSET_COUNT || index[id].frameCount == 0) return nullptr;
+    return &index[id];
+}
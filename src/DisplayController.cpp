@@ -1,6 +1,10 @@
 #include "DisplayController.h"
 #include "bitmaps.h"
-#include <EEPROM.h>
+#include "TextFormat.h"
+#include "HeapGuard.h"
+#include "Profiler.h"
+#include "Trace.h"
+#include "InputController.h"
 #include HW_CONFIG
 
 #ifdef U8X8_HAVE_HW_SPI
@@ -21,8 +25,15 @@ DisplayController::DisplayController(int pinSDA, int pinSCL)
     : pinSDA(pinSDA),
       pinSCL(pinSCL),
       u8g2(U8G2_R0, U8X8_PIN_NONE),
-      animation(&u8g2)
-      {}
+      animation(&u8g2),
+      headLine(&u8g2),
+      valueLine(&u8g2),
+      shadowValid(false),
+      soundLevel(0),
+      stats{}
+      {
+        ssid[0] = '\0';
+      }
 
 void DisplayController::begin(int){
     Wire.begin(pinSDA, pinSCL);
@@ -30,6 +41,47 @@ void DisplayController::begin(int){
     // u8g2.setContrast(brightness);
 }
 
+/**
+ * Keeps the brightness, the sound icon and the SSID in step with the settings,
+ * so no frame has to read them back.
+ */
+void DisplayController::onSettingChanged(void *context, const SettingsData &settings, SettingId id) {
+    DisplayController *display = (DisplayController *)context;
+
+    switch (id) {
+    case SETTING_SCREEN_BRIGHTNESS:
+        display->setBrightness(settings.screenBrightness);
+        break;
+    case SETTING_SOUND_LEVEL:
+        display->soundLevel = settings.soundLevel;
+        break;
+    case SETTING_SSID:
+        display->setSsid(settings.ssid);
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * Updates the SSID shown on the info screen.
+ *
+ * @param ssid The SSID of the selected network.
+ */
+void DisplayController::setSsid(const char* ssid) {
+    strncpy(this->ssid, ssid, sizeof(this->ssid) - 1);
+    this->ssid[sizeof(this->ssid) - 1] = '\0';
+}
+
+/**
+ * Updates the totals shown on the stats screen.
+ *
+ * @param stats The totals from the session log.
+ */
+void DisplayController::setStats(const SessionStats& stats) {
+    this->stats = stats;
+}
+
 /**
  * Updates the display based on the current system state and encoder value.
  * If an animation is running, it will be updated. Otherwise, the time screen
@@ -43,8 +95,16 @@ void DisplayController::update(
     long int timer,
     long int position) {
 
-    if (animation.isRunning())
-    animation.update();
+    TRACE_SPAN_ARG("display", state);
+    HEAP_GUARD_BEGIN();
+
+    if (animation.isRunning()) {
+        // Animations send whole frames on their own, so the panel RAM no longer
+        // matches the shadow copy.
+        stopHardwareScroll();
+        shadowValid = false;
+        animation.update();
+    }
     
     else { //If animation has finished, resume normal operation.
         u8g2.clearBuffer();
@@ -119,24 +179,43 @@ void DisplayController::update(
             drawTimerSettingsCCW(position);
             break;
 
+        case STATE_SETTINGS_TIMER_ACCEL:
+            drawTimerSettingsAccel(position);
+            break;
+
+        case STATE_SETTINGS_TIMER_CLICK:
+            drawTimerSettingsClick(position);
+            break;
+
+        case STATE_SETTINGS_VOLUME:
+            drawVolumeSettings(position);
+            break;
+
         case STATE_INFO:
             drawInfo();
             break;
+
+        case STATE_STATS:
+            drawStats(position);
+            break;
             
         default:
             break;
         }
         drawBatteryLevel();
+        headLine.render();
+        valueLine.render();
 
-        if (digitalRead(SWITCH_PIN)==LOW){
+        if (digitalRead(Board::switchPin)==LOW){
             u8g2.setDrawColor(2);
-            u8g2.drawBox(0,0,128,32);
+            u8g2.drawBox(0,0,Board::displayWidth,Board::displayHeight);
             u8g2.setDrawColor(1);
         }
         
-        u8g2.sendBuffer();
+        flush();
     }
 
+    HEAP_GUARD_END();
 }
 
 /**
@@ -154,15 +233,15 @@ void DisplayController::drawTimeScreen(long int timer) {
     long int mm = toSeconds / 60;
     long int ss = toSeconds % 60;
 
-    char timeStr[6];
+    TextBuffer<12> timeStr;
+    timeStr.appendInt(mm, 2).append(':').appendInt(ss, 2);
     u8g2.setFont(Fonts::LargeNumber);
-    sprintf(timeStr, "%02ld:%02ld", mm, ss);
-    u8g2.drawStr(0, 32, timeStr);
+    u8g2.drawStr(0, Layout::timeBaseline, timeStr.c_str());
 
-    char tensOfSecondsStr[2];
-    sprintf(tensOfSecondsStr, "%1ld", (timer % 1000) / 100);
+    TextBuffer<4> tensOfSecondsStr;
+    tensOfSecondsStr.appendInt((timer % 1000) / 100);
     u8g2.setFont(Fonts::MediumText);
-    u8g2.drawStr(91, 32, tensOfSecondsStr);
+    u8g2.drawStr(Layout::tenthsX, Layout::timeBaseline, tensOfSecondsStr.c_str());
 
     // u8g2.drawXBMP(113, 14, 15, 16, image_download_bits);
 
@@ -172,21 +251,18 @@ void DisplayController::drawWifiSelect(long int timer) {
     u8g2.setFontMode(1);
     u8g2.setBitmapMode(1);
 
-    u8g2.setFont(Fonts::MediumText);
-    u8g2.setCursor(0, 20);
-
     switch (timer){
         case 0:
-            u8g2.print(".. Back");
+            valueLine.set(Fonts::MediumText, 0, Layout::valueBaseline, Layout::textWidth, ".. Back");
             break;
         case 1:
-            u8g2.print("CocaYJuampi");
+            valueLine.set(Fonts::MediumText, 0, Layout::valueBaseline, Layout::textWidth, "CocaYJuampi");
             break;
         case 2:
-            u8g2.print("Manuel");
+            valueLine.set(Fonts::MediumText, 0, Layout::valueBaseline, Layout::textWidth, "Manuel");
             break;
         case 3:
-            u8g2.print("SKYIRTWD");
+            valueLine.set(Fonts::MediumText, 0, Layout::valueBaseline, Layout::textWidth, "SKYIRTWD");
             break;
 
         default:
@@ -196,28 +272,18 @@ void DisplayController::drawWifiSelect(long int timer) {
 
 void DisplayController::drawAudioSettings(long int position)
 {
-    u8g2.setFontMode(1);
-    u8g2.setBitmapMode(1);
-
-    u8g2.setFont(Fonts::SmallText);
-    u8g2.setCursor(0, 12);
-    u8g2.print("Sound");
-    
-    u8g2.setFont(Fonts::MediumText);
-    u8g2.setCursor(0, 32);
-
     switch (position)
     {
     case 0:
-        u8g2.print("Muted");
+        drawSettingsText("Sound", "Muted");
         break;
 
     case 1:
-        u8g2.print("Alarms");
+        drawSettingsText("Sound", "Alarms");
         break;
 
     case 2:
-        u8g2.print("All sounds");
+        drawSettingsText("Sound", "All sounds");
         break;
 
     default:
@@ -228,48 +294,75 @@ void DisplayController::drawAudioSettings(long int position)
 
 void DisplayController::drawDisplaySettings(long int position)
 {
-    String valueText = String(position * 10) + "%";
+    TextBuffer<12> valueText;
+    valueText.appendInt(position * 10).append('%');
     drawSettingsText("Display brightness", valueText.c_str());
 }
 
 void DisplayController::drawLedringSettings(long int position)
 {
-    String valueText = String(position * 10) + "%";
+    TextBuffer<12> valueText;
+    valueText.appendInt(position * 10).append('%');
     drawSettingsText("Ring brightness", valueText.c_str());
 }
 
 void DisplayController::drawTimerSettings(long int position)
 {
-    u8g2.setFontMode(1);
-    u8g2.setBitmapMode(1);
-
-    u8g2.setFont(Fonts::SmallText);
-    u8g2.setCursor(0, 12);
-    u8g2.print("Timer settings");
-
-    u8g2.setFont(Fonts::MediumText);
-    u8g2.setCursor(0, 32);
-
-    if (position%2 == 0)
-        u8g2.print("CCW step");
-    else
-        u8g2.print("CW step");
-    
+    switch (position)
+    {
+    case 0:
+        drawSettingsText("Timer settings", "CCW step");
+        break;
+    case 1:
+        drawSettingsText("Timer settings", "CW step");
+        break;
+    case 2:
+        drawSettingsText("Timer settings", "Acceleration");
+        break;
+    case 3:
+        drawSettingsText("Timer settings", "Click window");
+        break;
+    default:
+        break;
+    }
 }
 
 void DisplayController::drawTimerSettingsCW(long int position)
 {
-    String valueText = String(position * 1000) + "ms";
+    TextBuffer<16> valueText;
+    valueText.appendInt(position * 1000).append("ms");
     drawSettingsText("CW step", valueText.c_str());
 
 }
 
 void DisplayController::drawTimerSettingsCCW(long int position)
 {
-    String valueText = String(position * 1000) + "ms";
+    TextBuffer<16> valueText;
+    valueText.appendInt(position * 1000).append("ms");
     drawSettingsText("CCW step", valueText.c_str());
 }
 
+void DisplayController::drawTimerSettingsAccel(long int position)
+{
+    const char* levels[INPUT_ACCEL_MAX_LEVEL + 1] = {"Off", "Low", "Medium", "High"};
+    if (position < 0 || position > INPUT_ACCEL_MAX_LEVEL) return;
+    drawSettingsText("Acceleration", levels[position]);
+}
+
+void DisplayController::drawTimerSettingsClick(long int position)
+{
+    TextBuffer<16> valueText;
+    valueText.appendInt(position * INPUT_MULTI_CLICK_STEP_MS).append("ms");
+    drawSettingsText("Click window", valueText.c_str());
+}
+
+void DisplayController::drawVolumeSettings(long int position)
+{
+    TextBuffer<16> valueText;
+    valueText.appendInt(position * 10).append("%");
+    drawSettingsText("Volume", valueText.c_str());
+}
+
 void DisplayController::drawSettings(long int position)
 {
 
@@ -287,6 +380,9 @@ void DisplayController::drawSettings(long int position)
     case 3:
         drawSettingsText("Settings", "Timer");
         break;
+    case 4:
+        drawSettingsText("Settings", "Volume");
+        break;
     
     default:
         break;
@@ -297,16 +393,42 @@ void DisplayController::drawInfo() {
     u8g2.setFontMode(1);
     u8g2.setBitmapMode(1);
 
-    char ssid[32]; // Buffer to store the SSID
-    EEPROM.get(0, ssid); // Read the SSID from EEPROM starting at address 0
-
-    u8g2.setFont(Fonts::MediumText);
-    u8g2.setCursor(0, 20);
+    u8g2.setFont(Fonts::SmallText);
+    u8g2.setCursor(0, Layout::headBaseline);
     u8g2.print("SSID:");
-    u8g2.setCursor(0, 40);
-    u8g2.print(ssid);
+    valueLine.set(Fonts::MediumText, 0, Layout::valueBaseline, Layout::textWidth, ssid);
+
+    }
+
+/**
+ * Draws one page of the session totals: today, the last 7 days, or the number
+ * of sessions ever logged.
+ *
+ * @param position The page to draw.
+ */
+void DisplayController::drawStats(long int position) {
+    TextBuffer<24> valueText;
+
+    switch (position)
+    {
+    case 0:
+    case 1: {
+        uint32_t seconds = position == 0 ? stats.today.activeSeconds : stats.weekSeconds;
+        uint16_t sessions = position == 0 ? stats.today.sessions : stats.weekSessions;
+        valueText.appendInt(seconds / 3600).append("h ").appendInt(seconds / 60 % 60, 2).append("m, ")
+                 .appendInt(sessions).append(sessions == 1 ? " run" : " runs");
+        drawSettingsText(position == 0 ? "Today" : "Last 7 days", valueText.c_str());
+        break;
+    }
+    case 2:
+        valueText.appendInt(stats.totalSessions).append(" runs");
+        drawSettingsText("All sessions", valueText.c_str());
+        break;
 
+    default:
+        break;
     }
+}
 
 /**
  * Puts the display into a low-power sleep mode.
@@ -314,41 +436,108 @@ void DisplayController::drawInfo() {
  * effectively turning off the display.
  */
 void DisplayController::sleepScreen(){
+    stopHardwareScroll();
     u8g2.setPowerSave(1);
     u8g2.clearBuffer();
     u8g2.sendBuffer();
+    shadowValid = false;
+}
+
+/**
+ * Sends the frame buffer to the display, skipping the transfer when nothing changed
+ * since the last frame. Otherwise only the changed tiles of each page are sent, so
+ * a scrolling line or a ticking number costs a few tiles instead of the whole buffer.
+ * A running hardware scroll is left alone while the frame is unchanged, and stopped
+ * with a full resend when it is not.
+ */
+void DisplayController::flush() {
+    uint8_t *buffer = u8g2.getBufferPtr();
+    int tileWidth = u8g2.getBufferTileWidth();
+    int tileHeight = u8g2.getBufferTileHeight();
+    int pageStride = tileWidth * 8;
+    size_t bufferSize = pageStride * tileHeight;
+
+    if (bufferSize > sizeof(shadowBuffer)) {
+        PROFILE_SCOPE(PROBE_I2C);
+        TRACE_SPAN("i2c");
+        u8g2.sendBuffer();
+        return;
+    }
+
+    if (shadowValid && memcmp(buffer, shadowBuffer, bufferSize) == 0) {
+        headLine.onFlushed();
+        valueLine.onFlushed();
+        return;
+    }
+
+    PROFILE_SCOPE(PROBE_I2C);
+    TRACE_SPAN("i2c");
+
+    if (headLine.isHardwareScrolling() || valueLine.isHardwareScrolling()) {
+        stopHardwareScroll();
+        shadowValid = false;
+    }
+
+    if (!shadowValid) {
+        u8g2.sendBuffer();
+    } else {
+        for (int page = 0; page < tileHeight; page++) {
+            int firstTile = -1;
+            int lastTile = -1;
+            for (int tile = 0; tile < tileWidth; tile++) {
+                int offset = page * pageStride + tile * 8;
+                if (memcmp(buffer + offset, shadowBuffer + offset, 8) != 0) {
+                    if (firstTile < 0) firstTile = tile;
+                    lastTile = tile;
+                }
+            }
+            if (firstTile >= 0)
+                u8g2.updateDisplayArea(firstTile, page, lastTile - firstTile + 1, 1);
+        }
+    }
+
+    memcpy(shadowBuffer, buffer, bufferSize);
+    shadowValid = true;
+
+    headLine.onFlushed();
+    valueLine.onFlushed();
+}
+
+void DisplayController::stopHardwareScroll() {
+    headLine.stopHardwareScroll();
+    valueLine.stopHardwareScroll();
 }
 
 void DisplayController::drawBatteryLevel() {
 
     u8g2.setFont(Fonts::Symbols);
-    switch (EEPROM.readUChar(EEPROM_PIEZO_MUTE_ADDR))
+    switch (soundLevel)
     {
 
     case 0:
-        u8g2.drawGlyph(107, 21, 326); // Sound off icon
+        u8g2.drawGlyph(Layout::soundIconX, Layout::soundIconBaseline, 326); // Sound off icon
         break;
         
     case 1:
-        u8g2.drawGlyph(107, 21, 433); // Alarms only icon
+        u8g2.drawGlyph(Layout::soundIconX, Layout::soundIconBaseline, 433); // Alarms only icon
         break;
 
     case 2:
-        u8g2.drawGlyph(107, 21, 484); // Sound on icon
+        u8g2.drawGlyph(Layout::soundIconX, Layout::soundIconBaseline, 484); // Sound on icon
         break;
 
     default:
         break;
     }
 
-    int level = analogRead(BATTERY_PIN);
-    int c_level = constrain(level, BATTERY_LOW_LEVEL, BATTERY_HIGH_LEVEL); 
-    int batPctg = map(c_level, BATTERY_LOW_LEVEL, BATTERY_HIGH_LEVEL, 0, 100);
+    int level = analogRead(Board::batteryPin);
+    int c_level = constrain(level, Board::batteryLowLevel, Board::batteryHighLevel); 
+    int batPctg = map(c_level, Board::batteryLowLevel, Board::batteryHighLevel, 0, 100);
 
     u8g2.setFont(Fonts::SmallText);
-    char batStr[5];
-    snprintf(batStr, sizeof(batStr), "%d%%", batPctg);
-    u8g2.drawStr(110, 32, batStr);
+    TextBuffer<5> batStr;
+    batStr.appendInt(batPctg).append('%');
+    u8g2.drawStr(Layout::batteryX, Layout::batteryBaseline, batStr.c_str());
     // u8g2.setCursor(90, 32);
     // u8g2.print(level);
 
@@ -358,20 +547,22 @@ void DisplayController::drawBatteryLevel() {
     // u8g2.drawStr(110, 32, levelStr);
 
     // u8g2.drawXBM(115, 16, 12, 15, battery_base);
-    // Serial.println(analogRead(BATTERY_PIN));
+    // Serial.println(analogRead(Board::batteryPin));
 
 }
 
+/**
+ * Draws a settings page with a small heading and a larger value below it. Lines
+ * that run into the status icons scroll instead of being clipped.
+ *
+ * @param headText The heading of the page.
+ * @param valueText The value shown under the heading.
+ */
 void DisplayController::drawSettingsText(const char* headText, const char* valueText) {
     u8g2.setFontMode(1);
     u8g2.setBitmapMode(1);
 
-    u8g2.setFont(Fonts::SmallText);
-    u8g2.setCursor(0, 12);
-    u8g2.print(headText);
-
-    u8g2.setFont(Fonts::MediumText);
-    u8g2.setCursor(0, 32);
-    u8g2.print(valueText);
+    headLine.set(Fonts::SmallText, 0, Layout::headBaseline, Layout::textWidth, headText);
+    valueLine.set(Fonts::MediumText, 0, Layout::valueBaseline, Layout::textWidth, valueText);
 
 }
\ No newline at end of file
@@ -0,0 +1,52 @@
+#include "HeapGuard.h"
+
+#ifdef RENDER_HEAP_GUARD
+
+static volatile TaskHandle_t watchedTask = nullptr;
+static volatile uint32_t allocations = 0;
+
+extern "C" {
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+static inline void countAllocation() {
+    if (watchedTask != nullptr && xTaskGetCurrentTaskHandle() == watchedTask)
+        allocations++;
+}
+
+void *__wrap_malloc(size_t size) {
+    countAllocation();
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+    countAllocation();
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    countAllocation();
+    return __real_realloc(ptr, size);
+}
+}
+
+/**
+ * Starts counting allocations made by the calling task.
+ */
+void HeapGuard::arm() {
+    allocations = 0;
+    watchedTask = xTaskGetCurrentTaskHandle();
+}
+
+/**
+ * Stops counting allocations.
+ *
+ * @return The number of allocations made since the guard was armed.
+ */
+uint32_t HeapGuard::disarm() {
+    watchedTask = nullptr;
+    return allocations;
+}
+
+#endif
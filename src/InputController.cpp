@@ -1,55 +1,209 @@
 #include <Arduino.h>
+#include <driver/gpio.h>
+#include <esp_timer.h>
 #include "InputController.h"
+#include "Trace.h"
 #include HW_CONFIG
 
+// Step for each (previous << 2 | current) pair of encoder pin states. Pairs
+// where both pins changed at once are impossible and marked 2.
+static const int8_t quadratureSteps[16] = {
+     0, -1,  1,  2,
+     1,  0,  2, -1,
+    -1,  2,  0,  1,
+     2,  1, -1,  0
+};
+
 InputController::InputController(int pinEncoder1, int pinEncoder2, int pinButton)
-    : pinEncoder1(pinEncoder1),
+    : currentPosition(0),
+      buttonHeld(false),
+      buttonPressStartTime(0),
+      pinEncoder1(pinEncoder1),
       pinEncoder2(pinEncoder2),
       pinButton(pinButton),
-      encoder(pinEncoder1, pinEncoder2, -1, -1, 2) {}
+      accelerationLevel(0),
+      accelerate(false),
+      maxClicks(1),
+      chords(false),
+      multiClickWindowMs(INPUT_MULTI_CLICK_MS),
+      chordSteps(0),
+      overflowCount(0),
+      quadratureErrors(0),
+      detentsCoalesced(0),
+      quadratureState(0),
+      stepCount(0),
+      buttonDown(false),
+      lastButtonEdge(0),
+      settleTimer(nullptr),
+      buttonLock(portMUX_INITIALIZER_UNLOCKED),
+      clickCount(0),
+      lastReleaseMs(0),
+      chorded(false),
+      lastDetentMs(0),
+      lastDetentDelta(0),
+      detentInterval(INPUT_ACCEL_SLOW_MS) {}
 
-void InputController::begin() {
+void InputController::begin(uint8_t accelerationLevel) {
     pinMode(pinButton, INPUT_PULLUP);
-    bounce.attach(pinButton, INPUT_PULLUP);
-    bounce.interval(5);
+    pinMode(pinEncoder1, INPUT_PULLUP);
+    pinMode(pinEncoder2, INPUT_PULLUP);
     buttonHeld = false;
-    
-    encoder.setEncoderType(EncoderType::FLOATING);
-    encoder.setBoundaries(-1000, 1000, true);
-    encoder.begin();
+    setAcceleration(accelerationLevel);
+    buttonDown = digitalRead(pinButton) == LOW;
+    quadratureState = (digitalRead(pinEncoder1) << 1) | digitalRead(pinEncoder2);
 
     // Retain the previous position value. This is defined as an extern variable in config and main
-    encoder.setEncoderValue(previousPosition);
+    currentPosition = previousPosition;
+
+    esp_timer_create_args_t timerArgs = {};
+    timerArgs.callback = onButtonSettled;
+    timerArgs.arg = this;
+    timerArgs.dispatch_method = ESP_TIMER_TASK;
+    timerArgs.name = "button_settle";
+    esp_timer_create(&timerArgs, &settleTimer);
+
+    attachInterruptArg(pinEncoder1, onEncoderEdge, this, CHANGE);
+    attachInterruptArg(pinEncoder2, onEncoderEdge, this, CHANGE);
+    attachInterruptArg(pinButton, onButtonEdge, this, CHANGE);
 }
 
+/**
+ * Drains the input events into currentPosition and lastAction. Detents are
+ * applied up to the first button action, which stops the drain so the state
+ * controller sees every press. Whatever is left is handled on the next pass.
+ * However many detents arrive, the state controller sees one position change.
+ *
+ * Gestures are judged from the edge timestamps, so a slow frame does not turn
+ * two quick clicks into two single ones.
+ */
 void InputController::update() {
     lastAction = NO_ACTION; // Reset last action
+    chordSteps = 0;
+    uint32_t detents = 0;
 
-    // Update the button state
-    bounce.update();
+    InputEvent event;
+    while (lastAction == NO_ACTION && events.pop(event)) {
+        switch (event.type) {
+        case INPUT_DETENT:
+            if (buttonHeld && chords) {
+                chordSteps += event.delta;
+                chorded = true;
+                clickCount = 0; // a chord cancels the clicks before it
+            } else {
+                applyDetent(event);
+                detents++;
+            }
+            break;
 
-    // Check for button press
-    if (bounce.fell()) {
-        buttonPressStartTime = millis();
-        buttonHeld = true;
-    }
-    
-    // Check for long press
-    if (buttonHeld && bounce.read() == LOW) {
-        if (millis() - buttonPressStartTime > BUTTON_LONG_PRESS_THRESHOLD) {
-            lastAction = BUTTON_LONG_PRESS;
-            buttonHeld = false; // Prevent multiple long press events
+        case INPUT_PRESS:
+            // Clicks whose window closed before this press are complete
+            if (clickCount > 0 && event.timeMs - lastReleaseMs > multiClickWindowMs)
+                dispatchClicks();
+            buttonPressStartTime = event.timeMs;
+            buttonHeld = true;
+            chorded = false;
+            break;
+
+        case INPUT_RELEASE:
+            if (!buttonHeld || chorded) {
+                buttonHeld = false;
+                break;
+            }
+            buttonHeld = false;
+            if (event.timeMs - buttonPressStartTime > BUTTON_LONG_PRESS_THRESHOLD) {
+                clickCount = 0;
+                lastAction = BUTTON_LONG_PRESS;
+                break;
+            }
+            clickCount++;
+            lastReleaseMs = event.timeMs;
+            if (clickCount >= maxClicks)
+                dispatchClicks();
+            break;
         }
     }
 
-    // Reset when button released
-    if (bounce.rose() && buttonHeld) {
-        buttonHeld = false;
-        lastAction = BUTTON_SHORT_PRESS;
+    if (lastAction == NO_ACTION && chordSteps != 0)
+        lastAction = chordSteps > 0 ? BUTTON_PRESS_ROTATE_CW : BUTTON_PRESS_ROTATE_CCW;
+
+    // No further click came within the window
+    if (lastAction == NO_ACTION && clickCount > 0 && !buttonHeld &&
+        millis() - lastReleaseMs > multiClickWindowMs)
+        dispatchClicks();
+
+    // Check for long press while the button is still down
+    if (lastAction == NO_ACTION && buttonHeld && !chorded &&
+        millis() - buttonPressStartTime > BUTTON_LONG_PRESS_THRESHOLD) {
+        lastAction = BUTTON_LONG_PRESS;
+        buttonHeld = false; // Prevent multiple long press events
+        clickCount = 0;
     }
 
-    // Check for rotary encoder movement
-    long int newPosition = encoder.getEncoderValue();
+    if (detents > 1)
+        detentsCoalesced += detents - 1;
+}
+
+/**
+ * Reports the clicks counted so far as a single, double or triple press.
+ */
+void InputController::dispatchClicks() {
+    const InputAction clickActions[INPUT_MAX_CLICKS] = {
+        BUTTON_SHORT_PRESS,
+        BUTTON_DOUBLE_PRESS,
+        BUTTON_TRIPLE_PRESS};
+
+    lastAction = clickActions[min(clickCount, (uint8_t)INPUT_MAX_CLICKS) - 1];
+    clickCount = 0;
+}
+
+/**
+ * Sets how strongly fast spins are accelerated.
+ *
+ * @param level The acceleration level, 0 (off) to INPUT_ACCEL_MAX_LEVEL.
+ */
+void InputController::setAcceleration(uint8_t level) {
+    accelerationLevel = min(level, (uint8_t)INPUT_ACCEL_MAX_LEVEL);
+}
+
+void InputController::onSettingChanged(void *context, const SettingsData &settings, SettingId id) {
+    InputController *input = (InputController *)context;
+    if (id == SETTING_ENCODER_ACCEL)
+        input->setAcceleration(settings.encoderAcceleration);
+    else if (id == SETTING_MULTI_CLICK)
+        input->multiClickWindowMs = settings.multiClickWindowMs;
+}
+
+void InputController::applyDetent(const InputEvent &event) {
+    currentPosition += detentStep(event);
+    if (currentPosition > INPUT_POSITION_MAX) currentPosition = INPUT_POSITION_MIN;
+    if (currentPosition < INPUT_POSITION_MIN) currentPosition = INPUT_POSITION_MAX;
+}
+
+/**
+ * Works out how far a detent moves the position. The time between detents is
+ * smoothed over the last few so a single quick flick doesn't jump, and the
+ * step grows with the square of the speed above INPUT_ACCEL_SLOW_MS, up to
+ * 1 + 4 * level steps per detent. Slow turns and direction changes always move
+ * exactly one step, so the last detents before stopping stay precise.
+ *
+ * @param event The detent, with the time its edge happened.
+ * @return The signed number of steps to move.
+ */
+long InputController::detentStep(const InputEvent &event) {
+    uint32_t interval = event.timeMs - lastDetentMs;
+    bool sameDirection = event.delta == lastDetentDelta;
+    lastDetentMs = event.timeMs;
+    lastDetentDelta = event.delta;
+
+    if (!accelerate || accelerationLevel == 0 || !sameDirection || interval >= INPUT_ACCEL_SLOW_MS) {
+        detentInterval = INPUT_ACCEL_SLOW_MS;
+        return event.delta;
+    }
+
+    detentInterval = (3 * detentInterval + interval) / 4;
+    uint32_t speed = INPUT_ACCEL_SLOW_MS - detentInterval;
+    long step = 1 + accelerationLevel * speed * speed * 4 / (INPUT_ACCEL_SLOW_MS * INPUT_ACCEL_SLOW_MS);
+    return event.delta * step;
 }
 
 long int InputController::getPosition() {
@@ -57,7 +211,86 @@ long int InputController::getPosition() {
 }
 
 void InputController::setPosition(long int pos) {
-    encoder.setEncoderValue(pos);
     currentPosition = pos;
 }
 
+// The encoder and button handlers share the GPIO interrupt and never preempt
+// each other, and the settle timer pushes with interrupts masked, so together
+// they are the single producer of the queue.
+void IRAM_ATTR InputController::push(InputEventType type, int8_t delta, uint32_t timeMs) {
+    TRACE_INSTANT("input", type);
+    if (!events.push({type, delta, timeMs}))
+        overflowCount++;
+}
+
+/**
+ * Decodes one quadrature edge. Steps are counted until a full detent has
+ * passed, and impossible transitions, where a missed edge leaves the direction
+ * unknown, are counted and skipped.
+ */
+void IRAM_ATTR InputController::onEncoderEdge(void *context) {
+    InputController *input = (InputController *)context;
+
+    uint8_t state = (gpio_get_level((gpio_num_t)input->pinEncoder1) << 1) |
+                    gpio_get_level((gpio_num_t)input->pinEncoder2);
+    int8_t step = quadratureSteps[(input->quadratureState << 2) | state];
+    input->quadratureState = state;
+
+    if (step == 2) {
+        input->quadratureErrors++;
+        return;
+    }
+
+    input->stepCount += step;
+    if (input->stepCount >= INPUT_STEPS_PER_DETENT || input->stepCount <= -INPUT_STEPS_PER_DETENT) {
+        int8_t delta = input->stepCount > 0 ? 1 : -1;
+        input->stepCount = 0;
+        input->push(INPUT_DETENT, delta, esp_timer_get_time() / 1000);
+    }
+}
+
+/**
+ * Debounces the button. The first edge after a quiet period is taken at once,
+ * so a press costs no debounce delay, and edges within INPUT_DEBOUNCE_US of
+ * the previous one are contact bounce and ignored. Every edge rearms the
+ * settle timer, which catches a level the ignored edges left behind.
+ */
+void IRAM_ATTR InputController::onButtonEdge(void *context) {
+    InputController *input = (InputController *)context;
+    int64_t now = esp_timer_get_time();
+
+    bool down = gpio_get_level((gpio_num_t)input->pinButton) == 0;
+    bool quiet = now - input->lastButtonEdge >= INPUT_DEBOUNCE_US;
+    input->lastButtonEdge = now;
+
+    esp_timer_stop(input->settleTimer);
+    esp_timer_start_once(input->settleTimer, INPUT_DEBOUNCE_US);
+
+    if (!quiet || down == input->buttonDown) return;
+
+    input->buttonDown = down;
+    input->push(down ? INPUT_PRESS : INPUT_RELEASE, 0, now / 1000);
+}
+
+/**
+ * Re-reads the button once it has been quiet for INPUT_DEBOUNCE_US. A tap or
+ * a glitch shorter than the debounce window has its second edge ignored, and
+ * without this the button would stay down until the next edge and turn into
+ * a long press. The missing edge is pushed with the time of the last bounce.
+ *
+ * Runs from the esp_timer task, so interrupts are masked while it touches
+ * the handler state and the queue, keeping the handlers its single producer.
+ */
+void InputController::onButtonSettled(void *context) {
+    InputController *input = (InputController *)context;
+    bool down = gpio_get_level((gpio_num_t)input->pinButton) == 0;
+
+    portENTER_CRITICAL(&input->buttonLock);
+    // A later edge has rearmed the timer, which will run again
+    bool settled = esp_timer_get_time() - input->lastButtonEdge >= INPUT_DEBOUNCE_US;
+    if (settled && down != input->buttonDown) {
+        input->buttonDown = down;
+        input->push(down ? INPUT_PRESS : INPUT_RELEASE, 0, input->lastButtonEdge / 1000);
+    }
+    portEXIT_CRITICAL(&input->buttonLock);
+}
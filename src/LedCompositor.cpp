@@ -0,0 +1,117 @@
+#include "LedCompositor.h"
+#include "PixelKernels.h"
+#include "Waveform.h"
+
+LedCompositor::LedCompositor() {
+    stopAll();
+}
+
+/**
+ * Starts an effect on its layer, replacing whatever that layer was running.
+ * Effects on other layers keep running.
+ *
+ * @param effect The effect to start.
+ * @param shown The ring as currently shown, copied for snapshot effects.
+ * @param now The current time in milliseconds.
+ */
+void LedCompositor::start(const LedEffect &effect, const uint32_t *shown, unsigned long now) {
+    Layer &layer = layers[effect.layer];
+
+    if (effect.source == SOURCE_SNAPSHOT)
+        memcpy(layer.pixels, shown, sizeof(layer.pixels));
+    else
+        for (int i = 0; i < Board::numLeds; i++)
+            layer.pixels[i] = effect.color;
+
+    layer.effect = &effect;
+    layer.startTime = now;
+}
+
+void LedCompositor::stop(LedLayer layer) {
+    layers[layer].effect = nullptr;
+}
+
+void LedCompositor::stopAll() {
+    for (int i = 0; i < LEDRING_LAYER_COUNT; i++)
+        layers[i].effect = nullptr;
+}
+
+bool LedCompositor::isActive(LedLayer layer) {
+    return layers[layer].effect != nullptr;
+}
+
+/**
+ * Draws the active layers over the base ring, bottom layer first. Layers whose
+ * timeline has ended are removed.
+ *
+ * @param base The ring rendered for the current state.
+ * @param output The array receiving the composed ring. May alias `base`.
+ * @param now The current time in milliseconds.
+ */
+void LedCompositor::compose(const uint32_t *base, uint32_t *output, unsigned long now) {
+    if (output != base)
+        memcpy(output, base, sizeof(uint32_t) * Board::numLeds);
+
+    for (int l = 0; l < LEDRING_LAYER_COUNT; l++) {
+        Layer &layer = layers[l];
+        if (layer.effect == nullptr) continue;
+
+        bool finished;
+        uint8_t opacity = opacityAt(*layer.effect, now - layer.startTime, finished);
+        if (finished) {
+            layer.effect = nullptr;
+            continue;
+        }
+        if (opacity == 0) continue;
+
+        if (layer.effect->blend == BLEND_NORMAL) {
+            PixelKernels::blendRing(output, layer.pixels, output, Board::numLeds, opacity);
+        } else {
+            for (int i = 0; i < Board::numLeds; i++)
+                output[i] = PixelKernels::addSaturate(output[i], PixelKernels::blend(0, layer.pixels[i], opacity));
+        }
+    }
+}
+
+/**
+ * Evaluates the opacity timeline of an effect.
+ *
+ * @param effect The effect.
+ * @param elapsed The time since the effect started, in milliseconds.
+ * @param finished Set to true once a non-looping timeline is past its last keyframe.
+ * @return The opacity of the layer.
+ */
+uint8_t LedCompositor::opacityAt(const LedEffect &effect, unsigned long elapsed, bool &finished) {
+    const Keyframe *keys = effect.keys;
+
+    // Effects built outside the KEYFRAMES table have no compile-time check
+    if (effect.keyCount < 2) {
+        finished = !effect.loop;
+        return effect.keyCount == 1 ? keys[0].opacity : 0;
+    }
+
+    uint16_t duration = keys[effect.keyCount - 1].timeMs;
+
+    finished = false;
+    if (elapsed >= duration) {
+        if (!effect.loop || duration == 0) {
+            finished = true;
+            return keys[effect.keyCount - 1].opacity;
+        }
+        elapsed %= duration;
+    }
+
+    int k = 0;
+    while (k < effect.keyCount - 2 && elapsed >= keys[k + 1].timeMs)
+        k++;
+
+    const Keyframe &from = keys[k];
+    const Keyframe &to = keys[k + 1];
+    uint8_t progress = 255;
+    if (to.timeMs > from.timeMs)
+        progress = (elapsed - from.timeMs) * 255 / (to.timeMs - from.timeMs);
+    if (effect.easing == EASE_IN_OUT)
+        progress = Waveform::easeInOut(progress);
+
+    return from.opacity + ((int)to.opacity - from.opacity) * progress / 255;
+}
@@ -0,0 +1,123 @@
+#include "LedOutput.h"
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+
+LedOutput::LedOutput()
+    : lastWriteMicros(0),
+      framesSent(0),
+      framesRejected(0),
+      pin(-1),
+      frameLength(0),
+      txBuffer(nullptr),
+      channel(nullptr),
+      encoder(nullptr),
+      doneCallback(nullptr),
+      doneContext(nullptr),
+      inFlight(false),
+      doneTime(0)
+      {}
+
+/**
+ * Sets up the RMT channel and the WS2812 bit encoder. The transmit buffer is
+ * allocated here, once, so frames can be queued without touching the heap.
+ *
+ * @param pin The data pin of the strip.
+ * @param frameLength The number of bytes in a frame, three per pixel.
+ * @return true if the channel is ready.
+ */
+bool LedOutput::begin(int pin, size_t frameLength) {
+    this->pin = pin;
+    this->frameLength = frameLength;
+    txBuffer = (uint8_t *)heap_caps_malloc(frameLength, MALLOC_CAP_INTERNAL);
+    if (txBuffer == nullptr) return false;
+
+    rmt_tx_channel_config_t channelConfig = {};
+    channelConfig.gpio_num = (gpio_num_t)pin;
+    channelConfig.clk_src = RMT_CLK_SRC_DEFAULT;
+    channelConfig.resolution_hz = LED_RMT_RESOLUTION_HZ;
+    channelConfig.mem_block_symbols = SOC_RMT_MEM_WORDS_PER_CHANNEL;
+    channelConfig.trans_queue_depth = 1;
+    if (rmt_new_tx_channel(&channelConfig, &channel) != ESP_OK) return false;
+
+    rmt_bytes_encoder_config_t encoderConfig = {};
+    encoderConfig.bit0.level0 = 1;
+    encoderConfig.bit0.duration0 = LED_T0H_TICKS;
+    encoderConfig.bit0.level1 = 0;
+    encoderConfig.bit0.duration1 = LED_T0L_TICKS;
+    encoderConfig.bit1.level0 = 1;
+    encoderConfig.bit1.duration0 = LED_T1H_TICKS;
+    encoderConfig.bit1.level1 = 0;
+    encoderConfig.bit1.duration1 = LED_T1L_TICKS;
+    encoderConfig.flags.msb_first = 1;
+    if (rmt_new_bytes_encoder(&encoderConfig, &encoder) != ESP_OK) return false;
+
+    rmt_tx_event_callbacks_t callbacks = {};
+    callbacks.on_trans_done = onTransmitDone;
+    rmt_tx_register_event_callbacks(channel, &callbacks, this);
+
+    return rmt_enable(channel) == ESP_OK;
+}
+
+/**
+ * Queues a frame and returns without waiting for it to be sent.
+ *
+ * @param grb The frame, three bytes per pixel in the order sent to the strip.
+ * @return false if the previous frame is still in flight and this one was not queued.
+ */
+bool LedOutput::write(const uint8_t *grb) {
+    unsigned long start = micros();
+
+    if (channel == nullptr || busy()) {
+        framesRejected++;
+        return false;
+    }
+
+    memcpy(txBuffer, grb, frameLength);
+
+    rmt_transmit_config_t transmitConfig = {};
+    transmitConfig.loop_count = 0;
+    transmitConfig.flags.eot_level = 0;
+
+    inFlight = true;
+    if (rmt_transmit(channel, encoder, txBuffer, frameLength, &transmitConfig) != ESP_OK) {
+        inFlight = false;
+        framesRejected++;
+        return false;
+    }
+
+    framesSent++;
+    lastWriteMicros = micros() - start;
+    return true;
+}
+
+/**
+ * Checks whether a frame is still being sent, or the line is still held low for
+ * the reset time that latches it.
+ *
+ * @return true if a new frame can't be queued yet.
+ */
+bool LedOutput::busy() {
+    if (inFlight) return true;
+    return (uint32_t)esp_timer_get_time() - doneTime < LED_RESET_US;
+}
+
+/**
+ * Registers a function called when a frame has been sent. It runs in interrupt
+ * context, so it must be short and placed in IRAM.
+ *
+ * @param callback The function to call, or nullptr to remove it.
+ * @param context The argument passed to the function.
+ */
+void LedOutput::setDoneCallback(DoneCallback callback, void *context) {
+    doneCallback = callback;
+    doneContext = context;
+}
+
+bool IRAM_ATTR LedOutput::onTransmitDone(rmt_channel_handle_t channel, const rmt_tx_done_event_data_t *event, void *context) {
+    LedOutput *output = (LedOutput *)context;
+    output->doneTime = (uint32_t)esp_timer_get_time();
+    output->inFlight = false;
+    if (output->doneCallback != nullptr)
+        output->doneCallback(output->doneContext);
+    return false;
+}
@@ -1,175 +1,362 @@
 #include "LedRingController.h"
-#include <Adafruit_NeoPixel.h>
 #include HW_CONFIG
-#include "EEPROM.h"
-
-LedRingController::LedRingController(int numLeds, int ledPin)
-  : numLeds(numLeds),
-    ledPin(ledPin),
-    strip(numLeds, ledPin, NEO_GRB + NEO_KHZ800)
+#include "InputController.h"
+#include "Profiler.h"
+#include "Trace.h"
+
+LedRingController::LedRingController()
+  : deltaTCw(1000),
+    deltaTCcw(10000),
+    showsPerSecond(0),
+    framesSuppressed(0),
+    showMicros(0),
+    ditherMicros(0),
+    ditherMaxMicros(0),
+    framePending(false),
+    lastSendTime(0),
+    metricsWindowStart(0),
+    showsInWindow(0),
+    lut(luts[0]),
+    ditherTimer(nullptr),
+    dithering(false),
+    ditherRefreshing(false),
+    frameLock(portMUX_INITIALIZER_UNLOCKED)
 {}
 
 void LedRingController::begin(int brightness) {
-    strip.begin();
-    this->brightness = brightness;
-    strip.setBrightness(brightness);
-    strip.clear();
-    strip.show();
+    for (int c = 0; c < Board::ledChannels; c++)
+        outputs[c].begin(Board::ledPins[c], Board::ledCounts[c] * 3);
+    setBrightness(brightness);
+    clearFrame();
+    memcpy(composed, frame, sizeof(composed));
+    PixelKernels::applyLut(composed, pixels, numLeds, lut);
+    transmit();
+
+    esp_timer_create_args_t timerArgs = {};
+    timerArgs.callback = onDitherTimer;
+    timerArgs.arg = this;
+    timerArgs.dispatch_method = ESP_TIMER_TASK;
+    timerArgs.name = "led_dither";
+    timerArgs.skip_unhandled_events = true;
+    esp_timer_create(&timerArgs, &ditherTimer);
 }
 
-void LedRingController::update(SystemState state, long int encoder, long int timer, long int initialTimer){
-  if (animationRunning) updateAnimation();
-  else{
-    switch (state)
-    {
-    case STATE_TIMER_SELECT:
-      LedRingTimeScreen(timer, encoder);
-      break;
-    case STATE_PULSE_SELECT:
-      LedRingTimeScreen(timer, encoder);
-      break;
-    case STATE_TIMER_RUN:
-      LedRingTimeCountdown(timer, initialTimer, encoder);
-      break;
-    case STATE_PULSE_RUN:
-      LedRingTimeCountdown(timer, initialTimer, encoder);
-      break;
-    case STATE_TIMER_PAUSED:
-      LedRingCountdownPaused(timer, initialTimer, encoder);
-      break;
-    case STATE_STOPWATCH_RUN:
-      LedRingStopwatchRun(timer);
-      break;
-    case STATE_MODE_SELECT:
-      LedRingModeSelect(abs(encoder), 6);
-      break;
-    case STATE_SETTINGS_LEDRING:
-      LedringSingleColor(strip.Color(255, 255, 255));
-      break;
-    case STATE_SETTINGS:
-      LedRingModeSelect(abs(encoder), 4);
-      break;
-    case STATE_SETTINGS_TIMER:
-      LedRingModeSelect(abs(encoder), 2);
-      break;
-    case STATE_SETTINGS_TIMER_CW:
-      LedRingSettingsSelect(encoder, 10, 1);
-      break;
-    case STATE_SETTINGS_TIMER_CCW:
-      LedRingSettingsSelect(encoder, 60, 10);
-      break;
-    case STATE_SETTINGS_DISPLAY:
-      LedRingSettingsSelect(encoder, 25, 0);
-      break;
+/**
+ * Sets the brightness, 0-255, by rebuilding the lookup table. The refresh
+ * timer may be reading the active table, so the spare one is rebuilt and
+ * swapped in.
+ */
+void LedRingController::setBrightness(int brightness) {
+    this->brightness = brightness;
+
+    // A refresh that started before the last swap may still read the spare
+    uint16_t *spare = lut == luts[0] ? luts[1] : luts[0];
+    while (ditherRefreshing)
+        taskYIELD();
+    PixelKernels::buildLut(spare, brightness, LED_GAMMA);
+    lut = spare;
+}
 
+/**
+ * Follows the brightness and the timer steps the time screen is scaled by.
+ */
+void LedRingController::onSettingChanged(void *context, const SettingsData &settings, SettingId id) {
+    LedRingController *ledRing = (LedRingController *)context;
+
+    switch (id) {
+    case SETTING_LEDRING_BRIGHTNESS:
+        ledRing->setBrightness(settings.ledRingBrightness);
+        break;
+    case SETTING_DELTA_T_CW:
+        ledRing->deltaTCw = settings.deltaTCw;
+        break;
+    case SETTING_DELTA_T_CCW:
+        ledRing->deltaTCcw = settings.deltaTCcw;
+        break;
     default:
-      break;
+        break;
     }
-  }
 }
 
-// Start an animation for transition between states with timer and encoder parameters
-void LedRingController::startAnimation(ledRingAnimation anim, long int timer, long int initialTimer, long int encoder, int totalFrames){
-  animationRunning = true;
-  animation = anim;
-  currentFrame = 0;
-  animationStartTime = millis();
-  this->totalFrames = totalFrames;
-
-  // Populate initialState with the current LED state
-  for (int i = 0; i < numLeds; i++) {
-    initialState[i] = strip.getPixelColor(i);
-    endState[i] = strip.Color(0,0,0); // Default endState is off (black)
-  }
+/**
+ * Switches between the dithered output, refreshed at LED_DITHER_REFRESH_HZ from
+ * a timer, and the direct output, sent from show() only when the frame changes.
+ * Switching off returns once no refresh is running, so the caller owns the
+ * pixel buffers again.
+ *
+ * @param enabled true to dither.
+ */
+void LedRingController::setDithering(bool enabled) {
+    if (ditherTimer == nullptr || LED_DITHER_REFRESH_HZ == 0 || enabled == dithering) return;
+
+    if (enabled) {
+        memcpy(published, composed, sizeof(published));
+        memset(residual, 0, sizeof(residual));
+        dithering = true;
+        esp_timer_start_periodic(ditherTimer, 1000000 / LED_DITHER_REFRESH_HZ);
+    } else {
+        // esp_timer_stop doesn't wait for a callback that is already running
+        esp_timer_stop(ditherTimer);
+        while (ditherRefreshing)
+            taskYIELD();
+        dithering = false;
+        framePending = true;
+    }
+}
 
-  switch (anim)
-  {
-  case LEDRING_PAUSE_TIMER:
-    singleColorRingCounting(timer, initialTimer, encoder < 0, strip.Color(255, 255, 0), endState);
-    break;
+/**
+ * Composes the active effects over the base frame and sends the result to the
+ * LEDs, applying brightness and gamma through the lookup table while writing
+ * the pixel buffer. The bytes are compared with the last
+ * frame sent, so brightness changes count as changes, and an identical frame
+ * is not sent again. The transfer runs on the RMT and this returns immediately.
+ *
+ * Below LED_DITHER_MAX_BRIGHTNESS, a frame whose levels fall between two
+ * output steps is dithered instead, and only handed over to the refresh timer.
+ * The timer stops again as soon as the frame is exact, so static screens at
+ * normal brightness are not resent.
+ */
+void LedRingController::show() {
+    unsigned long start = micros();
+    compositor.compose(frame, composed, millis());
+
+    setDithering(brightness < LED_DITHER_MAX_BRIGHTNESS && PixelKernels::hasFraction(composed, numLeds, lut));
+
+    // The timer picks the frame up on its next refresh
+    if (dithering) {
+        portENTER_CRITICAL(&frameLock);
+        memcpy(published, composed, sizeof(published));
+        portEXIT_CRITICAL(&frameLock);
+        showMicros = micros() - start;
+        return;
+    }
 
-  case LEDRING_START_TIMER:
-    singleColorRingCounting(timer, initialTimer, encoder < 0, strip.Color(255, 0, 0), endState);
-    break;
+    PixelKernels::applyLut(composed, pixels, numLeds, lut);
 
-  case LEDRING_FINISHED_TIMER:
-    singleColorRing(strip.Color(0, 0, 0), initialState);
-    singleColorRing(strip.Color(255, 255, 255), endState);
-    break;
+    if (!framePending && memcmp(pixels, sentPixels, sizeof(pixels)) == 0)
+        framesSuppressed++;
+    else
+        transmit();
+    showMicros = micros() - start;
+}
+
+/**
+ * Queues the pixel buffer on the output. If the previous frame is still in
+ * flight the new one is kept and sent by the next update() instead of waiting
+ * for the line.
+ */
+void LedRingController::transmit() {
+    framePending = !writeOutputs();
+    if (framePending) return;
+
+    memcpy(sentPixels, pixels, sizeof(pixels));
+    lastSendTime = millis();
+    countShow();
+}
 
-  case LEDRING_RETURN_MAIN_MENU:
-    for (int i = abs(encoder)%8*2; i < abs(encoder)%8*2+2; i++){
-      endState[i] = strip.Color(0, 255, 255);
+/**
+ * Sends the published frame with the fractions of the brightness scaling
+ * diffused over time. Runs from the esp_timer task, so the loop never pays for
+ * it. A static frame without fractions is sent once and then suppressed like
+ * in the direct output.
+ */
+void LedRingController::refreshDithered() {
+    if (outputsBusy()) return;
+    unsigned long start = micros();
+
+    portENTER_CRITICAL(&frameLock);
+    memcpy(ditherFrame, published, sizeof(ditherFrame));
+    portEXIT_CRITICAL(&frameLock);
+
+    const uint16_t *table = lut;
+    bool exact = PixelKernels::applyLutDithered(ditherFrame, pixels, numLeds, table, residual);
+    if (exact && memcmp(pixels, sentPixels, sizeof(pixels)) == 0 &&
+        millis() - lastSendTime < LEDRING_FORCED_REFRESH_MS) {
+        framesSuppressed++;
+    } else if (writeOutputs()) {
+        memcpy(sentPixels, pixels, sizeof(pixels));
+        lastSendTime = millis();
+        countShow();
     }
-    break;
 
-  case LEDRING_PREPARE_SLEEP:
-    singleColorRing(strip.Color(0, 0, 0), endState);
-    break;
+    ditherMicros = micros() - start;
+    if (ditherMicros > ditherMaxMicros)
+        ditherMaxMicros = ditherMicros;
+}
 
-  case LEDRING_MODE_SELECT:
-    singleColorRing(strip.Color(0, 0, 0), endState);
-    break;
+void LedRingController::onDitherTimer(void *context) {
+    LedRingController *ledRing = (LedRingController *)context;
+    ledRing->ditherRefreshing = true;
+    ledRing->refreshDithered();
+    ledRing->ditherRefreshing = false;
+}
 
+/**
+ * Checks whether any segment is still sending its previous frame.
+ */
+bool LedRingController::outputsBusy() {
+    for (int c = 0; c < Board::ledChannels; c++)
+        if (outputs[c].busy()) return true;
+    return false;
+}
 
-  default:
-    break;
-  }
+/**
+ * Queues the pixel buffer split into its segments. The segments are sent in
+ * parallel, so a frame takes as long as the longest segment. Nothing is queued
+ * unless every segment is free, so the segments never show different frames.
+ *
+ * @return false if the frame was not queued.
+ */
+bool LedRingController::writeOutputs() {
+    if (outputsBusy()) return false;
+    PROFILE_SCOPE(PROBE_LED_SHOW);
+    TRACE_SPAN("ledshow");
+
+    bool sent = true;
+    int offset = 0;
+    for (int c = 0; c < Board::ledChannels; c++) {
+        sent &= outputs[c].write(pixels + offset * 3);
+        offset += Board::ledCounts[c];
+    }
+    return sent;
 }
 
-// Start animation for animations that don't require timer and encoder parameters
-void LedRingController::startAnimation(ledRingAnimation anim, int totalFrames){
-  animationRunning = true;
-  animation = anim;
-  currentFrame = 0;
-  animationStartTime = millis();
-  this->totalFrames = totalFrames;
+/**
+ * Prints the output metrics on the serial console.
+ */
+void LedRingController::printMetrics(Print &out) {
+    // The rate only updates on a show, so a static screen would keep the last one
+    unsigned long window = millis() - metricsWindowStart;
+    uint16_t rate = window >= LEDRING_METRICS_WINDOW_MS ? showsInWindow * 1000UL / window : showsPerSecond;
+
+    out.print("led: show ");
+    out.print(showMicros);
+    out.print(" us, ");
+    out.print((unsigned long)rate);
+    out.print(" shows/s, ");
+    out.print((unsigned long)framesSuppressed);
+    out.println(" suppressed");
+
+    // CPU share of the refresh timer, from the last refresh
+    out.print(dithering ? "led: dither on, refresh " : "led: dither off, last refresh ");
+    out.print(ditherMicros);
+    out.print(" us, max ");
+    out.print(ditherMaxMicros);
+    out.print(" us, ");
+    out.print((unsigned long)(ditherMicros * LED_DITHER_REFRESH_HZ / 1000));
+    out.println(" permille CPU");
+    for (int c = 0; c < Board::ledChannels; c++) {
+        out.print("led: output ");
+        out.print((long)c);
+        out.print(" sent ");
+        out.print((unsigned long)outputs[c].framesSent);
+        out.print(" rejected ");
+        out.print((unsigned long)outputs[c].framesRejected);
+        out.print(" write ");
+        out.print(outputs[c].lastWriteMicros);
+        out.println(" us");
+    }
 }
 
-// Update the LED ring animation based on the current animation state and frame
-void LedRingController::updateAnimation(){
+void LedRingController::countShow() {
+    showsInWindow++;
+    if (millis() - metricsWindowStart >= LEDRING_METRICS_WINDOW_MS) {
+        showsPerSecond = showsInWindow * 1000UL / (millis() - metricsWindowStart);
+        showsInWindow = 0;
+        metricsWindowStart = millis();
+    }
+}
 
-  if (millis() - lastFrameTime < frameDelay){
-    return;
-  }
-  lastFrameTime = millis();
-  switch (animation)
+void LedRingController::clearFrame() {
+    singleColorRing(0, frame);
+}
+
+void LedRingController::update(SystemState state, long int encoder, long int timer, long int initialTimer){
+  TRACE_SPAN_ARG("ledring", state);
+  // States without a case keep the last base frame
+  switch (state)
   {
-  case LEDRING_PAUSE_TIMER:
-    fadeBetweenStates(initialState, endState);
+  case STATE_TIMER_SELECT:
+    LedRingTimeScreen(timer, encoder);
     break;
-  
-  case LEDRING_START_TIMER:
-    fadeBetweenStates(initialState, endState);
+  case STATE_PULSE_SELECT:
+    LedRingTimeScreen(timer, encoder);
     break;
-
-  case LEDRING_FINISHED_TIMER:
-    pulseBetweenStates(initialState, endState);
+  case STATE_TIMER_RUN:
+    LedRingTimeCountdown(timer, initialTimer, encoder);
     break;
-
-  case LEDRING_RETURN_MAIN_MENU:
-    fadeBetweenStates(initialState, endState);
+  case STATE_PULSE_RUN:
+    LedRingTimeCountdown(timer, initialTimer, encoder);
     break;
-
-  case LEDRING_PREPARE_SLEEP:
-    fadeBetweenStates(initialState, endState);
+  case STATE_TIMER_PAUSED:
+    LedRingCountdownPaused(timer, initialTimer, encoder);
     break;
-  
-  case LEDRING_MODE_SELECT:
-    fadeBetweenStates(initialState, endState);
+  case STATE_STOPWATCH_RUN:
+    LedRingStopwatchRun(timer);
     break;
-
-  case LEDRING_SETTINGS_LIMIT:
-    LedRingShortSinglePulse(strip.Color(255, 255, 255));
+  case STATE_TIMER_FINISHED:
+    clearFrame();
     break;
-
-  case LEDRING_PULSE_FLASH:
-    LedRingShortSinglePulse(strip.Color(255, 255, 255));
+  case STATE_PREPARE_SLEEP:
+    clearFrame();
+    break;
+  case STATE_MODE_SELECT:
+    LedRingModeSelect(abs(encoder), 7);
+    break;
+  case STATE_STATS:
+    LedRingModeSelect(abs(encoder), 3);
+    break;
+  case STATE_SETTINGS_LEDRING:
+    LedringSingleColor(PixelKernels::rgb(255, 255, 255));
+    break;
+  case STATE_SETTINGS:
+    LedRingModeSelect(abs(encoder), 5);
+    break;
+  case STATE_SETTINGS_TIMER:
+    LedRingModeSelect(abs(encoder), 4);
+    break;
+  case STATE_SETTINGS_TIMER_CW:
+    LedRingSettingsSelect(encoder, 10, 1);
+    break;
+  case STATE_SETTINGS_TIMER_CCW:
+    LedRingSettingsSelect(encoder, 60, 10);
+    break;
+  case STATE_SETTINGS_TIMER_ACCEL:
+    LedRingSettingsSelect(encoder, INPUT_ACCEL_MAX_LEVEL, 0);
+    break;
+  case STATE_SETTINGS_TIMER_CLICK:
+    LedRingSettingsSelect(encoder, INPUT_MULTI_CLICK_MAX_MS / INPUT_MULTI_CLICK_STEP_MS,
+                          INPUT_MULTI_CLICK_MIN_MS / INPUT_MULTI_CLICK_STEP_MS);
+    break;
+  case STATE_SETTINGS_DISPLAY:
+    LedRingSettingsSelect(encoder, 25, 0);
+    break;
+  case STATE_SETTINGS_VOLUME:
+    LedRingSettingsSelect(encoder, 10, 1);
     break;
 
   default:
     break;
   }
+
+  show();
+
+  if (!dithering && millis() - lastSendTime >= LEDRING_FORCED_REFRESH_MS && !outputsBusy())
+    transmit();
+}
+
+/**
+ * Starts the effect of an animation on its layer. Effects on other layers keep
+ * running, so a flash can play over a transition or the progress ring.
+ *
+ * @param animation The animation to start.
+ */
+void LedRingController::startAnimation(ledRingAnimation animation){
+  compositor.start(ledEffects[animation], composed, millis());
+}
+
+void LedRingController::stopAnimation(ledRingAnimation animation){
+  compositor.stop(ledEffects[animation].layer);
 }
 
 // ------------------------------------------------------
@@ -177,109 +364,68 @@ void LedRingController::updateAnimation(){
 // ------------------------------------------------------
 
 void LedRingController::LedRingSettingsSelect(long int encoder, uint8_t nMax, uint8_t nMin){
-  strip.clear();
-  unsigned int endPos = numLeds*(encoder-nMin)/(nMax-nMin);
+  clearFrame();
+  long int endPos = numLeds*(encoder-nMin)/(nMax-nMin);
 
   if (endPos > numLeds) endPos = numLeds;
-  if (endPos == 0) endPos = 1;
+  if (endPos < 1) endPos = 1;
 
   for (int i = 0; i < endPos; i++){
-    strip.setPixelColor(i, 255, 255, 255);
+    frame[i] = PixelKernels::rgb(255, 255, 255);
   }
-  strip.show();
 }
 
 void LedRingController::LedRingTimeScreen(long int timer, long int encoder){
 
-    int DELTA_T_CCW = EEPROM.readInt(EEPROM_DELTAT_CCW_ADDR);
-    int DELTA_T_CW = EEPROM.readInt(EEPROM_DELTAT_CW_ADDR);
-
-    strip.clear();
     if (encoder < 0)
-      singleColorRingSelecting(timer/DELTA_T_CCW, true, strip.Color(0, 0, 255), newLeds);
+      singleColorRingSelecting(timer/deltaTCcw, true, PixelKernels::rgb(0, 0, 255), frame);
     if (encoder >= 0)
-      singleColorRingSelecting(timer/DELTA_T_CW, false, strip.Color(0, 255, 0), newLeds);
-    for (int i = 0; i < numLeds; i++)
-      strip.setPixelColor(i, newLeds[i]);
-    strip.show();
+      singleColorRingSelecting(timer/deltaTCw, false, PixelKernels::rgb(0, 255, 0), frame);
 }
 
 void LedRingController::LedRingTimeCountdown(long int timer, long int initialTimer, long int encoder){
     
-    strip.clear();
-    singleColorRingCounting(timer, initialTimer, encoder<0,  strip.Color(255, 0, 0), newLeds);
-    for (int i = 0; i < numLeds; i++)
-      strip.setPixelColor(i, newLeds[i]);
-    strip.show();
+    singleColorRingCounting(timer, initialTimer, encoder<0,  PixelKernels::rgb(255, 0, 0), frame);
 }
 
 void LedRingController::LedRingStopwatchRun(long int timer){
-    strip.clear();
-    singleColorRingCounting(timer%1000, 1000, false, strip.Color(255, 0, 0), newLeds);
-    
-    for (int i = 0; i < numLeds; i++)
-      strip.setPixelColor(i, newLeds[i]);
-
-    strip.show();
+    singleColorRingCounting(timer%1000, 1000, false, PixelKernels::rgb(255, 0, 0), frame);
 }
 
 void LedRingController::LedRingCountdownPaused(long int timer, long int initialTimer, long int encoder){
     
-    strip.clear();
-    singleColorRingCounting(timer, initialTimer, encoder<0, strip.Color(255, 255, 0), newLeds);
-    for (int i = 0; i < numLeds; i++)
-      strip.setPixelColor(i, newLeds[i]);
-    strip.show();
+    singleColorRingCounting(timer, initialTimer, encoder<0, PixelKernels::rgb(255, 255, 0), frame);
 }
 
+/**
+ * Turns the ring off right away, dropping any running effect, and waits for the
+ * frame to reach the LEDs so it is safe to power down afterwards.
+ */
 void LedRingController::LedRingSleep(){
-    strip.clear();
-    strip.show();
+    setDithering(false);
+    compositor.stopAll();
+    clearFrame();
+    show();
+
+    // A frame deferred behind a busy output must still go out before sleep.
+    // Outputs that failed to start never take it, so the wait is bounded.
+    unsigned long start = millis();
+    while ((framePending || outputsBusy()) && millis() - start < LEDRING_SLEEP_FLUSH_MS) {
+        if (framePending && !outputsBusy())
+            transmit();
+    }
 }
 
 void LedRingController::LedRingModeSelect(long int encoder, uint8_t nModes){
-  strip.clear();
+  clearFrame();
   int nSelLeds = numLeds/nModes;
   unsigned int initPos = abs(encoder)%nModes*nSelLeds;
   
   for (int i = initPos; i < initPos+nSelLeds; i++){
-    strip.setPixelColor(i, 0, 255, 255);
+    frame[i] = PixelKernels::rgb(0, 255, 255);
   }
-  strip.show();
-}
-
-
-// ---------------------------------------------------
-// Transition states with timer and encoder parameters
-// ---------------------------------------------------
-
-void LedRingController::LedRingShortSinglePulse(uint32_t color){
-  LedringSingleColor(color);
-  currentFrame++;
-
-  if (currentFrame > totalFrames)
-    animationRunning = false;
-}
-
-void LedRingController::fadeBetweenStates(uint32_t* initialState, uint32_t* endState){
-  strip.clear();
-
-  float t = (float) currentFrame / totalFrames;
-  for (int i = 0; i < numLeds; i++)
-    strip.setPixelColor(i, blendColor(initialState[i], endState[i], t*255));
-  currentFrame++;
-  if (currentFrame > totalFrames)
-    animationRunning = false;
-  strip.show();
 }
 
-void LedRingController::pulseBetweenStates(uint32_t* initialState, uint32_t* endState){
-  strip.clear();
-  for (int i = 0; i < numLeds; i++)
-    strip.setPixelColor(i, blendColor(initialState[i], endState[i], beatsin8(20, 0, 255)));
-
-  strip.show();
-}
 
 // -------------------------------------------
 // Helper functions for LED state calculations
@@ -289,7 +435,7 @@ void LedRingController::pulseBetweenStates(uint32_t* initialState, uint32_t* end
  * @brief Calculates a time scale factor based on the encoder value.
  *
  * This function determines the smallest power-of-two scale factor such that
- * the encoder value is less than NUM_LEDS times the scale factor. It starts with
+ * the encoder value is less than numLeds times the scale factor. It starts with
  * a scale factor of 1 and doubles it until the condition is met.
  *
  * @param encoder The input value from the encoder.
@@ -298,7 +444,7 @@ void LedRingController::pulseBetweenStates(uint32_t* initialState, uint32_t* end
 int LedRingController::timeScale(long int encoder){
   int testExp = 1;
   while (true){
-    if (encoder < NUM_LEDS*testExp)
+    if (encoder < numLeds*testExp)
       return testExp;
     else
       testExp *= 2;
@@ -306,18 +452,20 @@ int LedRingController::timeScale(long int encoder){
 }
 
 /**
- * @brief Inverts the order of LEDs in a ring.
+ * @brief Reverses the order of LEDs in a ring, in place.
  *
- * Copies the contents of the input LED array (`ring`) into the output array (`output`)
- * in reverse order. The size of the arrays is specified by `arraySize`.
+ * Swaps the LEDs pairwise from both ends, so no temporary copy of the ring is
+ * needed whatever its size.
  *
- * @param ring Pointer to the input array of CRGB objects representing the LED ring.
- * @param output Pointer to the output array where the inverted LED order will be stored.
- * @param arraySize Number of elements in the ring and output arrays.
+ * @param ring Pointer to the array of colors representing the LED ring.
+ * @param arraySize Number of elements in the ring.
  */
-void LedRingController::invertRing(const uint32_t* ring, uint32_t* output, int arraySize) {
-  for (int i = 0; i < arraySize; i++)
-      output[i] = ring[arraySize - i - 1];
+void LedRingController::reverseRing(uint32_t* ring, int arraySize) {
+  for (int i = 0, j = arraySize - 1; i < j; i++, j--) {
+    uint32_t color = ring[i];
+    ring[i] = ring[j];
+    ring[j] = color;
+  }
 }
 
 /**
@@ -335,23 +483,21 @@ void LedRingController::invertRing(const uint32_t* ring, uint32_t* output, int a
  */
 void LedRingController::singleColorRingSelecting(long int timer, bool reversed, uint32_t color, uint32_t* output, int arraySize) {
   for (int i = 0; i < arraySize; i++)
-    output[i] = strip.Color(0, 0, 0);
+    output[i] = PixelKernels::rgb(0, 0, 0);
 
+  if (timer < 0) timer = 0;
   int d = timeScale(timer);
-  int posLeds = timer / d;
+  int posLeds = min(timer / d, (long int)arraySize);
   int remLeds = timer % d;
 
   for (int i = 0; i < posLeds; i++)
     output[i] = color;
 
-  output[posLeds] = blendColor(strip.Color(0, 0, 0), color, remLeds * 255 / d);
+  if (posLeds < arraySize)
+    output[posLeds] = PixelKernels::blend(PixelKernels::rgb(0, 0, 0), color, remLeds * 255 / d);
 
-  if (reversed) {
-      uint32_t temp[arraySize];
-      invertRing(output, temp, arraySize);
-      for (int i = 0; i < arraySize; i++)
-          output[i] = temp[i];
-    }
+  if (reversed)
+    reverseRing(output, arraySize);
 }
 
 /**
@@ -378,9 +524,12 @@ void LedRingController::singleColorRingCounting(
 ) {
   int brightnessStep = 10;
   for (int i = 0; i < arraySize; i++)
-    output[i] = strip.Color(0, 0, 0);
+    output[i] = PixelKernels::rgb(0, 0, 0);
+
+  if (initialTimer <= 0) return;
 
-  long int elapsed = (timer * NUM_LEDS * brightnessStep) / initialTimer;
+  // 64-bit so long timers on large rings can't overflow
+  int64_t elapsed = (int64_t)constrain(timer, 0L, initialTimer) * arraySize * brightnessStep / initialTimer;
 
   int posLeds = elapsed / brightnessStep;
   int remLeds = elapsed % brightnessStep;
@@ -388,14 +537,12 @@ void LedRingController::singleColorRingCounting(
   for(int i = 0; i < posLeds; i++)
     output[i] = color;
 
-  output[posLeds] = blendColor(strip.Color(0, 0, 0), color, remLeds * 255 / brightnessStep);
+  // A finished timer fills the whole ring and has no partial LED
+  if (posLeds < arraySize)
+    output[posLeds] = PixelKernels::blend(PixelKernels::rgb(0, 0, 0), color, remLeds * 255 / brightnessStep);
 
-  if (reversed) {
-    uint32_t temp[arraySize];
-    invertRing(output, temp, arraySize);
-    for (int i = 0; i < arraySize; i++)
-        output[i] = temp[i];
-  }
+  if (reversed)
+    reverseRing(output, arraySize);
 }
 
 /**
@@ -412,27 +559,3 @@ void LedRingController::singleColorRing(uint32_t color, uint32_t* output, int ar
   for (int i = 0; i < arraySize; i++)
     output[i] = color;
 }
-
-uint32_t LedRingController::blendColor(uint32_t c1, uint32_t c2, uint8_t t) {
-    // Extract RGB components
-    uint8_t r1 = (c1 >> 16) & 0xFF;
-    uint8_t g1 = (c1 >> 8) & 0xFF;
-    uint8_t b1 = c1 & 0xFF;
-
-    uint8_t r2 = (c2 >> 16) & 0xFF;
-    uint8_t g2 = (c2 >> 8) & 0xFF;
-    uint8_t b2 = c2 & 0xFF;
-
-    // Linear interpolation
-    uint8_t r = r1 + ((r2 - r1) * t) / 255;
-    uint8_t g = g1 + ((g2 - g1) * t) / 255;
-    uint8_t b = b1 + ((b2 - b1) * t) / 255;
-
-    return strip.Color(r, g, b);
-}
-
-uint8_t LedRingController::beatsin8(float bpm, uint8_t low, uint8_t high) {
-    float beat = millis() / (60000.0 / bpm); // Convert BPM to period in ms
-    float wave = (sin(beat * TWO_PI) + 1.0) / 2.0; // Normalize 0–1
-    return low + (high - low) * wave;
-}
\ No newline at end of file
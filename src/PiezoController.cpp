@@ -1,57 +1,327 @@
 #include "PiezoController.h"
+#include "HeapGuard.h"
+#include "Trace.h"
 #include HW_CONFIG
 
+// Lowest sound_level at which each class is heard
+static const uint8_t minSoundLevel[SOUND_PRIORITY_COUNT] = {
+    2, // SOUND_CLICK
+    1, // SOUND_PULSE
+    1  // SOUND_ALARM
+};
+
 PiezoController::PiezoController(int buzzerPin)
     : buzzerPin(buzzerPin),
       melodyRunning(false),
-      currentNote(0),
-      sound_level(sound_level)
+      timingErrorUs(0),
+      maxTimingErrorUs(0),
+      commandsDropped(0),
+      clicksLimited(0),
+      ledcWrites(0),
+      timer(nullptr),
+      lastClickTime(0),
+      voices{},
+      clickNote{0, 0},
+      clickMelody{&clickNote, 1, false},
+      outputPitch(0),
+      ledcDetached(false),
+      clipPriority(SOUND_CLICK)
       {}
 
+/**
+ * Sets up the LEDC channel of the buzzer and creates the sequencer timer. The
+ * timer first runs when a sound is posted.
+ *
+ * @param sound_level The initial sound level.
+ */
 void PiezoController::begin(uint8_t sound_level) {
-    pinMode(buzzerPin, OUTPUT);
     this->sound_level = sound_level;
+
+    ledc_timer_config_t timerConfig = {};
+    timerConfig.speed_mode = PIEZO_LEDC_MODE;
+    timerConfig.duty_resolution = PIEZO_LEDC_RESOLUTION;
+    timerConfig.timer_num = PIEZO_LEDC_TIMER;
+    timerConfig.freq_hz = NOTE_A4;
+    timerConfig.clk_cfg = LEDC_AUTO_CLK;
+    ledc_timer_config(&timerConfig);
+    attachLedc();
+    samples.begin(buzzerPin);
+
+    esp_timer_create_args_t timerArgs = {};
+    timerArgs.callback = onTick;
+    timerArgs.arg = this;
+    timerArgs.dispatch_method = ESP_TIMER_TASK;
+    timerArgs.name = "piezo";
+    timerArgs.skip_unhandled_events = true;
+    esp_timer_create(&timerArgs, &timer);
 }
 
-void PiezoController::update(SystemState state) {
-    if (melodyRunning)
-        updateMelody();
+void PiezoController::onSettingChanged(void *context, const SettingsData &settings, SettingId id) {
+    PiezoController *piezo = (PiezoController *)context;
+    if (id == SETTING_SOUND_LEVEL)
+        piezo->sound_level = settings.soundLevel;
+    else if (id == SETTING_VOLUME)
+        piezo->clipVolume = settings.volume * 255 / 100;
 }
 
-void PiezoController::startMelody(Melody melody) {
-    this->melody = melody;
+/**
+ * Starts playing a melody on the voice of its class, replacing what that voice
+ * was playing. Only a pointer to it is kept, so the melody must outlive the
+ * playback, as the constant tables in melodies.h do.
+ *
+ * @param melody The melody to play.
+ * @param priority The class of the melody.
+ */
+void PiezoController::startMelody(const Melody &melody, SoundPriority priority) {
+    HEAP_GUARD_BEGIN();
+    // Set here too, so the caller sees the melody as running right away
     melodyRunning = true;
-    lastNoteTime = millis();
-    currentNote = 0;
-
-    if (sound_level > 0)
-        tone(buzzerPin, melody.notes[currentNote], melody.durations[currentNote]);
+    post({Command::PLAY, &melody, nullptr, priority, {0, 0}});
+    HEAP_GUARD_END();
 }
 
+/**
+ * Plays a UI click. Clicks closer together than PIEZO_CLICK_MIN_INTERVAL_MS are
+ * dropped, so a fast encoder spin neither floods the queue nor reconfigures
+ * the LEDC on every detent.
+ *
+ * @param frequency The pitch of the click.
+ * @param duration The length of the click in milliseconds.
+ */
 void PiezoController::beep(int frequency, int duration){
-    if (sound_level > 1)
-        tone(buzzerPin, frequency, duration);
+    HEAP_GUARD_BEGIN();
+    if (sound_level >= minSoundLevel[SOUND_CLICK]) {
+        if (millis() - lastClickTime < PIEZO_CLICK_MIN_INTERVAL_MS) {
+            clicksLimited++;
+        } else {
+            lastClickTime = millis();
+            post({Command::PLAY, nullptr, nullptr, SOUND_CLICK, {(uint16_t)frequency, (uint16_t)duration}});
+        }
+    }
+    HEAP_GUARD_END();
+}
+
+/**
+ * Plays a sample clip over the tone voices. The clip is skipped if its class is
+ * not heard at the current sound_level.
+ *
+ * @param clip The clip to play. Only a pointer is kept.
+ * @param priority The class of the clip.
+ */
+void PiezoController::playClip(const Clip &clip, SoundPriority priority) {
+    post({Command::PLAY_CLIP, nullptr, &clip, priority, {0, 0}});
 }
 
 void PiezoController::stopMelody() {
-    melodyRunning = false;
+    post({Command::STOP_ALL, nullptr, nullptr, SOUND_CLICK, {0, 0}});
 }
 
-void PiezoController::updateMelody() {
-    if (millis() - lastNoteTime >= melody.durations[currentNote]) {
-        currentNote++;
-        if (currentNote < melody.notes.size()) {
-            if (sound_level > 0)
-                tone(buzzerPin, melody.notes[currentNote]);
-        } else {
-            noTone(buzzerPin);
-            if (melody.loop) {
-                currentNote = 0;
-                if (sound_level > 0)
-                    tone(buzzerPin, melody.notes[currentNote], melody.durations[currentNote]);
-            } else 
-                melodyRunning = false;
+void PiezoController::stopMelody(SoundPriority priority) {
+    post({Command::STOP, nullptr, nullptr, priority, {0, 0}});
+}
+
+/**
+ * Queues a command and runs the sequencer right away to apply it. A wake-up
+ * already armed for a note boundary is replaced, tick() arms the next one.
+ */
+void PiezoController::post(const Command &command) {
+    if (!commands.push(command)) {
+        commandsDropped++;
+        return;
+    }
+    if (timer == nullptr) return;
+
+    esp_timer_stop(timer);
+    esp_timer_start_once(timer, 0);
+}
+
+void PiezoController::onTick(void *context) {
+    ((PiezoController *)context)->tick();
+}
+
+/**
+ * Runs on every sequencer wake-up: applies the queued commands, advances every
+ * voice, then sends the note of the highest audible voice to the LEDC if it
+ * differs from what is already playing. Then arms the timer for the next note
+ * boundary of any voice.
+ */
+void PiezoController::tick() {
+    int64_t now = esp_timer_get_time();
+
+    Command command;
+    while (commands.pop(command))
+        handle(command, now);
+
+    uint16_t pitch = 0;
+    bool running = false;
+    bool voiceFound = false;
+    int64_t wakeTime = INT64_MAX;
+
+    for (int p = SOUND_PRIORITY_COUNT - 1; p >= 0; p--) {
+        Voice &voice = voices[p];
+        if (voice.melody == nullptr) continue;
+
+        advance(voice, now);
+        if (voice.melody == nullptr) continue;
+
+        running = true;
+        wakeTime = min(wakeTime, voice.nextNoteTime);
+        if (!voiceFound && audible((SoundPriority)p)) {
+            pitch = voice.melody->notes[voice.currentNote].pitch;
+            voiceFound = true;
         }
-        lastNoteTime = millis();
     }
-}   
\ No newline at end of file
+
+    // While a clip plays the pin belongs to the I2S, and nothing tells the
+    // sequencer when it ends, so it looks again every PIEZO_CLIP_POLL_US
+    if (ledcDetached) {
+        if (samples.isPlaying()) {
+            melodyRunning = true;
+            schedule(min(wakeTime, now + PIEZO_CLIP_POLL_US));
+            return;
+        }
+        attachLedc();
+    }
+
+    output(pitch);
+    melodyRunning = running;
+    schedule(wakeTime);
+}
+
+/**
+ * Arms the sequencer timer.
+ *
+ * @param wakeTime When to run next, in esp_timer time, or INT64_MAX to stay idle.
+ */
+void PiezoController::schedule(int64_t wakeTime) {
+    if (wakeTime == INT64_MAX) return;
+    esp_timer_start_once(timer, max(wakeTime - esp_timer_get_time(), (int64_t)0));
+}
+
+void PiezoController::handle(const Command &command, int64_t now) {
+    switch (command.type) {
+    case Command::PLAY: {
+        const Melody *melody = command.melody;
+        if (melody == nullptr) {
+            clickNote = command.note;
+            melody = &clickMelody;
+        }
+        Voice &voice = voices[command.priority];
+        voice.melody = melody;
+        voice.currentNote = 0;
+        voice.nextNoteTime = now + melody->notes[0].duration * 1000LL;
+        break;
+    }
+
+    case Command::PLAY_CLIP:
+        if (!audible(command.priority)) break;
+        output(0);
+        ledcDetached = true;
+        clipPriority = command.priority;
+        samples.start(*command.clip, clipVolume);
+        break;
+
+    case Command::STOP:
+        voices[command.priority].melody = nullptr;
+        if (ledcDetached && clipPriority == command.priority)
+            samples.stop();
+        break;
+
+    case Command::STOP_ALL:
+        for (int p = 0; p < SOUND_PRIORITY_COUNT; p++)
+            voices[p].melody = nullptr;
+        samples.stop();
+        break;
+    }
+}
+
+/**
+ * Prints the sequencer and clip metrics on the serial console.
+ */
+void PiezoController::printMetrics(Print &out) {
+    out.print("piezo: timing error ");
+    out.print((unsigned long)timingErrorUs);
+    out.print(" us, max ");
+    out.print((unsigned long)maxTimingErrorUs);
+    out.println(maxTimingErrorUs <= PIEZO_TIMING_LIMIT_US ? " us, within limit" : " us, OVER LIMIT");
+    out.print("piezo: commands dropped ");
+    out.print((unsigned long)commandsDropped);
+    out.print(", clicks limited ");
+    out.print((unsigned long)clicksLimited);
+    out.print(", ledc writes ");
+    out.println((unsigned long)ledcWrites);
+    out.print("piezo: clip decode ");
+    out.print((unsigned long)samples.cpuPermille);
+    out.print(" permille CPU, max ");
+    out.print((unsigned long)samples.maxCpuPermille);
+    out.print(", overruns ");
+    out.println((unsigned long)samples.budgetOverruns);
+}
+
+/**
+ * Moves a voice to the note it should be playing now. Note times are
+ * accumulated from the start of the melody, so a late tick doesn't shift the
+ * notes after it, and a silenced voice stays in time.
+ */
+void PiezoController::advance(Voice &voice, int64_t now) {
+    while (now >= voice.nextNoteTime) {
+        uint32_t error = min(now - voice.nextNoteTime, (int64_t)UINT32_MAX);
+        timingErrorUs = error;
+        if (error > maxTimingErrorUs)
+            maxTimingErrorUs = error;
+
+        voice.currentNote++;
+        if (voice.currentNote >= voice.melody->length) {
+            if (!voice.melody->loop) {
+                voice.melody = nullptr;
+                return;
+            }
+            voice.currentNote = 0;
+        }
+        voice.nextNoteTime += voice.melody->notes[voice.currentNote].duration * 1000LL;
+    }
+}
+
+bool PiezoController::audible(SoundPriority priority) {
+    return sound_level >= minSoundLevel[priority];
+}
+
+/**
+ * Sets the buzzer pitch, 0 for silence. The LEDC is only touched when the
+ * pitch changes.
+ */
+void PiezoController::output(uint16_t pitch) {
+    if (pitch == outputPitch) return;
+    TRACE_INSTANT("note", pitch);
+
+    if (pitch == 0) {
+        ledc_set_duty(PIEZO_LEDC_MODE, PIEZO_LEDC_CHANNEL, 0);
+    } else {
+        ledc_set_freq(PIEZO_LEDC_MODE, PIEZO_LEDC_TIMER, pitch);
+        if (outputPitch == 0)
+            ledc_set_duty(PIEZO_LEDC_MODE, PIEZO_LEDC_CHANNEL, PIEZO_DUTY_ON);
+    }
+    ledc_update_duty(PIEZO_LEDC_MODE, PIEZO_LEDC_CHANNEL);
+
+    outputPitch = pitch;
+    ledcWrites++;
+}
+
+/**
+ * Routes the buzzer pin to the LEDC channel, silent. Called at start and again
+ * when a clip hands the pin back.
+ */
+void PiezoController::attachLedc() {
+    ledc_channel_config_t channelConfig = {};
+    channelConfig.gpio_num = buzzerPin;
+    channelConfig.speed_mode = PIEZO_LEDC_MODE;
+    channelConfig.channel = PIEZO_LEDC_CHANNEL;
+    channelConfig.intr_type = LEDC_INTR_DISABLE;
+    channelConfig.timer_sel = PIEZO_LEDC_TIMER;
+    channelConfig.duty = 0;
+    channelConfig.hpoint = 0;
+    ledc_channel_config(&channelConfig);
+
+    outputPitch = 0;
+    ledcDetached = false;
+}
@@ -0,0 +1,103 @@
+#include "Profiler.h"
+
+#if LOOP_PROFILER
+
+static const char *const probeNames[] = {
+    "loop", "input", "state", "ledring", "display", "storage", "i2c", "ledshow"};
+static_assert(sizeof(probeNames) / sizeof(probeNames[0]) == PROBE_COUNT, "every probe needs a name");
+
+static const char *const stateNames[] = {
+    "MODE_SELECT", "WIFI_SELECT",
+    "TIMER_SELECT", "TIMER_RUN", "TIMER_PAUSED", "TIMER_FINISHED",
+    "PULSE_SELECT", "PULSE_RUN",
+    "STOPWATCH_START", "STOPWATCH_RUN", "STOPWATCH_PAUSED",
+    "SLEEP", "PREPARE_SLEEP", "INFO", "STATS",
+    "SETTINGS", "SETTINGS_AUDIO", "SETTINGS_DISPLAY", "SETTINGS_LEDRING", "SETTINGS_TIMER",
+    "SETTINGS_TIMER_CW", "SETTINGS_TIMER_CCW", "SETTINGS_TIMER_ACCEL",
+    "SETTINGS_TIMER_CLICK", "SETTINGS_VOLUME"};
+static_assert(sizeof(stateNames) / sizeof(stateNames[0]) == STATE_COUNT, "every state needs a name");
+
+static ProfileHistogram histograms[PROBE_COUNT][STATE_COUNT];
+static volatile uint8_t currentState = STATE_MODE_SELECT;
+
+/**
+ * Sets the state the following records are counted in.
+ */
+void Profiler::setState(SystemState state) {
+    if (state < STATE_COUNT)
+        currentState = state;
+}
+
+/**
+ * Counts one run of a probe.
+ *
+ * @param probe The code path that ran.
+ * @param cycles How long it took, in CPU cycles.
+ */
+void Profiler::record(ProfileProbe probe, uint32_t cycles) {
+    ProfileHistogram &histogram = histograms[probe][currentState];
+
+    int bucket = 31 - __builtin_clz(cycles | 1) - PROFILER_MIN_SHIFT;
+    bucket = constrain(bucket, 0, PROFILER_BUCKETS - 1);
+
+    if (histogram.buckets[bucket] == UINT16_MAX) {
+        for (uint16_t &count : histogram.buckets)
+            count /= 2;
+    }
+    histogram.buckets[bucket]++;
+    histogram.count++;
+    if (cycles > histogram.maxCycles)
+        histogram.maxCycles = cycles;
+}
+
+void Profiler::reset() {
+    memset(histograms, 0, sizeof(histograms));
+}
+
+/**
+ * Returns the upper bound, in cycles, of the bucket holding a percentile.
+ */
+static uint32_t percentile(const ProfileHistogram &histogram, uint32_t permille) {
+    uint32_t total = 0;
+    for (uint16_t count : histogram.buckets)
+        total += count;
+
+    uint32_t rank = (total * permille + 999) / 1000;
+    uint32_t seen = 0;
+    for (int bucket = 0; bucket < PROFILER_BUCKETS; bucket++) {
+        seen += histogram.buckets[bucket];
+        if (seen >= rank && seen > 0)
+            return min(1UL << (bucket + PROFILER_MIN_SHIFT + 1), (unsigned long)histogram.maxCycles);
+    }
+    return histogram.maxCycles;
+}
+
+/**
+ * Prints every histogram that has counts, one line each, with times in
+ * microseconds.
+ */
+void Profiler::dump(Print &out) {
+    uint32_t cyclesPerMicro = getCpuFrequencyMhz();
+
+    out.println("prof: probe state count p50 p99 max (us)");
+    for (int probe = 0; probe < PROBE_COUNT; probe++) {
+        for (int state = 0; state < STATE_COUNT; state++) {
+            const ProfileHistogram &histogram = histograms[probe][state];
+            if (histogram.count == 0) continue;
+
+            out.print(probeNames[probe]);
+            out.print(' ');
+            out.print(stateNames[state]);
+            out.print(' ');
+            out.print((unsigned long)histogram.count);
+            out.print(' ');
+            out.print((unsigned long)(percentile(histogram, 500) / cyclesPerMicro));
+            out.print(' ');
+            out.print((unsigned long)(percentile(histogram, 990) / cyclesPerMicro));
+            out.print(' ');
+            out.println((unsigned long)(histogram.maxCycles / cyclesPerMicro));
+        }
+    }
+}
+
+#endif
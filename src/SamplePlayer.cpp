@@ -0,0 +1,126 @@
+#include "SamplePlayer.h"
+#include <esp_timer.h>
+
+SamplePlayer::SamplePlayer()
+    : cpuPermille(0),
+      maxCpuPermille(0),
+      budgetOverruns(0),
+      pin(-1),
+      channel(nullptr),
+      task(nullptr),
+      playing(false),
+      stopRequested(false),
+      requested(nullptr),
+      volume(255)
+      {}
+
+/**
+ * Creates the PDM channel and the refill task. The channel starts with no pin,
+ * so the LEDC keeps the buzzer until a clip plays.
+ *
+ * @param pin The buzzer pin.
+ * @return true if playback is available.
+ */
+bool SamplePlayer::begin(int pin) {
+    this->pin = pin;
+
+    i2s_chan_config_t channelConfig = I2S_CHANNEL_DEFAULT_CONFIG(I2S_NUM_0, I2S_ROLE_MASTER);
+    channelConfig.dma_desc_num = SAMPLE_DMA_BUFFERS;
+    channelConfig.dma_frame_num = SAMPLE_CHUNK;
+    channelConfig.auto_clear = true; // send silence if the task falls behind
+    if (i2s_new_channel(&channelConfig, &channel, nullptr) != ESP_OK) return false;
+
+    i2s_pdm_tx_config_t pdmConfig = {};
+    pdmConfig.clk_cfg = I2S_PDM_TX_CLK_DEFAULT_CONFIG(SAMPLE_RATE_HZ);
+    pdmConfig.slot_cfg = I2S_PDM_TX_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_MONO);
+    pdmConfig.gpio_cfg.clk = (gpio_num_t)I2S_GPIO_UNUSED;
+    pdmConfig.gpio_cfg.dout = (gpio_num_t)I2S_GPIO_UNUSED;
+    if (i2s_channel_init_pdm_tx_mode(channel, &pdmConfig) != ESP_OK) return false;
+
+    return xTaskCreate(taskEntry, "samples", SAMPLE_TASK_STACK, this, SAMPLE_TASK_PRIORITY, &task) == pdPASS;
+}
+
+/**
+ * Starts a clip, replacing the one playing. isPlaying() is true as soon as this
+ * returns, so the caller can release the pin right away.
+ *
+ * @param clip The clip to play. Only a pointer is kept.
+ * @param volume The volume, 0-255.
+ */
+void SamplePlayer::start(const Clip &clip, uint8_t volume) {
+    if (task == nullptr) return;
+
+    this->volume = volume;
+    requested = &clip;
+    stopRequested = false;
+    playing = true;
+    xTaskNotifyGive(task);
+}
+
+void SamplePlayer::stop() {
+    stopRequested = true;
+}
+
+bool SamplePlayer::isPlaying() {
+    return playing;
+}
+
+void SamplePlayer::taskEntry(void *context) {
+    ((SamplePlayer *)context)->run();
+}
+
+void SamplePlayer::run() {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        i2s_pdm_tx_gpio_config_t gpioConfig = {};
+        gpioConfig.clk = (gpio_num_t)I2S_GPIO_UNUSED;
+        gpioConfig.dout = (gpio_num_t)pin;
+        i2s_channel_reconfig_pdm_tx_gpio(channel, &gpioConfig);
+        i2s_channel_enable(channel);
+
+        // A clip started while another plays is picked up here
+        const Clip *clip;
+        while ((clip = requested) != nullptr && !stopRequested) {
+            requested = nullptr;
+            play(*clip);
+        }
+
+        i2s_channel_disable(channel);
+
+        // start() writes requested before playing, so a clip started while this
+        // task was finishing is never reported as stopped
+        playing = false;
+        if (requested != nullptr)
+            playing = true;
+    }
+}
+
+/**
+ * Decodes a clip chunk by chunk. i2s_channel_write blocks until the DMA frees a
+ * buffer, so the task sleeps while the audio plays and only the decoding costs
+ * CPU, which is measured against the playback time of each chunk.
+ */
+void SamplePlayer::play(const Clip &clip) {
+    Adpcm::State state = {0, 0};
+    uint32_t position = 0;
+
+    while (position < clip.sampleCount) {
+        if (stopRequested || requested != nullptr) return;
+
+        int64_t start = esp_timer_get_time();
+        uint32_t count = min((uint32_t)SAMPLE_CHUNK, clip.sampleCount - position);
+        Adpcm::decodeScaled(state, clip.data, position, count, volume, buffer);
+        position += count;
+
+        int64_t chunkUs = count * 1000000LL / SAMPLE_RATE_HZ;
+        cpuPermille = (esp_timer_get_time() - start) * 1000 / chunkUs;
+        if (cpuPermille > maxCpuPermille)
+            maxCpuPermille = cpuPermille;
+        if (cpuPermille > SAMPLE_CPU_BUDGET_PERMILLE)
+            budgetOverruns++;
+
+        size_t written;
+        i2s_channel_write(channel, buffer, count * sizeof(int16_t), &written, portMAX_DELAY);
+    }
+}
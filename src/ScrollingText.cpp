@@ -0,0 +1,173 @@
+#include <Arduino.h>
+#include "ScrollingText.h"
+#include HW_CONFIG
+
+ScrollingText *ScrollingText::hardwareOwner = nullptr;
+
+ScrollingText::ScrollingText(DisplayType *u8g2)
+    : u8g2(u8g2),
+      font(nullptr),
+      x(0),
+      baseline(0),
+      width(0),
+      firstPage(0),
+      lastPage(0),
+      pending(false),
+      wantsHardware(false),
+      hardwareScrolling(false),
+      scrollStartTime(0)
+{
+    text[0] = '\0';
+}
+
+/**
+ * Queues a line of text for the current frame. The text is copied, so the caller
+ * can pass a temporary buffer. Changing the text restarts the scroll.
+ *
+ * @param font The u8g2 font used to draw the line.
+ * @param x The left edge of the line.
+ * @param baseline The baseline of the line.
+ * @param width The width available to the line before it has to scroll.
+ * @param text The text to display.
+ */
+void ScrollingText::set(const uint8_t *font, int x, int baseline, int width, const char *text) {
+    if (strncmp(this->text, text, SCROLL_TEXT_MAX_LENGTH - 1) != 0 || this->baseline != baseline) {
+        strncpy(this->text, text, SCROLL_TEXT_MAX_LENGTH - 1);
+        this->text[SCROLL_TEXT_MAX_LENGTH - 1] = '\0';
+        scrollStartTime = millis();
+    }
+
+    this->font = font;
+    this->x = x;
+    this->baseline = baseline;
+    this->width = width;
+    pending = true;
+}
+
+/**
+ * Draws the queued line into the frame buffer. It must run after everything else
+ * on the frame has been drawn, so the hardware path can check that the display
+ * pages of the line are not shared with other content.
+ */
+void ScrollingText::render() {
+    wantsHardware = false;
+    if (!pending) return;
+    pending = false;
+
+    u8g2->setFont(font);
+    int textWidth = u8g2->getStrWidth(text);
+
+    firstPage = max(0, (baseline - u8g2->getAscent()) / 8);
+    lastPage = min(u8g2->getDisplayHeight() / 8 - 1, (baseline - u8g2->getDescent() - 1) / 8);
+
+    if (textWidth <= width) {
+        u8g2->drawStr(x, baseline, text);
+        return;
+    }
+
+    // The controller can only rotate what is already in its RAM, so the whole
+    // text has to fit on the panel and the pages must belong to this line only.
+    if (Board::displayHwScroll &&
+        (hardwareOwner == nullptr || hardwareOwner == this) &&
+        x + textWidth <= u8g2->getDisplayWidth() &&
+        pagesAreEmpty()) {
+        u8g2->drawStr(x, baseline, text);
+        wantsHardware = true;
+        return;
+    }
+
+    drawSoftware(textWidth);
+}
+
+/**
+ * Called once the frame buffer has been sent to the panel. Starts the hardware
+ * scroll if this frame asked for it, as the scroll must be set up after the RAM
+ * holds the text.
+ */
+void ScrollingText::onFlushed() {
+    if (wantsHardware && !hardwareScrolling)
+        startHardwareScroll();
+}
+
+bool ScrollingText::isHardwareScrolling() {
+    return hardwareScrolling;
+}
+
+/**
+ * Stops the hardware scroll. The panel RAM is left rotated, so the caller is
+ * responsible for sending a full frame afterwards.
+ */
+void ScrollingText::stopHardwareScroll() {
+    if (!hardwareScrolling) return;
+
+    sendScrollCommand(SSD1306_SCROLL_DEACTIVATE);
+    hardwareScrolling = false;
+    if (hardwareOwner == this)
+        hardwareOwner = nullptr;
+}
+
+void ScrollingText::startHardwareScroll() {
+    u8x8_t *u8x8 = u8g2->getU8x8();
+
+    u8x8_cad_StartTransfer(u8x8);
+    u8x8_cad_SendCmd(u8x8, SSD1306_SCROLL_DEACTIVATE);
+    u8x8_cad_SendCmd(u8x8, SSD1306_SCROLL_LEFT);
+    u8x8_cad_SendArg(u8x8, 0x00);
+    u8x8_cad_SendArg(u8x8, firstPage);
+    u8x8_cad_SendArg(u8x8, SSD1306_SCROLL_5_FRAMES);
+    u8x8_cad_SendArg(u8x8, lastPage);
+    u8x8_cad_SendArg(u8x8, 0x00);
+    u8x8_cad_SendArg(u8x8, 0xFF);
+    u8x8_cad_SendCmd(u8x8, SSD1306_SCROLL_ACTIVATE);
+    u8x8_cad_EndTransfer(u8x8);
+
+    hardwareScrolling = true;
+    hardwareOwner = this;
+}
+
+void ScrollingText::sendScrollCommand(uint8_t command) {
+    u8x8_t *u8x8 = u8g2->getU8x8();
+
+    u8x8_cad_StartTransfer(u8x8);
+    u8x8_cad_SendCmd(u8x8, command);
+    u8x8_cad_EndTransfer(u8x8);
+}
+
+/**
+ * Draws the text as a marquee inside the clip window of the line. Only the tiles
+ * covered by the line change between frames, so the display controller sends
+ * just those.
+ *
+ * @param textWidth The width of the text in pixels.
+ */
+void ScrollingText::drawSoftware(int textWidth) {
+    unsigned long elapsed = millis() - scrollStartTime;
+    int offset = 0;
+
+    if (elapsed > SCROLL_START_PAUSE)
+        offset = ((elapsed - SCROLL_START_PAUSE) * SCROLL_SPEED_PX_PER_S / 1000) % (textWidth + SCROLL_GAP_PX);
+
+    u8g2->setClipWindow(x, 0, x + width, u8g2->getDisplayHeight());
+    u8g2->drawStr(x - offset, baseline, text);
+    u8g2->drawStr(x - offset + textWidth + SCROLL_GAP_PX, baseline, text);
+    u8g2->setMaxClipWindow();
+}
+
+/**
+ * Checks that the display pages covered by the line are still empty, as the
+ * hardware scroll rotates whole pages across the full panel width.
+ *
+ * @return true if nothing else has been drawn on the pages of the line.
+ */
+bool ScrollingText::pagesAreEmpty() {
+    uint8_t *buffer = u8g2->getBufferPtr();
+    int pageStride = u8g2->getBufferTileWidth() * 8;
+
+    for (int page = firstPage; page <= lastPage; page++) {
+        for (int col = 0; col < pageStride; col++) {
+            if (buffer[page * pageStride + col] != 0)
+                return false;
+        }
+    }
+    return true;
+}
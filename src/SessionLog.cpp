@@ -0,0 +1,331 @@
+#include <Arduino.h>
+#include <esp_rom_crc.h>
+#include <sys/time.h>
+#include <time.h>
+#include "SessionLog.h"
+#include "Trace.h"
+
+#define SESSION_SCAN_SLOTS 16 // slots read from flash at once while scanning
+
+/**
+ * Start of every sector, in slot 0.
+ */
+struct SessionSectorHeader {
+    uint32_t magic;
+    uint32_t sequence;
+    uint32_t reserved[2];
+};
+
+static_assert(sizeof(SessionSectorHeader) == 16, "the header fills one slot");
+
+SessionLog::SessionLog()
+    : recordsWritten(0),
+      recordsDropped(0),
+      compactions(0),
+      lastFlushMicros(0),
+      maxFlushMicros(0),
+      partition(nullptr),
+      sectorCount(0),
+      headSector(0),
+      headSlot(slotsPerSector),
+      sequence(0),
+      compactedThrough(0),
+      pendingCount(0),
+      pendingSince(0),
+      week{},
+      totalSessions(0) {}
+
+/**
+ * Finds the log partition and rebuilds the totals from it. This is the only
+ * full scan of the log.
+ *
+ * Nothing sets the clock, so after a power loss time() starts again from zero.
+ * It is moved forward to the newest time in the log, so it never goes back and
+ * new runs never land in the day buckets of old ones.
+ */
+void SessionLog::begin() {
+    partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, SESSION_PARTITION_LABEL);
+    if (partition == nullptr) {
+        Serial.println("Session log partition not found");
+        return;
+    }
+    sectorCount = partition->size / SESSION_SECTOR_SIZE;
+
+    // First pass: find the newest sector and the sectors already compacted
+    int newest = -1;
+    for (uint16_t sector = 0; sector < sectorCount; sector++) {
+        SessionSectorHeader header;
+        esp_partition_read(partition, slotAddress(sector, 0), &header, sizeof(header));
+        if (header.magic != SESSION_MAGIC) continue;
+
+        if (newest < 0 || header.sequence > sequence) {
+            newest = sector;
+            sequence = header.sequence;
+        }
+        scanSector(sector, [&](uint16_t, const uint8_t *slot) {
+            const DayRecord *day = (const DayRecord *)slot;
+            if (day->type == SESSION_RECORD_DAY && day->check == checkOf(*day))
+                compactedThrough = max(compactedThrough, day->sourceSequence);
+        });
+    }
+
+    // Second pass: count what hasn't been folded into a day record yet. Day
+    // records only survive in sectors newer than the runs they replace, so the
+    // newest time is among what is counted here.
+    uint32_t newestTime = 0;
+    for (uint16_t sector = 0; sector < sectorCount; sector++) {
+        SessionSectorHeader header;
+        esp_partition_read(partition, slotAddress(sector, 0), &header, sizeof(header));
+        if (header.magic != SESSION_MAGIC || (uint16_t)header.sequence <= compactedThrough)
+            continue;
+
+        scanSector(sector, [&](uint16_t, const uint8_t *slot) {
+            const SessionRecord *run = (const SessionRecord *)slot;
+            const DayRecord *day = (const DayRecord *)slot;
+            if (run->type == SESSION_RECORD_RUN && run->check == checkOf(*run)) {
+                countRun(*run);
+                newestTime = max(newestTime, run->end);
+            } else if (day->type == SESSION_RECORD_DAY && day->check == checkOf(*day)) {
+                countDay(*day);
+                newestTime = max(newestTime, day->day * SESSION_SECONDS_PER_DAY);
+            }
+        });
+    }
+
+    if ((uint32_t)time(nullptr) < newestTime) {
+        struct timeval now = {(time_t)newestTime, 0};
+        settimeofday(&now, nullptr);
+        Serial.println("Session log: clock moved forward to the newest run");
+    }
+
+    if (newest < 0) return; // empty log, the first write compacts its way to sector 1
+
+    headSector = newest;
+    headSlot = 1;
+    scanSector(newest, [&](uint16_t index, const uint8_t *slot) {
+        // A slot that failed its check, or was torn before its type byte, was
+        // still written and can't be reused
+        for (int i = 0; i < 16; i++) {
+            if (slot[i] != 0xFF) {
+                headSlot = index + 1;
+                break;
+            }
+        }
+    });
+}
+
+/**
+ * Queues a finished run and counts it in the totals. Never touches flash, so it
+ * is safe to call from the timer path.
+ *
+ * @param mode The kind of run.
+ * @param start When the run started, from time().
+ * @param end When the run ended, from time().
+ * @param activeMs The time counted, without pauses.
+ * @param completed true if the run reached its end rather than being cancelled.
+ */
+void SessionLog::append(SessionMode mode, uint32_t start, uint32_t end, uint32_t activeMs, bool completed) {
+    SessionRecord run = {start, end, activeMs, mode, completed, SESSION_RECORD_RUN, 0};
+    run.check = checkOf(run);
+    countRun(run);
+
+    if (pendingCount >= SESSION_PENDING_SIZE) {
+        recordsDropped++;
+        return;
+    }
+    if (pendingCount == 0)
+        pendingSince = millis();
+    pending[pendingCount++] = run;
+}
+
+/**
+ * Writes the queued runs as one batch once enough have gathered, or they have
+ * waited too long, and only while idle.
+ *
+ * @param idle true if a flash stall would go unnoticed now.
+ */
+void SessionLog::update(bool idle) {
+    if (!idle || pendingCount == 0) return;
+
+    if (pendingCount >= SESSION_BATCH_SIZE || millis() - pendingSince >= SESSION_MAX_DEFER_MS)
+        flush();
+}
+
+/**
+ * Writes the queued runs now.
+ */
+void SessionLog::flush() {
+    if (pendingCount == 0) return;
+    TRACE_SPAN_ARG("session flush", pendingCount);
+
+    unsigned long start = micros();
+    for (uint8_t i = 0; i < pendingCount; i++) {
+        if (!writeSlot(&pending[i]))
+            recordsDropped++;
+    }
+    pendingCount = 0;
+
+    lastFlushMicros = micros() - start;
+    maxFlushMicros = max(maxFlushMicros, lastFlushMicros);
+}
+
+/**
+ * Reads the totals. Constant time, from the running totals.
+ */
+SessionStats SessionLog::stats() const {
+    uint32_t today = time(nullptr) / SESSION_SECONDS_PER_DAY;
+    SessionStats stats = {};
+    stats.today.day = today;
+    stats.totalSessions = totalSessions;
+
+    for (const DayTotal &bucket : week) {
+        if (bucket.sessions == 0 || bucket.day > today || bucket.day + SESSION_WEEK_DAYS <= today) continue;
+
+        if (bucket.day == today)
+            stats.today = bucket;
+        stats.weekSeconds += bucket.activeSeconds;
+        stats.weekSessions += bucket.sessions;
+    }
+    return stats;
+}
+
+/**
+ * Calls visit for every slot of a sector after the header, reading a few slots
+ * at a time.
+ */
+template <typename Visit>
+void SessionLog::scanSector(uint16_t sector, Visit visit) {
+    uint8_t chunk[SESSION_SCAN_SLOTS * 16];
+    for (uint16_t first = 0; first < slotsPerSector; first += SESSION_SCAN_SLOTS) {
+        if (esp_partition_read(partition, slotAddress(sector, first), chunk, sizeof(chunk)) != ESP_OK)
+            return;
+        for (uint16_t i = 0; i < SESSION_SCAN_SLOTS; i++) {
+            if (first + i > 0)
+                visit(first + i, chunk + i * 16);
+        }
+    }
+}
+
+bool SessionLog::writeSlot(const void *record) {
+    if (partition == nullptr) return false;
+
+    if (headSlot >= slotsPerSector - SESSION_COMPACT_RESERVE)
+        compact();
+
+    uint32_t address = slotAddress(headSector, headSlot++);
+    if (esp_partition_write(partition, address, record, 16) != ESP_OK) return false;
+
+    recordsWritten++;
+    return true;
+}
+
+/**
+ * Frees the next sector of the ring. If it holds runs, they are summed per day
+ * into the reserved end of the head sector before it is erased. Days that
+ * don't fit in the reserve, or are older than SESSION_KEEP_DAYS, are dropped,
+ * oldest first.
+ */
+void SessionLog::compact() {
+    uint16_t oldest = (headSector + 1) % sectorCount;
+
+    SessionSectorHeader header;
+    esp_partition_read(partition, slotAddress(oldest, 0), &header, sizeof(header));
+
+    // A sector folded before a power failure cut the erase short is not folded again
+    if (header.magic == SESSION_MAGIC && (uint16_t)header.sequence > compactedThrough) {
+        DayTotal days[SESSION_COMPACT_RESERVE];
+        uint8_t dayCount = 0;
+        uint32_t today = time(nullptr) / SESSION_SECONDS_PER_DAY;
+
+        auto fold = [&](uint32_t day, uint32_t activeSeconds, uint16_t sessions, uint16_t completedSessions) {
+            if (day + SESSION_KEEP_DAYS < today) return;
+
+            int target = -1;
+            int oldestDay = 0;
+            for (int i = 0; i < dayCount; i++) {
+                if (days[i].day == day) target = i;
+                if (days[i].day < days[oldestDay].day) oldestDay = i;
+            }
+            if (target < 0) {
+                if (dayCount < SESSION_COMPACT_RESERVE) {
+                    target = dayCount++;
+                } else if (day > days[oldestDay].day) {
+                    target = oldestDay;
+                } else {
+                    return;
+                }
+                days[target] = {day, 0, 0, 0};
+            }
+            days[target].activeSeconds += activeSeconds;
+            days[target].sessions += sessions;
+            days[target].completedSessions += completedSessions;
+        };
+
+        scanSector(oldest, [&](uint16_t, const uint8_t *slot) {
+            const SessionRecord *run = (const SessionRecord *)slot;
+            const DayRecord *day = (const DayRecord *)slot;
+            if (run->type == SESSION_RECORD_RUN && run->check == checkOf(*run))
+                fold(run->end / SESSION_SECONDS_PER_DAY, run->activeMs / 1000, 1, run->completed);
+            else if (day->type == SESSION_RECORD_DAY && day->check == checkOf(*day))
+                fold(day->day, day->activeSeconds, day->sessions, day->completedSessions);
+        });
+
+        for (uint8_t i = 0; i < dayCount; i++) {
+            DayRecord record = {days[i].day, days[i].activeSeconds, days[i].sessions, days[i].completedSessions,
+                                (uint16_t)header.sequence, SESSION_RECORD_DAY, 0};
+            record.check = checkOf(record);
+            esp_partition_write(partition, slotAddress(headSector, headSlot++), &record, sizeof(record));
+        }
+        compactedThrough = header.sequence;
+        compactions++;
+    }
+
+    esp_partition_erase_range(partition, slotAddress(oldest, 0), SESSION_SECTOR_SIZE);
+    SessionSectorHeader fresh = {SESSION_MAGIC, ++sequence, {0xFFFFFFFF, 0xFFFFFFFF}};
+    esp_partition_write(partition, slotAddress(oldest, 0), &fresh, sizeof(fresh));
+    headSector = oldest;
+    headSlot = 1;
+}
+
+void SessionLog::countRun(const SessionRecord &run) {
+    DayTotal &bucket = bucketFor(run.end / SESSION_SECONDS_PER_DAY);
+    bucket.activeSeconds += run.activeMs / 1000;
+    bucket.sessions++;
+    bucket.completedSessions += run.completed;
+    totalSessions++;
+}
+
+void SessionLog::countDay(const DayRecord &day) {
+    DayTotal &bucket = bucketFor(day.day);
+    bucket.activeSeconds += day.activeSeconds;
+    bucket.sessions += day.sessions;
+    bucket.completedSessions += day.completedSessions;
+    totalSessions += day.sessions;
+}
+
+/**
+ * Returns the running total of a day. Each bucket holds the newest day that
+ * maps to it, so a day a week older than its bucket only counts in the grand
+ * total, whatever order the log is read in.
+ */
+DayTotal &SessionLog::bucketFor(uint32_t day) {
+    static DayTotal discarded;
+
+    DayTotal &bucket = week[day % SESSION_WEEK_DAYS];
+    if (bucket.day == day) return bucket;
+    if (bucket.sessions > 0 && bucket.day > day) {
+        discarded = {};
+        return discarded;
+    }
+    bucket = {day, 0, 0, 0};
+    return bucket;
+}
+
+uint32_t SessionLog::slotAddress(uint16_t sector, uint16_t slot) const {
+    return sector * SESSION_SECTOR_SIZE + slot * 16;
+}
+
+template <typename R>
+uint8_t SessionLog::checkOf(const R &record) {
+    return esp_rom_crc8_le(0, (const uint8_t *)&record, offsetof(R, check));
+}
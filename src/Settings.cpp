@@ -0,0 +1,305 @@
+#include <Arduino.h>
+#include <EEPROM.h>
+#include <esp_rom_crc.h>
+#include "Settings.h"
+#include "InputController.h"
+#include "Trace.h"
+#include HW_CONFIG
+
+/**
+ * Range and default of a numeric setting. String settings have no field.
+ */
+struct SettingSpec {
+    int32_t SettingsData::*field;
+    int32_t min;
+    int32_t max;
+    int32_t fallback;
+};
+
+// Indexed by SettingId
+static const SettingSpec specs[] = {
+    {&SettingsData::ledRingBrightness, 0, 100, 50},
+    {&SettingsData::screenBrightness, 0, 250, 120},
+    {&SettingsData::soundLevel, 0, 2, 2},
+    {&SettingsData::deltaTCw, 1000, 10000, 5000},
+    {&SettingsData::deltaTCcw, 10000, 60000, 60000},
+    {&SettingsData::encoderAcceleration, 0, INPUT_ACCEL_MAX_LEVEL, INPUT_ACCEL_DEFAULT_LEVEL},
+    {nullptr, 0, 0, 0}, // SSID
+    {nullptr, 0, 0, 0}, // password
+    {&SettingsData::multiClickWindowMs, INPUT_MULTI_CLICK_MIN_MS, INPUT_MULTI_CLICK_MAX_MS, INPUT_MULTI_CLICK_MS},
+    {&SettingsData::volume, 10, 100, 100},
+};
+static_assert(sizeof(specs) / sizeof(specs[0]) == SETTING_COUNT, "every setting needs a spec");
+
+static bool isNumeric(int id) {
+    return id < SETTING_COUNT && specs[id].field != nullptr;
+}
+
+static_assert(EEPROM_SETTINGS_ADDR + sizeof(SettingsData) <= EEPROM_SIZE, "settings must fit in the EEPROM");
+static_assert(SETTING_COUNT <= 32, "dirtyMask has one bit per setting");
+static_assert(sizeof(SettingsData::ssid) - 1 <= JOURNAL_MAX_PAYLOAD, "strings must fit in a journal record");
+static_assert(sizeof(SettingsData::password) - 1 <= JOURNAL_MAX_PAYLOAD, "strings must fit in a journal record");
+
+static const uint32_t allSettings = (1UL << SETTING_COUNT) - 1;
+
+Settings::Settings()
+    : commits(0),
+      lastCommitMicros(0),
+      maxCommitMicros(0),
+      migrated(false),
+      dirtyMask(0),
+      firstChange(0),
+      lastChange(0),
+      listenerCount(0) {
+    memset(&data, 0, sizeof(data));
+}
+
+/**
+ * Loads the settings from the journal, or migrates them from EEPROM when the
+ * journal is empty. Must run after EEPROM.begin().
+ */
+void Settings::begin() {
+    if (!journal.begin(onRecord, this)) {
+        if (!loadEeprom()) {
+            Serial.println("Settings: migrating legacy layout");
+            loadLegacy();
+        }
+        validate();
+        migrated = true;
+        dirtyMask = allSettings;
+        save();
+    } else if (validate()) {
+        dirtyMask = allSettings;
+        save();
+    }
+}
+
+/**
+ * Commits pending changes once the user has stopped changing settings and
+ * nothing time-critical is running. Otherwise, when idle, prepares the
+ * journal so the next commit doesn't have to erase.
+ *
+ * @param idle true if a flash stall would go unnoticed now.
+ */
+void Settings::update(bool idle) {
+    if (dirtyMask == 0) {
+        if (idle)
+            journal.prepare();
+        return;
+    }
+
+    unsigned long now = millis();
+    bool quiet = now - lastChange >= SETTINGS_WRITE_BACK_MS;
+    if ((idle && quiet) || now - firstChange >= SETTINGS_MAX_DEFER_MS)
+        save();
+}
+
+/**
+ * Commits pending changes now.
+ */
+void Settings::flush() {
+    if (dirtyMask != 0)
+        save();
+}
+
+/**
+ * Changes a numeric setting, clamping it to its range. Listeners are only
+ * told when the stored value actually changes.
+ *
+ * @param id The setting to change.
+ * @param value The new value.
+ */
+void Settings::set(SettingId id, int32_t value) {
+    if (!isNumeric(id)) return;
+
+    const SettingSpec &spec = specs[id];
+    value = constrain(value, spec.min, spec.max);
+    if (data.*spec.field == value) return;
+
+    data.*spec.field = value;
+    if (dirtyMask == 0)
+        firstChange = millis();
+    dirtyMask |= 1UL << id;
+    lastChange = millis();
+    notify(id);
+}
+
+void Settings::setSsid(const char *ssid) {
+    if (strncmp(data.ssid, ssid, sizeof(data.ssid) - 1) == 0) return;
+
+    strncpy(data.ssid, ssid, sizeof(data.ssid) - 1);
+    data.ssid[sizeof(data.ssid) - 1] = '\0';
+    if (dirtyMask == 0)
+        firstChange = millis();
+    dirtyMask |= 1UL << SETTING_SSID;
+    lastChange = millis();
+    notify(SETTING_SSID);
+}
+
+/**
+ * Registers a consumer and hands it every current value.
+ *
+ * @param listener The function called on changes.
+ * @param context Passed back to the listener, usually the consumer object.
+ * @return false if all listener slots are taken.
+ */
+bool Settings::addListener(SettingsListener listener, void *context) {
+    if (listenerCount >= SETTINGS_MAX_LISTENERS) return false;
+
+    listeners[listenerCount++] = {listener, context};
+    for (int id = 0; id < SETTING_COUNT; id++)
+        listener(context, data, (SettingId)id);
+    return true;
+}
+
+/**
+ * Prints the commit cost and the journal wear, one line each.
+ */
+void Settings::printMetrics(Print &out) {
+    out.print("settings: ");
+    out.print((unsigned long)commits);
+    out.print(" commits, last ");
+    out.print(lastCommitMicros);
+    out.print(" us, max ");
+    out.print(maxCommitMicros);
+    out.println(" us");
+
+    out.print("settings: journal ");
+    out.print((unsigned long)journal.sectorErases);
+    out.print(" erases, ");
+    out.print((unsigned long)journal.bytesWritten);
+    out.print(" bytes written, ");
+    out.print((unsigned long)journal.recordsSkipped);
+    out.print(" records skipped, ");
+    out.print((unsigned long)journal.estimatedCycles());
+    out.println(" erase cycles per sector");
+}
+
+void Settings::notify(SettingId id) {
+    for (int i = 0; i < listenerCount; i++)
+        listeners[i].callback(listeners[i].context, data, id);
+}
+
+/**
+ * Applies a journal record to the settings. Values are validated once the
+ * whole journal has been replayed.
+ */
+void Settings::onRecord(void *context, uint8_t id, const uint8_t *payload, uint8_t length) {
+    SettingsData &data = ((Settings *)context)->data;
+
+    if (isNumeric(id) && length == sizeof(int32_t)) {
+        memcpy(&(data.*specs[id].field), payload, sizeof(int32_t));
+    } else if (id == SETTING_SSID || id == SETTING_PASSWORD) {
+        char *text = id == SETTING_SSID ? data.ssid : data.password;
+        size_t size = id == SETTING_SSID ? sizeof(data.ssid) : sizeof(data.password);
+        size_t copied = min((size_t)length, size - 1);
+        memcpy(text, payload, copied);
+        text[copied] = '\0';
+    }
+}
+
+/**
+ * Reads the settings block earlier firmware kept in EEPROM.
+ *
+ * @return false if it is missing, from another version or corrupted.
+ */
+bool Settings::loadEeprom() {
+    EEPROM.get(EEPROM_SETTINGS_ADDR, data);
+    return data.version == SETTINGS_VERSION &&
+           data.length == sizeof(SettingsData) &&
+           data.crc == checksum();
+}
+
+/**
+ * Reads the values the firmware used to keep at fixed EEPROM addresses. Values
+ * that were never written read as erased flash and are replaced by validate().
+ */
+void Settings::loadLegacy() {
+    memset(&data, 0, sizeof(data));
+    data.ledRingBrightness = EEPROM.readInt(EEPROM_LEDRING_BRIGHTNESS_ADDR);
+    data.screenBrightness = EEPROM.readInt(EEPROM_SCREEN_BRIGHTNESS_ADDR);
+    data.soundLevel = EEPROM.readUChar(EEPROM_PIEZO_MUTE_ADDR);
+    data.deltaTCw = EEPROM.readInt(EEPROM_DELTAT_CW_ADDR);
+    data.deltaTCcw = EEPROM.readInt(EEPROM_DELTAT_CCW_ADDR);
+    data.encoderAcceleration = EEPROM.readUChar(EEPROM_ENCODER_ACCEL_ADDR);
+    EEPROM.readString(EEPROM_SSID_ADDR, data.ssid, sizeof(data.ssid));
+    EEPROM.readString(EEPROM_PASSWORD_ADDR, data.password, sizeof(data.password));
+}
+
+/**
+ * Replaces out of range values by their default and drops strings holding
+ * anything but printable characters, as erased flash does.
+ *
+ * @return true if anything had to be fixed.
+ */
+bool Settings::validate() {
+    bool fixed = false;
+
+    for (const SettingSpec &spec : specs) {
+        if (spec.field == nullptr) continue;
+        int32_t value = data.*spec.field;
+        if (value < spec.min || value > spec.max) {
+            data.*spec.field = spec.fallback;
+            fixed = true;
+        }
+    }
+
+    char *strings[] = {data.ssid, data.password};
+    size_t sizes[] = {sizeof(data.ssid), sizeof(data.password)};
+    for (int s = 0; s < 2; s++) {
+        strings[s][sizes[s] - 1] = '\0';
+        for (char *c = strings[s]; *c != '\0'; c++) {
+            if (!isprint((unsigned char)*c)) {
+                strings[s][0] = '\0';
+                fixed = true;
+                break;
+            }
+        }
+    }
+    return fixed;
+}
+
+/**
+ * Appends a record for every dirty setting. When the active sector runs out of
+ * room, a new one is started with a snapshot of every setting.
+ */
+void Settings::save() {
+    TRACE_SPAN("settings commit");
+    unsigned long start = micros();
+
+    if (!writeRecords(dirtyMask)) {
+        if (!journal.startSector() || !writeRecords(allSettings) || !journal.sealSector())
+            Serial.println("Settings: journal write failed");
+    }
+    dirtyMask = 0;
+
+    lastCommitMicros = micros() - start;
+    maxCommitMicros = max(maxCommitMicros, lastCommitMicros);
+    commits++;
+}
+
+/**
+ * Writes one record per setting in the mask.
+ *
+ * @return false if the active sector is full.
+ */
+bool Settings::writeRecords(uint32_t mask) {
+    for (int id = 0; id < SETTING_COUNT; id++) {
+        if ((mask & (1UL << id)) == 0) continue;
+
+        bool written;
+        if (isNumeric(id)) {
+            int32_t value = data.*specs[id].field;
+            written = journal.append(id, &value, sizeof(value));
+        } else {
+            const char *text = id == SETTING_SSID ? data.ssid : data.password;
+            written = journal.append(id, text, strlen(text));
+        }
+        if (!written) return false;
+    }
+    return true;
+}
+
+uint32_t Settings::checksum() const {
+    return esp_rom_crc32_le(0, (const uint8_t *)&data, offsetof(SettingsData, crc));
+}
@@ -0,0 +1,193 @@
+#include <Arduino.h>
+#include <esp_rom_crc.h>
+#include "SettingsJournal.h"
+#include "Trace.h"
+
+SettingsJournal::SettingsJournal()
+    : sectorErases(0),
+      bytesWritten(0),
+      recordsSkipped(0),
+      partition(nullptr),
+      sectorCount(0),
+      activeSector(0),
+      sequence(0),
+      writeOffset(JOURNAL_SECTOR_SIZE),
+      nextErased(false) {}
+
+/**
+ * Finds the journal partition and replays the newest complete sector.
+ *
+ * @param replay Called for every valid record.
+ * @param context Passed back to replay.
+ * @return true if a complete sector was found. Otherwise the journal is empty
+ *         and the next append fails until startSector() is called.
+ */
+bool SettingsJournal::begin(JournalReplay replay, void *context) {
+    partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, JOURNAL_PARTITION_LABEL);
+    if (partition == nullptr) {
+        Serial.println("Settings journal partition not found");
+        return false;
+    }
+    sectorCount = partition->size / JOURNAL_SECTOR_SIZE;
+
+    int newest = -1;
+    uint32_t newestSequence = 0;
+    for (uint16_t sector = 0; sector < sectorCount; sector++) {
+        JournalSectorHeader header;
+        if (esp_partition_read(partition, sector * JOURNAL_SECTOR_SIZE, &header, sizeof(header)) != ESP_OK ||
+            header.magic != JOURNAL_MAGIC)
+            continue;
+
+        // Incomplete sectors still count, so their sequence is never reused
+        sequence = max(sequence, header.sequence);
+        if (header.complete == JOURNAL_COMPLETE && (newest < 0 || header.sequence > newestSequence)) {
+            newest = sector;
+            newestSequence = header.sequence;
+        }
+    }
+
+    if (newest < 0) {
+        // Start from the first sector on the next write
+        activeSector = sectorCount - 1;
+        writeOffset = JOURNAL_SECTOR_SIZE;
+        return false;
+    }
+
+    activeSector = newest;
+    writeOffset = scanSector(newest, replay, context);
+    return true;
+}
+
+/**
+ * Appends a record to the active sector.
+ *
+ * @param id The record type.
+ * @param payload The record data.
+ * @param length The size of the data, up to JOURNAL_MAX_PAYLOAD.
+ * @return false if the sector has no room left, or the write failed.
+ */
+bool SettingsJournal::append(uint8_t id, const void *payload, uint8_t length) {
+    if (partition == nullptr || length > JOURNAL_MAX_PAYLOAD) return false;
+
+    uint32_t size = recordSize(length);
+    if (writeOffset + size > JOURNAL_SECTOR_SIZE) return false;
+
+    uint8_t buffer[recordSize(JOURNAL_MAX_PAYLOAD)];
+    memset(buffer, 0xFF, size);
+    JournalRecordHeader header = {id, length, 0};
+    memcpy(buffer + sizeof(header), payload, length);
+    header.check = checkOf(header, buffer + sizeof(header));
+    memcpy(buffer, &header, sizeof(header));
+
+    uint32_t address = activeSector * JOURNAL_SECTOR_SIZE + writeOffset;
+    writeOffset += size; // a failed write leaves the space unusable either way
+    if (esp_partition_write(partition, address, buffer, size) != ESP_OK) return false;
+
+    bytesWritten += size;
+    return true;
+}
+
+/**
+ * Moves on to the next sector and writes its header. The caller then writes a
+ * snapshot of every value and seals the sector. Until then, recovery still
+ * uses the previous sector.
+ *
+ * @return false if the sector could not be prepared.
+ */
+bool SettingsJournal::startSector() {
+    if (partition == nullptr) return false;
+
+    uint16_t next = (activeSector + 1) % sectorCount;
+    if (!nextErased && !eraseSector(next)) return false;
+    nextErased = false;
+
+    JournalSectorHeader header = {JOURNAL_MAGIC, ++sequence, 0xFFFFFFFF, 0xFFFFFFFF};
+    if (esp_partition_write(partition, next * JOURNAL_SECTOR_SIZE, &header, sizeof(header)) != ESP_OK)
+        return false;
+
+    activeSector = next;
+    writeOffset = sizeof(header);
+    bytesWritten += sizeof(header);
+    return true;
+}
+
+/**
+ * Marks the active sector as holding a full snapshot.
+ */
+bool SettingsJournal::sealSector() {
+    if (partition == nullptr) return false;
+
+    uint32_t complete = JOURNAL_COMPLETE;
+    uint32_t address = activeSector * JOURNAL_SECTOR_SIZE + offsetof(JournalSectorHeader, complete);
+    return esp_partition_write(partition, address, &complete, sizeof(complete)) == ESP_OK;
+}
+
+/**
+ * Idle work. Erases the next sector ahead of time once the active one is
+ * filling up, so the erase stall does not land on a later commit.
+ */
+void SettingsJournal::prepare() {
+    if (partition == nullptr || nextErased || writeOffset < JOURNAL_SECTOR_SIZE * 3 / 4) return;
+
+    nextErased = eraseSector((activeSector + 1) % sectorCount);
+}
+
+/**
+ * Estimates how many erase cycles each sector has been through. Sectors are
+ * used in turn and every new sector takes the next sequence number, so the
+ * sequence counts the erases of the whole partition.
+ */
+uint32_t SettingsJournal::estimatedCycles() const {
+    if (sectorCount == 0) return 0;
+    return (sequence + sectorCount - 1) / sectorCount;
+}
+
+/**
+ * Replays the records of a sector.
+ *
+ * @return The offset where the next record goes.
+ */
+uint32_t SettingsJournal::scanSector(uint16_t sector, JournalReplay replay, void *context) {
+    uint32_t base = sector * JOURNAL_SECTOR_SIZE;
+    uint32_t offset = sizeof(JournalSectorHeader);
+
+    while (offset + sizeof(JournalRecordHeader) <= JOURNAL_SECTOR_SIZE) {
+        JournalRecordHeader header;
+        if (esp_partition_read(partition, base + offset, &header, sizeof(header)) != ESP_OK)
+            return JOURNAL_SECTOR_SIZE;
+
+        // Erased flash, the end of the log
+        if (header.id == 0xFF && header.length == 0xFF && header.check == 0xFFFF)
+            break;
+
+        // A torn header gives no length to skip by, so nothing after it can be trusted
+        if (header.length > JOURNAL_MAX_PAYLOAD || offset + recordSize(header.length) > JOURNAL_SECTOR_SIZE)
+            return JOURNAL_SECTOR_SIZE;
+
+        uint8_t payload[JOURNAL_MAX_PAYLOAD];
+        if (esp_partition_read(partition, base + offset + sizeof(header), payload, header.length) != ESP_OK)
+            return JOURNAL_SECTOR_SIZE;
+
+        if (checkOf(header, payload) == header.check)
+            replay(context, header.id, payload, header.length);
+        else
+            recordsSkipped++;
+
+        offset += recordSize(header.length);
+    }
+    return offset;
+}
+
+bool SettingsJournal::eraseSector(uint16_t sector) {
+    TRACE_SPAN_ARG("journal erase", sector);
+    if (esp_partition_erase_range(partition, sector * JOURNAL_SECTOR_SIZE, JOURNAL_SECTOR_SIZE) != ESP_OK)
+        return false;
+    sectorErases++;
+    return true;
+}
+
+uint16_t SettingsJournal::checkOf(const JournalRecordHeader &header, const uint8_t *payload) {
+    uint8_t prefix[2] = {header.id, header.length};
+    uint16_t crc = esp_rom_crc16_le(0, prefix, sizeof(prefix));
+    return esp_rom_crc16_le(crc, payload, header.length);
+}
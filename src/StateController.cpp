@@ -2,25 +2,44 @@
 #include "StateController.h"
 #include HW_CONFIG
 #include <esp_sleep.h>
+#include <time.h>
 #include "Animation.h"
 #include "bitmaps.h"
 #include "Melody.h"
 #include "melodies.h"
-#include <EEPROM.h>
+#include "clips.h"
+#include "Trace.h"
+
+/**
+ * Wraps a menu position into 0..count-1. Accelerated detents move more than
+ * one step, so the position can be further than one lap below zero.
+ */
+static long wrapPosition(long position, long count) {
+  return ((position % count) + count) % count;
+}
 
 // Constructor
 StateController::StateController()
-    : currentState(STATE_MODE_SELECT),
+    : lapTimer(0),
+      lapCount(0),
+      currentState(STATE_MODE_SELECT),
+      unmutedSoundLevel(2),
+      sessionStart(0),
+      sessionStartMillis(0),
       lastInteractionTimer(millis()) {}
 
 // Update the state controller
 void StateController::update(DisplayController& display,
                              LedRingController& ledRing,
                              PiezoController& piezo,
-                             InputController& input) {
+                             InputController& input,
+                             Settings& settings,
+                             SessionLog& sessions) {
+  TRACE_SPAN("state");
+  SystemState enteredState = currentState;
 
-  int DELTA_T_CW = EEPROM.readInt(EEPROM_DELTAT_CW_ADDR);
-  int DELTA_T_CCW = EEPROM.readInt(EEPROM_DELTAT_CCW_ADDR);
+  int DELTA_T_CW = settings.get().deltaTCw;
+  int DELTA_T_CCW = settings.get().deltaTCcw;
 
   if (firstTime) {
     display.animation.start(bitmaps[previousPosition], 27, true);
@@ -30,7 +49,7 @@ void StateController::update(DisplayController& display,
   const char* ssidList1[3] = {"CocaYJuampi", "Manuel", "SKYIRTWD"};
 
   // Main page menu states
-  const int NMODES = 6;
+  const int NMODES = 7;
 
   const SystemState newCurrentState[] = {
       STATE_TIMER_SELECT,
@@ -38,15 +57,17 @@ void StateController::update(DisplayController& display,
       STATE_SETTINGS,
       STATE_PREPARE_SLEEP,
       STATE_PULSE_SELECT,
-      STATE_WIFI_SELECT};
+      STATE_WIFI_SELECT,
+      STATE_STATS};
 
-  const String newCurrentStateString[] = {
+  const char* newCurrentStateString[] = {
       "Timer",
       "Stopwatch",
       "Settings",
       "Deepsleep",
       "Pulse",
-      "Connection"};
+      "Connection",
+      "Stats"};
 
   const ledRingAnimation newAnimation[] = {
       LEDRING_MODE_SELECT,
@@ -58,19 +79,27 @@ void StateController::update(DisplayController& display,
       LEDRING_MODE_SELECT};
 
   // Settings page states
-  const int NSETTINGS_PAGES = 4;
+  const int NSETTINGS_PAGES = 5;
 
   const SystemState newCurrentStateSettings[] = {
       STATE_SETTINGS_AUDIO,
       STATE_SETTINGS_DISPLAY,
       STATE_SETTINGS_LEDRING,
-      STATE_SETTINGS_TIMER};
+      STATE_SETTINGS_TIMER,
+      STATE_SETTINGS_VOLUME};
 
-  const String newSettingsPageString[] = {
+  const char* newSettingsPageString[] = {
       "Sound",
       "Display",
       "Ledring",
-      "Timer"};
+      "Timer",
+      "Volume"};
+
+  // Timer settings pages: CCW step, CW step, acceleration, click window
+  const int NTIMER_SETTINGS_PAGES = 4;
+
+  // Stats pages: today, last 7 days, all sessions
+  const int NSTATS_PAGES = 3;
 
   switch (currentState){ 
 
@@ -79,7 +108,7 @@ void StateController::update(DisplayController& display,
   // ----------------
   case STATE_PREPARE_SLEEP:
     if (millis() - lastInteractionTimer > 2000)
-      enterDeepSleep(display, ledRing);
+      enterDeepSleep(display, ledRing, settings, sessions);
     break;
 
   // --------------
@@ -88,18 +117,21 @@ void StateController::update(DisplayController& display,
   case STATE_MODE_SELECT:
     newPosition = input.getPosition();
     if (newPosition != currentPosition) {
-      newPosition = (newPosition + NMODES) % (NMODES);
+      newPosition = wrapPosition(newPosition, NMODES);
       input.setPosition(newPosition);
       currentPosition = newPosition;
       rotaryFeedback(piezo);
       display.animation.start(bitmaps[currentPosition], 27, true); // Start the animation for the selected mode
     }
 
+    if (input.lastAction == BUTTON_TRIPLE_PRESS)
+      toggleMute(piezo, settings);
+
     if (input.lastAction == BUTTON_SHORT_PRESS) {
       buttonFeedback(piezo);
       display.animation.stop();
       
-      ledRing.startAnimation(newAnimation[currentPosition], currentPosition, initialTimer, currentPosition, 20);
+      ledRing.startAnimation(newAnimation[currentPosition]);
       currentState = newCurrentState[currentPosition];
       Serial.print("Entering new menu: ");
       Serial.println(newCurrentStateString[currentPosition]);
@@ -123,19 +155,20 @@ void StateController::update(DisplayController& display,
       buttonFeedback(piezo);
       if (currentPosition==0){
         Serial.println("Returning to main menu");
-        // ledRing.startAnimation(LEDRING_RETURN_MAIN_MENU, currentTimer, initialTimer, currentPosition);
+        // ledRing.startAnimation(LEDRING_RETURN_MAIN_MENU);
         currentState = STATE_MODE_SELECT;
         input.setPosition(0);
-        display.animation.start(hourglass, 27, true);
+        display.animation.start(ASSET_HOURGLASS, 27, true);
         currentPosition = input.getPosition();
       }
 
       else {
         currentState = STATE_TIMER_RUN;
-        display.animation.start(play_pause, 19); // Set the countdown animation to start
+        display.animation.start(ASSET_PLAY_PAUSE, 19); // Set the countdown animation to start
         initialTimer = currentTimer;
-        ledRing.startAnimation(LEDRING_START_TIMER, currentTimer, initialTimer, currentPosition, 20);
+        ledRing.startAnimation(LEDRING_START_TIMER);
         countdownTimer = millis();
+        startSession();
         Serial.print("Timer started with: ");
         Serial.print(currentTimer);
         Serial.println(" miliseconds");
@@ -148,10 +181,10 @@ void StateController::update(DisplayController& display,
 
       if (currentPosition==0){
         Serial.println("Returning to main menu");
-        // ledRing.startAnimation(LEDRING_RETURN_MAIN_MENU, currentTimer, initialTimer, currentPosition, 20);
+        // ledRing.startAnimation(LEDRING_RETURN_MAIN_MENU);
         currentState = STATE_MODE_SELECT;
         input.setPosition(0);
-        display.animation.start(hourglass, 27, true);
+        display.animation.start(ASSET_HOURGLASS, 27, true);
         currentPosition = input.getPosition();
       }
 
@@ -177,17 +210,35 @@ void StateController::update(DisplayController& display,
 
     if (currentTimer < 0){
       currentState = STATE_TIMER_FINISHED;
-      ledRing.startAnimation(LEDRING_FINISHED_TIMER, currentTimer, initialTimer, currentPosition, 20);
-      display.animation.start(ring_alarm, 27, true); 
-      piezo.startMelody(loopBeep);
+      endSession(sessions, SESSION_TIMER, initialTimer, true);
+      ledRing.startAnimation(LEDRING_FINISHED_TIMER);
+      display.animation.start(ASSET_RING_ALARM, 27, true); 
+      piezo.playClip(chimeClip, SOUND_ALARM);
+      piezo.startMelody(loopBeep, SOUND_ALARM);
       lastInteractionTimer = millis();
     }
 
     if (input.lastAction == BUTTON_SHORT_PRESS) {
       buttonFeedback(piezo);
       currentState = STATE_TIMER_PAUSED;
-      display.animation.start(play_pause, 19, false, true); // Set the countdown animation to start
-      ledRing.startAnimation(LEDRING_PAUSE_TIMER, currentTimer, initialTimer, currentPosition, 20);
+      display.animation.start(ASSET_PLAY_PAUSE, 19, false, true); // Set the countdown animation to start
+      ledRing.startAnimation(LEDRING_PAUSE_TIMER);
+    }
+
+    if (input.lastAction == BUTTON_DOUBLE_PRESS) {
+      buttonFeedback(piezo);
+      Serial.println("Adding one minute");
+      currentTimer += 60000;
+      initialTimer += 60000;
+    }
+
+    if (input.lastAction == BUTTON_TRIPLE_PRESS)
+      toggleMute(piezo, settings);
+
+    if (input.lastAction == BUTTON_PRESS_ROTATE_CW || input.lastAction == BUTTON_PRESS_ROTATE_CCW) {
+      rotaryFeedback(piezo);
+      currentTimer = max(1000L, currentTimer + input.chordSteps * 60000L);
+      initialTimer = max(initialTimer, currentTimer);
     }
     break;
 
@@ -196,16 +247,23 @@ void StateController::update(DisplayController& display,
     if (input.lastAction == BUTTON_SHORT_PRESS) {
       buttonFeedback(piezo);
       currentState = STATE_TIMER_RUN;
-      display.animation.start(play_pause, 19);
-      ledRing.startAnimation(LEDRING_START_TIMER, currentTimer, initialTimer, currentPosition, 20);
+      display.animation.start(ASSET_PLAY_PAUSE, 19);
+      ledRing.startAnimation(LEDRING_START_TIMER);
       countdownTimer = millis();
     }
 
     if (input.lastAction == BUTTON_LONG_PRESS) {
       buttonFeedback(piezo);
+      endSession(sessions, SESSION_TIMER, initialTimer - currentTimer, false);
       currentState = STATE_TIMER_SELECT;
       currentTimer = abs(currentPosition) * (currentPosition < 0 ? DELTA_T_CCW : DELTA_T_CW);
     }
+
+    if (input.lastAction == BUTTON_PRESS_ROTATE_CW || input.lastAction == BUTTON_PRESS_ROTATE_CCW) {
+      rotaryFeedback(piezo);
+      currentTimer = max(1000L, currentTimer + input.chordSteps * 60000L);
+      initialTimer = max(initialTimer, currentTimer);
+    }
     break;
   
   // Timer finished
@@ -214,9 +272,9 @@ void StateController::update(DisplayController& display,
 
     if (input.lastAction == BUTTON_SHORT_PRESS || newPosition != currentPosition) {
       buttonFeedback(piezo);
-      piezo.stopMelody();
+      piezo.stopMelody(SOUND_ALARM);
       currentState = STATE_TIMER_SELECT;
-      ledRing.animationRunning = false;
+      ledRing.stopAnimation(LEDRING_FINISHED_TIMER);
       display.animation.stop();
       currentPosition = newPosition;
       currentTimer = abs(currentPosition) * (currentPosition < 0 ? DELTA_T_CCW : DELTA_T_CW);
@@ -239,19 +297,20 @@ void StateController::update(DisplayController& display,
       buttonFeedback(piezo);
     
       if (currentPosition==0){
-        // ledRing.startAnimation(LEDRING_RETURN_MAIN_MENU, currentTimer, initialTimer, 4);
+        // ledRing.startAnimation(LEDRING_RETURN_MAIN_MENU);
         currentState = STATE_MODE_SELECT;
         input.setPosition(4);
         currentPosition = input.getPosition();
-        display.animation.start(pulse, 27, true);
+        display.animation.start(ASSET_PULSE, 27, true);
       }
 
       else {
         currentState = STATE_PULSE_RUN;
-        display.animation.start(play_pause, 19);
+        display.animation.start(ASSET_PLAY_PAUSE, 19);
         initialTimer = currentTimer;
-        ledRing.startAnimation(LEDRING_START_TIMER, currentTimer, initialTimer, currentPosition, 20);
+        ledRing.startAnimation(LEDRING_START_TIMER);
         countdownTimer = millis();
+        startSession();
         // positionTimer = millis();
       }      
     }
@@ -261,11 +320,11 @@ void StateController::update(DisplayController& display,
 
       if (currentPosition==0){
         Serial.println("Returning to main menu");
-        // ledRing.startAnimation(LEDRING_RETURN_MAIN_MENU, currentTimer, initialTimer, currentPosition);
+        // ledRing.startAnimation(LEDRING_RETURN_MAIN_MENU);
         currentState = STATE_MODE_SELECT;
         input.setPosition(4);
         currentPosition = input.getPosition();
-        display.animation.start(pulse, 27, true);
+        display.animation.start(ASSET_PULSE, 27, true);
       }
 
       else {
@@ -289,14 +348,17 @@ void StateController::update(DisplayController& display,
       Serial.println("Pulse timer finished");
       currentTimer += initialTimer;
       piezo.startMelody(rotaryUpMelody);
-      ledRing.startAnimation(LEDRING_PULSE_FLASH, 5);
+      ledRing.startAnimation(LEDRING_PULSE_FLASH);
     }
 
     if (input.lastAction == BUTTON_SHORT_PRESS) {
       buttonFeedback(piezo);
+      // A pulse run counts as completed once it went through at least one period
+      unsigned long int activeMs = millis() - sessionStartMillis;
+      endSession(sessions, SESSION_PULSE, activeMs, activeMs >= (unsigned long int)initialTimer);
       currentState = STATE_PULSE_SELECT;
       currentTimer = abs(currentPosition) * (currentPosition < 0 ? DELTA_T_CCW : DELTA_T_CW);
-      display.animation.start(play_pause, 19, false, true);
+      display.animation.start(ASSET_PLAY_PAUSE, 19, false, true);
     }
     break;
 
@@ -307,7 +369,7 @@ void StateController::update(DisplayController& display,
     newPosition = input.getPosition();
 
     if (newPosition != currentPosition) {
-      newPosition = (newPosition + 3) % 4; // Wrap around to 0-3
+      newPosition = wrapPosition(newPosition, 4);
       currentPosition = newPosition;
       rotaryFeedback(piezo);
       input.setPosition(newPosition);      
@@ -316,14 +378,15 @@ void StateController::update(DisplayController& display,
     if (input.lastAction == BUTTON_SHORT_PRESS) {
       buttonFeedback(piezo);
       if (currentPosition==0){
-        // ledRing.startAnimation(LEDRING_RETURN_MAIN_MENU, currentPosition, initialTimer, 5);
+        // ledRing.startAnimation(LEDRING_RETURN_MAIN_MENU);
         currentState = STATE_MODE_SELECT;
         input.setPosition(5);
         currentPosition = input.getPosition();
-        display.animation.start(wifi, 27, true);
-        EEPROM.commit();
+        display.animation.start(ASSET_WIFI, 27, true);
+      }
+      else {
+        settings.setSsid(ssidList1[currentPosition-1]);
       }
-      else EEPROM.writeString(EEPROM_SSID_ADDR, ssidList1[currentPosition-1]);
     }
     break;
 
@@ -335,13 +398,16 @@ void StateController::update(DisplayController& display,
       buttonFeedback(piezo);
       currentState = STATE_STOPWATCH_RUN;
       currentTimer = 0; // Reset stopwatch timer
+      lapTimer = 0;
+      lapCount = 0;
       timeNow = millis();
+      startSession();
     }
 
     if (input.lastAction == BUTTON_LONG_PRESS) {
       buttonFeedback(piezo);
       currentState = STATE_MODE_SELECT;
-      display.animation.start(watch, 27, true);
+      display.animation.start(ASSET_WATCH, 27, true);
       input.setPosition(1);
       currentPosition = input.getPosition();
     }
@@ -358,8 +424,19 @@ void StateController::update(DisplayController& display,
     if (input.lastAction == BUTTON_SHORT_PRESS) {
       buttonFeedback(piezo);
       currentState = STATE_STOPWATCH_PAUSED;
-      display.animation.start(play_pause, 19, false, true);
-      ledRing.startAnimation(LEDRING_PAUSE_TIMER, currentTimer, initialTimer, currentPosition, 20);
+      display.animation.start(ASSET_PLAY_PAUSE, 19, false, true);
+      ledRing.startAnimation(LEDRING_PAUSE_TIMER);
+    }
+
+    if (input.lastAction == BUTTON_DOUBLE_PRESS) {
+      buttonFeedback(piezo);
+      lapCount++;
+      Serial.print("Lap ");
+      Serial.print(lapCount);
+      Serial.print(": ");
+      Serial.print(currentTimer - lapTimer);
+      Serial.println(" miliseconds");
+      lapTimer = currentTimer;
     }
     break;
 
@@ -368,15 +445,16 @@ void StateController::update(DisplayController& display,
     if (input.lastAction == BUTTON_SHORT_PRESS) {
       buttonFeedback(piezo);
       currentState = STATE_STOPWATCH_RUN;
-      display.animation.start(play_pause, 19);
-      ledRing.startAnimation(LEDRING_START_TIMER, currentTimer, initialTimer, currentPosition, 20);
+      display.animation.start(ASSET_PLAY_PAUSE, 19);
+      ledRing.startAnimation(LEDRING_START_TIMER);
       timeNow = millis(); // Reset timeNow to current time
     }
 
     if (input.lastAction == BUTTON_LONG_PRESS) {
       buttonFeedback(piezo);
+      endSession(sessions, SESSION_STOPWATCH, currentTimer, true);
       currentState = STATE_STOPWATCH_START;
-      // display.animation.start(watch, 27, true);
+      // display.animation.start(ASSET_WATCH, 27, true);
       input.setPosition(0);
       currentPosition = input.getPosition();
       currentTimer = 0; // Reset stopwatch timer
@@ -391,7 +469,7 @@ void StateController::update(DisplayController& display,
 
     if (newPosition != currentPosition)
     {
-      newPosition = (newPosition + NSETTINGS_PAGES) % NSETTINGS_PAGES;
+      newPosition = wrapPosition(newPosition, NSETTINGS_PAGES);
       currentPosition = newPosition;
       rotaryFeedback(piezo);
       input.setPosition(newPosition);
@@ -419,6 +497,10 @@ void StateController::update(DisplayController& display,
       case 3:
         input.setPosition(0);
         break;
+
+      case 4:
+        input.setPosition(settings.get().volume/10);
+        break;
       
       default:
         break;
@@ -451,25 +533,49 @@ void StateController::update(DisplayController& display,
     if (input.lastAction == BUTTON_LONG_PRESS)
     {
       currentState = STATE_SETTINGS;
-      piezo.sound_level= newPosition; // Toggle piezo mute state
-      EEPROM.writeUChar(EEPROM_PIEZO_MUTE_ADDR, piezo.sound_level);
-      EEPROM.commit();
+      settings.set(SETTING_SOUND_LEVEL, newPosition);
       input.setPosition(0);
       currentPosition = input.getPosition();
     }
     break;
 
+  case STATE_SETTINGS_VOLUME:
+    newPosition = input.getPosition();
+    if (newPosition != currentPosition)
+    {
+      if (newPosition < 1) {
+        newPosition = 1;
+        ledRing.startAnimation(LEDRING_SETTINGS_LIMIT);
+      }
+      if (newPosition > 10) {
+        newPosition = 10;
+        ledRing.startAnimation(LEDRING_SETTINGS_LIMIT);
+      }
+      currentPosition = newPosition;
+      rotaryFeedback(piezo);
+      input.setPosition(newPosition);
+    }
+
+    if (input.lastAction == BUTTON_LONG_PRESS)
+    {
+      currentState = STATE_SETTINGS;
+      settings.set(SETTING_VOLUME, currentPosition*10);
+      input.setPosition(4);
+      currentPosition = input.getPosition();
+    }
+    break;
+
   case STATE_SETTINGS_DISPLAY:
     newPosition = input.getPosition();
     if (newPosition != currentPosition)
     {
       if (newPosition < 0) {
         newPosition = 0;
-        ledRing.startAnimation(LEDRING_SETTINGS_LIMIT, 5);
+        ledRing.startAnimation(LEDRING_SETTINGS_LIMIT);
       }
       if (newPosition > 25){
         newPosition = 25;
-        ledRing.startAnimation(LEDRING_SETTINGS_LIMIT, 5);
+        ledRing.startAnimation(LEDRING_SETTINGS_LIMIT);
       }
       currentPosition = newPosition;
       display.setBrightness(currentPosition*10);
@@ -480,8 +586,7 @@ void StateController::update(DisplayController& display,
     if (input.lastAction == BUTTON_LONG_PRESS)
     {
       currentState = STATE_SETTINGS;
-      EEPROM.writeInt(EEPROM_SCREEN_BRIGHTNESS_ADDR, currentPosition*10);
-      EEPROM.commit();
+      settings.set(SETTING_SCREEN_BRIGHTNESS, currentPosition*10);
       input.setPosition(2);
       currentPosition = input.getPosition();
     }
@@ -493,11 +598,11 @@ void StateController::update(DisplayController& display,
     {
       if (newPosition < 0) {
         newPosition = 0;
-        ledRing.startAnimation(LEDRING_SETTINGS_LIMIT, 5);
+        ledRing.startAnimation(LEDRING_SETTINGS_LIMIT);
       }
       if (newPosition > 10) {
         newPosition = 10;
-        ledRing.startAnimation(LEDRING_SETTINGS_LIMIT, 5);
+        ledRing.startAnimation(LEDRING_SETTINGS_LIMIT);
       }
       currentPosition = newPosition;
       ledRing.setBrightness(currentPosition*10);
@@ -508,8 +613,7 @@ void StateController::update(DisplayController& display,
     if (input.lastAction == BUTTON_LONG_PRESS)
     {
       currentState = STATE_SETTINGS;
-      EEPROM.writeInt(EEPROM_LEDRING_BRIGHTNESS_ADDR, currentPosition*10);
-      EEPROM.commit();
+      settings.set(SETTING_LEDRING_BRIGHTNESS, currentPosition*10);
       input.setPosition(2);
       currentPosition = input.getPosition();
     }
@@ -519,6 +623,7 @@ void StateController::update(DisplayController& display,
     newPosition = input.getPosition();
     if (newPosition != currentPosition)
     {
+      newPosition = wrapPosition(newPosition, NTIMER_SETTINGS_PAGES);
       currentPosition = newPosition;
       rotaryFeedback(piezo);
       input.setPosition(newPosition);
@@ -526,18 +631,30 @@ void StateController::update(DisplayController& display,
 
     if (input.lastAction == BUTTON_SHORT_PRESS)
     {
-      if (currentPosition%2 == 0) {
+      if (currentPosition == 0) {
         currentState = STATE_SETTINGS_TIMER_CCW;
         Serial.println("Editing CCW timer delta");
         input.setPosition(DELTA_T_CCW/1000);
         currentPosition = input.getPosition();
       }
-      else {
+      else if (currentPosition == 1) {
         currentState = STATE_SETTINGS_TIMER_CW;
         Serial.println("Editing CW timer delta");
         input.setPosition(DELTA_T_CW/1000);
         currentPosition = input.getPosition();      
       }
+      else if (currentPosition == 2) {
+        currentState = STATE_SETTINGS_TIMER_ACCEL;
+        Serial.println("Editing encoder acceleration");
+        input.setPosition(input.accelerationLevel);
+        currentPosition = input.getPosition();
+      }
+      else {
+        currentState = STATE_SETTINGS_TIMER_CLICK;
+        Serial.println("Editing multi-click window");
+        input.setPosition(settings.get().multiClickWindowMs / INPUT_MULTI_CLICK_STEP_MS);
+        currentPosition = input.getPosition();
+      }
     }
 
     if (input.lastAction == BUTTON_LONG_PRESS)
@@ -554,11 +671,11 @@ void StateController::update(DisplayController& display,
     {
       if (newPosition < 1) {
         newPosition = 1;
-        ledRing.startAnimation(LEDRING_SETTINGS_LIMIT, 5);
+        ledRing.startAnimation(LEDRING_SETTINGS_LIMIT);
       }
       if (newPosition > 10){
         newPosition = 10;
-        ledRing.startAnimation(LEDRING_SETTINGS_LIMIT, 5);
+        ledRing.startAnimation(LEDRING_SETTINGS_LIMIT);
       }
       currentPosition = newPosition;
       rotaryFeedback(piezo);
@@ -568,9 +685,8 @@ void StateController::update(DisplayController& display,
     if (input.lastAction == BUTTON_LONG_PRESS)
     {
       currentState = STATE_SETTINGS_TIMER;
-      EEPROM.writeInt(EEPROM_DELTAT_CW_ADDR, currentPosition*1000);
-      EEPROM.commit();
-      input.setPosition(3);
+      settings.set(SETTING_DELTA_T_CW, currentPosition*1000);
+      input.setPosition(1);
       currentPosition = input.getPosition();
     }
 
@@ -582,11 +698,11 @@ void StateController::update(DisplayController& display,
     {
       if (newPosition < 10) {
         newPosition = 10;
-        ledRing.startAnimation(LEDRING_SETTINGS_LIMIT, 5);
+        ledRing.startAnimation(LEDRING_SETTINGS_LIMIT);
       }
       if (newPosition > 60) {
         newPosition = 60;
-        ledRing.startAnimation(LEDRING_SETTINGS_LIMIT, 5);
+        ledRing.startAnimation(LEDRING_SETTINGS_LIMIT);
       }
       currentPosition = newPosition;
       rotaryFeedback(piezo);
@@ -596,14 +712,67 @@ void StateController::update(DisplayController& display,
     if (input.lastAction == BUTTON_LONG_PRESS)
     {
       currentState = STATE_SETTINGS_TIMER;
-      EEPROM.writeInt(EEPROM_DELTAT_CCW_ADDR, currentPosition*1000);
-      EEPROM.commit();
+      settings.set(SETTING_DELTA_T_CCW, currentPosition*1000);
       input.setPosition(0);
       currentPosition = input.getPosition();
     }
 
     break;
 
+  case STATE_SETTINGS_TIMER_ACCEL:
+    newPosition = input.getPosition();
+    if (newPosition != currentPosition)
+    {
+      if (newPosition < 0) {
+        newPosition = 0;
+        ledRing.startAnimation(LEDRING_SETTINGS_LIMIT);
+      }
+      if (newPosition > INPUT_ACCEL_MAX_LEVEL) {
+        newPosition = INPUT_ACCEL_MAX_LEVEL;
+        ledRing.startAnimation(LEDRING_SETTINGS_LIMIT);
+      }
+      currentPosition = newPosition;
+      rotaryFeedback(piezo);
+      input.setPosition(newPosition);
+    }
+
+    if (input.lastAction == BUTTON_LONG_PRESS)
+    {
+      currentState = STATE_SETTINGS_TIMER;
+      settings.set(SETTING_ENCODER_ACCEL, currentPosition);
+      input.setPosition(2);
+      currentPosition = input.getPosition();
+    }
+
+    break;
+
+  case STATE_SETTINGS_TIMER_CLICK:
+    newPosition = input.getPosition();
+    if (newPosition != currentPosition)
+    {
+      if (newPosition < INPUT_MULTI_CLICK_MIN_MS / INPUT_MULTI_CLICK_STEP_MS) {
+        newPosition = INPUT_MULTI_CLICK_MIN_MS / INPUT_MULTI_CLICK_STEP_MS;
+        ledRing.startAnimation(LEDRING_SETTINGS_LIMIT);
+      }
+      if (newPosition > INPUT_MULTI_CLICK_MAX_MS / INPUT_MULTI_CLICK_STEP_MS) {
+        newPosition = INPUT_MULTI_CLICK_MAX_MS / INPUT_MULTI_CLICK_STEP_MS;
+        ledRing.startAnimation(LEDRING_SETTINGS_LIMIT);
+      }
+      currentPosition = newPosition;
+      rotaryFeedback(piezo);
+      input.setPosition(newPosition);
+    }
+
+    if (input.lastAction == BUTTON_LONG_PRESS)
+    {
+      currentState = STATE_SETTINGS_TIMER;
+      settings.set(SETTING_MULTI_CLICK, currentPosition * INPUT_MULTI_CLICK_STEP_MS);
+      input.setPosition(3);
+      currentPosition = input.getPosition();
+    }
+
+    break;
+
   // ----------------
   //      INFO
   // ----------------
@@ -611,22 +780,67 @@ void StateController::update(DisplayController& display,
     if (input.lastAction == BUTTON_SHORT_PRESS) {
       buttonFeedback(piezo);
       currentState = STATE_MODE_SELECT;
-      display.animation.start(info, 27, true);
+      display.animation.start(ASSET_INFO, 27, true);
       input.setPosition(1);
       currentPosition = input.getPosition();
     }
     break;
 
+  // ----------------
+  //      STATS
+  // ----------------
+  case STATE_STATS:
+    newPosition = input.getPosition();
+
+    if (newPosition != currentPosition) {
+      newPosition = wrapPosition(newPosition, NSTATS_PAGES);
+      input.setPosition(newPosition);
+      currentPosition = newPosition;
+      rotaryFeedback(piezo);
+    }
+
+    display.setStats(sessions.stats());
+
+    if (input.lastAction == BUTTON_SHORT_PRESS || input.lastAction == BUTTON_LONG_PRESS) {
+      buttonFeedback(piezo);
+      currentState = STATE_MODE_SELECT;
+      display.animation.start(ASSET_INFO, 27, true);
+      input.setPosition(6);
+      currentPosition = input.getPosition();
+    }
+    break;
+
   default:
     break;
   }
-  checkDeepSleep(display, ledRing, currentState);
+
+  if (currentState != enteredState)
+    TRACE_INSTANT("transition", currentState);
+
+  configureInput(input);
+  checkDeepSleep(display, ledRing, settings, sessions, currentState);
 }
 
 SystemState StateController::getState() {
   return currentState;
 }
 
+/**
+ * Tells whether nothing is running that a flash stall would disturb, so
+ * deferred work such as committing settings can happen now.
+ */
+bool StateController::isIdle() {
+  switch (currentState) {
+  case STATE_TIMER_RUN:
+  case STATE_TIMER_FINISHED:
+  case STATE_PULSE_RUN:
+  case STATE_STOPWATCH_RUN:
+    return false;
+  default:
+    return true;
+  }
+}
+
 long int StateController::getPosition() {
   return currentPosition;
 }
@@ -639,8 +853,42 @@ long int StateController::getInitialTimer() {
   return initialTimer;
 }
 
-void StateController::enterDeepSleep(DisplayController& display, LedRingController& ledRing) {
+uint32_t StateController::getSessionStart() {
+  return sessionStart;
+}
+
+/**
+ * Resumes a run interrupted by a reset, as found by TimerCheckpoint::begin().
+ */
+void StateController::restore(const TimerCheckpointData& checkpoint, InputController& input) {
+  currentState = (SystemState)checkpoint.state;
+  currentPosition = checkpoint.position;
+  input.setPosition(currentPosition);
+  initialTimer = checkpoint.initialTimer;
+  currentTimer = checkpoint.timer;
+
+  // A pulse keeps its phase through the periods missed while down
+  if (currentState == STATE_PULSE_RUN && currentTimer < 0 && initialTimer > 0) {
+    currentTimer %= initialTimer;
+    if (currentTimer < 0) currentTimer += initialTimer;
+  }
+
+  countdownTimer = millis();
+  timeNow = millis();
+  sessionStart = checkpoint.sessionStart;
+  sessionStartMillis = millis();
+  lapTimer = 0;
+  lapCount = 0;
+  firstTime = false;
+
+  Serial.print("Resumed run in state ");
+  Serial.println(currentState);
+}
+
+void StateController::enterDeepSleep(DisplayController& display, LedRingController& ledRing, Settings& settings, SessionLog& sessions) {
     Serial.println("Saving state and entering deep sleep...");
+    settings.flush();
+    sessions.flush();
 
     Serial.end();
     display.sleepScreen();
@@ -652,16 +900,16 @@ void StateController::enterDeepSleep(DisplayController& display, LedRingControll
     esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_ALL);
 
     // Determine the current state of encoder pins
-    int encoder1State = digitalRead(ENCODER_PIN1);
-    int encoder2State = digitalRead(ENCODER_PIN2);
+    int encoder1State = digitalRead(Board::encoderPin1);
+    int encoder2State = digitalRead(Board::encoderPin2);
 
     // Add button wake-up condition
     #ifdef DEVICE_VARIANT_H2
-      esp_sleep_enable_ext1_wakeup(1 << SWITCH_PIN, ESP_EXT1_WAKEUP_ANY_LOW);
+      esp_sleep_enable_ext1_wakeup(1 << Board::switchPin, ESP_EXT1_WAKEUP_ANY_LOW);
     #endif
 
     #ifdef DEVICE_VARIANT_C3
-      esp_deep_sleep_enable_gpio_wakeup(1 << SWITCH_PIN, ESP_GPIO_WAKEUP_GPIO_LOW);
+      esp_deep_sleep_enable_gpio_wakeup(1 << Board::switchPin, ESP_GPIO_WAKEUP_GPIO_LOW);
     #endif
 
     // Go to sleep
@@ -671,22 +919,90 @@ void StateController::enterDeepSleep(DisplayController& display, LedRingControll
 
 void StateController::buttonFeedback(PiezoController& piezo) {
   Serial.println("Button pressed");
-  if (piezo.sound_level > 1) {
-      piezo.beep(NOTE_A6, 50);
-  }
+  piezo.beep(NOTE_A6, 50);
   lastInteractionTimer = millis();
 }
 
 void StateController::rotaryFeedback(PiezoController& piezo) {
   Serial.print("Rotary encoder moved to position: ");
   Serial.println(currentPosition);
-  if (piezo.sound_level > 1) {
-      piezo.beep(NOTE_A6, 50);
-  }
+  piezo.beep(NOTE_A6, 50);
   lastInteractionTimer = millis();
 }
 
-void StateController::checkDeepSleep(DisplayController& display, LedRingController& ledRing, SystemState state) {
+/**
+ * Mutes the piezo, or restores the sound level it had before being muted.
+ */
+void StateController::toggleMute(PiezoController& piezo, Settings& settings) {
+  if (settings.get().soundLevel > 0) {
+    unmutedSoundLevel = settings.get().soundLevel;
+    settings.set(SETTING_SOUND_LEVEL, 0);
+  } else {
+    settings.set(SETTING_SOUND_LEVEL, unmutedSoundLevel);
+  }
+  Serial.print("Sound level: ");
+  Serial.println(piezo.sound_level);
+  buttonFeedback(piezo);
+}
+
+/**
+ * Notes when a timer, pulse or stopwatch run starts.
+ */
+void StateController::startSession() {
+  sessionStart = time(nullptr);
+  sessionStartMillis = millis();
+}
+
+/**
+ * Hands a finished run to the session log. Only queues it in RAM, so it is safe
+ * on the timer path.
+ *
+ * @param activeMs The time counted, without pauses.
+ * @param completed true if the run reached its end rather than being cancelled.
+ */
+void StateController::endSession(SessionLog& sessions, SessionMode mode, unsigned long int activeMs, bool completed) {
+  sessions.append(mode, sessionStart, time(nullptr), activeMs, completed);
+}
+
+/**
+ * Sets up the input gestures for the state the next pass starts in. Only states
+ * with a multi-click binding wait for further clicks, so everywhere else a
+ * short press is reported as soon as the button is released.
+ */
+void StateController::configureInput(InputController& input) {
+  // Only the duration entry screens accelerate; menus and settings keep one
+  // step per detent
+  input.accelerate = currentState == STATE_TIMER_SELECT || currentState == STATE_PULSE_SELECT;
+
+  switch (currentState) {
+  case STATE_MODE_SELECT:
+    input.maxClicks = 3; // mute toggle
+    input.chords = false;
+    break;
+
+  case STATE_TIMER_RUN:
+    input.maxClicks = 3; // +1 minute, mute toggle
+    input.chords = true; // +-1 minute per detent
+    break;
+
+  case STATE_TIMER_PAUSED:
+    input.maxClicks = 1;
+    input.chords = true;
+    break;
+
+  case STATE_STOPWATCH_RUN:
+    input.maxClicks = 2; // lap
+    input.chords = false;
+    break;
+
+  default:
+    input.maxClicks = 1;
+    input.chords = false;
+    break;
+  }
+}
+
+void StateController::checkDeepSleep(DisplayController& display, LedRingController& ledRing, Settings& settings, SessionLog& sessions, SystemState state) {
 
   const SystemState deepSleepStates[] = {
     STATE_MODE_SELECT,
@@ -696,7 +1012,8 @@ void StateController::checkDeepSleep(DisplayController& display, LedRingControll
     STATE_WIFI_SELECT,
     STATE_STOPWATCH_START,
     STATE_SETTINGS,
-    STATE_INFO
+    STATE_INFO,
+    STATE_STATS
   };
 
   if (millis() - lastInteractionTimer > SLEEP_TIMEOUT) {
@@ -704,7 +1021,7 @@ void StateController::checkDeepSleep(DisplayController& display, LedRingControll
     for (SystemState deepSleepState : deepSleepStates) {
       if (state == deepSleepState) {
         Serial.println("Entering deep sleep due to inactivity");
-        enterDeepSleep(display, ledRing);
+        enterDeepSleep(display, ledRing, settings, sessions);
       }
     }
   }
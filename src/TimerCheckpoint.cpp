@@ -0,0 +1,290 @@
+#include <Arduino.h>
+#include <esp_attr.h>
+#include <esp_rom_crc.h>
+#include <esp_system.h>
+#include <sys/time.h>
+#include "TimerCheckpoint.h"
+
+#define CHECKPOINT_SCAN_SLOTS 16 // slots read from flash at once while scanning
+
+// Left alone by the reset, so it still holds the last checkpoint after a crash
+static RTC_NOINIT_ATTR TimerCheckpointData rtcCopy;
+
+TimerCheckpoint::TimerCheckpoint()
+    : rtcWrites(0),
+      flashWrites(0),
+      restoredFromFlash(false),
+      partition(nullptr),
+      activeSector(0),
+      nextSlot(slotsPerSector),
+      spareErased(false),
+      sequence(0),
+      current{},
+      flashDirty(false),
+      lastChange(0),
+      lastFlashWrite(0) {
+    current.state = CHECKPOINT_NO_RUN;
+}
+
+/**
+ * Finds the run to resume, according to why the chip reset.
+ *
+ * @param restored Set to the run to resume, with its timer brought up to now.
+ * @return true if a run should be resumed.
+ */
+bool TimerCheckpoint::begin(TimerCheckpointData &restored) {
+    TimerCheckpointData flashCopy;
+    bool flashValid = loadFlash(flashCopy) && isRun(flashCopy.state);
+    int64_t now = nowMicros();
+    bool found = false;
+    bool fromFlash = false;
+
+    switch (esp_reset_reason()) {
+    case ESP_RST_DEEPSLEEP:
+        // Runs never sleep, nothing was interrupted
+        break;
+
+    case ESP_RST_POWERON:
+    case ESP_RST_EXT:
+    case ESP_RST_UNKNOWN:
+        fromFlash = true;
+        break;
+
+    default:
+        // Panic, watchdog, brownout or software reset: RTC memory and the clock kept
+        // going. A valid copy is newer than the flash one, also when nothing ran.
+        if (rtcCopy.check != checkOf(rtcCopy) || now < rtcCopy.taken) {
+            fromFlash = true;
+        } else if (isRun(rtcCopy.state)) {
+            restored = rtcCopy;
+            restored.timer += direction(restored.state) * (int32_t)((now - restored.taken) / 1000);
+            found = true;
+        }
+        break;
+    }
+
+    if (fromFlash && flashValid) {
+        // How long the power was off is unknown, so the run waits for the user
+        restored = flashCopy;
+        if (restored.state == STATE_TIMER_RUN)
+            restored.state = STATE_TIMER_PAUSED;
+        else if (restored.state == STATE_STOPWATCH_RUN)
+            restored.state = STATE_STOPWATCH_PAUSED;
+        restoredFromFlash = true;
+        found = true;
+    }
+
+    if (found && restored.restores >= CHECKPOINT_MAX_RESTORES) {
+        Serial.println("Checkpoint: run keeps resetting, dropped");
+        found = false;
+    }
+
+    if (found) {
+        restored.taken = now;
+        restored.restores++;
+        current = restored;
+    } else {
+        current = {};
+        current.state = CHECKPOINT_NO_RUN;
+        restoredFromFlash = false;
+    }
+    rtcCopy = current;
+    rtcCopy.check = checkOf(rtcCopy);
+
+    // A run in flash that isn't resumed must not come back after the next power loss
+    flashDirty = flashValid && !found;
+    return found;
+}
+
+/**
+ * Takes a checkpoint if the timing state changed since the last one. Called on
+ * every pass, only compares when nothing changed.
+ *
+ * @param state The state of the state machine.
+ * @param position The encoder position the duration was set with.
+ * @param initialTimer The duration of the run in ms.
+ * @param timer The time left, or elapsed for the stopwatch, in ms.
+ * @param sessionStart time() when the run started.
+ * @param idle true if a flash stall would go unnoticed now.
+ */
+void TimerCheckpoint::update(SystemState state, long position, long initialTimer, long timer, uint32_t sessionStart, bool idle) {
+    uint8_t recorded = isRun(state) ? state : CHECKPOINT_NO_RUN;
+    int dir = direction(recorded);
+    int64_t now = dir != 0 ? nowMicros() : 0;
+
+    bool changed;
+    if (recorded != current.state) {
+        changed = true;
+    } else if (recorded == CHECKPOINT_NO_RUN) {
+        changed = false;
+    } else if (position != current.position || initialTimer != current.initialTimer) {
+        changed = true;
+    } else if (dir == 0) {
+        changed = timer != current.timer;
+    } else {
+        long expected = current.timer + dir * (long)((now - current.taken) / 1000);
+        changed = abs(expected - timer) > CHECKPOINT_DRIFT_MS;
+    }
+
+    unsigned long ms = millis();
+    if (changed) {
+        bool sameRun = recorded == current.state && initialTimer == current.initialTimer;
+        current = {now, 0, (int32_t)position, (int32_t)initialTimer, (int32_t)timer, sessionStart,
+                   recorded, (uint8_t)(sameRun ? current.restores : 0), 0};
+        rtcCopy = current;
+        rtcCopy.check = checkOf(rtcCopy);
+        rtcWrites++;
+        flashDirty = true;
+        lastChange = ms;
+    }
+
+    // The flash copy of a running timer goes stale on its own, so it is refreshed
+    bool due = idle ? flashDirty && ms - lastChange >= CHECKPOINT_QUIET_MS
+                    : (flashDirty || dir != 0) && ms - lastFlashWrite >= CHECKPOINT_FLASH_PERIOD_MS;
+    if (due) {
+        if (dir != 0) {
+            current.taken = now;
+            current.timer = timer;
+        }
+        if (writeFlash(idle)) {
+            flashDirty = false;
+            lastFlashWrite = ms;
+        }
+    }
+
+    if (idle && partition != nullptr && !spareErased && nextSlot >= slotsPerSector * 3 / 4)
+        spareErased = eraseSector((activeSector + 1) % (partition->size / CHECKPOINT_SECTOR_SIZE));
+}
+
+/**
+ * Finds the newest valid checkpoint in flash and where the next one goes.
+ *
+ * @return false if there is none.
+ */
+bool TimerCheckpoint::loadFlash(TimerCheckpointData &latest) {
+    partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, CHECKPOINT_PARTITION_LABEL);
+    if (partition == nullptr) {
+        Serial.println("Checkpoint partition not found");
+        return false;
+    }
+    uint16_t sectorCount = partition->size / CHECKPOINT_SECTOR_SIZE;
+
+    bool found = false;
+    activeSector = sectorCount - 1;
+    nextSlot = slotsPerSector; // empty: the first write starts sector 0
+
+    for (uint16_t sector = 0; sector < sectorCount; sector++) {
+        TimerCheckpointData slots[CHECKPOINT_SCAN_SLOTS];
+        uint16_t used = 0;
+        bool newest = false;
+
+        for (uint16_t first = 0; first < slotsPerSector; first += CHECKPOINT_SCAN_SLOTS) {
+            if (esp_partition_read(partition, slotAddress(sector, first), slots, sizeof(slots)) != ESP_OK)
+                return found;
+
+            for (uint16_t i = 0; i < CHECKPOINT_SCAN_SLOTS; i++) {
+                const uint8_t *bytes = (const uint8_t *)&slots[i];
+                bool erased = true;
+                for (size_t b = 0; b < sizeof(TimerCheckpointData) && erased; b++)
+                    erased = bytes[b] == 0xFF;
+                if (erased) continue;
+
+                // A slot that failed its check was still written and can't be reused
+                used = first + i + 1;
+                if (slots[i].check == checkOf(slots[i]) && (!found || slots[i].sequence > sequence)) {
+                    latest = slots[i];
+                    sequence = slots[i].sequence;
+                    found = true;
+                    newest = true;
+                }
+            }
+        }
+        if (newest) {
+            activeSector = sector;
+            nextSlot = used;
+        }
+    }
+    return found;
+}
+
+/**
+ * Appends the current checkpoint to flash. Moving on to the other sector needs
+ * it erased, which only happens while idle.
+ *
+ * @return false if nothing was written.
+ */
+bool TimerCheckpoint::writeFlash(bool idle) {
+    if (partition == nullptr) return false;
+
+    if (nextSlot >= slotsPerSector) {
+        uint16_t spare = (activeSector + 1) % (partition->size / CHECKPOINT_SECTOR_SIZE);
+        if (!spareErased && !(idle && eraseSector(spare)))
+            return false;
+        activeSector = spare;
+        nextSlot = 0;
+        spareErased = false;
+    }
+
+    TimerCheckpointData record = current;
+    record.sequence = ++sequence;
+    record.check = checkOf(record);
+    if (esp_partition_write(partition, slotAddress(activeSector, nextSlot++), &record, sizeof(record)) != ESP_OK)
+        return false;
+
+    flashWrites++;
+    return true;
+}
+
+bool TimerCheckpoint::eraseSector(uint16_t sector) {
+    return esp_partition_erase_range(partition, slotAddress(sector, 0), CHECKPOINT_SECTOR_SIZE) == ESP_OK;
+}
+
+uint32_t TimerCheckpoint::slotAddress(uint16_t sector, uint16_t slot) const {
+    return sector * CHECKPOINT_SECTOR_SIZE + slot * sizeof(TimerCheckpointData);
+}
+
+/**
+ * Tells whether a state is part of a run worth resuming.
+ */
+bool TimerCheckpoint::isRun(uint8_t state) {
+    switch (state) {
+    case STATE_TIMER_RUN:
+    case STATE_TIMER_PAUSED:
+    case STATE_PULSE_RUN:
+    case STATE_STOPWATCH_RUN:
+    case STATE_STOPWATCH_PAUSED:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/**
+ * How the timer of a state moves with time: -1 counting down, 1 counting up,
+ * 0 frozen.
+ */
+int TimerCheckpoint::direction(uint8_t state) {
+    switch (state) {
+    case STATE_TIMER_RUN:
+    case STATE_PULSE_RUN:
+        return -1;
+    case STATE_STOPWATCH_RUN:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+/**
+ * The system clock, which unlike millis() keeps counting through a reset that
+ * isn't a power loss.
+ */
+int64_t TimerCheckpoint::nowMicros() {
+    struct timeval now;
+    gettimeofday(&now, nullptr);
+    return (int64_t)now.tv_sec * 1000000 + now.tv_usec;
+}
+
+uint16_t TimerCheckpoint::checkOf(const TimerCheckpointData &data) {
+    return esp_rom_crc16_le(0, (const uint8_t *)&data, offsetof(TimerCheckpointData, check));
+}
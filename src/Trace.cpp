@@ -0,0 +1,106 @@
+#include "Trace.h"
+
+#ifdef SPAN_TRACE
+
+static_assert((TRACE_BUFFER_EVENTS & (TRACE_BUFFER_EVENTS - 1)) == 0, "the ring size must be a power of two");
+
+static TraceEvent events[TRACE_BUFFER_EVENTS];
+static std::atomic<uint32_t> head(0); // events ever recorded
+static volatile bool paused = false;
+
+#define TRACE_MAX_TASKS 8 // named tasks in a dump
+
+/**
+ * Stores one event, overwriting the oldest once the ring is full. Safe from
+ * any task or ISR.
+ *
+ * @param name The event name, a string literal.
+ * @param start When it started, from Trace::now().
+ * @param duration How long it took, or TRACE_INSTANT_EVENT.
+ * @param arg A value shown with the event.
+ */
+void IRAM_ATTR Trace::record(const char *name, uint32_t start, uint32_t duration, int32_t arg) {
+    if (paused) return;
+
+    uint32_t slot = head.fetch_add(1, std::memory_order_relaxed);
+    TraceEvent &event = events[slot & (TRACE_BUFFER_EVENTS - 1)];
+    event.start = start;
+    event.duration = duration;
+    event.name = name;
+    event.task = xPortInIsrContext() ? 0 : (uintptr_t)xTaskGetCurrentTaskHandle();
+    event.arg = arg;
+}
+
+void Trace::clear() {
+    head.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * Prints the ring as Chrome trace JSON, oldest event first, between two
+ * marker lines. Times are relative to the earliest start in the ring, so the
+ * 32-bit clock wrapping doesn't matter.
+ *
+ * The chips are single core and every recorder either runs above the loop or
+ * is an ISR, so once paused no slot is left half written while the loop reads.
+ */
+void Trace::dump(Print &out) {
+    paused = true;
+
+    uint32_t end = head.load(std::memory_order_relaxed);
+    uint32_t first = end > TRACE_BUFFER_EVENTS ? end - TRACE_BUFFER_EVENTS : 0;
+    // Spans are recorded when they end, so an outer span comes after the ones
+    // nested in it but starts before them. The origin is the earliest start,
+    // compared as signed differences so the clock wrapping doesn't matter.
+    uint32_t origin = end > first ? events[first & (TRACE_BUFFER_EVENTS - 1)].start : 0;
+    for (uint32_t i = first; i < end; i++) {
+        uint32_t start = events[i & (TRACE_BUFFER_EVENTS - 1)].start;
+        if ((int32_t)(start - origin) < 0)
+            origin = start;
+    }
+    uintptr_t tasks[TRACE_MAX_TASKS];
+    int taskCount = 0;
+
+    out.println("trace: begin");
+    out.print("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    for (uint32_t i = first; i < end; i++) {
+        const TraceEvent &event = events[i & (TRACE_BUFFER_EVENTS - 1)];
+
+        bool known = false;
+        for (int t = 0; t < taskCount; t++)
+            known |= tasks[t] == event.task;
+        if (!known && taskCount < TRACE_MAX_TASKS)
+            tasks[taskCount++] = event.task;
+
+        out.print(i == first ? "\n" : ",\n");
+        out.print("{\"name\":\"");
+        out.print(event.name);
+        out.print("\",\"pid\":1,\"tid\":");
+        out.print((unsigned long)event.task);
+        out.print(",\"ts\":");
+        out.print((unsigned long)(event.start - origin));
+        if (event.duration == TRACE_INSTANT_EVENT) {
+            out.print(",\"ph\":\"i\",\"s\":\"t\"");
+        } else {
+            out.print(",\"ph\":\"X\",\"dur\":");
+            out.print((unsigned long)event.duration);
+        }
+        out.print(",\"args\":{\"arg\":");
+        out.print((long)event.arg);
+        out.print("}}");
+    }
+
+    // Lane names
+    for (int t = 0; t < taskCount; t++) {
+        out.print(",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":");
+        out.print((unsigned long)tasks[t]);
+        out.print(",\"args\":{\"name\":\"");
+        out.print(tasks[t] == 0 ? "ISR" : pcTaskGetName((TaskHandle_t)tasks[t]));
+        out.print("\"}}");
+    }
+    out.println("\n]}");
+    out.println("trace: end");
+
+    paused = false;
+}
+
+#endif
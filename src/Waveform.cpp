@@ -0,0 +1,99 @@
+#include "Waveform.h"
+
+// Tables are generated offline:
+//   sine:    (sin(2 * pi * i / 256) + 1) / 2 * 255
+//   ease:    smoothstep, x * x * (3 - 2 * x) with x = i / 255
+//   breathe: (exp(sin(2 * pi * i / 256 - pi / 2)) - 1 / e) / (e - 1 / e) * 255
+
+static const uint8_t sineTable[256] PROGMEM = {
+    128, 131, 134, 137, 140, 143, 146, 149, 152, 155, 158, 162, 165, 167, 170, 173,
+    176, 179, 182, 185, 188, 190, 193, 196, 198, 201, 203, 206, 208, 211, 213, 215,
+    218, 220, 222, 224, 226, 228, 230, 232, 234, 235, 237, 238, 240, 241, 243, 244,
+    245, 246, 248, 249, 250, 250, 251, 252, 253, 253, 254, 254, 254, 255, 255, 255,
+    255, 255, 255, 255, 254, 254, 254, 253, 253, 252, 251, 250, 250, 249, 248, 246,
+    245, 244, 243, 241, 240, 238, 237, 235, 234, 232, 230, 228, 226, 224, 222, 220,
+    218, 215, 213, 211, 208, 206, 203, 201, 198, 196, 193, 190, 188, 185, 182, 179,
+    176, 173, 170, 167, 165, 162, 158, 155, 152, 149, 146, 143, 140, 137, 134, 131,
+    128, 124, 121, 118, 115, 112, 109, 106, 103, 100,  97,  93,  90,  88,  85,  82,
+     79,  76,  73,  70,  67,  65,  62,  59,  57,  54,  52,  49,  47,  44,  42,  40,
+     37,  35,  33,  31,  29,  27,  25,  23,  21,  20,  18,  17,  15,  14,  12,  11,
+     10,   9,   7,   6,   5,   5,   4,   3,   2,   2,   1,   1,   1,   0,   0,   0,
+      0,   0,   0,   0,   1,   1,   1,   2,   2,   3,   4,   5,   5,   6,   7,   9,
+     10,  11,  12,  14,  15,  17,  18,  20,  21,  23,  25,  27,  29,  31,  33,  35,
+     37,  40,  42,  44,  47,  49,  52,  54,  57,  59,  62,  65,  67,  70,  73,  76,
+     79,  82,  85,  88,  90,  93,  97, 100, 103, 106, 109, 112, 115, 118, 121, 124,
+};
+
+static const uint8_t easeInOutTable[256] PROGMEM = {
+      0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   2,   2,   2,   3,
+      3,   3,   4,   4,   4,   5,   5,   6,   6,   7,   7,   8,   9,   9,  10,  10,
+     11,  12,  12,  13,  14,  15,  15,  16,  17,  18,  18,  19,  20,  21,  22,  23,
+     24,  25,  26,  27,  27,  28,  29,  30,  31,  33,  34,  35,  36,  37,  38,  39,
+     40,  41,  42,  44,  45,  46,  47,  48,  50,  51,  52,  53,  54,  56,  57,  58,
+     60,  61,  62,  63,  65,  66,  67,  69,  70,  72,  73,  74,  76,  77,  78,  80,
+     81,  83,  84,  85,  87,  88,  90,  91,  93,  94,  96,  97,  98, 100, 101, 103,
+    104, 106, 107, 109, 110, 112, 113, 115, 116, 118, 119, 121, 122, 124, 125, 127,
+    128, 130, 131, 133, 134, 136, 137, 139, 140, 142, 143, 145, 146, 148, 149, 151,
+    152, 154, 155, 157, 158, 159, 161, 162, 164, 165, 167, 168, 170, 171, 172, 174,
+    175, 177, 178, 179, 181, 182, 183, 185, 186, 188, 189, 190, 192, 193, 194, 195,
+    197, 198, 199, 201, 202, 203, 204, 205, 207, 208, 209, 210, 211, 213, 214, 215,
+    216, 217, 218, 219, 220, 221, 222, 224, 225, 226, 227, 228, 228, 229, 230, 231,
+    232, 233, 234, 235, 236, 237, 237, 238, 239, 240, 240, 241, 242, 243, 243, 244,
+    245, 245, 246, 246, 247, 248, 248, 249, 249, 250, 250, 251, 251, 251, 252, 252,
+    252, 253, 253, 253, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255,
+};
+
+static const uint8_t breatheTable[256] PROGMEM = {
+      0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   2,   2,   2,   3,
+      3,   4,   4,   4,   5,   6,   6,   7,   7,   8,   9,   9,  10,  11,  12,  13,
+     14,  15,  16,  17,  18,  19,  20,  21,  22,  24,  25,  26,  28,  29,  31,  32,
+     34,  36,  38,  39,  41,  43,  45,  47,  49,  52,  54,  56,  58,  61,  63,  66,
+     69,  71,  74,  77,  80,  83,  86,  89,  92,  95,  98, 102, 105, 109, 112, 116,
+    119, 123, 126, 130, 134, 138, 142, 145, 149, 153, 157, 161, 165, 169, 172, 176,
+    180, 184, 188, 191, 195, 199, 202, 206, 209, 213, 216, 219, 222, 225, 228, 231,
+    233, 236, 238, 240, 243, 245, 246, 248, 249, 251, 252, 253, 254, 254, 255, 255,
+    255, 255, 255, 254, 254, 253, 252, 251, 249, 248, 246, 245, 243, 240, 238, 236,
+    233, 231, 228, 225, 222, 219, 216, 213, 209, 206, 202, 199, 195, 191, 188, 184,
+    180, 176, 172, 169, 165, 161, 157, 153, 149, 145, 142, 138, 134, 130, 126, 123,
+    119, 116, 112, 109, 105, 102,  98,  95,  92,  89,  86,  83,  80,  77,  74,  71,
+     69,  66,  63,  61,  58,  56,  54,  52,  49,  47,  45,  43,  41,  39,  38,  36,
+     34,  32,  31,  29,  28,  26,  25,  24,  22,  21,  20,  19,  18,  17,  16,  15,
+     14,  13,  12,  11,  10,   9,   9,   8,   7,   7,   6,   6,   5,   4,   4,   4,
+      3,   3,   2,   2,   2,   1,   1,   1,   1,   1,   0,   0,   0,   0,   0,   0,
+};
+
+/**
+ * Samples a waveform at the given phase.
+ *
+ * @param shape The waveform to sample.
+ * @param phase The 16-bit phase, where 65536 is a full period.
+ * @return The value of the waveform, 0-255.
+ */
+uint8_t Waveform::sample(WaveShape shape, uint16_t phase) {
+    uint8_t index = phase >> 8;
+
+    switch (shape)
+    {
+    case WAVE_SINE:
+        return sineTable[index];
+
+    case WAVE_TRIANGLE:
+        return index < 128 ? index * 2 : 255 - (index - 128) * 2;
+
+    case WAVE_BREATHE:
+        return breatheTable[index];
+
+    default:
+        return index;
+    }
+}
+
+/**
+ * Applies the ease-in/out curve to a linear progress value.
+ *
+ * @param progress The linear progress, 0-255.
+ * @return The eased progress, 0-255.
+ */
+uint8_t Waveform::easeInOut(uint8_t progress) {
+    return easeInOutTable[progress];
+}
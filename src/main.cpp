@@ -4,17 +4,27 @@
 #include "LedRingController.h"
 #include "PiezoController.h"
 #include "InputController.h"
+#include "Settings.h"
+#include "SessionLog.h"
+#include "AssetPack.h"
+#include "TimerCheckpoint.h"
+#include "Profiler.h"
+#include "Trace.h"
 #include HW_CONFIG
 #include "utils.h"
 #include "pitches.h"
 #include <EEPROM.h>
 
 SystemState currentState = STATE_TIMER_SELECT;
-DisplayController displayController(SDA_PIN, SCL_PIN);
+Settings settings;
+SessionLog sessionLog;
+AssetPack assetPack;
+TimerCheckpoint timerCheckpoint;
+DisplayController displayController(Board::sdaPin, Board::sclPin);
 StateController stateController;
-LedRingController ledRingController(NUM_LEDS, LED_PIN);
-PiezoController piezoController(BUZZER_PIN);
-InputController inputController(ENCODER_PIN1, ENCODER_PIN2, SWITCH_PIN);
+LedRingController ledRingController;
+PiezoController piezoController(Board::buzzerPin);
+InputController inputController(Board::encoderPin1, Board::encoderPin2, Board::switchPin);
 
 unsigned long tMemoryInfo = 0;
 unsigned long tReportBatteryLevel = 0;
@@ -25,6 +35,57 @@ unsigned long tReportBatteryLevel = 0;
 SystemState previousState = STATE_TIMER_SELECT;
 long int previousPosition = 0;
 
+/**
+ * Runs the commands typed on the serial console, one per line:
+ *   prof dump   prints the loop timing histograms
+ *   prof reset  clears them
+ *   trace dump  prints the span trace as Chrome trace JSON
+ *   trace clear empties it
+ *   mem         prints the heap and stack usage
+ *   led         prints the LED output metrics
+ *   piezo       prints the sound timing metrics
+ *   settings    prints the settings commit and journal wear metrics
+ */
+void pollSerialCommands() {
+  static char line[32];
+  static uint8_t length = 0;
+
+  while (Serial.available() > 0) {
+    char c = Serial.read();
+    if (c == '\r') continue;
+    if (c != '\n') {
+      if (length < sizeof(line) - 1) line[length++] = c;
+      continue;
+    }
+    line[length] = '\0';
+    length = 0;
+
+    if (strcmp(line, "prof dump") == 0) {
+      Profiler::dump(Serial);
+    } else if (strcmp(line, "prof reset") == 0) {
+      Profiler::reset();
+      Serial.println("prof: reset");
+    } else if (strcmp(line, "trace dump") == 0) {
+      Trace::dump(Serial);
+    } else if (strcmp(line, "trace clear") == 0) {
+      Trace::clear();
+      Serial.println("trace: cleared");
+    } else if (strcmp(line, "mem") == 0) {
+      printHeapInfo();
+      printTaskStackInfo();
+    } else if (strcmp(line, "led") == 0) {
+      ledRingController.printMetrics(Serial);
+    } else if (strcmp(line, "piezo") == 0) {
+      piezoController.printMetrics(Serial);
+    } else if (strcmp(line, "settings") == 0) {
+      settings.printMetrics(Serial);
+    } else if (line[0] != '\0') {
+      Serial.print("Unknown command: ");
+      Serial.println(line);
+    }
+  }
+}
+
 void setup(void) {
 
     // Initialize EEPROM
@@ -43,59 +104,85 @@ void setup(void) {
         currentState = STATE_TIMER_SELECT;
     }
 
-  if (EEPROM.readInt(EEPROM_LEDRING_BRIGHTNESS_ADDR) > 100) {
-    EEPROM.writeInt(EEPROM_LEDRING_BRIGHTNESS_ADDR, 100);
-    EEPROM.commit();
-  }
+  settings.begin();
+  sessionLog.begin();
+  const SettingsData &stored = settings.get();
 
-  if (EEPROM.readInt(EEPROM_SCREEN_BRIGHTNESS_ADDR) > 100) {
-    EEPROM.writeInt(EEPROM_SCREEN_BRIGHTNESS_ADDR, 100);
-    EEPROM.commit();
-  }
+  assetPack.begin();
+  displayController.animation.setAssets(&assetPack);
+  displayController.begin(stored.screenBrightness);
+  ledRingController.begin(stored.ledRingBrightness);
+  piezoController.begin(stored.soundLevel);
+  inputController.begin(stored.encoderAcceleration);
+
+  settings.addListener(DisplayController::onSettingChanged, &displayController);
+  settings.addListener(LedRingController::onSettingChanged, &ledRingController);
+  settings.addListener(PiezoController::onSettingChanged, &piezoController);
+  settings.addListener(InputController::onSettingChanged, &inputController);
 
-  if (EEPROM.readInt(EEPROM_DELTAT_CCW_ADDR) > 60000) {
-    EEPROM.writeInt(EEPROM_DELTAT_CCW_ADDR, 60000);
-    EEPROM.commit();
+  TimerCheckpointData interrupted;
+  if (timerCheckpoint.begin(interrupted))
+    stateController.restore(interrupted, inputController);
+
+}
+
+void loop(void) {
+  PROFILE_SCOPE(PROBE_LOOP);
+  Profiler::setState(stateController.getState());
+
+  pollSerialCommands();
+
+  {
+    PROFILE_SCOPE(PROBE_INPUT);
+    inputController.update();
   }
 
-  if (EEPROM.readInt(EEPROM_DELTAT_CW_ADDR) > 10000) {
-    EEPROM.writeInt(EEPROM_DELTAT_CW_ADDR, 10000);
-    EEPROM.commit();
+  {
+    PROFILE_SCOPE(PROBE_STATE);
+    stateController.update(
+      displayController,
+      ledRingController,
+      piezoController,
+      inputController,
+      settings,
+      sessionLog
+      );
   }
 
-  displayController.begin(EEPROM.readInt(EEPROM_SCREEN_BRIGHTNESS_ADDR));
-  ledRingController.begin(EEPROM.readInt(EEPROM_LEDRING_BRIGHTNESS_ADDR));
-  piezoController.begin(EEPROM.readUChar(EEPROM_PIEZO_MUTE_ADDR));
-  inputController.begin();
+  {
+    PROFILE_SCOPE(PROBE_LEDRING);
+    ledRingController.update(
+      currentState = stateController.getState(),
+      stateController.getPosition(),
+      stateController.getTimer(),
+      stateController.getInitialTimer()
+      );
+  }
 
-}
+  {
+    PROFILE_SCOPE(PROBE_DISPLAY);
+    displayController.update(
+      currentState = stateController.getState(),
+      stateController.getTimer(),
+      stateController.getPosition()
+      );
+  }
 
-void loop(void) {
+  {
+    PROFILE_SCOPE(PROBE_STORAGE);
+    timerCheckpoint.update(
+      stateController.getState(),
+      stateController.getPosition(),
+      stateController.getInitialTimer(),
+      stateController.getTimer(),
+      stateController.getSessionStart(),
+      stateController.isIdle()
+      );
+
+    settings.update(stateController.isIdle());
+    sessionLog.update(stateController.isIdle());
+  }
 
-  inputController.update();
-
-  stateController.update(
-    displayController,
-    ledRingController,
-    piezoController,
-    inputController
-    );
-
-  ledRingController.update(
-    currentState = stateController.getState(),
-    stateController.getPosition(),
-    stateController.getTimer(),
-    stateController.getInitialTimer()
-    );
-  
-  displayController.update(
-    currentState = stateController.getState(),
-    stateController.getTimer(),
-    stateController.getPosition()
-    );
-
-  piezoController.update(stateController.getState());
-  
   // if (millis() - tMemoryInfo > 5000) {
   //   tMemoryInfo = millis();
   //   printHeapInfo();
@@ -105,6 +192,6 @@ void loop(void) {
   // if (millis() - tReportBatteryLevel > 2000) {
   //   tReportBatteryLevel = millis();
   //   Serial.print("Battery level: ");
-  //   Serial.println(analogRead(BATTERY_PIN));
+  //   Serial.println(analogRead(Board::batteryPin));
   // }
 }
\ No newline at end of file
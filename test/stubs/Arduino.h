@@ -0,0 +1,84 @@
+#ifndef NATIVE_ARDUINO_H
+#define NATIVE_ARDUINO_H
+
+// The parts of the Arduino core the hardware-independent modules use, so they
+// build on the host for the native test environment.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+#include <stdio.h>
+#include <algorithm>
+#include "fake_clock.h"
+
+using std::max;
+using std::min;
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define PROGMEM
+#define IRAM_ATTR
+
+// FreeRTOS tasks: a handle points to a FakeTask, and the test sets which one
+// is running or that an ISR is
+typedef void *TaskHandle_t;
+
+struct FakeTask {
+    const char *name;
+};
+
+namespace FakeTasks {
+inline FakeTask loop = {"loopTask"};
+inline TaskHandle_t current = &loop;
+inline bool inIsr = false;
+}
+
+inline TaskHandle_t xTaskGetCurrentTaskHandle() {
+    return FakeTasks::current;
+}
+
+inline int xPortInIsrContext() {
+    return FakeTasks::inIsr;
+}
+
+inline const char *pcTaskGetName(TaskHandle_t task) {
+    return ((FakeTask *)task)->name;
+}
+
+inline unsigned long millis() {
+    return FakeClock::uptimeUs / 1000;
+}
+
+inline unsigned long micros() {
+    return FakeClock::uptimeUs;
+}
+
+inline uint32_t getCpuFrequencyMhz() {
+    return 160;
+}
+
+// Everything goes through write(), which a test overrides to capture the text
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(const char *text, size_t length) { return fwrite(text, 1, length, stdout); }
+
+    size_t print(const char *text) { return write(text, strlen(text)); }
+    size_t print(char c) { return write(&c, 1); }
+    size_t print(long value) { return format("%ld", value); }
+    size_t print(unsigned long value) { return format("%lu", value); }
+    size_t println(const char *text = "") { return print(text) + print('\n'); }
+    size_t println(unsigned long value) { return print(value) + print('\n'); }
+
+private:
+    template <typename T>
+    size_t format(const char *pattern, T value) {
+        char text[24];
+        return write(text, snprintf(text, sizeof(text), pattern, value));
+    }
+};
+
+inline Print Serial;
+
+#endif
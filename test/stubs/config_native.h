@@ -0,0 +1,9 @@
+#ifndef CONFIG_NATIVE_H
+#define CONFIG_NATIVE_H
+
+// HW_CONFIG of the native environment, only what the modules built on the host
+// read from the board configs.
+
+#define LOOP_PROFILER 1
+
+#endif
@@ -0,0 +1,8 @@
+#ifndef NATIVE_I2S_PDM_H
+#define NATIVE_I2S_PDM_H
+
+// Only the handle type SamplePlayer.h declares, so clips.h builds on the host
+
+typedef struct i2s_channel_obj_t *i2s_chan_handle_t;
+
+#endif
@@ -0,0 +1,10 @@
+#ifndef NATIVE_ESP_ATTR_H
+#define NATIVE_ESP_ATTR_H
+
+// Placement attributes of ESP-IDF. On the host RTC memory is ordinary memory,
+// which keeps its contents across a simulated reset like the real one.
+
+#define RTC_DATA_ATTR
+#define RTC_NOINIT_ATTR
+
+#endif
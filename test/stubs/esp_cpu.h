@@ -0,0 +1,16 @@
+#ifndef NATIVE_ESP_CPU_H
+#define NATIVE_ESP_CPU_H
+
+// The cycle counter of the CPU, moved by the tests.
+
+#include <stdint.h>
+
+namespace FakeCpu {
+inline uint32_t cycles = 0;
+}
+
+inline uint32_t esp_cpu_get_cycle_count() {
+    return FakeCpu::cycles;
+}
+
+#endif
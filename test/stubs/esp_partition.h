@@ -0,0 +1,144 @@
+#ifndef NATIVE_ESP_PARTITION_H
+#define NATIVE_ESP_PARTITION_H
+
+// The partition API of ESP-IDF over fake NOR flash in host memory: writes can
+// only clear bits and an erase sets whole sectors back to 0xFF. A test adds the
+// partitions the module under test looks up by label.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "esp_err.h"
+
+typedef enum {
+    ESP_PARTITION_TYPE_APP = 0,
+    ESP_PARTITION_TYPE_DATA = 1
+} esp_partition_type_t;
+
+typedef enum {
+    ESP_PARTITION_SUBTYPE_ANY = 0xFF
+} esp_partition_subtype_t;
+
+typedef struct {
+    esp_partition_type_t type;
+    esp_partition_subtype_t subtype;
+    uint32_t address;
+    uint32_t size;
+    uint32_t erase_size;
+    char label[17];
+} esp_partition_t;
+
+typedef enum {
+    ESP_PARTITION_MMAP_DATA,
+    ESP_PARTITION_MMAP_INST
+} esp_partition_mmap_memory_t;
+
+typedef uint32_t esp_partition_mmap_handle_t;
+
+#define FAKE_FLASH_MAX_PARTITIONS 4
+
+namespace FakeFlash {
+
+struct Partition {
+    esp_partition_t info;
+    uint8_t *data;
+    uint32_t *erases; // per sector, or nullptr
+};
+
+inline Partition partitions[FAKE_FLASH_MAX_PARTITIONS];
+inline int partitionCount = 0;
+
+// Bytes left to program before the power fails, tearing the write in progress.
+// Every further write and erase fails until the test sets it back to -1.
+inline long writeBudget = -1;
+
+inline int mappings = 0; // open esp_partition_mmap() mappings
+
+/**
+ * Removes every partition and restores the power.
+ */
+inline void reset() {
+    partitionCount = 0;
+    writeBudget = -1;
+    mappings = 0;
+}
+
+/**
+ * Adds a partition backed by the test's own buffer, left as it is.
+ *
+ * @param erases Counts the erases of every sector when not nullptr.
+ */
+inline const esp_partition_t *add(const char *label, uint8_t *data, uint32_t size, uint32_t eraseSize,
+                                  uint32_t *erases = nullptr) {
+    if (partitionCount >= FAKE_FLASH_MAX_PARTITIONS) return nullptr;
+
+    Partition &partition = partitions[partitionCount++];
+    partition.info = {ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, 0, size, eraseSize, {}};
+    strncpy(partition.info.label, label, sizeof(partition.info.label) - 1);
+    partition.data = data;
+    partition.erases = erases;
+    return &partition.info;
+}
+
+inline Partition *find(const esp_partition_t *info) {
+    for (int i = 0; i < partitionCount; i++)
+        if (&partitions[i].info == info) return &partitions[i];
+    return nullptr;
+}
+
+}
+
+inline const esp_partition_t *esp_partition_find_first(esp_partition_type_t, esp_partition_subtype_t,
+                                                       const char *label) {
+    for (int i = 0; i < FakeFlash::partitionCount; i++)
+        if (strcmp(FakeFlash::partitions[i].info.label, label) == 0) return &FakeFlash::partitions[i].info;
+    return nullptr;
+}
+
+inline esp_err_t esp_partition_read(const esp_partition_t *info, size_t offset, void *dst, size_t size) {
+    FakeFlash::Partition *partition = FakeFlash::find(info);
+    if (partition == nullptr || offset + size > info->size) return ESP_FAIL;
+    memcpy(dst, partition->data + offset, size);
+    return ESP_OK;
+}
+
+inline esp_err_t esp_partition_write(const esp_partition_t *info, size_t offset, const void *src, size_t size) {
+    FakeFlash::Partition *partition = FakeFlash::find(info);
+    if (partition == nullptr || offset + size > info->size) return ESP_FAIL;
+    for (size_t i = 0; i < size; i++) {
+        if (FakeFlash::writeBudget == 0) return ESP_FAIL;
+        if (FakeFlash::writeBudget > 0) FakeFlash::writeBudget--;
+        partition->data[offset + i] &= ((const uint8_t *)src)[i];
+    }
+    return ESP_OK;
+}
+
+inline esp_err_t esp_partition_erase_range(const esp_partition_t *info, size_t offset, size_t size) {
+    FakeFlash::Partition *partition = FakeFlash::find(info);
+    if (partition == nullptr || FakeFlash::writeBudget == 0 || offset % info->erase_size != 0 ||
+        size % info->erase_size != 0 || offset + size > info->size)
+        return ESP_FAIL;
+    memset(partition->data + offset, 0xFF, size);
+    if (partition->erases != nullptr) {
+        for (size_t sector = offset / info->erase_size; sector < (offset + size) / info->erase_size; sector++)
+            partition->erases[sector]++;
+    }
+    return ESP_OK;
+}
+
+// Maps the test's buffer itself, so a mapping sees later writes like the flash cache
+inline esp_err_t esp_partition_mmap(const esp_partition_t *info, size_t offset, size_t size,
+                                    esp_partition_mmap_memory_t, const void **out,
+                                    esp_partition_mmap_handle_t *handle) {
+    FakeFlash::Partition *partition = FakeFlash::find(info);
+    if (partition == nullptr || offset + size > info->size) return ESP_FAIL;
+    *out = partition->data + offset;
+    *handle = ++FakeFlash::mappings;
+    return ESP_OK;
+}
+
+inline void esp_partition_munmap(esp_partition_mmap_handle_t) {
+    FakeFlash::mappings--;
+}
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef NATIVE_ESP_SYSTEM_H
+#define NATIVE_ESP_SYSTEM_H
+
+// The reset reason of ESP-IDF, set by the test before it simulates a boot.
+
+typedef enum {
+    ESP_RST_UNKNOWN,
+    ESP_RST_POWERON,
+    ESP_RST_EXT,
+    ESP_RST_SW,
+    ESP_RST_PANIC,
+    ESP_RST_INT_WDT,
+    ESP_RST_TASK_WDT,
+    ESP_RST_WDT,
+    ESP_RST_DEEPSLEEP,
+    ESP_RST_BROWNOUT,
+    ESP_RST_SDIO
+} esp_reset_reason_t;
+
+namespace FakeSystem {
+inline esp_reset_reason_t resetReason = ESP_RST_POWERON;
+}
+
+inline esp_reset_reason_t esp_reset_reason() {
+    return FakeSystem::resetReason;
+}
+
+#endif
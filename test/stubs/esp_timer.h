@@ -0,0 +1,12 @@
+#ifndef NATIVE_ESP_TIMER_H
+#define NATIVE_ESP_TIMER_H
+
+// The microsecond clock of ESP-IDF, the time since boot of the fake clock.
+
+#include "fake_clock.h"
+
+inline int64_t esp_timer_get_time() {
+    return FakeClock::uptimeUs;
+}
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef NATIVE_FAKE_CLOCK_H
+#define NATIVE_FAKE_CLOCK_H
+
+// The clocks of the device, moved by the tests: the time since boot behind
+// millis() and micros(), and the system clock behind time() and gettimeofday(),
+// which keeps counting through a reset but not through a power loss.
+
+#include <stdint.h>
+
+namespace FakeClock {
+
+inline int64_t uptimeUs = 0;
+inline int64_t systemUs = 0;
+
+inline void advance(int64_t us) {
+    uptimeUs += us;
+    systemUs += us;
+}
+
+// A reset or a wake-up from deep sleep
+inline void reboot() {
+    uptimeUs = 0;
+}
+
+inline void powerOn() {
+    uptimeUs = 0;
+    systemUs = 0;
+}
+
+}
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef NATIVE_SYS_TIME_H
+#define NATIVE_SYS_TIME_H
+
+// The system clock of the C library, redirected to the fake clock so a test
+// never reads or sets the clock of the host.
+
+#include_next <sys/time.h>
+#include <time.h>
+#include "../fake_clock.h"
+
+namespace FakeClock {
+
+inline time_t time(time_t *out) {
+    time_t now = systemUs / 1000000;
+    if (out != nullptr) *out = now;
+    return now;
+}
+
+inline int gettimeofday(struct timeval *now, void *) {
+    now->tv_sec = systemUs / 1000000;
+    now->tv_usec = systemUs % 1000000;
+    return 0;
+}
+
+inline int settimeofday(const struct timeval *now, const void *) {
+    systemUs = (int64_t)now->tv_sec * 1000000 + now->tv_usec;
+    return 0;
+}
+
+}
+
+#define time(out) FakeClock::time(out)
+#define gettimeofday(now, zone) FakeClock::gettimeofday(now, zone)
+#define settimeofday(now, zone) FakeClock::settimeofday(now, zone)
+
+#endif
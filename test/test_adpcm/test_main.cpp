@@ -0,0 +1,136 @@
+#include <unity.h>
+#include "Adpcm.h"
+#include "clips.h"
+
+void setUp() {}
+void tearDown() {}
+
+#define SINE_SAMPLES 1600
+
+static int16_t samples[8000];
+static int16_t reference[8000];
+
+/**
+ * Reference IMA ADPCM encoder, packing codes low nibble first like the clips.
+ */
+static void encode(const int16_t *input, uint32_t count, uint8_t *output) {
+    Adpcm::State state = {0, 0};
+    for (uint32_t i = 0; i < count; i++) {
+        int step = Adpcm::stepTable[state.index];
+        int diff = input[i] - state.predictor;
+        uint8_t code = 0;
+        if (diff < 0) {
+            code = 8;
+            diff = -diff;
+        }
+        if (diff >= step) { code |= 4; diff -= step; }
+        if (diff >= step >> 1) { code |= 2; diff -= step >> 1; }
+        if (diff >= step >> 2) code |= 1;
+
+        // Track the decoder so the next difference is taken from what it sees
+        Adpcm::decode(state, code);
+        if (i & 1)
+            output[i >> 1] |= code << 4;
+        else
+            output[i >> 1] = code;
+    }
+}
+
+static double rms(const int16_t *values, uint32_t count) {
+    double sum = 0;
+    for (uint32_t i = 0; i < count; i++)
+        sum += (double)values[i] * values[i];
+    return sqrt(sum / count);
+}
+
+static int zeroCrossings(const int16_t *values, uint32_t count) {
+    int crossings = 0;
+    for (uint32_t i = 1; i < count; i++)
+        crossings += (values[i - 1] < 0) != (values[i] < 0);
+    return crossings;
+}
+
+// A 1 kHz tone survives a round trip through the encoder and the decoder
+void test_round_trip_of_a_sine() {
+    uint8_t codes[SINE_SAMPLES / 2];
+    for (int i = 0; i < SINE_SAMPLES; i++)
+        reference[i] = (int16_t)(8000 * sin(2 * M_PI * 1000 * i / SAMPLE_RATE_HZ));
+    encode(reference, SINE_SAMPLES, codes);
+
+    Adpcm::State state = {0, 0};
+    double error = 0;
+    for (int i = 0; i < SINE_SAMPLES; i++) {
+        uint8_t code = codes[i >> 1];
+        if (i & 1) code >>= 4;
+        samples[i] = Adpcm::decode(state, code & 0x0F);
+        // The step size needs a few samples to adapt
+        if (i >= 32)
+            error += (double)(samples[i] - reference[i]) * (samples[i] - reference[i]);
+    }
+
+    double errorRms = sqrt(error / (SINE_SAMPLES - 32));
+    TEST_ASSERT_TRUE(errorRms < 0.05 * rms(reference + 32, SINE_SAMPLES - 32));
+}
+
+// The chime is a 400 ms decaying bell on E6 (1319 Hz) that never clips
+void test_chime_decodes_to_a_decaying_tone() {
+    const uint32_t count = chimeClip.sampleCount;
+    TEST_ASSERT_EQUAL(6400, count);
+    TEST_ASSERT_EQUAL(count / 2, sizeof(chimeData));
+
+    Adpcm::State state = {0, 0};
+    Adpcm::decodeScaled(state, chimeClip.data, 0, count, 255, samples);
+
+    int peak = 0;
+    for (uint32_t i = 0; i < count; i++)
+        peak = max(peak, abs((int)samples[i]));
+    TEST_ASSERT_GREATER_THAN(4000, peak);
+    TEST_ASSERT_LESS_THAN(32000, peak);
+
+    // Two crossings per period over the first 100 ms
+    const uint32_t window = SAMPLE_RATE_HZ / 10;
+    int frequency = zeroCrossings(samples, window) * 10 / 2;
+    TEST_ASSERT_INT_WITHIN(130, 1319, frequency);
+
+    TEST_ASSERT_TRUE(rms(samples + count - window, window) < 0.5 * rms(samples, window));
+}
+
+// The volume scales the sample stream, which sets the PDM duty
+void test_volume_scales_the_duty_stream() {
+    const uint32_t count = chimeClip.sampleCount;
+    Adpcm::State state = {0, 0};
+    Adpcm::decodeScaled(state, chimeClip.data, 0, count, 255, reference);
+
+    state = {0, 0};
+    Adpcm::decodeScaled(state, chimeClip.data, 0, count, 0, samples);
+    for (uint32_t i = 0; i < count; i++)
+        TEST_ASSERT_EQUAL_INT16(0, samples[i]);
+
+    state = {0, 0};
+    Adpcm::decodeScaled(state, chimeClip.data, 0, count, 128, samples);
+    for (uint32_t i = 0; i < count; i++)
+        TEST_ASSERT_INT_WITHIN(1, reference[i] * 128 / 255, samples[i]);
+}
+
+// Decoding in DMA-sized chunks, as the player does, gives the same stream
+void test_chunked_decode_matches_whole_clip() {
+    const uint32_t count = chimeClip.sampleCount;
+    Adpcm::State state = {0, 0};
+    Adpcm::decodeScaled(state, chimeClip.data, 0, count, 200, reference);
+
+    state = {0, 0};
+    for (uint32_t position = 0; position < count; position += SAMPLE_CHUNK) {
+        uint32_t chunk = min((uint32_t)SAMPLE_CHUNK, count - position);
+        Adpcm::decodeScaled(state, chimeClip.data, position, chunk, 200, samples + position);
+    }
+    TEST_ASSERT_EQUAL_MEMORY(reference, samples, count * sizeof(int16_t));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_round_trip_of_a_sine);
+    RUN_TEST(test_chime_decodes_to_a_decaying_tone);
+    RUN_TEST(test_volume_scales_the_duty_stream);
+    RUN_TEST(test_chunked_decode_matches_whole_clip);
+    return UNITY_END();
+}
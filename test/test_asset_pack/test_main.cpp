@@ -0,0 +1,171 @@
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <esp_rom_crc.h>
+#include "AssetPack.h"
+
+// Built from assets/ by tools/native_assets.py
+#ifndef ASSET_PACK_PATH
+#error "ASSET_PACK_PATH is set by tools/native_assets.py"
+#endif
+
+#define PARTITION_SIZE 0xAE000 // as in partitions.csv
+
+// The asset partition on the fake flash of the esp_partition.h stub
+static uint8_t flash[PARTITION_SIZE];
+
+static AssetPack pack;
+
+static AssetPackHeader header() {
+    AssetPackHeader header;
+    memcpy(&header, flash, sizeof(header));
+    return header;
+}
+
+static void setHeader(const AssetPackHeader &header) {
+    memcpy(flash, &header, sizeof(header));
+}
+
+/**
+ * Loads the pack pack_assets.py built into the partition.
+ *
+ * @return Its size.
+ */
+static size_t loadPackFile() {
+    FILE *file = fopen(ASSET_PACK_PATH, "rb");
+    TEST_ASSERT_NOT_NULL(file);
+    size_t size = fread(flash, 1, sizeof(flash), file);
+    fclose(file);
+    return size;
+}
+
+/**
+ * Writes a pack of hand-made entries, each with 8x8 frames of 8 bytes, and
+ * seals it with the right CRC.
+ */
+static void writePack(const AssetEntry *entries, uint16_t count, uint32_t dataSize) {
+    uint32_t size = sizeof(AssetPackHeader) + count * sizeof(AssetEntry) + dataSize;
+    memcpy(flash + sizeof(AssetPackHeader), entries, count * sizeof(AssetEntry));
+    for (uint32_t i = 0; i < dataSize; i++)
+        flash[sizeof(AssetPackHeader) + count * sizeof(AssetEntry) + i] = i;
+
+    uint32_t crc = esp_rom_crc32_le(0, flash + sizeof(AssetPackHeader), size - sizeof(AssetPackHeader));
+    setHeader({ASSET_PACK_MAGIC, ASSET_PACK_VERSION, count, size, crc});
+}
+
+void setUp() {
+    memset(flash, 0xFF, sizeof(flash));
+    FakeFlash::reset();
+    FakeFlash::add(ASSET_PARTITION_LABEL, flash, sizeof(flash), 4096);
+    pack = AssetPack();
+}
+
+void tearDown() {}
+
+// The CRC pack_assets.py computes is the one the ROM routine checks, and the
+// pack holds every asset the firmware knows
+void test_packed_assets_load() {
+    size_t size = loadPackFile();
+    AssetPackHeader packed = header();
+    TEST_ASSERT_EQUAL_HEX32(ASSET_PACK_MAGIC, packed.magic);
+    TEST_ASSERT_EQUAL(ASSET_PACK_VERSION, packed.version);
+    TEST_ASSERT_EQUAL(ASSET_COUNT, packed.count);
+    TEST_ASSERT_EQUAL(size, packed.size);
+    TEST_ASSERT_EQUAL_HEX32(esp_rom_crc32_le(0, flash + sizeof(packed), size - sizeof(packed)), packed.crc);
+
+    TEST_ASSERT_TRUE(pack.begin());
+    TEST_ASSERT_EQUAL(1, FakeFlash::mappings);
+    for (int id = 0; id < ASSET_COUNT; id++) {
+        const Asset *asset = pack.get((AssetId)id);
+        TEST_ASSERT_NOT_NULL(asset);
+        TEST_ASSERT_GREATER_THAN(0, asset->frameCount);
+        TEST_ASSERT_EQUAL(asset->width, asset->height);
+
+        const uint8_t *end = asset->frame(asset->frameCount);
+        TEST_ASSERT_TRUE(asset->data >= flash && end <= flash + size);
+    }
+}
+
+// A pack whose contents don't match the CRC is unmapped and holds nothing
+void test_corrupted_pack_is_rejected() {
+    size_t size = loadPackFile();
+    flash[size - 1] ^= 0x01;
+
+    TEST_ASSERT_FALSE(pack.begin());
+    TEST_ASSERT_FALSE(pack.isLoaded());
+    TEST_ASSERT_EQUAL(0, FakeFlash::mappings);
+    TEST_ASSERT_NULL(pack.get(ASSET_PLAY_PAUSE));
+}
+
+// Entries of a newer firmware, or that point past the pack or don't hold
+// their frames, are skipped and the others still load
+void test_invalid_entries_are_skipped() {
+    const uint32_t data = sizeof(AssetPackHeader) + 5 * sizeof(AssetEntry);
+    const AssetEntry entries[] = {
+        {ASSET_HOURGLASS, 2, 8, 8, data, 16},
+        {ASSET_COUNT, 1, 8, 8, data, 8},
+        {ASSET_WATCH, 1, 8, 8, data + 16, 0xFFFFFFF0},
+        {ASSET_GEARS, 1, 8, 8, 0xFFFFFFF0, 8},
+        {ASSET_EYE, 3, 8, 8, data, 16},
+    };
+    writePack(entries, 5, 16);
+
+    TEST_ASSERT_TRUE(pack.begin());
+    const Asset *hourglass = pack.get(ASSET_HOURGLASS);
+    TEST_ASSERT_NOT_NULL(hourglass);
+    TEST_ASSERT_EQUAL(2, hourglass->frameCount);
+    TEST_ASSERT_EQUAL(8, hourglass->frame(1)[0]);
+
+    TEST_ASSERT_NULL(pack.get(ASSET_WATCH));
+    TEST_ASSERT_NULL(pack.get(ASSET_GEARS));
+    TEST_ASSERT_NULL(pack.get(ASSET_EYE));
+    TEST_ASSERT_NULL(pack.get(ASSET_COUNT));
+}
+
+// A header that is not of this version, or sizes the pack wrong, is turned down
+// before anything is mapped
+void test_bad_headers_are_rejected() {
+    const AssetEntry entry = {ASSET_INFO, 1, 8, 8, sizeof(AssetPackHeader) + sizeof(AssetEntry), 8};
+    writePack(&entry, 1, 8);
+    const AssetPackHeader good = header();
+
+    AssetPackHeader bad = good;
+    bad.version++;
+    setHeader(bad);
+    TEST_ASSERT_FALSE(pack.begin());
+
+    bad = good;
+    bad.size = PARTITION_SIZE + 1;
+    setHeader(bad);
+    TEST_ASSERT_FALSE(pack.begin());
+
+    bad = good;
+    bad.count = 2;
+    bad.size = sizeof(AssetPackHeader) + sizeof(AssetEntry);
+    setHeader(bad);
+    TEST_ASSERT_FALSE(pack.begin());
+    TEST_ASSERT_EQUAL(0, FakeFlash::mappings);
+
+    setHeader(good);
+    TEST_ASSERT_TRUE(pack.begin());
+    TEST_ASSERT_NOT_NULL(pack.get(ASSET_INFO));
+}
+
+// An erased partition, as after a firmware-only flash, leaves every asset missing
+void test_erased_partition_has_no_assets() {
+    TEST_ASSERT_FALSE(pack.begin());
+    TEST_ASSERT_NULL(pack.get(ASSET_WIFI));
+
+    FakeFlash::reset();
+    TEST_ASSERT_FALSE(pack.begin());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_packed_assets_load);
+    RUN_TEST(test_corrupted_pack_is_rejected);
+    RUN_TEST(test_invalid_entries_are_skipped);
+    RUN_TEST(test_bad_headers_are_rejected);
+    RUN_TEST(test_erased_partition_has_no_assets);
+    return UNITY_END();
+}
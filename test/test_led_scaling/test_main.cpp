@@ -0,0 +1,100 @@
+#include <unity.h>
+#include <chrono>
+#include "PixelKernels.h"
+
+using namespace PixelKernels;
+
+void setUp() {}
+void tearDown() {}
+
+#define MAX_PIXELS 256
+#define CANARY 0xA5A5A5A5u
+
+static const int sizes[] = {16, 64, 256};
+
+// One slot past the frame is filled with a canary that no kernel may touch
+static uint32_t from[MAX_PIXELS + 1];
+static uint32_t to[MAX_PIXELS + 1];
+static uint32_t composed[MAX_PIXELS + 1];
+static uint8_t grb[MAX_PIXELS * 3 + 4];
+static uint8_t residual[MAX_PIXELS * 3 + 4];
+static uint16_t lut[256];
+
+static void fill(int count) {
+    for (int i = 0; i < count; i++) {
+        from[i] = rgb(i * 10, 255 - i, i * 3);
+        to[i] = rgb(i * 7, i * 2, 255 - i * 5);
+    }
+    from[count] = to[count] = composed[count] = CANARY;
+    memset(grb + count * 3, 0xA5, 4);
+    memset(residual, 0, count * 3);
+    memset(residual + count * 3, 0xA5, 4);
+}
+
+static void checkCanaries(int count) {
+    const uint8_t canary[4] = {0xA5, 0xA5, 0xA5, 0xA5};
+    TEST_ASSERT_EQUAL_HEX32(CANARY, from[count]);
+    TEST_ASSERT_EQUAL_HEX32(CANARY, to[count]);
+    TEST_ASSERT_EQUAL_HEX32(CANARY, composed[count]);
+    TEST_ASSERT_EQUAL_MEMORY(canary, grb + count * 3, 4);
+    TEST_ASSERT_EQUAL_MEMORY(canary, residual + count * 3, 4);
+}
+
+/**
+ * One frame of the LED path: a transition blend, a saturating flash layer and
+ * the dithered conversion to the GRB stream.
+ */
+static void frame(int count, uint8_t t) {
+    blendRing(from, to, composed, count, t);
+    for (int i = 0; i < count; i++)
+        composed[i] = addSaturate(composed[i], blend(0, rgb(255, 255, 255), t / 4));
+    applyLutDithered(composed, grb, count, lut, residual);
+}
+
+void test_kernels_stay_in_bounds() {
+    buildLut(lut, 30, 1.0f);
+    for (int count : sizes) {
+        fill(count);
+        for (int t = 0; t < 256; t += 15)
+            frame(count, t);
+        applyLut(composed, grb, count, lut);
+        checkCanaries(count);
+    }
+}
+
+// Prints the frame cost at each size and checks that it grows linearly: the
+// cost per pixel at 256 pixels must not exceed twice that at 16.
+void test_frame_cost_scales_linearly() {
+    buildLut(lut, 30, 1.0f);
+    double perPixel[3];
+
+    for (int s = 0; s < 3; s++) {
+        int count = sizes[s];
+        int rounds = 400000 / count;
+        fill(count);
+
+        // Best of several runs, so a preempted run doesn't count
+        double best = 1e30;
+        for (int run = 0; run < 5; run++) {
+            auto start = std::chrono::steady_clock::now();
+            for (int r = 0; r < rounds; r++)
+                frame(count, r & 0xFF);
+            auto end = std::chrono::steady_clock::now();
+            best = min(best, std::chrono::duration<double, std::nano>(end - start).count() / rounds);
+        }
+        perPixel[s] = best / count;
+
+        char message[96];
+        snprintf(message, sizeof(message), "%3d pixels: %8.0f ns/frame, %5.2f ns/pixel", count, best, perPixel[s]);
+        TEST_MESSAGE(message);
+    }
+
+    TEST_ASSERT_TRUE(perPixel[2] <= 2 * perPixel[0]);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_kernels_stay_in_bounds);
+    RUN_TEST(test_frame_cost_scales_linearly);
+    return UNITY_END();
+}
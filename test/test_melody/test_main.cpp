@@ -0,0 +1,128 @@
+#include <unity.h>
+#include <new>
+#include <stdlib.h>
+#include <type_traits>
+#include "melodies.h"
+
+// Counts every allocation made through operator new, which is where the old
+// std::vector based melodies allocated.
+static size_t allocations = 0;
+
+void *operator new(size_t size) {
+    allocations++;
+    void *block = malloc(size);
+    if (block == nullptr) throw std::bad_alloc();
+    return block;
+}
+
+void operator delete(void *block) noexcept {
+    free(block);
+}
+
+void operator delete(void *block, size_t) noexcept {
+    free(block);
+}
+
+void setUp() {}
+void tearDown() {}
+
+// A melody is a view on a table placed at compile time
+static_assert(std::is_trivially_copyable<Melody>::value, "a melody is copied by value");
+static_assert(sizeof(Melody) <= 2 * sizeof(void *), "a melody is a pointer and a length");
+static_assert(finishMelody.length == 8 && finishMelody.notes[0].pitch == NOTE_C5, "melodies are constant");
+
+static void assertNotes(const Note *expected, uint8_t length, const Melody &melody) {
+    TEST_ASSERT_EQUAL(length, melody.length);
+    for (int i = 0; i < length; i++) {
+        TEST_ASSERT_EQUAL_UINT16(expected[i].pitch, melody.notes[i].pitch);
+        TEST_ASSERT_EQUAL_UINT16(expected[i].duration, melody.notes[i].duration);
+    }
+}
+
+// The RTTTL sources compile to the note tables they replaced
+void test_rtttl_matches_the_original_tables() {
+    const Note finish[] = {
+        {NOTE_C5, 200}, {NOTE_G4, 100}, {NOTE_G4, 100}, {NOTE_A4, 200},
+        {NOTE_G4, 200}, {0, 200}, {NOTE_B4, 200}, {NOTE_C5, 200}};
+    const Note rotaryUp[] = {{NOTE_A6, 50}};
+    const Note beep[] = {{NOTE_A6, 50}, {0, 200}, {NOTE_A6, 50}, {0, 800}, {0, 200}};
+
+    assertNotes(finish, 8, finishMelody);
+    assertNotes(rotaryUp, 1, rotaryUpMelody);
+    assertNotes(beep, 5, loopBeep);
+    TEST_ASSERT_FALSE(finishMelody.loop);
+    TEST_ASSERT_TRUE(loopBeep.loop);
+}
+
+RTTTL_MELODY(sample, "s:b=60,o=4,d=4:c,8d#5,2e.,f.6,p,16a#7", false);
+
+void test_rtttl_defaults_dots_and_sharps() {
+    const Note expected[] = {
+        {NOTE_C4, 1000}, {NOTE_DS5, 500}, {NOTE_E4, 3000},
+        {NOTE_F6, 1500}, {0, 1000}, {NOTE_AS7, 250}};
+    TEST_ASSERT_EQUAL(6, sample.length);
+    for (int i = 0; i < 6; i++) {
+        TEST_ASSERT_EQUAL_UINT16(expected[i].pitch, sample.notes[i].pitch);
+        TEST_ASSERT_EQUAL_UINT16(expected[i].duration, sample.notes[i].duration);
+    }
+}
+
+/**
+ * Plays a melody the way the sequencer does: a pointer to the melody, an index
+ * and the time the next note is due.
+ */
+static uint32_t play(const Melody &melody, uint32_t ticks) {
+    const Melody *current = &melody;
+    uint8_t note = 0;
+    uint32_t nextNoteTime = current->notes[0].duration;
+    uint32_t sounding = 0;
+
+    for (uint32_t now = 0; now < ticks && current != nullptr; now++) {
+        while (current != nullptr && now >= nextNoteTime) {
+            if (++note >= current->length) {
+                if (!current->loop) {
+                    current = nullptr;
+                    break;
+                }
+                note = 0;
+            }
+            nextNoteTime += current->notes[note].duration;
+        }
+        if (current != nullptr && current->notes[note].pitch != 0)
+            sounding++;
+    }
+    return sounding;
+}
+
+// Starting, copying and playing the feedback beeps never touches the heap
+void test_feedback_beeps_do_not_allocate() {
+    allocations = 0;
+    uint32_t sounding = 0;
+
+    for (int i = 0; i < 1000; i++) {
+        Melody beep = rotaryUpMelody;
+        sounding += play(beep, 100);
+        sounding += play(finishMelody, 2000);
+        sounding += play(loopBeep, 3000);
+    }
+
+    TEST_ASSERT_GREATER_THAN(0, sounding);
+    TEST_ASSERT_EQUAL(0, allocations);
+}
+
+// The counter does see allocations, so the zero above means something
+void test_allocation_counter_works() {
+    allocations = 0;
+    int *volatile value = new int(1); // volatile, so the pair is not optimized away
+    delete value;
+    TEST_ASSERT_EQUAL(1, allocations);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_rtttl_matches_the_original_tables);
+    RUN_TEST(test_rtttl_defaults_dots_and_sharps);
+    RUN_TEST(test_feedback_beeps_do_not_allocate);
+    RUN_TEST(test_allocation_counter_works);
+    return UNITY_END();
+}
@@ -0,0 +1,99 @@
+#include <unity.h>
+#include <string>
+#include "Profiler.h"
+
+#define CYCLES_PER_US 160 // getCpuFrequencyMhz() of the Arduino.h stub
+
+/**
+ * Keeps what is printed to it.
+ */
+class Capture : public Print {
+public:
+    std::string text;
+
+    size_t write(const char *data, size_t length) override {
+        text.append(data, length);
+        return length;
+    }
+};
+
+static const char *const heading = "prof: probe state count p50 p99 max (us)\n";
+
+static std::string dump() {
+    Capture out;
+    Profiler::dump(out);
+    return out.text;
+}
+
+void setUp() {
+    Profiler::reset();
+    Profiler::setState(STATE_TIMER_RUN);
+}
+
+void tearDown() {}
+
+// Only the histograms with counts are printed, with times in microseconds
+void test_dump_prints_recorded_histograms() {
+    TEST_ASSERT_EQUAL_STRING(heading, dump().c_str());
+
+    Profiler::record(PROBE_DISPLAY, 100 * CYCLES_PER_US);
+    TEST_ASSERT_EQUAL_STRING((std::string(heading) + "display TIMER_RUN 1 100 100 100\n").c_str(), dump().c_str());
+
+    Profiler::reset();
+    TEST_ASSERT_EQUAL_STRING(heading, dump().c_str());
+}
+
+// A percentile is the upper bound of its log2 bucket, and the maximum is exact
+void test_percentiles_come_from_the_buckets() {
+    for (int i = 0; i < 98; i++)
+        Profiler::record(PROBE_LOOP, 10 * CYCLES_PER_US);
+    Profiler::record(PROBE_LOOP, 900 * CYCLES_PER_US);
+    Profiler::record(PROBE_LOOP, 1000 * CYCLES_PER_US);
+
+    // 1600 cycles fall in the bucket up to 2048, 12.8 us
+    TEST_ASSERT_EQUAL_STRING((std::string(heading) + "loop TIMER_RUN 100 12 1000 1000\n").c_str(), dump().c_str());
+}
+
+// Every state has its own histogram, and a state out of range is ignored
+void test_states_are_counted_apart() {
+    Profiler::record(PROBE_INPUT, 10 * CYCLES_PER_US);
+    Profiler::setState(STATE_SETTINGS_VOLUME);
+    Profiler::record(PROBE_INPUT, 20 * CYCLES_PER_US);
+    Profiler::setState(STATE_COUNT);
+    Profiler::record(PROBE_INPUT, 20 * CYCLES_PER_US);
+
+    TEST_ASSERT_EQUAL_STRING((std::string(heading) + "input TIMER_RUN 1 10 10 10\n"
+                                                     "input SETTINGS_VOLUME 2 20 20 20\n").c_str(),
+                             dump().c_str());
+}
+
+// A full bucket halves them all, which keeps the percentiles while the count
+// stays exact
+void test_full_bucket_halves_the_histogram() {
+    for (uint32_t i = 0; i < UINT16_MAX; i++)
+        Profiler::record(PROBE_STATE, 10 * CYCLES_PER_US);
+    Profiler::record(PROBE_STATE, 10 * CYCLES_PER_US);
+    Profiler::record(PROBE_STATE, 1000 * CYCLES_PER_US);
+
+    TEST_ASSERT_EQUAL_STRING((std::string(heading) + "state TIMER_RUN 65537 12 12 1000\n").c_str(), dump().c_str());
+}
+
+// A scope is timed with the cycle counter from where it starts to its end
+void test_scope_times_the_rest_of_the_block() {
+    FakeCpu::cycles = UINT32_MAX - 100; // the counter wraps inside the scope
+    {
+        PROFILE_SCOPE(PROBE_I2C);
+        FakeCpu::cycles += 20 * CYCLES_PER_US;
+    }
+    TEST_ASSERT_EQUAL_STRING((std::string(heading) + "i2c TIMER_RUN 1 20 20 20\n").c_str(), dump().c_str());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_dump_prints_recorded_histograms);
+    RUN_TEST(test_percentiles_come_from_the_buckets);
+    RUN_TEST(test_states_are_counted_apart);
+    RUN_TEST(test_full_bucket_halves_the_histogram);
+    RUN_TEST(test_scope_times_the_rest_of_the_block);
+    return UNITY_END();
+}
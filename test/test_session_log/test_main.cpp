@@ -0,0 +1,195 @@
+#include <unity.h>
+#include <string.h>
+#include <sys/time.h>
+#include "SessionLog.h"
+
+#define FLASH_SECTORS 3
+#define DAY SESSION_SECONDS_PER_DAY
+#define FIRST_DAY 100
+#define RUN_MS 60000
+
+// Runs logged until a sector has to be compacted: each sector keeps the header
+// slot and the reserve for day records
+#define RUNS_PER_SECTOR (SESSION_SECTOR_SIZE / 16 - SESSION_COMPACT_RESERVE - 1)
+
+// The log partition on the fake flash of the esp_partition.h stub
+static uint8_t flash[FLASH_SECTORS * SESSION_SECTOR_SIZE];
+
+static SessionLog sessionLog;
+
+/**
+ * Restores the power and starts over from what is on the flash.
+ */
+static void reboot() {
+    FakeFlash::writeBudget = -1;
+    FakeClock::reboot();
+    sessionLog = SessionLog();
+    sessionLog.begin();
+}
+
+/**
+ * Logs runs of RUN_MS, one a minute, spread over the five days before today,
+ * and writes them in batches the way update() does.
+ */
+static void logRuns(int count) {
+    for (int i = 0; i < count; i++) {
+        uint32_t end = (FIRST_DAY + i % 5) * DAY + 60 * (i / 5 % 1000);
+        sessionLog.append(SESSION_TIMER, end - RUN_MS / 1000, end, RUN_MS, i % 2 == 0);
+        sessionLog.update(true);
+    }
+    sessionLog.flush();
+}
+
+static uint32_t sectorMagic(int sector) {
+    uint32_t magic;
+    memcpy(&magic, flash + sector * SESSION_SECTOR_SIZE, sizeof(magic));
+    return magic;
+}
+
+void setUp() {
+    memset(flash, 0xFF, sizeof(flash));
+    FakeFlash::reset();
+    FakeFlash::add(SESSION_PARTITION_LABEL, flash, sizeof(flash), SESSION_SECTOR_SIZE);
+    FakeClock::powerOn();
+    FakeClock::advance((int64_t)(FIRST_DAY + 4) * DAY * 1000000 + 43200LL * 1000000);
+}
+
+void tearDown() {}
+
+// Runs wait in RAM until a batch has gathered, or the first has waited too long
+void test_appends_are_written_in_batches() {
+    reboot();
+    for (int i = 0; i < SESSION_BATCH_SIZE - 1; i++) {
+        sessionLog.append(SESSION_PULSE, 0, FIRST_DAY * DAY, RUN_MS, true);
+        sessionLog.update(true);
+    }
+    TEST_ASSERT_EQUAL(0, sessionLog.recordsWritten);
+
+    sessionLog.append(SESSION_PULSE, 0, FIRST_DAY * DAY, RUN_MS, true);
+    sessionLog.update(false);
+    TEST_ASSERT_EQUAL(0, sessionLog.recordsWritten);
+    sessionLog.update(true);
+    TEST_ASSERT_EQUAL(SESSION_BATCH_SIZE, sessionLog.recordsWritten);
+
+    sessionLog.append(SESSION_PULSE, 0, FIRST_DAY * DAY, RUN_MS, true);
+    sessionLog.update(true);
+    TEST_ASSERT_EQUAL(SESSION_BATCH_SIZE, sessionLog.recordsWritten);
+    FakeClock::advance((int64_t)SESSION_MAX_DEFER_MS * 1000);
+    sessionLog.update(true);
+    TEST_ASSERT_EQUAL(SESSION_BATCH_SIZE + 1, sessionLog.recordsWritten);
+}
+
+// The totals count a run when it is appended, and are rebuilt from the flash
+void test_totals_survive_a_reboot() {
+    reboot();
+    logRuns(10);
+
+    SessionStats stats = sessionLog.stats();
+    TEST_ASSERT_EQUAL(10, stats.totalSessions);
+    TEST_ASSERT_EQUAL(10, stats.weekSessions);
+    TEST_ASSERT_EQUAL(10 * RUN_MS / 1000, stats.weekSeconds);
+    TEST_ASSERT_EQUAL(2, stats.today.sessions);
+    TEST_ASSERT_EQUAL(1, stats.today.completedSessions);
+
+    reboot();
+    SessionStats restored = sessionLog.stats();
+    TEST_ASSERT_EQUAL(10, restored.totalSessions);
+    TEST_ASSERT_EQUAL(10, restored.weekSessions);
+    TEST_ASSERT_EQUAL(stats.weekSeconds, restored.weekSeconds);
+    TEST_ASSERT_EQUAL(2, restored.today.sessions);
+}
+
+// An empty log compacts its way to the sector after the head it starts with
+void test_first_write_starts_sector_1() {
+    reboot();
+    logRuns(1);
+    TEST_ASSERT_EQUAL(0xFFFFFFFF, sectorMagic(0));
+    TEST_ASSERT_EQUAL(SESSION_MAGIC, sectorMagic(1));
+    TEST_ASSERT_EQUAL(0, sessionLog.compactions);
+}
+
+// Appends after a reboot go after the last written slot, also when the power
+// failed before the type byte of that slot was written
+void test_begin_finds_the_head_after_a_torn_write() {
+    reboot();
+    logRuns(3);
+
+    sessionLog.append(SESSION_STOPWATCH, 0, FIRST_DAY * DAY, RUN_MS, true);
+    FakeFlash::writeBudget = 8;
+    sessionLog.flush();
+    TEST_ASSERT_EQUAL(1, sessionLog.recordsDropped);
+
+    reboot();
+    TEST_ASSERT_EQUAL(3, sessionLog.stats().totalSessions);
+    logRuns(2);
+    reboot();
+    TEST_ASSERT_EQUAL(5, sessionLog.stats().totalSessions);
+}
+
+// Once the ring is full, the runs of the oldest sector become day records and
+// the totals stay the same
+void test_compaction_keeps_the_totals() {
+    reboot();
+    logRuns(FLASH_SECTORS * RUNS_PER_SECTOR);
+    TEST_ASSERT_EQUAL(0, sessionLog.compactions);
+
+    logRuns(1);
+    TEST_ASSERT_EQUAL(1, sessionLog.compactions);
+    TEST_ASSERT_EQUAL(0, sessionLog.recordsDropped);
+
+    reboot();
+    SessionStats stats = sessionLog.stats();
+    TEST_ASSERT_EQUAL(FLASH_SECTORS * RUNS_PER_SECTOR + 1, stats.totalSessions);
+    TEST_ASSERT_EQUAL(FLASH_SECTORS * RUNS_PER_SECTOR + 1, stats.weekSessions);
+    TEST_ASSERT_EQUAL((FLASH_SECTORS * RUNS_PER_SECTOR + 1) * (RUN_MS / 1000), stats.weekSeconds);
+}
+
+// Power fails after the day records are written but before the compacted
+// sector is erased: its runs are not counted again
+void test_compacted_sector_is_not_counted_twice() {
+    reboot();
+    logRuns(FLASH_SECTORS * RUNS_PER_SECTOR);
+
+    FakeFlash::writeBudget = 5 * sizeof(DayRecord); // one record for each of the five days
+    logRuns(1);
+    TEST_ASSERT_EQUAL(1, sessionLog.recordsDropped);
+
+    reboot();
+    TEST_ASSERT_EQUAL(FLASH_SECTORS * RUNS_PER_SECTOR, sessionLog.stats().totalSessions);
+    TEST_ASSERT_EQUAL(FLASH_SECTORS * RUNS_PER_SECTOR, sessionLog.stats().weekSessions);
+
+    // The next write finishes the erase without folding the sector again
+    logRuns(1);
+    TEST_ASSERT_EQUAL(0, sessionLog.compactions);
+    reboot();
+    TEST_ASSERT_EQUAL(FLASH_SECTORS * RUNS_PER_SECTOR + 1, sessionLog.stats().totalSessions);
+}
+
+// After a power loss the clock starts from zero and is moved to the newest run,
+// but a clock that is ahead is left alone
+void test_begin_moves_the_clock_forward() {
+    reboot();
+    logRuns(5);
+    uint32_t newest = (FIRST_DAY + 4) * DAY;
+
+    FakeClock::powerOn();
+    reboot();
+    TEST_ASSERT_EQUAL(newest, time(nullptr));
+    TEST_ASSERT_EQUAL(1, sessionLog.stats().today.sessions);
+
+    FakeClock::advance((int64_t)10 * DAY * 1000000);
+    reboot();
+    TEST_ASSERT_EQUAL(newest + 10 * DAY, time(nullptr));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_appends_are_written_in_batches);
+    RUN_TEST(test_totals_survive_a_reboot);
+    RUN_TEST(test_first_write_starts_sector_1);
+    RUN_TEST(test_begin_finds_the_head_after_a_torn_write);
+    RUN_TEST(test_compaction_keeps_the_totals);
+    RUN_TEST(test_compacted_sector_is_not_counted_twice);
+    RUN_TEST(test_begin_moves_the_clock_forward);
+    return UNITY_END();
+}
@@ -0,0 +1,244 @@
+#include <unity.h>
+#include <string.h>
+#include "SettingsJournal.h"
+
+#define FLASH_SECTORS 4
+
+// The journal partition on the fake flash of the esp_partition.h stub
+static uint8_t flash[FLASH_SECTORS * JOURNAL_SECTOR_SIZE];
+static uint32_t erases[FLASH_SECTORS];
+
+/**
+ * The values the journal replays, as the settings store would keep them.
+ */
+struct Replayed {
+    int32_t values[256];
+    bool seen[256];
+    int records;
+};
+
+static void onRecord(void *context, uint8_t id, const uint8_t *payload, uint8_t length) {
+    Replayed *replayed = (Replayed *)context;
+    TEST_ASSERT_EQUAL(sizeof(int32_t), length);
+    memcpy(&replayed->values[id], payload, sizeof(int32_t));
+    replayed->seen[id] = true;
+    replayed->records++;
+}
+
+static SettingsJournal journal;
+static Replayed replayed;
+
+/**
+ * Restores the power and starts over from what is on the flash.
+ *
+ * @return What SettingsJournal::begin() returned.
+ */
+static bool reboot() {
+    FakeFlash::writeBudget = -1;
+    journal = SettingsJournal();
+    memset(&replayed, 0, sizeof(replayed));
+    return journal.begin(onRecord, &replayed);
+}
+
+static bool append(uint8_t id, int32_t value) {
+    return journal.append(id, &value, sizeof(value));
+}
+
+static uint32_t sectorSequence(int sector) {
+    JournalSectorHeader header;
+    memcpy(&header, flash + sector * JOURNAL_SECTOR_SIZE, sizeof(header));
+    return header.sequence;
+}
+
+void setUp() {
+    memset(flash, 0xFF, sizeof(flash));
+    memset(erases, 0, sizeof(erases));
+    FakeFlash::reset();
+    FakeFlash::add(JOURNAL_PARTITION_LABEL, flash, sizeof(flash), JOURNAL_SECTOR_SIZE, erases);
+}
+
+void tearDown() {}
+
+void test_empty_partition_needs_a_sector() {
+    TEST_ASSERT_FALSE(reboot());
+    TEST_ASSERT_FALSE(append(1, 10));
+
+    TEST_ASSERT_TRUE(journal.startSector());
+    TEST_ASSERT_TRUE(append(1, 10));
+    TEST_ASSERT_TRUE(journal.sealSector());
+
+    TEST_ASSERT_TRUE(reboot());
+    TEST_ASSERT_EQUAL(10, replayed.values[1]);
+}
+
+// Later records override earlier ones, including those of the snapshot
+void test_records_replay_in_order() {
+    reboot();
+    journal.startSector();
+    append(1, 100);
+    append(2, 200);
+    journal.sealSector();
+    append(1, 101);
+    append(3, 300);
+    append(1, 102);
+
+    TEST_ASSERT_TRUE(reboot());
+    TEST_ASSERT_EQUAL(5, replayed.records);
+    TEST_ASSERT_EQUAL(102, replayed.values[1]);
+    TEST_ASSERT_EQUAL(200, replayed.values[2]);
+    TEST_ASSERT_EQUAL(300, replayed.values[3]);
+
+    // Appends continue after the last record
+    TEST_ASSERT_TRUE(append(2, 201));
+    TEST_ASSERT_TRUE(reboot());
+    TEST_ASSERT_EQUAL(6, replayed.records);
+    TEST_ASSERT_EQUAL(201, replayed.values[2]);
+}
+
+// Power fails halfway through a payload: the record fails its check
+void test_torn_record_is_skipped() {
+    reboot();
+    journal.startSector();
+    append(1, 100);
+    journal.sealSector();
+
+    FakeFlash::writeBudget = sizeof(JournalRecordHeader) + 2;
+    TEST_ASSERT_FALSE(append(1, 0x12345678));
+
+    TEST_ASSERT_TRUE(reboot());
+    TEST_ASSERT_EQUAL(1, journal.recordsSkipped);
+    TEST_ASSERT_EQUAL(100, replayed.values[1]);
+
+    // The torn record is stepped over, and records after it are read
+    TEST_ASSERT_TRUE(append(1, 103));
+    TEST_ASSERT_TRUE(reboot());
+    TEST_ASSERT_EQUAL(1, journal.recordsSkipped);
+    TEST_ASSERT_EQUAL(103, replayed.values[1]);
+}
+
+// Power fails inside a header: with no length to skip by, the sector is closed
+// and the next commit starts a new one
+void test_torn_header_closes_the_sector() {
+    reboot();
+    journal.startSector();
+    append(1, 100);
+    append(2, 200);
+    journal.sealSector();
+
+    FakeFlash::writeBudget = 1;
+    TEST_ASSERT_FALSE(append(1, 101));
+
+    TEST_ASSERT_TRUE(reboot());
+    TEST_ASSERT_EQUAL(100, replayed.values[1]);
+    TEST_ASSERT_EQUAL(200, replayed.values[2]);
+    TEST_ASSERT_FALSE(append(1, 101));
+
+    TEST_ASSERT_TRUE(journal.startSector());
+    append(1, 101);
+    append(2, 200);
+    journal.sealSector();
+    TEST_ASSERT_TRUE(reboot());
+    TEST_ASSERT_EQUAL(101, replayed.values[1]);
+}
+
+// Power fails while the snapshot goes into a new sector: recovery keeps using
+// the previous one, and the sequence of the unfinished sector is not reused
+void test_incomplete_sector_falls_back_to_the_previous() {
+    reboot();
+    journal.startSector();
+    append(1, 100);
+    journal.sealSector();
+    append(1, 200);
+
+    journal.startSector();
+    FakeFlash::writeBudget = sizeof(JournalRecordHeader) + sizeof(int32_t);
+    TEST_ASSERT_TRUE(append(1, 200));
+    TEST_ASSERT_FALSE(append(2, 300));
+    TEST_ASSERT_FALSE(journal.sealSector());
+
+    TEST_ASSERT_TRUE(reboot());
+    TEST_ASSERT_EQUAL(200, replayed.values[1]);
+    TEST_ASSERT_FALSE(replayed.seen[2]);
+    TEST_ASSERT_EQUAL(0, journal.recordsSkipped);
+
+    TEST_ASSERT_TRUE(journal.startSector());
+    TEST_ASSERT_EQUAL(3, sectorSequence(1));
+    append(1, 200);
+    append(2, 300);
+    journal.sealSector();
+    TEST_ASSERT_TRUE(reboot());
+    TEST_ASSERT_EQUAL(200, replayed.values[1]);
+    TEST_ASSERT_EQUAL(300, replayed.values[2]);
+}
+
+// Commits the way Settings::save() does: a new sector with a snapshot when the
+// active one is full
+static void commit(int32_t value) {
+    if (append(1, value)) return;
+    TEST_ASSERT_TRUE(journal.startSector());
+    TEST_ASSERT_TRUE(append(1, value));
+    TEST_ASSERT_TRUE(append(2, -value));
+    TEST_ASSERT_TRUE(journal.sealSector());
+}
+
+// Sectors are used in turn, so they wear evenly, and recovery finds the newest
+// after the journal has wrapped around the partition
+void test_sectors_wrap_and_wear_evenly() {
+    reboot();
+    journal.startSector();
+    append(2, 0);
+    journal.sealSector();
+
+    const uint32_t perSector = (JOURNAL_SECTOR_SIZE - sizeof(JournalSectorHeader)) / 8;
+    const int32_t commits = perSector * FLASH_SECTORS * 5 / 2;
+    for (int32_t value = 1; value <= commits; value++)
+        commit(value);
+
+    uint32_t fewest = erases[0], most = erases[0];
+    for (int s = 1; s < FLASH_SECTORS; s++) {
+        fewest = min(fewest, erases[s]);
+        most = max(most, erases[s]);
+    }
+    TEST_ASSERT_GREATER_OR_EQUAL(2, fewest);
+    TEST_ASSERT_LESS_OR_EQUAL(fewest + 1, most);
+    TEST_ASSERT_EQUAL(most, journal.estimatedCycles());
+
+    TEST_ASSERT_TRUE(reboot());
+    TEST_ASSERT_EQUAL(commits, replayed.values[1]);
+    TEST_ASSERT_TRUE(replayed.seen[2]); // from the snapshot of the newest sector
+}
+
+// Idle time erases the next sector once the active one is three quarters
+// full, so the commit that moves on does not erase
+void test_prepare_erases_ahead() {
+    reboot();
+    journal.startSector();
+    append(1, 0);
+    journal.sealSector();
+
+    journal.prepare();
+    TEST_ASSERT_EQUAL(1, journal.sectorErases);
+
+    int32_t value = 1;
+    while (journal.sectorErases == 1 && append(1, value++))
+        journal.prepare();
+    TEST_ASSERT_EQUAL(2, journal.sectorErases);
+    TEST_ASSERT_EQUAL(1, erases[1]);
+
+    while (append(1, value++)) {}
+    TEST_ASSERT_TRUE(journal.startSector());
+    TEST_ASSERT_EQUAL(2, journal.sectorErases);
+    TEST_ASSERT_EQUAL(1, erases[1]);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_empty_partition_needs_a_sector);
+    RUN_TEST(test_records_replay_in_order);
+    RUN_TEST(test_torn_record_is_skipped);
+    RUN_TEST(test_torn_header_closes_the_sector);
+    RUN_TEST(test_incomplete_sector_falls_back_to_the_previous);
+    RUN_TEST(test_sectors_wrap_and_wear_evenly);
+    RUN_TEST(test_prepare_erases_ahead);
+    return UNITY_END();
+}
@@ -0,0 +1,137 @@
+#include <unity.h>
+#include <string.h>
+#include <esp_system.h>
+#include "TimerCheckpoint.h"
+
+#define FLASH_SECTORS 2
+#define SECOND 1000000LL
+#define DURATION_MS 300000
+#define POSITION 5
+#define SESSION_START 1234
+
+// The checkpoint partition on the fake flash of the esp_partition.h stub
+static uint8_t flash[FLASH_SECTORS * CHECKPOINT_SECTOR_SIZE];
+
+static TimerCheckpoint checkpoint;
+static TimerCheckpointData restored;
+
+/**
+ * Starts the firmware over after a reset of the given kind. RTC memory keeps
+ * its contents, and a power-on also restarts the system clock.
+ *
+ * @return What TimerCheckpoint::begin() returned.
+ */
+static bool boot(esp_reset_reason_t reason) {
+    if (reason == ESP_RST_POWERON)
+        FakeClock::powerOn();
+    else
+        FakeClock::reboot();
+    FakeSystem::resetReason = reason;
+    checkpoint = TimerCheckpoint();
+    memset(&restored, 0, sizeof(restored));
+    return checkpoint.begin(restored);
+}
+
+// One pass of the loop while a countdown started at 0 runs
+static void runCountdown(int64_t elapsedUs, bool idle) {
+    checkpoint.update(STATE_TIMER_RUN, POSITION, DURATION_MS, DURATION_MS - elapsedUs / 1000, SESSION_START, idle);
+}
+
+void setUp() {
+    memset(flash, 0xFF, sizeof(flash));
+    FakeFlash::reset();
+    FakeFlash::add(CHECKPOINT_PARTITION_LABEL, flash, sizeof(flash), CHECKPOINT_SECTOR_SIZE);
+    TEST_ASSERT_FALSE(boot(ESP_RST_POWERON));
+
+    // The menus before a run are idle, which erases the first sector ahead
+    checkpoint.update(STATE_TIMER_SELECT, 0, 0, 0, 0, true);
+}
+
+void tearDown() {}
+
+// After a crash the RTC copy comes back running, with the time since it was
+// taken, the reboot included, applied to the timer
+void test_crash_restores_the_rtc_copy_with_elapsed_time() {
+    runCountdown(0, false);
+    TEST_ASSERT_EQUAL(1, checkpoint.rtcWrites);
+
+    // The timer keeps to its deadline, so no further copy is taken
+    FakeClock::advance(10 * SECOND);
+    runCountdown(10 * SECOND, false);
+    TEST_ASSERT_EQUAL(1, checkpoint.rtcWrites);
+
+    FakeClock::advance(2 * SECOND);
+    TEST_ASSERT_TRUE(boot(ESP_RST_PANIC));
+    TEST_ASSERT_FALSE(checkpoint.restoredFromFlash);
+    TEST_ASSERT_EQUAL(STATE_TIMER_RUN, restored.state);
+    TEST_ASSERT_EQUAL(DURATION_MS - 12000, restored.timer);
+    TEST_ASSERT_EQUAL(DURATION_MS, restored.initialTimer);
+    TEST_ASSERT_EQUAL(POSITION, restored.position);
+    TEST_ASSERT_EQUAL(SESSION_START, restored.sessionStart);
+    TEST_ASSERT_EQUAL(1, restored.restores);
+}
+
+// A stopwatch counts the time of the reboot up instead
+void test_crash_restores_a_stopwatch_counting_up() {
+    checkpoint.update(STATE_STOPWATCH_RUN, 0, 0, 0, SESSION_START, false);
+    FakeClock::advance(3 * SECOND);
+    TEST_ASSERT_TRUE(boot(ESP_RST_TASK_WDT));
+    TEST_ASSERT_EQUAL(STATE_STOPWATCH_RUN, restored.state);
+    TEST_ASSERT_EQUAL(3000, restored.timer);
+}
+
+// After a power loss the clock starts over, so the flash copy comes back
+// paused at the time it was taken
+void test_power_loss_restores_the_flash_copy_paused() {
+    runCountdown(0, false);
+    TEST_ASSERT_EQUAL(0, checkpoint.flashWrites);
+
+    FakeClock::advance(CHECKPOINT_FLASH_PERIOD_MS * 1000LL);
+    runCountdown(CHECKPOINT_FLASH_PERIOD_MS * 1000LL, false);
+    TEST_ASSERT_EQUAL(1, checkpoint.flashWrites);
+
+    FakeClock::advance(5 * SECOND);
+    TEST_ASSERT_TRUE(boot(ESP_RST_POWERON));
+    TEST_ASSERT_TRUE(checkpoint.restoredFromFlash);
+    TEST_ASSERT_EQUAL(STATE_TIMER_PAUSED, restored.state);
+    TEST_ASSERT_EQUAL(DURATION_MS - CHECKPOINT_FLASH_PERIOD_MS, restored.timer);
+    TEST_ASSERT_EQUAL(SESSION_START, restored.sessionStart);
+}
+
+// Waking from deep sleep resumes nothing, since runs never sleep
+void test_deep_sleep_resumes_nothing() {
+    runCountdown(0, false);
+    TEST_ASSERT_FALSE(boot(ESP_RST_DEEPSLEEP));
+}
+
+// A run that crashes the firmware every time it is resumed is given up, and
+// does not come back from flash after the next power loss either
+void test_run_is_dropped_after_max_restores() {
+    runCountdown(0, false);
+    FakeClock::advance(CHECKPOINT_FLASH_PERIOD_MS * 1000LL);
+    runCountdown(CHECKPOINT_FLASH_PERIOD_MS * 1000LL, false);
+    TEST_ASSERT_EQUAL(1, checkpoint.flashWrites);
+
+    for (int restore = 1; restore <= CHECKPOINT_MAX_RESTORES; restore++) {
+        TEST_ASSERT_TRUE(boot(ESP_RST_PANIC));
+        TEST_ASSERT_EQUAL(restore, restored.restores);
+    }
+    TEST_ASSERT_FALSE(boot(ESP_RST_PANIC));
+    TEST_ASSERT_FALSE(boot(ESP_RST_PANIC));
+
+    // The idle loop overwrites the flash copy once nothing has changed for a while
+    FakeClock::advance(CHECKPOINT_QUIET_MS * 1000LL);
+    checkpoint.update(STATE_TIMER_SELECT, 0, 0, 0, 0, true);
+    TEST_ASSERT_EQUAL(1, checkpoint.flashWrites);
+    TEST_ASSERT_FALSE(boot(ESP_RST_POWERON));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_crash_restores_the_rtc_copy_with_elapsed_time);
+    RUN_TEST(test_crash_restores_a_stopwatch_counting_up);
+    RUN_TEST(test_power_loss_restores_the_flash_copy_paused);
+    RUN_TEST(test_deep_sleep_resumes_nothing);
+    RUN_TEST(test_run_is_dropped_after_max_restores);
+    return UNITY_END();
+}
@@ -0,0 +1,154 @@
+#include <unity.h>
+#include <string>
+#include "Trace.h"
+
+#ifndef SPAN_TRACE
+#error "the native environment builds with SPAN_TRACE"
+#endif
+
+/**
+ * Keeps what is printed to it.
+ */
+class Capture : public Print {
+public:
+    std::string text;
+
+    size_t write(const char *data, size_t length) override {
+        text.append(data, length);
+        return length;
+    }
+};
+
+static FakeTask timerTask = {"esp_timer"};
+
+static std::string dump() {
+    Capture out;
+    Trace::dump(out);
+    return out.text;
+}
+
+static std::string tid(const void *task) {
+    return std::to_string((uintptr_t)task);
+}
+
+static void assertContains(const std::string &text, const std::string &part) {
+    TEST_ASSERT_TRUE_MESSAGE(text.find(part) != std::string::npos, part.c_str());
+}
+
+static int count(const std::string &text, const std::string &part) {
+    int found = 0;
+    for (size_t at = text.find(part); at != std::string::npos; at = text.find(part, at + 1))
+        found++;
+    return found;
+}
+
+void setUp() {
+    Trace::clear();
+    FakeClock::powerOn();
+    FakeClock::advance(1000);
+    FakeTasks::current = &FakeTasks::loop;
+    FakeTasks::inIsr = false;
+}
+
+void tearDown() {}
+
+// Spans and instants come out as Chrome trace events between the marker
+// lines, with a lane name for the task that recorded them
+void test_dump_is_chrome_trace_json() {
+    TRACE_INSTANT("tap", 3);
+    FakeClock::advance(500);
+    {
+        TRACE_SPAN_ARG("frame", 7);
+        FakeClock::advance(200);
+    }
+
+    std::string json = dump();
+    std::string loop = tid(&FakeTasks::loop);
+    TEST_ASSERT_EQUAL(0, json.find("trace: begin\n{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n{"));
+    assertContains(json, "{\"name\":\"tap\",\"pid\":1,\"tid\":" + loop +
+                             ",\"ts\":0,\"ph\":\"i\",\"s\":\"t\",\"args\":{\"arg\":3}},\n");
+    assertContains(json, "{\"name\":\"frame\",\"pid\":1,\"tid\":" + loop +
+                             ",\"ts\":500,\"ph\":\"X\",\"dur\":200,\"args\":{\"arg\":7}},\n");
+    assertContains(json, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + loop +
+                             ",\"args\":{\"name\":\"loopTask\"}}\n]}\ntrace: end\n");
+    TEST_ASSERT_EQUAL(1, count(json, "thread_name"));
+}
+
+// An outer span is recorded after the spans nested in it, but the origin is
+// still its start
+void test_origin_is_the_earliest_start() {
+    {
+        TRACE_SPAN("outer");
+        FakeClock::advance(50);
+        {
+            TRACE_SPAN("inner");
+            FakeClock::advance(10);
+        }
+        FakeClock::advance(40);
+    }
+
+    std::string json = dump();
+    TEST_ASSERT_TRUE(json.find("\"inner\"") < json.find("\"outer\""));
+    assertContains(json, "\"outer\",\"pid\":1,\"tid\":" + tid(&FakeTasks::loop) + ",\"ts\":0,\"ph\":\"X\",\"dur\":100");
+    assertContains(json, "\"inner\",\"pid\":1,\"tid\":" + tid(&FakeTasks::loop) + ",\"ts\":50,\"ph\":\"X\",\"dur\":10");
+}
+
+// Times are kept in 32 bits, and stay in order across the wrap
+void test_times_across_the_clock_wrap() {
+    FakeClock::advance((1LL << 32) - 1000 - 30);
+    {
+        TRACE_SPAN("before");
+        FakeClock::advance(50);
+    }
+    TRACE_INSTANT("after", 0);
+
+    std::string json = dump();
+    assertContains(json, "\"before\",\"pid\":1,\"tid\":" + tid(&FakeTasks::loop) + ",\"ts\":0,\"ph\":\"X\",\"dur\":50");
+    assertContains(json, "\"after\",\"pid\":1,\"tid\":" + tid(&FakeTasks::loop) + ",\"ts\":50,");
+}
+
+// Once the ring is full, the oldest events are overwritten
+void test_ring_keeps_the_newest_events() {
+    for (int i = 0; i < TRACE_BUFFER_EVENTS + 10; i++) {
+        TRACE_INSTANT("tick", i);
+        FakeClock::advance(1);
+    }
+
+    std::string json = dump();
+    TEST_ASSERT_EQUAL(TRACE_BUFFER_EVENTS, count(json, "\"tick\""));
+    TEST_ASSERT_EQUAL(0, count(json, "{\"arg\":9}"));
+    assertContains(json, "\"ts\":0,\"ph\":\"i\",\"s\":\"t\",\"args\":{\"arg\":10}}");
+}
+
+// ISRs and every task get a lane of their own
+void test_each_task_gets_a_lane() {
+    TRACE_INSTANT("loop", 0);
+    FakeTasks::current = &timerTask;
+    TRACE_INSTANT("note", 0);
+    FakeTasks::inIsr = true;
+    TRACE_INSTANT("edge", 0);
+
+    std::string json = dump();
+    assertContains(json, "\"edge\",\"pid\":1,\"tid\":0,");
+    assertContains(json, "\"tid\":" + tid(&timerTask) + ",\"args\":{\"name\":\"esp_timer\"}}");
+    assertContains(json, "\"tid\":0,\"args\":{\"name\":\"ISR\"}}");
+    TEST_ASSERT_EQUAL(3, count(json, "thread_name"));
+}
+
+void test_clear_empties_the_ring() {
+    TRACE_INSTANT("tap", 0);
+    Trace::clear();
+    TEST_ASSERT_EQUAL_STRING("trace: begin\n{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n]}\ntrace: end\n",
+                             dump().c_str());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_dump_is_chrome_trace_json);
+    RUN_TEST(test_origin_is_the_earliest_start);
+    RUN_TEST(test_times_across_the_clock_wrap);
+    RUN_TEST(test_ring_keeps_the_newest_events);
+    RUN_TEST(test_each_task_gets_a_lane);
+    RUN_TEST(test_clear_empties_the_ring);
+    return UNITY_END();
+}
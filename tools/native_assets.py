@@ -0,0 +1,17 @@
+"""PlatformIO extra script of the native environment.
+
+Builds the asset pack and passes its path to the tests as ASSET_PACK_PATH, so
+test_asset_pack loads what pack_assets.py writes with AssetPack::begin.
+"""
+
+import sys
+from pathlib import Path
+
+Import("env")  # noqa: F821, provided by PlatformIO
+
+sys.path.insert(0, str(Path(env.subst("$PROJECT_DIR")) / "tools"))  # noqa: F821
+import pack_assets  # noqa: E402
+
+output = Path(env.subst("$BUILD_DIR")) / "assets.bin"  # noqa: F821
+pack_assets.build(output)
+env.Append(CPPDEFINES=[("ASSET_PACK_PATH", env.StringifyMacro(output.as_posix()))])  # noqa: F821
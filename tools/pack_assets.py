@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+"""Builds the asset pack for the "assets" partition.
+
+Every entry of the AssetId enum in include/AssetPack.h is read from
+assets/<name>.xbm, the name being the enum entry without ASSET_ in lower case.
+An animation is one XBM image with its frames stacked from top to bottom, each
+frame as tall as the image is wide.
+
+The pack layout is described in include/AssetPack.h. The hardware
+environments build it with the firmware through tools/upload_assets.py, and
+`pio run -t upload` writes it along with the firmware. Flash it on its own,
+without rebuilding the firmware, with:
+
+    python tools/pack_assets.py --flash /dev/ttyACM0
+"""
+
+import argparse
+import binascii
+import csv
+import re
+import struct
+import subprocess
+import sys
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+MAGIC = 0x54455341  # "ASET"
+VERSION = 1
+HEADER = struct.Struct("<IHHII")
+ENTRY = struct.Struct("<HHHHII")
+ALIGN = 4
+
+
+def asset_ids(header):
+    """Returns the AssetId entries in enum order, without ASSET_COUNT."""
+    enum = re.search(r"enum AssetId[^{]*\{(.*?)\};", header.read_text(), re.S)
+    if enum is None:
+        sys.exit(f"no AssetId enum in {header}")
+    names = re.findall(r"\b(ASSET_\w+)", enum.group(1))
+    return [name for name in names if name != "ASSET_COUNT"]
+
+
+def read_xbm(path):
+    """Returns the width, height and bytes of an XBM image."""
+    text = path.read_text()
+    width = re.search(r"#define\s+\w*_width\s+(\d+)", text)
+    height = re.search(r"#define\s+\w*_height\s+(\d+)", text)
+    if width is None or height is None:
+        sys.exit(f"{path}: missing width or height")
+    width, height = int(width.group(1)), int(height.group(1))
+
+    body = text[text.index("{") + 1:text.rindex("}")]
+    data = bytes(int(value, 0) for value in re.findall(r"0x[0-9a-fA-F]+|\d+", body))
+    if len(data) != (width + 7) // 8 * height:
+        sys.exit(f"{path}: {len(data)} bytes for a {width}x{height} image")
+    return width, height, data
+
+
+def partition(table, label):
+    """Returns the offset and size of a partition of partitions.csv."""
+    with open(table) as rows:
+        for row in csv.reader(line for line in rows if not line.lstrip().startswith("#")):
+            if row and row[0].strip() == label:
+                return int(row[3], 0), int(row[4], 0)
+    sys.exit(f"no {label} partition in {table}")
+
+
+def pack(ids, source):
+    entries = []
+    blobs = []
+    offset = HEADER.size + ENTRY.size * len(ids)
+
+    for number, name in enumerate(ids):
+        path = source / (name[len("ASSET_"):].lower() + ".xbm")
+        width, height, data = read_xbm(path)
+        if height % width != 0:
+            sys.exit(f"{path}: height {height} is not a whole number of {width}px frames")
+
+        entries.append(ENTRY.pack(number, height // width, width, width, offset, len(data)))
+        padding = -len(data) % ALIGN
+        blobs.append(data + b"\0" * padding)
+        offset += len(data) + padding
+
+    body = b"".join(entries) + b"".join(blobs)
+    crc = binascii.crc32(body) & 0xFFFFFFFF
+    return HEADER.pack(MAGIC, VERSION, len(ids), HEADER.size + len(body), crc) + body
+
+
+def build(output):
+    """Writes the pack to output and returns the offset of the assets partition."""
+    image = pack(asset_ids(ROOT / "include" / "AssetPack.h"), ROOT / "assets")
+    address, size = partition(ROOT / "partitions.csv", "assets")
+    if len(image) > size:
+        sys.exit(f"pack is {len(image)} bytes, the partition holds {size}")
+
+    output.parent.mkdir(parents=True, exist_ok=True)
+    output.write_bytes(image)
+    print(f"{output}: {len(image)} bytes, {len(image) * 100 // size}% of the partition")
+    return address
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("-o", "--output", type=Path, default=ROOT / ".pio" / "assets.bin")
+    parser.add_argument("--flash", metavar="PORT", help="write the pack to the device on PORT with esptool")
+    args = parser.parse_args()
+
+    address = build(args.output)
+
+    command = [sys.executable, "-m", "esptool", "write_flash", hex(address), str(args.output)]
+    if args.flash:
+        subprocess.run(command[:3] + ["--port", args.flash] + command[3:], check=True)
+    else:
+        print("Flash with: python", " ".join(command[1:]))
+
+
+if __name__ == "__main__":
+    main()
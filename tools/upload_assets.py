@@ -0,0 +1,18 @@
+"""PlatformIO extra script of the hardware environments.
+
+Builds the asset pack with the firmware and adds it to the images the upload
+target writes, so `pio run -t upload` leaves the "assets" partition in step
+with the AssetId list the firmware was built with.
+"""
+
+import sys
+from pathlib import Path
+
+Import("env")  # noqa: F821, provided by PlatformIO
+
+sys.path.insert(0, str(Path(env.subst("$PROJECT_DIR")) / "tools"))  # noqa: F821
+import pack_assets  # noqa: E402
+
+output = Path(env.subst("$BUILD_DIR")) / "assets.bin"  # noqa: F821
+address = pack_assets.build(output)
+env.Append(FLASH_EXTRA_IMAGES=[(hex(address), str(output))])  # noqa: F821